@@ -0,0 +1,161 @@
+/* graphene-affine2d.h: A 2D affine transformation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * graphene_affine2d_t:
+ *
+ * A 2D affine transformation, using the same layout as
+ * graphene_matrix_init_from_2d():
+ *
+ * |[<!-- language="plain" -->
+ *   ⎛ xx  yx ⎞   ⎛  a   b  0 ⎞
+ *   ⎜ xy  yy ⎟ = ⎜  c   d  0 ⎟
+ *   ⎝ x0  y0 ⎠   ⎝ tx  ty  1 ⎠
+ * ]|
+ *
+ * The contents of the `graphene_affine2d_t` structure are private, and
+ * should not be modified directly.
+ *
+ * Since: 1.12
+ */
+struct _graphene_affine2d_t
+{
+  /*< private >*/
+  GRAPHENE_PRIVATE_FIELD (float, xx);
+  GRAPHENE_PRIVATE_FIELD (float, yx);
+  GRAPHENE_PRIVATE_FIELD (float, xy);
+  GRAPHENE_PRIVATE_FIELD (float, yy);
+  GRAPHENE_PRIVATE_FIELD (float, x0);
+  GRAPHENE_PRIVATE_FIELD (float, y0);
+};
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_affine2d_t *   graphene_affine2d_alloc                 (void);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine2d_free                  (graphene_affine2d_t       *a);
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_affine2d_t *   graphene_affine2d_init                  (graphene_affine2d_t       *a,
+                                                                 float                      xx,
+                                                                 float                      yx,
+                                                                 float                      xy,
+                                                                 float                      yy,
+                                                                 float                      x_0,
+                                                                 float                      y_0);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_affine2d_t *   graphene_affine2d_init_identity         (graphene_affine2d_t       *a);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_affine2d_t *   graphene_affine2d_init_translate        (graphene_affine2d_t       *a,
+                                                                 const graphene_point_t    *p);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_affine2d_t *   graphene_affine2d_init_scale            (graphene_affine2d_t       *a,
+                                                                 float                      x,
+                                                                 float                      y);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_affine2d_t *   graphene_affine2d_init_rotate           (graphene_affine2d_t       *a,
+                                                                 float                      angle);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_affine2d_t *   graphene_affine2d_init_from_affine2d    (graphene_affine2d_t       *a,
+                                                                 const graphene_affine2d_t *src);
+GRAPHENE_AVAILABLE_IN_1_12
+bool                    graphene_affine2d_init_from_matrix      (graphene_affine2d_t       *a,
+                                                                 const graphene_matrix_t   *m);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine2d_to_matrix             (const graphene_affine2d_t *a,
+                                                                 graphene_matrix_t         *m);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine2d_to_float              (const graphene_affine2d_t *a,
+                                                                 float                     *v);
+
+GRAPHENE_AVAILABLE_IN_1_12
+bool                    graphene_affine2d_is_identity           (const graphene_affine2d_t *a);
+GRAPHENE_AVAILABLE_IN_1_12
+bool                    graphene_affine2d_near                  (const graphene_affine2d_t *a,
+                                                                 const graphene_affine2d_t *b,
+                                                                 float                      epsilon);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine2d_multiply              (const graphene_affine2d_t *a,
+                                                                 const graphene_affine2d_t *b,
+                                                                 graphene_affine2d_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine2d_translate             (graphene_affine2d_t       *a,
+                                                                 const graphene_point_t    *p);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine2d_scale                 (graphene_affine2d_t       *a,
+                                                                 float                      x,
+                                                                 float                      y);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine2d_rotate                (graphene_affine2d_t       *a,
+                                                                 float                      angle);
+GRAPHENE_AVAILABLE_IN_1_12
+bool                    graphene_affine2d_inverse               (const graphene_affine2d_t *a,
+                                                                 graphene_affine2d_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine2d_interpolate           (const graphene_affine2d_t *a,
+                                                                 const graphene_affine2d_t *b,
+                                                                 double                     factor,
+                                                                 graphene_affine2d_t       *res);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine2d_transform_point       (const graphene_affine2d_t *a,
+                                                                 const graphene_point_t    *p,
+                                                                 graphene_point_t          *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine2d_transform_points      (const graphene_affine2d_t *a,
+                                                                 unsigned int               n_points,
+                                                                 const graphene_point_t    *points,
+                                                                 graphene_point_t          *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine2d_transform_rect        (const graphene_affine2d_t *a,
+                                                                 const graphene_rect_t     *r,
+                                                                 graphene_quad_t           *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine2d_transform_bounds      (const graphene_affine2d_t *a,
+                                                                 const graphene_rect_t     *r,
+                                                                 graphene_rect_t           *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine2d_transform_bounds_array (const graphene_affine2d_t *a,
+                                                                  unsigned int               n_rects,
+                                                                  const graphene_rect_t     *rects,
+                                                                  graphene_rect_t           *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine2d_transform_quads       (const graphene_affine2d_t *a,
+                                                                 unsigned int               n_quads,
+                                                                 const graphene_quad_t     *quads,
+                                                                 graphene_quad_t           *res);
+
+GRAPHENE_END_DECLS
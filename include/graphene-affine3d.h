@@ -0,0 +1,133 @@
+/* graphene-affine3d.h: A 3D affine transformation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * graphene_affine3d_t:
+ *
+ * A 3D affine transformation, stored as the first three columns of the
+ * equivalent #graphene_matrix_t; each row of the 3x4 matrix holds the
+ * linear coefficients and the translation of one axis:
+ *
+ * |[<!-- language="plain" -->
+ *   ⎛ xx  yx  zx  x0 ⎞
+ *   ⎜ xy  yy  zy  y0 ⎟
+ *   ⎝ xz  yz  zz  z0 ⎠
+ * ]|
+ *
+ * The implicit last row of the matrix is always (0, 0, 0, 1).
+ *
+ * The contents of the `graphene_affine3d_t` structure are private, and
+ * should not be modified directly.
+ *
+ * Since: 1.12
+ */
+struct _graphene_affine3d_t
+{
+  /*< private >*/
+  GRAPHENE_ALIGNED_DECL (GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, x), 16);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, y);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, z);
+};
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_affine3d_t *   graphene_affine3d_alloc                 (void);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine3d_free                  (graphene_affine3d_t       *a);
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_affine3d_t *   graphene_affine3d_init_identity         (graphene_affine3d_t       *a);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_affine3d_t *   graphene_affine3d_init_from_float       (graphene_affine3d_t       *a,
+                                                                 const float               *v);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_affine3d_t *   graphene_affine3d_init_translate        (graphene_affine3d_t       *a,
+                                                                 const graphene_point3d_t  *p);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_affine3d_t *   graphene_affine3d_init_scale            (graphene_affine3d_t       *a,
+                                                                 float                      x,
+                                                                 float                      y,
+                                                                 float                      z);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_affine3d_t *   graphene_affine3d_init_rotate           (graphene_affine3d_t       *a,
+                                                                 float                      angle,
+                                                                 const graphene_vec3_t     *axis);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_affine3d_t *   graphene_affine3d_init_from_affine3d    (graphene_affine3d_t       *a,
+                                                                 const graphene_affine3d_t *src);
+GRAPHENE_AVAILABLE_IN_1_12
+bool                    graphene_affine3d_init_from_matrix      (graphene_affine3d_t       *a,
+                                                                 const graphene_matrix_t   *m);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine3d_to_matrix             (const graphene_affine3d_t *a,
+                                                                 graphene_matrix_t         *m);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine3d_to_float              (const graphene_affine3d_t *a,
+                                                                 float                     *v);
+
+GRAPHENE_AVAILABLE_IN_1_12
+bool                    graphene_affine3d_is_identity           (const graphene_affine3d_t *a);
+GRAPHENE_AVAILABLE_IN_1_12
+bool                    graphene_affine3d_near                  (const graphene_affine3d_t *a,
+                                                                 const graphene_affine3d_t *b,
+                                                                 float                      epsilon);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine3d_multiply              (const graphene_affine3d_t *a,
+                                                                 const graphene_affine3d_t *b,
+                                                                 graphene_affine3d_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+bool                    graphene_affine3d_inverse               (const graphene_affine3d_t *a,
+                                                                 graphene_affine3d_t       *res);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine3d_transform_point       (const graphene_affine3d_t *a,
+                                                                 const graphene_point3d_t  *p,
+                                                                 graphene_point3d_t        *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine3d_transform_points      (const graphene_affine3d_t *a,
+                                                                 unsigned int               n_points,
+                                                                 const graphene_point3d_t  *points,
+                                                                 graphene_point3d_t        *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine3d_transform_vec3        (const graphene_affine3d_t *a,
+                                                                 const graphene_vec3_t     *v,
+                                                                 graphene_vec3_t           *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_affine3d_transform_box         (const graphene_affine3d_t *a,
+                                                                 const graphene_box_t      *b,
+                                                                 graphene_box_t            *res);
+
+GRAPHENE_END_DECLS
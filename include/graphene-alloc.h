@@ -0,0 +1,111 @@
+/* graphene-alloc.h: Memory allocation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+
+#include <stddef.h>
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * graphene_alloc_stats_t:
+ * @hits: the number of allocations served by the cache of the
+ *   allocating thread
+ * @misses: the number of allocations that had to refill the cache of
+ *   the allocating thread, from the shared pool or from the system
+ *
+ * The counters of the allocator used by the `_alloc()` functions of the
+ * Graphene types.
+ *
+ * Since: 1.12
+ */
+typedef struct {
+  uint64_t hits;
+  uint64_t misses;
+} graphene_alloc_stats_t;
+
+GRAPHENE_AVAILABLE_IN_1_12
+void            graphene_alloc_get_stats        (graphene_alloc_stats_t *stats);
+
+/**
+ * graphene_arena_t:
+ *
+ * An arena for temporary allocations.
+ *
+ * The contents of the `graphene_arena_t` structure are private and
+ * opaque.
+ *
+ * Since: 1.12
+ */
+
+/**
+ * GRAPHENE_ARENA_MAX_ALIGNMENT:
+ *
+ * The largest alignment accepted by graphene_arena_alloc().
+ *
+ * Since: 1.12
+ */
+#define GRAPHENE_ARENA_MAX_ALIGNMENT    64
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_arena_t *      graphene_arena_new              (size_t            block_size);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_arena_free             (graphene_arena_t *arena);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void *                  graphene_arena_alloc            (graphene_arena_t *arena,
+                                                         size_t            size,
+                                                         size_t            alignment);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_arena_reset            (graphene_arena_t *arena);
+GRAPHENE_AVAILABLE_IN_1_12
+size_t                  graphene_arena_get_size         (const graphene_arena_t *arena);
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_vec2_t *       graphene_arena_new_vec2         (graphene_arena_t *arena);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_vec3_t *       graphene_arena_new_vec3         (graphene_arena_t *arena);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_vec4_t *       graphene_arena_new_vec4         (graphene_arena_t *arena);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_point3d_t *    graphene_arena_new_point3d      (graphene_arena_t *arena);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_matrix_t *     graphene_arena_new_matrix       (graphene_arena_t *arena);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_quaternion_t * graphene_arena_new_quaternion   (graphene_arena_t *arena);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_box_t *        graphene_arena_new_box          (graphene_arena_t *arena);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_sphere_t *     graphene_arena_new_sphere       (graphene_arena_t *arena);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_ray_t *        graphene_arena_new_ray          (graphene_arena_t *arena);
+
+GRAPHENE_END_DECLS
@@ -66,6 +66,13 @@ GRAPHENE_AVAILABLE_IN_1_2
 graphene_box_t *        graphene_box_init_from_vectors          (graphene_box_t           *box,
                                                                  unsigned int              n_vectors,
                                                                  const graphene_vec3_t    *vectors);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_box_t *        graphene_box_init_from_float_array      (graphene_box_t           *box,
+                                                                 unsigned int              n_points,
+                                                                 const float              *points);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_box_t *        graphene_box_init_from_strided          (graphene_box_t                *box,
+                                                                 const graphene_strided_view_t *points);
 GRAPHENE_AVAILABLE_IN_1_2
 graphene_box_t *        graphene_box_init_from_box              (graphene_box_t           *box,
                                                                  const graphene_box_t     *src);
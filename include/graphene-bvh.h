@@ -0,0 +1,84 @@
+/* graphene-bvh.h: Bounding volume hierarchy
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * graphene_bvh_t:
+ *
+ * A bounding volume hierarchy over boxes or triangles.
+ *
+ * The contents of the `graphene_bvh_t` structure are private and
+ * opaque.
+ *
+ * Since: 1.12
+ */
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_bvh_t *        graphene_bvh_new_from_boxes             (unsigned int              n_boxes,
+                                                                 const graphene_box_t     *boxes);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_bvh_t *        graphene_bvh_new_from_triangles         (unsigned int              n_vertices,
+                                                                 const graphene_point3d_t *vertices,
+                                                                 unsigned int              n_indices,
+                                                                 const unsigned int       *indices);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_bvh_free                       (graphene_bvh_t           *bvh);
+
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int            graphene_bvh_get_n_primitives           (const graphene_bvh_t     *bvh);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_bvh_get_bounds                 (const graphene_bvh_t     *bvh,
+                                                                 graphene_box_t           *bounds);
+
+GRAPHENE_AVAILABLE_IN_1_12
+bool                    graphene_bvh_intersect_ray              (const graphene_bvh_t     *bvh,
+                                                                 const graphene_ray_t     *r,
+                                                                 unsigned int             *primitive_out,
+                                                                 float                    *t_out);
+GRAPHENE_AVAILABLE_IN_1_12
+bool                    graphene_bvh_intersects_ray             (const graphene_bvh_t     *bvh,
+                                                                 const graphene_ray_t     *r,
+                                                                 float                     max_distance);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int            graphene_bvh_query_box                  (const graphene_bvh_t     *bvh,
+                                                                 const graphene_box_t     *box,
+                                                                 unsigned int              max_results,
+                                                                 unsigned int             *results);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int            graphene_bvh_query_frustum              (const graphene_bvh_t     *bvh,
+                                                                 const graphene_frustum_t *frustum,
+                                                                 unsigned int              max_results,
+                                                                 unsigned int             *results);
+
+GRAPHENE_END_DECLS
@@ -50,6 +50,36 @@ struct _graphene_frustum_t
   GRAPHENE_PRIVATE_FIELD (graphene_plane_t, planes[6]);
 };
 
+/**
+ * GRAPHENE_FRUSTUM_ALL_PLANES:
+ *
+ * A plane mask selecting all the clip planes of a #graphene_frustum_t.
+ *
+ * This value should be used as the initial plane mask for
+ * graphene_frustum_classify_box() and graphene_frustum_classify_sphere().
+ *
+ * Since: 1.12
+ */
+#define GRAPHENE_FRUSTUM_ALL_PLANES     0x3fu
+
+/**
+ * graphene_frustum_containment_t:
+ * @GRAPHENE_FRUSTUM_CONTAINMENT_OUTSIDE: The volume is outside the frustum
+ * @GRAPHENE_FRUSTUM_CONTAINMENT_INTERSECTING: The volume intersects at least
+ *   one of the clip planes of the frustum
+ * @GRAPHENE_FRUSTUM_CONTAINMENT_INSIDE: The volume is entirely inside
+ *   the frustum
+ *
+ * The result of classifying a volume against a #graphene_frustum_t.
+ *
+ * Since: 1.12
+ */
+typedef enum {
+  GRAPHENE_FRUSTUM_CONTAINMENT_OUTSIDE,
+  GRAPHENE_FRUSTUM_CONTAINMENT_INTERSECTING,
+  GRAPHENE_FRUSTUM_CONTAINMENT_INSIDE
+} graphene_frustum_containment_t;
+
 GRAPHENE_AVAILABLE_IN_1_2
 graphene_frustum_t *    graphene_frustum_alloc                  (void);
 GRAPHENE_AVAILABLE_IN_1_2
@@ -81,6 +111,40 @@ GRAPHENE_AVAILABLE_IN_1_2
 bool                    graphene_frustum_intersects_box         (const graphene_frustum_t *f,
                                                                  const graphene_box_t     *box);
 
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_frustum_containment_t graphene_frustum_classify_sphere (const graphene_frustum_t *f,
+                                                                 const graphene_sphere_t  *sphere,
+                                                                 unsigned int              plane_mask,
+                                                                 unsigned int             *out_mask);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_frustum_containment_t graphene_frustum_classify_box    (const graphene_frustum_t *f,
+                                                                 const graphene_box_t     *box,
+                                                                 unsigned int              plane_mask,
+                                                                 unsigned int             *out_mask);
+GRAPHENE_AVAILABLE_IN_1_12
+bool                    graphene_frustum_intersects_obb         (const graphene_frustum_t *f,
+                                                                 const graphene_obb_t     *obb);
+
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int            graphene_frustum_cull_points            (const graphene_frustum_t *f,
+                                                                 unsigned int              n_points,
+                                                                 const graphene_point3d_t *points,
+                                                                 uint32_t                 *visible);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int            graphene_frustum_cull_strided           (const graphene_frustum_t      *f,
+                                                                 const graphene_strided_view_t *points,
+                                                                 uint32_t                      *visible);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int            graphene_frustum_cull_spheres           (const graphene_frustum_t *f,
+                                                                 unsigned int              n_spheres,
+                                                                 const graphene_sphere_t  *spheres,
+                                                                 uint32_t                 *visible);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int            graphene_frustum_cull_boxes             (const graphene_frustum_t *f,
+                                                                 unsigned int              n_boxes,
+                                                                 const graphene_box_t     *boxes,
+                                                                 uint32_t                 *visible);
+
 GRAPHENE_AVAILABLE_IN_1_2
 void                    graphene_frustum_get_planes             (const graphene_frustum_t *f,
                                                                  graphene_plane_t          planes[]);
@@ -156,4 +156,32 @@ GType graphene_box2d_get_type (void);
 
 G_DEFINE_AUTOPTR_CLEANUP_FUNC(graphene_box2d_t, graphene_box2d_free)
 
+#define GRAPHENE_TYPE_TRANSFORM         (graphene_transform_get_type ())
+
+GRAPHENE_AVAILABLE_IN_1_12
+GType graphene_transform_get_type (void);
+
+G_DEFINE_AUTOPTR_CLEANUP_FUNC(graphene_transform_t, graphene_transform_free)
+
+#define GRAPHENE_TYPE_AFFINE2D          (graphene_affine2d_get_type ())
+
+GRAPHENE_AVAILABLE_IN_1_12
+GType graphene_affine2d_get_type (void);
+
+G_DEFINE_AUTOPTR_CLEANUP_FUNC(graphene_affine2d_t, graphene_affine2d_free)
+
+#define GRAPHENE_TYPE_AFFINE3D          (graphene_affine3d_get_type ())
+
+GRAPHENE_AVAILABLE_IN_1_12
+GType graphene_affine3d_get_type (void);
+
+G_DEFINE_AUTOPTR_CLEANUP_FUNC(graphene_affine3d_t, graphene_affine3d_free)
+
+#define GRAPHENE_TYPE_OBB               (graphene_obb_get_type ())
+
+GRAPHENE_AVAILABLE_IN_1_12
+GType graphene_obb_get_type (void);
+
+G_DEFINE_AUTOPTR_CLEANUP_FUNC(graphene_obb_t, graphene_obb_free)
+
 G_END_DECLS
@@ -101,6 +101,17 @@ GRAPHENE_AVAILABLE_IN_1_0
 graphene_matrix_t *     graphene_matrix_init_rotate             (graphene_matrix_t        *m,
                                                                  float                     angle,
                                                                  const graphene_vec3_t    *axis);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_matrix_t *     graphene_matrix_init_trs                (graphene_matrix_t           *m,
+                                                                 const graphene_vec3_t       *translate,
+                                                                 const graphene_quaternion_t *rotate,
+                                                                 const graphene_vec3_t       *scale);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_init_trs_array          (unsigned int                 n_matrices,
+                                                                 const graphene_vec3_t       *translate,
+                                                                 const graphene_quaternion_t *rotate,
+                                                                 const graphene_vec3_t       *scale,
+                                                                 graphene_matrix_t           *res);
 GRAPHENE_AVAILABLE_IN_1_0
 graphene_matrix_t *     graphene_matrix_init_skew               (graphene_matrix_t        *m,
                                                                  float                     x_skew,
@@ -189,6 +200,39 @@ void                    graphene_matrix_transform_ray           (const graphene_
                                                                  const graphene_ray_t     *r,
                                                                  graphene_ray_t           *res);
 
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_transform_points3d      (const graphene_matrix_t  *m,
+                                                                 unsigned int              n_points,
+                                                                 const graphene_point3d_t *points,
+                                                                 graphene_point3d_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_transform_strided       (const graphene_matrix_t       *m,
+                                                                 const graphene_strided_view_t *points);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_transform_obb           (const graphene_matrix_t  *m,
+                                                                 const graphene_obb_t     *obb,
+                                                                 graphene_obb_t           *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_transform_vec3_array    (const graphene_matrix_t  *m,
+                                                                 unsigned int              n_vectors,
+                                                                 const graphene_vec3_t    *vectors,
+                                                                 graphene_vec3_t          *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_transform_vec4_array    (const graphene_matrix_t  *m,
+                                                                 unsigned int              n_vectors,
+                                                                 const graphene_vec4_t    *vectors,
+                                                                 graphene_vec4_t          *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_transform_bounds_array  (const graphene_matrix_t  *m,
+                                                                 unsigned int              n_rects,
+                                                                 const graphene_rect_t    *r,
+                                                                 graphene_rect_t          *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_transform_boxes         (const graphene_matrix_t  *m,
+                                                                 unsigned int              n_boxes,
+                                                                 const graphene_box_t     *boxes,
+                                                                 graphene_box_t           *res);
+
 GRAPHENE_AVAILABLE_IN_1_0
 void                    graphene_matrix_project_point           (const graphene_matrix_t  *m,
                                                                  const graphene_point_t   *p,
@@ -260,6 +304,12 @@ void                    graphene_matrix_transpose               (const graphene_
 GRAPHENE_AVAILABLE_IN_1_0
 bool                    graphene_matrix_inverse                 (const graphene_matrix_t  *m,
                                                                  graphene_matrix_t        *res);
+GRAPHENE_AVAILABLE_IN_1_12
+bool                    graphene_matrix_inverse_affine          (const graphene_matrix_t  *m,
+                                                                 graphene_matrix_t        *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_inverse_rigid           (const graphene_matrix_t  *m,
+                                                                 graphene_matrix_t        *res);
 GRAPHENE_AVAILABLE_IN_1_0
 void                    graphene_matrix_perspective             (const graphene_matrix_t  *m,
                                                                  float                     depth,
@@ -0,0 +1,106 @@
+/* graphene-obb.h: An oriented bounding box
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+#include "graphene-vec3.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * graphene_obb_t:
+ *
+ * An oriented bounding box, represented by its center, three orthonormal
+ * axes, and the half extents of the box along each axis.
+ *
+ * The contents of the `graphene_obb_t` structure are private, and should
+ * not be modified directly.
+ *
+ * Since: 1.12
+ */
+struct _graphene_obb_t
+{
+  /*< private >*/
+  GRAPHENE_PRIVATE_FIELD (graphene_vec3_t, center);
+  GRAPHENE_PRIVATE_FIELD (graphene_vec3_t, half_extents);
+  GRAPHENE_PRIVATE_FIELD (graphene_vec3_t, axes[3]);
+};
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_obb_t *        graphene_obb_alloc                      (void);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_obb_free                       (graphene_obb_t           *obb);
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_obb_t *        graphene_obb_init                       (graphene_obb_t           *obb,
+                                                                 const graphene_point3d_t *center,
+                                                                 const graphene_vec3_t    *half_extents,
+                                                                 const graphene_vec3_t    *x_axis,
+                                                                 const graphene_vec3_t    *y_axis,
+                                                                 const graphene_vec3_t    *z_axis);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_obb_t *        graphene_obb_init_from_box              (graphene_obb_t           *obb,
+                                                                 const graphene_box_t     *box);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_obb_t *        graphene_obb_init_from_points           (graphene_obb_t           *obb,
+                                                                 unsigned int              n_points,
+                                                                 const graphene_point3d_t *points);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_obb_t *        graphene_obb_init_from_obb              (graphene_obb_t           *obb,
+                                                                 const graphene_obb_t     *src);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_obb_get_center                 (const graphene_obb_t     *obb,
+                                                                 graphene_point3d_t       *center);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_obb_get_half_extents           (const graphene_obb_t     *obb,
+                                                                 graphene_vec3_t          *half_extents);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_obb_get_axes                   (const graphene_obb_t     *obb,
+                                                                 graphene_vec3_t          *x_axis,
+                                                                 graphene_vec3_t          *y_axis,
+                                                                 graphene_vec3_t          *z_axis);
+GRAPHENE_AVAILABLE_IN_1_12
+float                   graphene_obb_get_volume                 (const graphene_obb_t     *obb);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_obb_get_vertices               (const graphene_obb_t     *obb,
+                                                                 graphene_vec3_t           vertices[]);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_obb_get_bounding_box           (const graphene_obb_t     *obb,
+                                                                 graphene_box_t           *box);
+
+GRAPHENE_AVAILABLE_IN_1_12
+bool                    graphene_obb_contains_point             (const graphene_obb_t     *obb,
+                                                                 const graphene_point3d_t *point);
+GRAPHENE_AVAILABLE_IN_1_12
+bool                    graphene_obb_intersects_obb             (const graphene_obb_t     *a,
+                                                                 const graphene_obb_t     *b);
+
+GRAPHENE_END_DECLS
@@ -0,0 +1,75 @@
+/* graphene-parallel.h: Parallel execution of batch operations
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * graphene_parallel_task_func_t:
+ * @task: the index of the task to run
+ * @data: the data passed to the executor
+ *
+ * A function that runs one of the tasks of a parallel operation.
+ *
+ * Since: 1.12
+ */
+typedef void (* graphene_parallel_task_func_t) (unsigned int task,
+                                                void        *data);
+
+/**
+ * graphene_parallel_executor_func_t:
+ * @n_tasks: the number of tasks to run
+ * @func: (scope call): the function that runs each task
+ * @data: the data to pass to @func
+ * @user_data: the data passed to graphene_parallel_set_executor()
+ *
+ * A function that runs @func for each task index between 0 and @n_tasks,
+ * in any order and on any thread, and returns once all the tasks are
+ * done.
+ *
+ * Since: 1.12
+ */
+typedef void (* graphene_parallel_executor_func_t) (unsigned int                   n_tasks,
+                                                    graphene_parallel_task_func_t  func,
+                                                    void                          *data,
+                                                    void                          *user_data);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void            graphene_parallel_set_n_threads (unsigned int                      n_threads);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int    graphene_parallel_get_n_threads (void);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void            graphene_parallel_set_executor  (graphene_parallel_executor_func_t executor,
+                                                 void                             *user_data);
+
+GRAPHENE_END_DECLS
@@ -69,6 +69,80 @@ typedef enum {
   GRAPHENE_RAY_INTERSECTION_KIND_LEAVE,
 } graphene_ray_intersection_kind_t;
 
+/**
+ * GRAPHENE_RAY_PACKET_SIZE:
+ *
+ * The maximum number of rays in a #graphene_ray_packet_t.
+ *
+ * Since: 1.12
+ */
+#define GRAPHENE_RAY_PACKET_SIZE        4
+
+/**
+ * graphene_ray_packet_t:
+ *
+ * A packet of up to %GRAPHENE_RAY_PACKET_SIZE rays, intersected with
+ * a primitive at the same time.
+ *
+ * The contents of the `graphene_ray_packet_t` structure are private, and
+ * should not be modified directly.
+ *
+ * Since: 1.12
+ */
+struct _graphene_ray_packet_t
+{
+  /*< private >*/
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, origin_x);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, origin_y);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, origin_z);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, direction_x);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, direction_y);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, direction_z);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, inv_direction_x);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, inv_direction_y);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, inv_direction_z);
+  GRAPHENE_PRIVATE_FIELD (unsigned int, n_rays);
+};
+
+/**
+ * GRAPHENE_RAY_PACKET8_SIZE:
+ *
+ * The maximum number of rays in a #graphene_ray_packet8_t.
+ *
+ * Since: 1.12
+ */
+#define GRAPHENE_RAY_PACKET8_SIZE       8
+
+/**
+ * graphene_ray_packet8_t:
+ *
+ * A packet of up to %GRAPHENE_RAY_PACKET8_SIZE rays, intersected with
+ * a primitive at the same time using #graphene_simd8f_t.
+ *
+ * The contents of the `graphene_ray_packet8_t` structure are private, and
+ * should not be modified directly.
+ *
+ * Since: 1.12
+ */
+struct _graphene_ray_packet8_t
+{
+  /*< private >*/
+  /* Each component is stored as the two halves of a graphene_simd8f_t,
+   * so that the layout of the structure does not depend on whether the
+   * code using it is built with AVX2 support
+   */
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, origin_x[2]);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, origin_y[2]);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, origin_z[2]);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, direction_x[2]);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, direction_y[2]);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, direction_z[2]);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, inv_direction_x[2]);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, inv_direction_y[2]);
+  GRAPHENE_PRIVATE_FIELD (graphene_simd4f_t, inv_direction_z[2]);
+  GRAPHENE_PRIVATE_FIELD (unsigned int, n_rays);
+};
+
 GRAPHENE_AVAILABLE_IN_1_4
 graphene_ray_t *                graphene_ray_alloc                  (void);
 GRAPHENE_AVAILABLE_IN_1_4
@@ -134,4 +208,64 @@ GRAPHENE_AVAILABLE_IN_1_10
 bool                            graphene_ray_intersects_triangle        (const graphene_ray_t      *r,
                                                                          const graphene_triangle_t *t);
 
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_ray_intersection_kind_t graphene_ray_intersect_obb             (const graphene_ray_t    *r,
+                                                                         const graphene_obb_t    *obb,
+                                                                         float                   *t_out);
+GRAPHENE_AVAILABLE_IN_1_12
+bool                            graphene_ray_intersects_obb             (const graphene_ray_t    *r,
+                                                                         const graphene_obb_t    *obb);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int                    graphene_ray_intersect_boxes            (const graphene_ray_t    *r,
+                                                                         unsigned int             n_boxes,
+                                                                         const graphene_box_t    *boxes,
+                                                                         float                   *t_out,
+                                                                         uint32_t                *hits);
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_ray_packet_t *         graphene_ray_packet_alloc               (void);
+GRAPHENE_AVAILABLE_IN_1_12
+void                            graphene_ray_packet_free                (graphene_ray_packet_t       *p);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_ray_packet_t *         graphene_ray_packet_init                (graphene_ray_packet_t       *p,
+                                                                         unsigned int                 n_rays,
+                                                                         const graphene_ray_t        *rays);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int                    graphene_ray_packet_get_n_rays          (const graphene_ray_packet_t *p);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int                    graphene_ray_packet_intersect_sphere    (const graphene_ray_packet_t *p,
+                                                                         const graphene_sphere_t     *s,
+                                                                         float                       *t_out);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int                    graphene_ray_packet_intersect_box       (const graphene_ray_packet_t *p,
+                                                                         const graphene_box_t        *b,
+                                                                         float                       *t_out);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int                    graphene_ray_packet_intersect_triangle  (const graphene_ray_packet_t *p,
+                                                                         const graphene_triangle_t   *t,
+                                                                         float                       *t_out);
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_ray_packet8_t *        graphene_ray_packet8_alloc              (void);
+GRAPHENE_AVAILABLE_IN_1_12
+void                            graphene_ray_packet8_free               (graphene_ray_packet8_t       *p);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_ray_packet8_t *        graphene_ray_packet8_init               (graphene_ray_packet8_t       *p,
+                                                                         unsigned int                  n_rays,
+                                                                         const graphene_ray_t         *rays);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int                    graphene_ray_packet8_get_n_rays         (const graphene_ray_packet8_t *p);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int                    graphene_ray_packet8_intersect_sphere   (const graphene_ray_packet8_t *p,
+                                                                         const graphene_sphere_t      *s,
+                                                                         float                        *t_out);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int                    graphene_ray_packet8_intersect_box      (const graphene_ray_packet8_t *p,
+                                                                         const graphene_box_t         *b,
+                                                                         float                        *t_out);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int                    graphene_ray_packet8_intersect_triangle (const graphene_ray_packet8_t *p,
+                                                                         const graphene_triangle_t    *t,
+                                                                         float                        *t_out);
+
 GRAPHENE_END_DECLS
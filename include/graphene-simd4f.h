@@ -184,6 +184,9 @@ graphene_simd4f_t       graphene_simd4f_madd            (const graphene_simd4f_t
                                                          const graphene_simd4f_t b,
                                                          const graphene_simd4f_t c);
 
+GRAPHENE_AVAILABLE_IN_1_12
+const char *            graphene_simd_get_active_backend (void);
+
 #if !defined(__GI_SCANNER__) && defined(GRAPHENE_USE_SSE)
 
 /* SSE2 implementation of SIMD 4f */
@@ -509,7 +512,7 @@ typedef GRAPHENE_ALIGN16 union {
   }))
 #  endif
 
-#  if defined(GRAPHENE_USE_AVX)
+#  if defined(GRAPHENE_USE_AVX2)
 #   define graphene_simd4f_madd(a,b,c) \
   (__extension__ ({ \
     (graphene_simd4f_t) _mm_fmadd_ps ((a), (b), (c)); \
@@ -859,7 +862,7 @@ _simd4f_madd (const graphene_simd4f_t a,
               const graphene_simd4f_t b,
               const graphene_simd4f_t c)
 {
-#if defined(GRAPHENE_USE_AVX)
+#if defined(GRAPHENE_USE_AVX2)
   return _mm_fmadd_ps (a, b, c);
 #else
   return _mm_add_ps (_mm_mul_ps (a, b), c);
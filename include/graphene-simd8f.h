@@ -0,0 +1,638 @@
+/* graphene-simd8f.h: 8-wide float vector operations
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "graphene-simd4f.h"
+#include "graphene-simd4x4f.h"
+
+#include <math.h>
+#include <float.h>
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * SECTION:graphene-simd8f
+ * @Title: SIMD 8-wide vector
+ * @short_description: Low level floating point 8-sized vector
+ *
+ * The #graphene_simd8f_t type wraps a platform specific implementation of
+ * a vector of eight floating point values.
+ *
+ * On x86 CPUs with AVX2 and FMA, if Graphene or the code using it was
+ * built with support for those instruction sets, the #graphene_simd8f_t
+ * type is a 256 bit register; on every other platform, it is emulated
+ * using two #graphene_simd4f_t vectors.
+ *
+ * The #graphene_simd8f_t type is meant to be used when operating on large
+ * arrays of values, with a "structure of arrays" layout: each vector holds
+ * the same component of eight different elements.
+ *
+ * Like #graphene_simd4f_t, the #graphene_simd8f_t type should be treated
+ * as an opaque, integral type; you cannot access its components directly,
+ * and you can only operate on all components at the same time.
+ */
+
+/**
+ * graphene_simd8f_t:
+ *
+ * A vector type containing eight floating point values.
+ *
+ * The contents of the #graphene_simd8f_t type are private and
+ * cannot be directly accessed; use the provided API instead.
+ *
+ * Since: 1.12
+ */
+
+/**
+ * graphene_simd8f_init:
+ * @a: the first component of the vector
+ * @b: the second component of the vector
+ * @c: the third component of the vector
+ * @d: the fourth component of the vector
+ * @e: the fifth component of the vector
+ * @f: the sixth component of the vector
+ * @g: the seventh component of the vector
+ * @h: the eighth component of the vector
+ *
+ * Initializes a #graphene_simd8f_t with the given values.
+ *
+ * Returns: the initialized #graphene_simd8f_t
+ *
+ * Since: 1.12
+ */
+static inline graphene_simd8f_t GRAPHENE_VECTORCALL
+graphene_simd8f_init (float a,
+                      float b,
+                      float c,
+                      float d,
+                      float e,
+                      float f,
+                      float g,
+                      float h)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  return _mm256_setr_ps (a, b, c, d, e, f, g, h);
+#else
+  graphene_simd8f_t s;
+
+  s.lo = graphene_simd4f_init (a, b, c, d);
+  s.hi = graphene_simd4f_init (e, f, g, h);
+
+  return s;
+#endif
+}
+
+/**
+ * graphene_simd8f_init_zero:
+ *
+ * Initializes a #graphene_simd8f_t with 0 in all components.
+ *
+ * Returns: the initialized #graphene_simd8f_t
+ *
+ * Since: 1.12
+ */
+static inline graphene_simd8f_t GRAPHENE_VECTORCALL
+graphene_simd8f_init_zero (void)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  return _mm256_setzero_ps ();
+#else
+  graphene_simd8f_t s;
+
+  s.lo = graphene_simd4f_init_zero ();
+  s.hi = graphene_simd4f_init_zero ();
+
+  return s;
+#endif
+}
+
+/**
+ * graphene_simd8f_init_8f:
+ * @v: (array fixed-size=8): an array of at least 8 floating
+ *   point values
+ *
+ * Initializes a #graphene_simd8f_t using an array of floating
+ * point values.
+ *
+ * The array does not need to be aligned.
+ *
+ * Returns: the initialized #graphene_simd8f_t
+ *
+ * Since: 1.12
+ */
+static inline graphene_simd8f_t GRAPHENE_VECTORCALL
+graphene_simd8f_init_8f (const float *v)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  return _mm256_loadu_ps (v);
+#else
+  graphene_simd8f_t s;
+
+  s.lo = graphene_simd4f_init_4f (v);
+  s.hi = graphene_simd4f_init_4f (v + 4);
+
+  return s;
+#endif
+}
+
+/**
+ * graphene_simd8f_init_simd4f:
+ * @lo: a #graphene_simd4f_t with the first four components
+ * @hi: a #graphene_simd4f_t with the last four components
+ *
+ * Initializes a #graphene_simd8f_t by concatenating two
+ * #graphene_simd4f_t vectors.
+ *
+ * Returns: the initialized #graphene_simd8f_t
+ *
+ * Since: 1.12
+ */
+static inline graphene_simd8f_t GRAPHENE_VECTORCALL
+graphene_simd8f_init_simd4f (graphene_simd4f_t lo,
+                             graphene_simd4f_t hi)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  return _mm256_insertf128_ps (_mm256_castps128_ps256 (lo), hi, 1);
+#else
+  graphene_simd8f_t s;
+
+  s.lo = lo;
+  s.hi = hi;
+
+  return s;
+#endif
+}
+
+/**
+ * graphene_simd8f_transpose_simd4f:
+ * @rows: (array fixed-size=8): eight #graphene_simd4f_t vectors
+ * @x: (out): return location for the first components of @rows
+ * @y: (out): return location for the second components of @rows
+ * @z: (out): return location for the third components of @rows
+ * @w: (out): return location for the fourth components of @rows
+ *
+ * Transposes eight #graphene_simd4f_t vectors into four
+ * #graphene_simd8f_t vectors, so that each of the resulting
+ * vectors holds the same component of all the @rows.
+ *
+ * This is useful to load arrays of Graphene types, like
+ * #graphene_vec4_t, in a "structure of arrays" layout.
+ *
+ * Since: 1.12
+ */
+static inline void GRAPHENE_VECTORCALL
+graphene_simd8f_transpose_simd4f (const graphene_simd4f_t  rows[8],
+                                  graphene_simd8f_t       *x,
+                                  graphene_simd8f_t       *y,
+                                  graphene_simd8f_t       *z,
+                                  graphene_simd8f_t       *w)
+{
+  graphene_simd4x4f_t lo, hi;
+
+  lo = graphene_simd4x4f_init (rows[0], rows[1], rows[2], rows[3]);
+  hi = graphene_simd4x4f_init (rows[4], rows[5], rows[6], rows[7]);
+  graphene_simd4x4f_transpose_in_place (&lo);
+  graphene_simd4x4f_transpose_in_place (&hi);
+
+  *x = graphene_simd8f_init_simd4f (lo.x, hi.x);
+  *y = graphene_simd8f_init_simd4f (lo.y, hi.y);
+  *z = graphene_simd8f_init_simd4f (lo.z, hi.z);
+  *w = graphene_simd8f_init_simd4f (lo.w, hi.w);
+}
+
+/**
+ * graphene_simd8f_splat:
+ * @v: a floating point value
+ *
+ * Sets all the components of a new #graphene_simd8f_t to the
+ * same value @v.
+ *
+ * Returns: the initialized #graphene_simd8f_t
+ *
+ * Since: 1.12
+ */
+static inline graphene_simd8f_t GRAPHENE_VECTORCALL
+graphene_simd8f_splat (float v)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  return _mm256_set1_ps (v);
+#else
+  graphene_simd8f_t s;
+
+  s.lo = graphene_simd4f_splat (v);
+  s.hi = s.lo;
+
+  return s;
+#endif
+}
+
+/**
+ * graphene_simd8f_get_low:
+ * @s: a #graphene_simd8f_t
+ *
+ * Retrieves the first four components of @s.
+ *
+ * Returns: a #graphene_simd4f_t
+ *
+ * Since: 1.12
+ */
+static inline graphene_simd4f_t GRAPHENE_VECTORCALL
+graphene_simd8f_get_low (graphene_simd8f_t s)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  return _mm256_castps256_ps128 (s);
+#else
+  return s.lo;
+#endif
+}
+
+/**
+ * graphene_simd8f_get_high:
+ * @s: a #graphene_simd8f_t
+ *
+ * Retrieves the last four components of @s.
+ *
+ * Returns: a #graphene_simd4f_t
+ *
+ * Since: 1.12
+ */
+static inline graphene_simd4f_t GRAPHENE_VECTORCALL
+graphene_simd8f_get_high (graphene_simd8f_t s)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  return _mm256_extractf128_ps (s, 1);
+#else
+  return s.hi;
+#endif
+}
+
+/**
+ * graphene_simd8f_dup_8f:
+ * @s: a #graphene_simd8f_t
+ * @v: (out caller-allocates) (array fixed-size=8): return location for
+ *   an array of at least 8 floating point values
+ *
+ * Copies the contents of @s in the given array of floats.
+ *
+ * The array does not need to be aligned.
+ *
+ * Since: 1.12
+ */
+static inline void GRAPHENE_VECTORCALL
+graphene_simd8f_dup_8f (graphene_simd8f_t  s,
+                        float             *v)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  _mm256_storeu_ps (v, s);
+#else
+  graphene_simd4f_dup_4f (s.lo, v);
+  graphene_simd4f_dup_4f (s.hi, v + 4);
+#endif
+}
+
+/**
+ * graphene_simd8f_add:
+ * @a: a #graphene_simd8f_t
+ * @b: a #graphene_simd8f_t
+ *
+ * Creates a new #graphene_simd8f_t vector where each component is
+ * the sum of the respective components in @a and @b.
+ *
+ * Returns: the sum vector
+ *
+ * Since: 1.12
+ */
+static inline graphene_simd8f_t GRAPHENE_VECTORCALL
+graphene_simd8f_add (graphene_simd8f_t a,
+                     graphene_simd8f_t b)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  return _mm256_add_ps (a, b);
+#else
+  graphene_simd8f_t s;
+
+  s.lo = graphene_simd4f_add (a.lo, b.lo);
+  s.hi = graphene_simd4f_add (a.hi, b.hi);
+
+  return s;
+#endif
+}
+
+/**
+ * graphene_simd8f_sub:
+ * @a: a #graphene_simd8f_t
+ * @b: a #graphene_simd8f_t
+ *
+ * Creates a new #graphene_simd8f_t vector where each component is
+ * the subtraction of the respective components in @a and @b.
+ *
+ * Returns: the difference vector
+ *
+ * Since: 1.12
+ */
+static inline graphene_simd8f_t GRAPHENE_VECTORCALL
+graphene_simd8f_sub (graphene_simd8f_t a,
+                     graphene_simd8f_t b)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  return _mm256_sub_ps (a, b);
+#else
+  graphene_simd8f_t s;
+
+  s.lo = graphene_simd4f_sub (a.lo, b.lo);
+  s.hi = graphene_simd4f_sub (a.hi, b.hi);
+
+  return s;
+#endif
+}
+
+/**
+ * graphene_simd8f_mul:
+ * @a: a #graphene_simd8f_t
+ * @b: a #graphene_simd8f_t
+ *
+ * Creates a new #graphene_simd8f_t vector where each component is
+ * the multiplication of the respective components in @a and @b.
+ *
+ * Returns: the product vector
+ *
+ * Since: 1.12
+ */
+static inline graphene_simd8f_t GRAPHENE_VECTORCALL
+graphene_simd8f_mul (graphene_simd8f_t a,
+                     graphene_simd8f_t b)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  return _mm256_mul_ps (a, b);
+#else
+  graphene_simd8f_t s;
+
+  s.lo = graphene_simd4f_mul (a.lo, b.lo);
+  s.hi = graphene_simd4f_mul (a.hi, b.hi);
+
+  return s;
+#endif
+}
+
+/**
+ * graphene_simd8f_div:
+ * @a: a #graphene_simd8f_t
+ * @b: a #graphene_simd8f_t
+ *
+ * Creates a new #graphene_simd8f_t vector where each component is
+ * the division of the respective components in @a and @b.
+ *
+ * Returns: the quotient vector
+ *
+ * Since: 1.12
+ */
+static inline graphene_simd8f_t GRAPHENE_VECTORCALL
+graphene_simd8f_div (graphene_simd8f_t a,
+                     graphene_simd8f_t b)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  return _mm256_div_ps (a, b);
+#else
+  graphene_simd8f_t s;
+
+  s.lo = graphene_simd4f_div (a.lo, b.lo);
+  s.hi = graphene_simd4f_div (a.hi, b.hi);
+
+  return s;
+#endif
+}
+
+/**
+ * graphene_simd8f_madd:
+ * @a: a #graphene_simd8f_t
+ * @b: a #graphene_simd8f_t
+ * @c: a #graphene_simd8f_t
+ *
+ * Adds @a times @b to @c; on AVX2, this is a single fused
+ * multiply-add operation.
+ *
+ * Returns: the result vector
+ *
+ * Since: 1.12
+ */
+static inline graphene_simd8f_t GRAPHENE_VECTORCALL
+graphene_simd8f_madd (graphene_simd8f_t a,
+                      graphene_simd8f_t b,
+                      graphene_simd8f_t c)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  return _mm256_fmadd_ps (a, b, c);
+#else
+  graphene_simd8f_t s;
+
+  s.lo = graphene_simd4f_madd (a.lo, b.lo, c.lo);
+  s.hi = graphene_simd4f_madd (a.hi, b.hi, c.hi);
+
+  return s;
+#endif
+}
+
+/**
+ * graphene_simd8f_min:
+ * @a: a #graphene_simd8f_t
+ * @b: a #graphene_simd8f_t
+ *
+ * Creates a new #graphene_simd8f_t that contains the minimum value
+ * of each component of @a and @b.
+ *
+ * Returns: the new vector
+ *
+ * Since: 1.12
+ */
+static inline graphene_simd8f_t GRAPHENE_VECTORCALL
+graphene_simd8f_min (graphene_simd8f_t a,
+                     graphene_simd8f_t b)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  return _mm256_min_ps (a, b);
+#else
+  graphene_simd8f_t s;
+
+  s.lo = graphene_simd4f_min (a.lo, b.lo);
+  s.hi = graphene_simd4f_min (a.hi, b.hi);
+
+  return s;
+#endif
+}
+
+/**
+ * graphene_simd8f_max:
+ * @a: a #graphene_simd8f_t
+ * @b: a #graphene_simd8f_t
+ *
+ * Creates a new #graphene_simd8f_t that contains the maximum value
+ * of each component of @a and @b.
+ *
+ * Returns: the new vector
+ *
+ * Since: 1.12
+ */
+static inline graphene_simd8f_t GRAPHENE_VECTORCALL
+graphene_simd8f_max (graphene_simd8f_t a,
+                     graphene_simd8f_t b)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  return _mm256_max_ps (a, b);
+#else
+  graphene_simd8f_t s;
+
+  s.lo = graphene_simd4f_max (a.lo, b.lo);
+  s.hi = graphene_simd4f_max (a.hi, b.hi);
+
+  return s;
+#endif
+}
+
+/**
+ * graphene_simd8f_sqrt:
+ * @s: a #graphene_simd8f_t
+ *
+ * Computes the square root of every component of @s.
+ *
+ * Returns: the vector containing the square roots
+ *
+ * Since: 1.12
+ */
+static inline graphene_simd8f_t GRAPHENE_VECTORCALL
+graphene_simd8f_sqrt (graphene_simd8f_t s)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  return _mm256_sqrt_ps (s);
+#else
+  graphene_simd8f_t res;
+
+  res.lo = graphene_simd4f_sqrt (s.lo);
+  res.hi = graphene_simd4f_sqrt (s.hi);
+
+  return res;
+#endif
+}
+
+/**
+ * graphene_simd8f_reciprocal:
+ * @s: a #graphene_simd8f_t
+ *
+ * Computes the reciprocal of every component of @s, with the
+ * same precision as graphene_simd4f_reciprocal().
+ *
+ * Returns: the vector containing the reciprocals
+ *
+ * Since: 1.12
+ */
+static inline graphene_simd8f_t GRAPHENE_VECTORCALL
+graphene_simd8f_reciprocal (graphene_simd8f_t s)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  /* One Newton-Raphson step on top of the approximated reciprocal;
+   * zero components are masked out of the refinement, so that they
+   * yield infinity instead of NaN
+   */
+  const __m256 zero = _mm256_setzero_ps ();
+  const __m256 two = _mm256_set1_ps (2.f);
+  const __m256 r = _mm256_rcp_ps (s);
+  const __m256 m = _mm256_mul_ps (s, _mm256_andnot_ps (_mm256_cmp_ps (s, zero, _CMP_EQ_OQ), r));
+
+  return _mm256_mul_ps (r, _mm256_sub_ps (two, m));
+#else
+  graphene_simd8f_t res;
+
+  res.lo = graphene_simd4f_reciprocal (s.lo);
+  res.hi = graphene_simd4f_reciprocal (s.hi);
+
+  return res;
+#endif
+}
+
+/**
+ * graphene_simd8f_mask_ge:
+ * @a: a #graphene_simd8f_t
+ * @b: a #graphene_simd8f_t
+ *
+ * Compares each component of @a with the respective component
+ * of @b.
+ *
+ * Unlike graphene_simd4f_cmp_ge(), this function does not return a
+ * single boolean value; the result for each component is stored in
+ * a separate bit, which allows using the result of the comparison
+ * for each element of a batch.
+ *
+ * Returns: a bitmask with the bit `i` set if the `i`-th component
+ *   of @a is greater than or equal to the `i`-th component of @b
+ *
+ * Since: 1.12
+ */
+static inline unsigned int GRAPHENE_VECTORCALL
+graphene_simd8f_mask_ge (graphene_simd8f_t a,
+                         graphene_simd8f_t b)
+{
+#if defined(GRAPHENE_USE_AVX2)
+  return (unsigned int) _mm256_movemask_ps (_mm256_cmp_ps (a, b, _CMP_GE_OQ));
+#elif defined(GRAPHENE_USE_SSE)
+  return (unsigned int) (_mm_movemask_ps (_mm_cmpge_ps (a.lo, b.lo)) |
+                         _mm_movemask_ps (_mm_cmpge_ps (a.hi, b.hi)) << 4);
+#else
+  float a_v[8], b_v[8];
+  unsigned int res = 0;
+
+  graphene_simd8f_dup_8f (a, a_v);
+  graphene_simd8f_dup_8f (b, b_v);
+
+  for (unsigned int i = 0; i < 8; i++)
+    {
+      if (a_v[i] >= b_v[i])
+        res |= 1u << i;
+    }
+
+  return res;
+#endif
+}
+
+/**
+ * graphene_simd8f_mask_le:
+ * @a: a #graphene_simd8f_t
+ * @b: a #graphene_simd8f_t
+ *
+ * Compares each component of @a with the respective component
+ * of @b, like graphene_simd8f_mask_ge().
+ *
+ * Returns: a bitmask with the bit `i` set if the `i`-th component
+ *   of @a is less than or equal to the `i`-th component of @b
+ *
+ * Since: 1.12
+ */
+static inline unsigned int GRAPHENE_VECTORCALL
+graphene_simd8f_mask_le (graphene_simd8f_t a,
+                         graphene_simd8f_t b)
+{
+  return graphene_simd8f_mask_ge (b, a);
+}
+
+GRAPHENE_END_DECLS
@@ -0,0 +1,261 @@
+/* graphene-soa.h: Structure of arrays vectors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * graphene_vec3_soa_t:
+ *
+ * An array of three dimensional vectors, with each component stored
+ * in a separate array.
+ *
+ * The contents of the `graphene_vec3_soa_t` structure are private and
+ * opaque.
+ *
+ * Since: 1.12
+ */
+
+/**
+ * graphene_vec4_soa_t:
+ *
+ * An array of four dimensional vectors, with each component stored
+ * in a separate array.
+ *
+ * The contents of the `graphene_vec4_soa_t` structure are private and
+ * opaque.
+ *
+ * Since: 1.12
+ */
+
+/**
+ * graphene_matrix_soa_t:
+ *
+ * An array of 4x4 matrices, with each element stored in a separate
+ * array.
+ *
+ * The contents of the `graphene_matrix_soa_t` structure are private and
+ * opaque.
+ *
+ * Since: 1.12
+ */
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_vec3_soa_t *   graphene_vec3_soa_new                   (unsigned int               n_elements);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_free                  (graphene_vec3_soa_t       *soa);
+
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int            graphene_vec3_soa_get_size              (const graphene_vec3_soa_t *soa);
+GRAPHENE_AVAILABLE_IN_1_12
+float *                 graphene_vec3_soa_get_x                 (graphene_vec3_soa_t       *soa);
+GRAPHENE_AVAILABLE_IN_1_12
+float *                 graphene_vec3_soa_get_y                 (graphene_vec3_soa_t       *soa);
+GRAPHENE_AVAILABLE_IN_1_12
+float *                 graphene_vec3_soa_get_z                 (graphene_vec3_soa_t       *soa);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_get                   (const graphene_vec3_soa_t *soa,
+                                                                 unsigned int               index_,
+                                                                 graphene_vec3_t           *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_set                   (graphene_vec3_soa_t       *soa,
+                                                                 unsigned int               index_,
+                                                                 const graphene_vec3_t     *v);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_init_from_vec3        (graphene_vec3_soa_t       *soa,
+                                                                 const graphene_vec3_t     *vectors);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_to_vec3               (const graphene_vec3_soa_t *soa,
+                                                                 graphene_vec3_t           *vectors);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_add                   (const graphene_vec3_soa_t *a,
+                                                                 const graphene_vec3_soa_t *b,
+                                                                 graphene_vec3_soa_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_subtract              (const graphene_vec3_soa_t *a,
+                                                                 const graphene_vec3_soa_t *b,
+                                                                 graphene_vec3_soa_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_scale                 (const graphene_vec3_soa_t *a,
+                                                                 float                      factor,
+                                                                 graphene_vec3_soa_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_lerp                  (const graphene_vec3_soa_t *a,
+                                                                 const graphene_vec3_soa_t *b,
+                                                                 float                      factor,
+                                                                 graphene_vec3_soa_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_dot                   (const graphene_vec3_soa_t *a,
+                                                                 const graphene_vec3_soa_t *b,
+                                                                 float                     *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_cross                 (const graphene_vec3_soa_t *a,
+                                                                 const graphene_vec3_soa_t *b,
+                                                                 graphene_vec3_soa_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_length                (const graphene_vec3_soa_t *a,
+                                                                 float                     *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_normalize             (const graphene_vec3_soa_t *a,
+                                                                 graphene_vec3_soa_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_get_min               (const graphene_vec3_soa_t *a,
+                                                                 graphene_vec3_t           *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_get_max               (const graphene_vec3_soa_t *a,
+                                                                 graphene_vec3_t           *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_transform             (const graphene_vec3_soa_t *a,
+                                                                 const graphene_matrix_t   *m,
+                                                                 graphene_vec3_soa_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec3_soa_transform_points      (const graphene_vec3_soa_t *a,
+                                                                 const graphene_matrix_t   *m,
+                                                                 graphene_vec3_soa_t       *res);
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_vec4_soa_t *   graphene_vec4_soa_new                   (unsigned int               n_elements);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec4_soa_free                  (graphene_vec4_soa_t       *soa);
+
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int            graphene_vec4_soa_get_size              (const graphene_vec4_soa_t *soa);
+GRAPHENE_AVAILABLE_IN_1_12
+float *                 graphene_vec4_soa_get_x                 (graphene_vec4_soa_t       *soa);
+GRAPHENE_AVAILABLE_IN_1_12
+float *                 graphene_vec4_soa_get_y                 (graphene_vec4_soa_t       *soa);
+GRAPHENE_AVAILABLE_IN_1_12
+float *                 graphene_vec4_soa_get_z                 (graphene_vec4_soa_t       *soa);
+GRAPHENE_AVAILABLE_IN_1_12
+float *                 graphene_vec4_soa_get_w                 (graphene_vec4_soa_t       *soa);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec4_soa_get                   (const graphene_vec4_soa_t *soa,
+                                                                 unsigned int               index_,
+                                                                 graphene_vec4_t           *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec4_soa_set                   (graphene_vec4_soa_t       *soa,
+                                                                 unsigned int               index_,
+                                                                 const graphene_vec4_t     *v);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec4_soa_init_from_vec4        (graphene_vec4_soa_t       *soa,
+                                                                 const graphene_vec4_t     *vectors);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec4_soa_to_vec4               (const graphene_vec4_soa_t *soa,
+                                                                 graphene_vec4_t           *vectors);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec4_soa_add                   (const graphene_vec4_soa_t *a,
+                                                                 const graphene_vec4_soa_t *b,
+                                                                 graphene_vec4_soa_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec4_soa_subtract              (const graphene_vec4_soa_t *a,
+                                                                 const graphene_vec4_soa_t *b,
+                                                                 graphene_vec4_soa_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec4_soa_scale                 (const graphene_vec4_soa_t *a,
+                                                                 float                      factor,
+                                                                 graphene_vec4_soa_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec4_soa_lerp                  (const graphene_vec4_soa_t *a,
+                                                                 const graphene_vec4_soa_t *b,
+                                                                 float                      factor,
+                                                                 graphene_vec4_soa_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec4_soa_dot                   (const graphene_vec4_soa_t *a,
+                                                                 const graphene_vec4_soa_t *b,
+                                                                 float                     *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec4_soa_length                (const graphene_vec4_soa_t *a,
+                                                                 float                     *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec4_soa_normalize             (const graphene_vec4_soa_t *a,
+                                                                 graphene_vec4_soa_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec4_soa_get_min               (const graphene_vec4_soa_t *a,
+                                                                 graphene_vec4_t           *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec4_soa_get_max               (const graphene_vec4_soa_t *a,
+                                                                 graphene_vec4_t           *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_vec4_soa_transform             (const graphene_vec4_soa_t *a,
+                                                                 const graphene_matrix_t   *m,
+                                                                 graphene_vec4_soa_t       *res);
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_matrix_soa_t * graphene_matrix_soa_new                 (unsigned int                 n_elements);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_soa_free                (graphene_matrix_soa_t       *soa);
+
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int            graphene_matrix_soa_get_size            (const graphene_matrix_soa_t *soa);
+GRAPHENE_AVAILABLE_IN_1_12
+float *                 graphene_matrix_soa_get_element         (graphene_matrix_soa_t       *soa,
+                                                                 unsigned int                 row,
+                                                                 unsigned int                 col);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_soa_get                 (const graphene_matrix_soa_t *soa,
+                                                                 unsigned int                 index_,
+                                                                 graphene_matrix_t           *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_soa_set                 (graphene_matrix_soa_t       *soa,
+                                                                 unsigned int                 index_,
+                                                                 const graphene_matrix_t     *m);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_soa_init_from_matrices  (graphene_matrix_soa_t       *soa,
+                                                                 const graphene_matrix_t     *matrices);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_soa_to_matrices         (const graphene_matrix_soa_t *soa,
+                                                                 graphene_matrix_t           *matrices);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_soa_multiply            (const graphene_matrix_soa_t *a,
+                                                                 const graphene_matrix_soa_t *b,
+                                                                 graphene_matrix_soa_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_soa_transpose           (const graphene_matrix_soa_t *a,
+                                                                 graphene_matrix_soa_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_soa_determinant         (const graphene_matrix_soa_t *a,
+                                                                 float                       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int            graphene_matrix_soa_inverse             (const graphene_matrix_soa_t *a,
+                                                                 graphene_matrix_soa_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                    graphene_matrix_soa_transform_points    (const graphene_matrix_soa_t *m,
+                                                                 const graphene_vec3_soa_t   *points,
+                                                                 graphene_vec3_soa_t         *res);
+
+GRAPHENE_END_DECLS
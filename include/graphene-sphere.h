@@ -48,6 +48,22 @@ struct _graphene_sphere_t
   GRAPHENE_PRIVATE_FIELD (float, radius);
 };
 
+/**
+ * graphene_sphere_fit_t:
+ * @GRAPHENE_SPHERE_FIT_FAST: An approximation of the smallest sphere,
+ *   computed with Ritter's algorithm
+ * @GRAPHENE_SPHERE_FIT_EXACT: The smallest sphere, computed with
+ *   Welzl's algorithm
+ *
+ * The algorithms used by graphene_sphere_init_from_points_tight().
+ *
+ * Since: 1.12
+ */
+typedef enum {
+  GRAPHENE_SPHERE_FIT_FAST,
+  GRAPHENE_SPHERE_FIT_EXACT
+} graphene_sphere_fit_t;
+
 GRAPHENE_AVAILABLE_IN_1_2
 graphene_sphere_t *     graphene_sphere_alloc                   (void);
 GRAPHENE_AVAILABLE_IN_1_2
@@ -63,11 +79,20 @@ graphene_sphere_t *     graphene_sphere_init_from_points        (graphene_sphere
                                                                  unsigned int              n_points,
                                                                  const graphene_point3d_t *points,
                                                                  const graphene_point3d_t *center);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_sphere_t *     graphene_sphere_init_from_points_tight  (graphene_sphere_t        *s,
+                                                                 unsigned int              n_points,
+                                                                 const graphene_point3d_t *points,
+                                                                 graphene_sphere_fit_t     fit);
 GRAPHENE_AVAILABLE_IN_1_2
 graphene_sphere_t *     graphene_sphere_init_from_vectors       (graphene_sphere_t        *s,
                                                                  unsigned int              n_vectors,
                                                                  const graphene_vec3_t    *vectors,
                                                                  const graphene_point3d_t *center);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_sphere_t *     graphene_sphere_init_from_strided       (graphene_sphere_t             *s,
+                                                                 const graphene_strided_view_t *points,
+                                                                 const graphene_point3d_t      *center);
 
 GRAPHENE_AVAILABLE_IN_1_2
 void                    graphene_sphere_get_center              (const graphene_sphere_t  *s,
@@ -0,0 +1,96 @@
+/* graphene-strided.h: Strided views over interleaved buffers
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+
+#include <stddef.h>
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * GRAPHENE_STRIDED_VIEW_INIT:
+ * @_data: a pointer to the first element
+ * @_stride: the distance between two elements, in bytes
+ * @_n_components: the number of components of each element
+ * @_n_elements: the number of elements
+ *
+ * Initializes a #graphene_strided_view_t when declaring it, e.g:
+ *
+ * |[<!-- language="C" -->
+ *   // Positions at offset 0 of 32 bytes vertices
+ *   graphene_strided_view_t positions =
+ *     GRAPHENE_STRIDED_VIEW_INIT (vertices, 32, 3, n_vertices);
+ * ]|
+ *
+ * Since: 1.12
+ */
+#define GRAPHENE_STRIDED_VIEW_INIT(_data,_stride,_n_components,_n_elements) \
+  (graphene_strided_view_t) { \
+    .data = (_data), \
+    .stride = (_stride), \
+    .n_components = (_n_components), \
+    .n_elements = (_n_elements), \
+  }
+
+/**
+ * graphene_strided_view_t:
+ * @data: a pointer to the first component of the first element
+ * @stride: the distance between the first components of two consecutive
+ *   elements, in bytes
+ * @n_components: the number of floating point components of each
+ *   element, between 2 and 4
+ * @n_elements: the number of elements
+ *
+ * A view over the elements of a buffer, like the positions of the
+ * vertices of an interleaved vertex buffer.
+ *
+ * Each element is made of @n_components floating point values, in the
+ * order x, y, z, and w; elements with two components have a Z coordinate
+ * of 0.
+ *
+ * Since: 1.12
+ */
+struct _graphene_strided_view_t
+{
+  void *data;
+  size_t stride;
+  unsigned int n_components;
+  unsigned int n_elements;
+};
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_strided_view_t *       graphene_strided_view_init      (graphene_strided_view_t *view,
+                                                                 void                    *data,
+                                                                 size_t                   stride,
+                                                                 unsigned int             n_components,
+                                                                 unsigned int             n_elements);
+
+GRAPHENE_END_DECLS
@@ -0,0 +1,87 @@
+/* graphene-transform-hierarchy.h: A flat hierarchy of transformations
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT:
+ *
+ * The parent index of the root nodes of a #graphene_transform_hierarchy_t.
+ *
+ * Since: 1.12
+ */
+#define GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT  ((unsigned int) -1)
+
+/**
+ * graphene_transform_hierarchy_t:
+ *
+ * A flat hierarchy of transformations.
+ *
+ * The contents of the `graphene_transform_hierarchy_t` structure are
+ * private and opaque.
+ *
+ * Since: 1.12
+ */
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_transform_hierarchy_t *        graphene_transform_hierarchy_new                (unsigned int                          n_nodes,
+                                                                                         const unsigned int                   *parents);
+GRAPHENE_AVAILABLE_IN_1_12
+void                                    graphene_transform_hierarchy_free               (graphene_transform_hierarchy_t       *h);
+
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int                            graphene_transform_hierarchy_get_n_nodes        (const graphene_transform_hierarchy_t *h);
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int                            graphene_transform_hierarchy_get_parent         (const graphene_transform_hierarchy_t *h,
+                                                                                         unsigned int                          node);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                                    graphene_transform_hierarchy_set_local          (graphene_transform_hierarchy_t       *h,
+                                                                                         unsigned int                          node,
+                                                                                         const graphene_matrix_t              *m);
+GRAPHENE_AVAILABLE_IN_1_12
+void                                    graphene_transform_hierarchy_get_local          (const graphene_transform_hierarchy_t *h,
+                                                                                         unsigned int                          node,
+                                                                                         graphene_matrix_t                    *res);
+
+GRAPHENE_AVAILABLE_IN_1_12
+unsigned int                            graphene_transform_hierarchy_update             (graphene_transform_hierarchy_t       *h);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                                    graphene_transform_hierarchy_get_world          (const graphene_transform_hierarchy_t *h,
+                                                                                         unsigned int                          node,
+                                                                                         graphene_matrix_t                    *res);
+GRAPHENE_AVAILABLE_IN_1_12
+const graphene_matrix_t *               graphene_transform_hierarchy_get_world_matrices (const graphene_transform_hierarchy_t *h);
+
+GRAPHENE_END_DECLS
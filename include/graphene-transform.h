@@ -0,0 +1,148 @@
+/* graphene-transform.h: A matrix with a cached transformation category
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#if !defined(GRAPHENE_H_INSIDE) && !defined(GRAPHENE_COMPILATION)
+#error "Only graphene.h can be included directly."
+#endif
+
+#include "graphene-types.h"
+#include "graphene-matrix.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/**
+ * graphene_transform_category_t:
+ * @GRAPHENE_TRANSFORM_CATEGORY_IDENTITY: The identity transformation
+ * @GRAPHENE_TRANSFORM_CATEGORY_TRANSLATE: A translation
+ * @GRAPHENE_TRANSFORM_CATEGORY_SCALE: A scale along the axes, followed
+ *   by a translation
+ * @GRAPHENE_TRANSFORM_CATEGORY_AFFINE_2D: An affine transformation on
+ *   the XY plane, which leaves the Z coordinate untouched; see
+ *   graphene_matrix_is_2d()
+ * @GRAPHENE_TRANSFORM_CATEGORY_AFFINE_3D: An affine transformation
+ * @GRAPHENE_TRANSFORM_CATEGORY_PROJECTIVE: Any transformation, including
+ *   projections
+ *
+ * The category of a #graphene_transform_t.
+ *
+ * Each category is a subset of the ones that follow it, so
+ * categories can be compared with the usual relational operators.
+ *
+ * Since: 1.12
+ */
+typedef enum {
+  GRAPHENE_TRANSFORM_CATEGORY_IDENTITY,
+  GRAPHENE_TRANSFORM_CATEGORY_TRANSLATE,
+  GRAPHENE_TRANSFORM_CATEGORY_SCALE,
+  GRAPHENE_TRANSFORM_CATEGORY_AFFINE_2D,
+  GRAPHENE_TRANSFORM_CATEGORY_AFFINE_3D,
+  GRAPHENE_TRANSFORM_CATEGORY_PROJECTIVE
+} graphene_transform_category_t;
+
+/**
+ * graphene_transform_t:
+ *
+ * A transformation matrix, along with its #graphene_transform_category_t.
+ *
+ * The contents of the `graphene_transform_t` structure are private, and
+ * should not be modified directly.
+ *
+ * Since: 1.12
+ */
+struct _graphene_transform_t
+{
+  /*< private >*/
+  GRAPHENE_PRIVATE_FIELD (graphene_matrix_t, matrix);
+  GRAPHENE_PRIVATE_FIELD (graphene_transform_category_t, category);
+};
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_transform_t *          graphene_transform_alloc                (void);
+GRAPHENE_AVAILABLE_IN_1_12
+void                            graphene_transform_free                 (graphene_transform_t       *t);
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_transform_t *          graphene_transform_init_identity        (graphene_transform_t       *t);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_transform_t *          graphene_transform_init_from_matrix     (graphene_transform_t       *t,
+                                                                         const graphene_matrix_t    *m);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_transform_t *          graphene_transform_init_from_transform  (graphene_transform_t       *t,
+                                                                         const graphene_transform_t *src);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_transform_t *          graphene_transform_init_translate       (graphene_transform_t       *t,
+                                                                         const graphene_point3d_t   *p);
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_transform_t *          graphene_transform_init_scale           (graphene_transform_t       *t,
+                                                                         float                       x,
+                                                                         float                       y,
+                                                                         float                       z);
+
+GRAPHENE_AVAILABLE_IN_1_12
+graphene_transform_category_t   graphene_transform_get_category         (const graphene_transform_t *t);
+GRAPHENE_AVAILABLE_IN_1_12
+void                            graphene_transform_to_matrix            (const graphene_transform_t *t,
+                                                                         graphene_matrix_t          *res);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                            graphene_transform_multiply             (const graphene_transform_t *a,
+                                                                         const graphene_transform_t *b,
+                                                                         graphene_transform_t       *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                            graphene_transform_translate            (graphene_transform_t       *t,
+                                                                         const graphene_point3d_t   *p);
+GRAPHENE_AVAILABLE_IN_1_12
+void                            graphene_transform_scale                (graphene_transform_t       *t,
+                                                                         float                       x,
+                                                                         float                       y,
+                                                                         float                       z);
+GRAPHENE_AVAILABLE_IN_1_12
+void                            graphene_transform_rotate               (graphene_transform_t       *t,
+                                                                         float                       angle,
+                                                                         const graphene_vec3_t      *axis);
+GRAPHENE_AVAILABLE_IN_1_12
+bool                            graphene_transform_inverse              (const graphene_transform_t *t,
+                                                                         graphene_transform_t       *res);
+
+GRAPHENE_AVAILABLE_IN_1_12
+void                            graphene_transform_transform_point      (const graphene_transform_t *t,
+                                                                         const graphene_point_t     *p,
+                                                                         graphene_point_t           *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                            graphene_transform_transform_point3d    (const graphene_transform_t *t,
+                                                                         const graphene_point3d_t   *p,
+                                                                         graphene_point3d_t         *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                            graphene_transform_transform_bounds     (const graphene_transform_t *t,
+                                                                         const graphene_rect_t      *r,
+                                                                         graphene_rect_t            *res);
+GRAPHENE_AVAILABLE_IN_1_12
+void                            graphene_transform_transform_box        (const graphene_transform_t *t,
+                                                                         const graphene_box_t       *b,
+                                                                         graphene_box_t             *res);
+
+GRAPHENE_END_DECLS
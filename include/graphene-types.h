@@ -33,6 +33,8 @@
 #include "graphene-macros.h"
 #include "graphene-version-macros.h"
 
+#include <stdint.h>
+
 GRAPHENE_BEGIN_DECLS
 
 /**
@@ -108,7 +110,14 @@ typedef struct _graphene_vec2_t         graphene_vec2_t;
 typedef struct _graphene_vec3_t         graphene_vec3_t;
 typedef struct _graphene_vec4_t         graphene_vec4_t;
 
+typedef struct _graphene_vec3_soa_t     graphene_vec3_soa_t;
+typedef struct _graphene_vec4_soa_t     graphene_vec4_soa_t;
+typedef struct _graphene_matrix_soa_t   graphene_matrix_soa_t;
+typedef struct _graphene_strided_view_t graphene_strided_view_t;
+
 typedef struct _graphene_matrix_t       graphene_matrix_t;
+typedef struct _graphene_affine2d_t     graphene_affine2d_t;
+typedef struct _graphene_affine3d_t     graphene_affine3d_t;
 
 typedef struct _graphene_point_t        graphene_point_t;
 typedef struct _graphene_size_t         graphene_size_t;
@@ -124,7 +133,17 @@ typedef struct _graphene_plane_t        graphene_plane_t;
 typedef struct _graphene_frustum_t      graphene_frustum_t;
 typedef struct _graphene_sphere_t       graphene_sphere_t;
 typedef struct _graphene_box_t          graphene_box_t;
+typedef struct _graphene_obb_t          graphene_obb_t;
 typedef struct _graphene_triangle_t     graphene_triangle_t;
 typedef struct _graphene_ray_t          graphene_ray_t;
+typedef struct _graphene_ray_packet_t   graphene_ray_packet_t;
+typedef struct _graphene_ray_packet8_t  graphene_ray_packet8_t;
+
+typedef struct _graphene_transform_t    graphene_transform_t;
+typedef struct _graphene_transform_hierarchy_t graphene_transform_hierarchy_t;
+
+typedef struct _graphene_bvh_t          graphene_bvh_t;
+
+typedef struct _graphene_arena_t        graphene_arena_t;
 
 GRAPHENE_END_DECLS
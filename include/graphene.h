@@ -36,12 +36,18 @@
 
 #include "graphene-simd4f.h"
 #include "graphene-simd4x4f.h"
+#include "graphene-simd8f.h"
 
 #include "graphene-vec2.h"
 #include "graphene-vec3.h"
 #include "graphene-vec4.h"
+#include "graphene-soa.h"
+#include "graphene-strided.h"
 
 #include "graphene-matrix.h"
+#include "graphene-transform.h"
+#include "graphene-affine2d.h"
+#include "graphene-affine3d.h"
 
 #include "graphene-point.h"
 #include "graphene-size.h"
@@ -56,8 +62,14 @@
 #include "graphene-frustum.h"
 #include "graphene-sphere.h"
 #include "graphene-box.h"
+#include "graphene-obb.h"
 #include "graphene-triangle.h"
 #include "graphene-ray.h"
+#include "graphene-bvh.h"
+#include "graphene-transform-hierarchy.h"
+
+#include "graphene-alloc.h"
+#include "graphene-parallel.h"
 
 #undef GRAPHENE_H_INSIDE
 
@@ -0,0 +1,697 @@
+/* graphene-affine2d.c: A 2D affine transformation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-affine2d
+ * @Title: Affine2D
+ * @Short_Description: A 2D affine transformation
+ *
+ * #graphene_affine2d_t represents an affine transformation on the plane,
+ * using six floating point values instead of the sixteen of a
+ * #graphene_matrix_t. Transforming a point with a #graphene_affine2d_t
+ * takes four multiplications and four additions, instead of a full 4x4
+ * matrix and vector product.
+ *
+ * #graphene_affine2d_t follows the same conventions as #graphene_matrix_t:
+ * points are row vectors multiplied on the left, so the transformation
+ * resulting from graphene_affine2d_multiply() applies the first operand
+ * first, and the translate(), scale(), and rotate() functions add their
+ * transformation after the existing one.
+ *
+ * A #graphene_affine2d_t can be converted to and from a #graphene_matrix_t
+ * using graphene_affine2d_to_matrix() and graphene_affine2d_init_from_matrix().
+ */
+
+#include "graphene-private.h"
+#include "graphene-alloc-private.h"
+
+#include "graphene-affine2d.h"
+
+#include "graphene-matrix.h"
+#include "graphene-point.h"
+#include "graphene-quad.h"
+#include "graphene-rect.h"
+
+/**
+ * graphene_affine2d_alloc: (constructor)
+ *
+ * Allocates a new #graphene_affine2d_t.
+ *
+ * The contents of the returned value are undefined.
+ *
+ * Returns: (transfer full): the newly allocated #graphene_affine2d_t
+ *
+ * Since: 1.12
+ */
+graphene_affine2d_t *
+graphene_affine2d_alloc (void)
+{
+  return graphene_aligned_alloc0 (sizeof (graphene_affine2d_t), 1, 16);
+}
+
+/**
+ * graphene_affine2d_free:
+ * @a: a #graphene_affine2d_t
+ *
+ * Frees the resources allocated by graphene_affine2d_alloc().
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine2d_free (graphene_affine2d_t *a)
+{
+  graphene_aligned_free (a);
+}
+
+/**
+ * graphene_affine2d_init:
+ * @a: a #graphene_affine2d_t
+ * @xx: the xx member
+ * @yx: the yx member
+ * @xy: the xy member
+ * @yy: the yy member
+ * @x_0: the x0 member
+ * @y_0: the y0 member
+ *
+ * Initializes a #graphene_affine2d_t with the given values, using the
+ * same layout as graphene_matrix_init_from_2d().
+ *
+ * Returns: (transfer none): the initialized #graphene_affine2d_t
+ *
+ * Since: 1.12
+ */
+graphene_affine2d_t *
+graphene_affine2d_init (graphene_affine2d_t *a,
+                        float                xx,
+                        float                yx,
+                        float                xy,
+                        float                yy,
+                        float                x_0,
+                        float                y_0)
+{
+  a->xx = xx;
+  a->yx = yx;
+  a->xy = xy;
+  a->yy = yy;
+  a->x0 = x_0;
+  a->y0 = y_0;
+
+  return a;
+}
+
+/**
+ * graphene_affine2d_init_identity:
+ * @a: a #graphene_affine2d_t
+ *
+ * Initializes a #graphene_affine2d_t with the identity transformation.
+ *
+ * Returns: (transfer none): the initialized #graphene_affine2d_t
+ *
+ * Since: 1.12
+ */
+graphene_affine2d_t *
+graphene_affine2d_init_identity (graphene_affine2d_t *a)
+{
+  return graphene_affine2d_init (a, 1.f, 0.f, 0.f, 1.f, 0.f, 0.f);
+}
+
+/**
+ * graphene_affine2d_init_translate:
+ * @a: a #graphene_affine2d_t
+ * @p: the translation coordinates
+ *
+ * Initializes a #graphene_affine2d_t with a translation.
+ *
+ * Returns: (transfer none): the initialized #graphene_affine2d_t
+ *
+ * Since: 1.12
+ */
+graphene_affine2d_t *
+graphene_affine2d_init_translate (graphene_affine2d_t    *a,
+                                  const graphene_point_t *p)
+{
+  return graphene_affine2d_init (a, 1.f, 0.f, 0.f, 1.f, p->x, p->y);
+}
+
+/**
+ * graphene_affine2d_init_scale:
+ * @a: a #graphene_affine2d_t
+ * @x: the scale factor on the X axis
+ * @y: the scale factor on the Y axis
+ *
+ * Initializes a #graphene_affine2d_t with the given scaling factors.
+ *
+ * Returns: (transfer none): the initialized #graphene_affine2d_t
+ *
+ * Since: 1.12
+ */
+graphene_affine2d_t *
+graphene_affine2d_init_scale (graphene_affine2d_t *a,
+                              float                x,
+                              float                y)
+{
+  return graphene_affine2d_init (a, x, 0.f, 0.f, y, 0.f, 0.f);
+}
+
+/**
+ * graphene_affine2d_init_rotate:
+ * @a: a #graphene_affine2d_t
+ * @angle: the rotation angle, in degrees
+ *
+ * Initializes a #graphene_affine2d_t with a rotation, like
+ * graphene_matrix_init_rotate() around the Z axis.
+ *
+ * Returns: (transfer none): the initialized #graphene_affine2d_t
+ *
+ * Since: 1.12
+ */
+graphene_affine2d_t *
+graphene_affine2d_init_rotate (graphene_affine2d_t *a,
+                               float                angle)
+{
+  float sin_a, cos_a;
+
+  graphene_sincos (GRAPHENE_DEG_TO_RAD (angle), &sin_a, &cos_a);
+
+  return graphene_affine2d_init (a, cos_a, sin_a, -sin_a, cos_a, 0.f, 0.f);
+}
+
+/**
+ * graphene_affine2d_init_from_affine2d:
+ * @a: a #graphene_affine2d_t
+ * @src: a #graphene_affine2d_t
+ *
+ * Initializes a #graphene_affine2d_t using the values of another one.
+ *
+ * Returns: (transfer none): the initialized #graphene_affine2d_t
+ *
+ * Since: 1.12
+ */
+graphene_affine2d_t *
+graphene_affine2d_init_from_affine2d (graphene_affine2d_t       *a,
+                                      const graphene_affine2d_t *src)
+{
+  *a = *src;
+
+  return a;
+}
+
+/**
+ * graphene_affine2d_init_from_matrix:
+ * @a: a #graphene_affine2d_t
+ * @m: a #graphene_matrix_t
+ *
+ * Initializes a #graphene_affine2d_t from a #graphene_matrix_t, if the
+ * matrix is compatible with a 2D affine transformation; see
+ * graphene_matrix_to_2d().
+ *
+ * If the matrix is not compatible, @a is initialized with the identity.
+ *
+ * Returns: `true` if the matrix is a 2D affine transformation
+ *
+ * Since: 1.12
+ */
+bool
+graphene_affine2d_init_from_matrix (graphene_affine2d_t     *a,
+                                    const graphene_matrix_t *m)
+{
+  double xx, yx, xy, yy, x_0, y_0;
+
+  if (!graphene_matrix_to_2d (m, &xx, &yx, &xy, &yy, &x_0, &y_0))
+    {
+      graphene_affine2d_init_identity (a);
+      return false;
+    }
+
+  graphene_affine2d_init (a, (float) xx, (float) yx, (float) xy, (float) yy, (float) x_0, (float) y_0);
+
+  return true;
+}
+
+/**
+ * graphene_affine2d_to_matrix:
+ * @a: a #graphene_affine2d_t
+ * @m: (out caller-allocates): return location for the matrix
+ *
+ * Converts a #graphene_affine2d_t to a #graphene_matrix_t, using
+ * graphene_matrix_init_from_2d().
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine2d_to_matrix (const graphene_affine2d_t *a,
+                             graphene_matrix_t         *m)
+{
+  graphene_matrix_init_from_2d (m, a->xx, a->yx, a->xy, a->yy, a->x0, a->y0);
+}
+
+/**
+ * graphene_affine2d_to_float:
+ * @a: a #graphene_affine2d_t
+ * @v: (out caller-allocates) (array fixed-size=6): return location
+ *   for the xx, yx, xy, yy, x0, and y0 members, in that order
+ *
+ * Stores the values of a #graphene_affine2d_t into an array of floating
+ * point values.
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine2d_to_float (const graphene_affine2d_t *a,
+                            float                     *v)
+{
+  v[0] = a->xx;
+  v[1] = a->yx;
+  v[2] = a->xy;
+  v[3] = a->yy;
+  v[4] = a->x0;
+  v[5] = a->y0;
+}
+
+/**
+ * graphene_affine2d_is_identity:
+ * @a: a #graphene_affine2d_t
+ *
+ * Checks whether the given #graphene_affine2d_t is the identity.
+ *
+ * Returns: `true` if the transformation is the identity
+ *
+ * Since: 1.12
+ */
+bool
+graphene_affine2d_is_identity (const graphene_affine2d_t *a)
+{
+  return graphene_approx_val (a->xx, 1.f) &&
+         graphene_approx_val (a->yx, 0.f) &&
+         graphene_approx_val (a->xy, 0.f) &&
+         graphene_approx_val (a->yy, 1.f) &&
+         graphene_approx_val (a->x0, 0.f) &&
+         graphene_approx_val (a->y0, 0.f);
+}
+
+/**
+ * graphene_affine2d_near:
+ * @a: a #graphene_affine2d_t
+ * @b: a #graphene_affine2d_t
+ * @epsilon: the threshold between the two transformations
+ *
+ * Compares the two given #graphene_affine2d_t and checks whether their
+ * values are within the given @epsilon of each other.
+ *
+ * Returns: `true` if the two transformations are near each other
+ *
+ * Since: 1.12
+ */
+bool
+graphene_affine2d_near (const graphene_affine2d_t *a,
+                        const graphene_affine2d_t *b,
+                        float                      epsilon)
+{
+  if (a == b)
+    return true;
+
+  if (a == NULL || b == NULL)
+    return false;
+
+  return fabsf (a->xx - b->xx) < epsilon &&
+         fabsf (a->yx - b->yx) < epsilon &&
+         fabsf (a->xy - b->xy) < epsilon &&
+         fabsf (a->yy - b->yy) < epsilon &&
+         fabsf (a->x0 - b->x0) < epsilon &&
+         fabsf (a->y0 - b->y0) < epsilon;
+}
+
+/**
+ * graphene_affine2d_multiply:
+ * @a: a #graphene_affine2d_t
+ * @b: a #graphene_affine2d_t
+ * @res: (out caller-allocates): return location for the result
+ *
+ * Multiplies two transformations; the result applies @a first, and
+ * then @b, like graphene_matrix_multiply().
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine2d_multiply (const graphene_affine2d_t *a,
+                            const graphene_affine2d_t *b,
+                            graphene_affine2d_t       *res)
+{
+  graphene_affine2d_t r;
+
+  r.xx = a->xx * b->xx + a->yx * b->xy;
+  r.yx = a->xx * b->yx + a->yx * b->yy;
+  r.xy = a->xy * b->xx + a->yy * b->xy;
+  r.yy = a->xy * b->yx + a->yy * b->yy;
+  r.x0 = a->x0 * b->xx + a->y0 * b->xy + b->x0;
+  r.y0 = a->x0 * b->yx + a->y0 * b->yy + b->y0;
+
+  *res = r;
+}
+
+/**
+ * graphene_affine2d_translate:
+ * @a: a #graphene_affine2d_t
+ * @p: the translation coordinates
+ *
+ * Adds a translation after the transformation in @a.
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine2d_translate (graphene_affine2d_t    *a,
+                             const graphene_point_t *p)
+{
+  a->x0 += p->x;
+  a->y0 += p->y;
+}
+
+/**
+ * graphene_affine2d_scale:
+ * @a: a #graphene_affine2d_t
+ * @x: the scale factor on the X axis
+ * @y: the scale factor on the Y axis
+ *
+ * Adds a scale after the transformation in @a.
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine2d_scale (graphene_affine2d_t *a,
+                         float                x,
+                         float                y)
+{
+  a->xx *= x;
+  a->xy *= x;
+  a->x0 *= x;
+
+  a->yx *= y;
+  a->yy *= y;
+  a->y0 *= y;
+}
+
+/**
+ * graphene_affine2d_rotate:
+ * @a: a #graphene_affine2d_t
+ * @angle: the rotation angle, in degrees
+ *
+ * Adds a rotation after the transformation in @a.
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine2d_rotate (graphene_affine2d_t *a,
+                          float                angle)
+{
+  graphene_affine2d_t r;
+
+  graphene_affine2d_init_rotate (&r, angle);
+  graphene_affine2d_multiply (a, &r, a);
+}
+
+/**
+ * graphene_affine2d_inverse:
+ * @a: a #graphene_affine2d_t
+ * @res: (out caller-allocates): return location for the inverse
+ *
+ * Inverts the given transformation.
+ *
+ * Returns: `true` if the transformation is invertible
+ *
+ * Since: 1.12
+ */
+bool
+graphene_affine2d_inverse (const graphene_affine2d_t *a,
+                           graphene_affine2d_t       *res)
+{
+  float det = a->xx * a->yy - a->yx * a->xy;
+  float inv_det;
+  graphene_affine2d_t r;
+
+  /* Same check as graphene_matrix_inverse() */
+  if (fabsf (det) < FLT_EPSILON)
+    return false;
+
+  inv_det = 1.f / det;
+
+  r.xx = a->yy * inv_det;
+  r.yx = -a->yx * inv_det;
+  r.xy = -a->xy * inv_det;
+  r.yy = a->xx * inv_det;
+  r.x0 = -(a->x0 * r.xx + a->y0 * r.xy);
+  r.y0 = -(a->x0 * r.yx + a->y0 * r.yy);
+
+  *res = r;
+
+  return true;
+}
+
+/**
+ * graphene_affine2d_interpolate:
+ * @a: a #graphene_affine2d_t
+ * @b: a #graphene_affine2d_t
+ * @factor: the linear interpolation factor
+ * @res: (out caller-allocates): return location for the interpolated
+ *   transformation
+ *
+ * Interpolates the two given transformations by decomposing them into
+ * translation, rotation, and scale, like graphene_matrix_interpolate().
+ *
+ * If either transformation cannot be decomposed, @res is set to the
+ * identity.
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine2d_interpolate (const graphene_affine2d_t *a,
+                               const graphene_affine2d_t *b,
+                               double                     factor,
+                               graphene_affine2d_t       *res)
+{
+  graphene_matrix_t ma, mb, mres;
+
+  /* graphene_matrix_interpolate() has a dedicated path for 2D affine
+   * matrices, so we reuse it instead of duplicating the decomposition
+   */
+  graphene_affine2d_to_matrix (a, &ma);
+  graphene_affine2d_to_matrix (b, &mb);
+  graphene_matrix_interpolate (&ma, &mb, factor, &mres);
+
+  graphene_affine2d_init_from_matrix (res, &mres);
+}
+
+static inline void
+affine2d_transform_xy (const graphene_affine2d_t *a,
+                       float                      x,
+                       float                      y,
+                       graphene_point_t          *res)
+{
+  res->x = x * a->xx + y * a->xy + a->x0;
+  res->y = x * a->yx + y * a->yy + a->y0;
+}
+
+/**
+ * graphene_affine2d_transform_point:
+ * @a: a #graphene_affine2d_t
+ * @p: a #graphene_point_t
+ * @res: (out caller-allocates): return location for the transformed
+ *   point
+ *
+ * Transforms a #graphene_point_t.
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine2d_transform_point (const graphene_affine2d_t *a,
+                                   const graphene_point_t    *p,
+                                   graphene_point_t          *res)
+{
+  affine2d_transform_xy (a, p->x, p->y, res);
+}
+
+/**
+ * graphene_affine2d_transform_points:
+ * @a: a #graphene_affine2d_t
+ * @n_points: the number of points in the @points array
+ * @points: (array length=n_points): an array of #graphene_point_t
+ * @res: (out caller-allocates) (array length=n_points): return location
+ *   for the transformed points
+ *
+ * Transforms each #graphene_point_t in the @points array.
+ *
+ * The @points and @res arrays can be the same.
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine2d_transform_points (const graphene_affine2d_t *a,
+                                    unsigned int               n_points,
+                                    const graphene_point_t    *points,
+                                    graphene_point_t          *res)
+{
+  const graphene_affine2d_t t = *a;
+
+  for (unsigned int i = 0; i < n_points; i++)
+    {
+      float x = points[i].x;
+      float y = points[i].y;
+
+      res[i].x = x * t.xx + y * t.xy + t.x0;
+      res[i].y = x * t.yx + y * t.yy + t.y0;
+    }
+}
+
+/**
+ * graphene_affine2d_transform_rect:
+ * @a: a #graphene_affine2d_t
+ * @r: a #graphene_rect_t
+ * @res: (out caller-allocates): return location for the transformed
+ *   quad
+ *
+ * Transforms each corner of a #graphene_rect_t, like
+ * graphene_matrix_transform_rect().
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine2d_transform_rect (const graphene_affine2d_t *a,
+                                  const graphene_rect_t     *r,
+                                  graphene_quad_t           *res)
+{
+  graphene_rect_t rr;
+  float x0, y0, x1, y1;
+
+  graphene_rect_normalize_r (r, &rr);
+
+  x0 = rr.origin.x;
+  y0 = rr.origin.y;
+  x1 = rr.origin.x + rr.size.width;
+  y1 = rr.origin.y + rr.size.height;
+
+  affine2d_transform_xy (a, x0, y0, &res->points[0]);
+  affine2d_transform_xy (a, x1, y0, &res->points[1]);
+  affine2d_transform_xy (a, x1, y1, &res->points[2]);
+  affine2d_transform_xy (a, x0, y1, &res->points[3]);
+}
+
+static inline void
+affine2d_transform_bounds (const graphene_affine2d_t *a,
+                           const graphene_rect_t     *r,
+                           graphene_rect_t           *res)
+{
+  graphene_rect_t rr;
+  graphene_point_t center;
+  float half_w, half_h;
+  float ext_x, ext_y;
+
+  graphene_rect_normalize_r (r, &rr);
+
+  /* Transform the center, and project the half extents on each axis */
+  half_w = rr.size.width * 0.5f;
+  half_h = rr.size.height * 0.5f;
+
+  affine2d_transform_xy (a, rr.origin.x + half_w, rr.origin.y + half_h, &center);
+
+  ext_x = fabsf (a->xx) * half_w + fabsf (a->xy) * half_h;
+  ext_y = fabsf (a->yx) * half_w + fabsf (a->yy) * half_h;
+
+  res->origin.x = center.x - ext_x;
+  res->origin.y = center.y - ext_y;
+  res->size.width = ext_x * 2.f;
+  res->size.height = ext_y * 2.f;
+}
+
+/**
+ * graphene_affine2d_transform_bounds:
+ * @a: a #graphene_affine2d_t
+ * @r: a #graphene_rect_t
+ * @res: (out caller-allocates): return location for the bounds
+ *   of the transformed rectangle
+ *
+ * Transforms a #graphene_rect_t, and computes the axis aligned rectangle
+ * containing the result, like graphene_matrix_transform_bounds().
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine2d_transform_bounds (const graphene_affine2d_t *a,
+                                    const graphene_rect_t     *r,
+                                    graphene_rect_t           *res)
+{
+  affine2d_transform_bounds (a, r, res);
+}
+
+/**
+ * graphene_affine2d_transform_bounds_array:
+ * @a: a #graphene_affine2d_t
+ * @n_rects: the number of rectangles in the @rects array
+ * @rects: (array length=n_rects): an array of #graphene_rect_t
+ * @res: (out caller-allocates) (array length=n_rects): return location
+ *   for the bounds of the transformed rectangles
+ *
+ * Computes the bounds of each transformed #graphene_rect_t in the
+ * @rects array, like graphene_affine2d_transform_bounds().
+ *
+ * The @rects and @res arrays can be the same.
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine2d_transform_bounds_array (const graphene_affine2d_t *a,
+                                          unsigned int               n_rects,
+                                          const graphene_rect_t     *rects,
+                                          graphene_rect_t           *res)
+{
+  const graphene_affine2d_t t = *a;
+
+  for (unsigned int i = 0; i < n_rects; i++)
+    affine2d_transform_bounds (&t, &rects[i], &res[i]);
+}
+
+/**
+ * graphene_affine2d_transform_quads:
+ * @a: a #graphene_affine2d_t
+ * @n_quads: the number of quads in the @quads array
+ * @quads: (array length=n_quads): an array of #graphene_quad_t
+ * @res: (out caller-allocates) (array length=n_quads): return location
+ *   for the transformed quads
+ *
+ * Transforms each point of the #graphene_quad_t in the @quads array.
+ *
+ * The @quads and @res arrays can be the same.
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine2d_transform_quads (const graphene_affine2d_t *a,
+                                   unsigned int               n_quads,
+                                   const graphene_quad_t     *quads,
+                                   graphene_quad_t           *res)
+{
+  const graphene_affine2d_t t = *a;
+
+  for (unsigned int i = 0; i < n_quads; i++)
+    graphene_affine2d_transform_points (&t, 4, quads[i].points, res[i].points);
+}
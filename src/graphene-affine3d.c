@@ -0,0 +1,563 @@
+/* graphene-affine3d.c: A 3D affine transformation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-affine3d
+ * @Title: Affine3D
+ * @Short_Description: A 3D affine transformation
+ *
+ * #graphene_affine3d_t represents an affine transformation in 3D space,
+ * using a 3x4 matrix instead of the full 4x4 matrix of a #graphene_matrix_t.
+ * Since the last column of an affine #graphene_matrix_t is always
+ * (0, 0, 0, 1), a #graphene_affine3d_t takes 48 bytes instead of 64, which
+ * makes it suitable for storing the transformations of large amounts of
+ * objects, like the nodes of a scene graph.
+ *
+ * #graphene_affine3d_t follows the same conventions as #graphene_matrix_t:
+ * points are row vectors multiplied on the left, so the transformation
+ * resulting from graphene_affine3d_multiply() applies the first operand
+ * first.
+ *
+ * A #graphene_affine3d_t can be converted to and from a #graphene_matrix_t
+ * without any loss of precision using graphene_affine3d_to_matrix() and
+ * graphene_affine3d_init_from_matrix().
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-affine3d.h"
+
+#include "graphene-alloc-private.h"
+#include "graphene-box.h"
+#include "graphene-kernels-private.h"
+#include "graphene-matrix.h"
+#include "graphene-point3d.h"
+#include "graphene-simd4f.h"
+#include "graphene-simd4x4f.h"
+#include "graphene-vec3.h"
+
+/* Each row of a graphene_affine3d_t is a column of the equivalent 4x4
+ * matrix, so the conversions between the two are a transposition
+ */
+static inline void
+affine3d_to_simd4x4f (const graphene_affine3d_t *a,
+                      graphene_simd4x4f_t       *m)
+{
+  *m = graphene_simd4x4f_init (a->x, a->y, a->z, graphene_simd4f_init (0.f, 0.f, 0.f, 1.f));
+  graphene_simd4x4f_transpose_in_place (m);
+}
+
+static inline void
+affine3d_from_simd4x4f (graphene_affine3d_t       *a,
+                        const graphene_simd4x4f_t *m)
+{
+  graphene_simd4x4f_t t = *m;
+
+  graphene_simd4x4f_transpose_in_place (&t);
+
+  a->x = t.x;
+  a->y = t.y;
+  a->z = t.z;
+}
+
+/* Combines the rows of @a with the coefficients of @row; the implicit
+ * last row of @a only contributes to the translation
+ */
+static inline graphene_simd4f_t
+affine3d_row_mul (graphene_simd4f_t          row,
+                  const graphene_affine3d_t *a)
+{
+  graphene_simd4f_t v;
+
+  v = graphene_simd4f_mul (row, graphene_simd4f_init (0.f, 0.f, 0.f, 1.f));
+  v = graphene_simd4f_madd (graphene_simd4f_splat_x (row), a->x, v);
+  v = graphene_simd4f_madd (graphene_simd4f_splat_y (row), a->y, v);
+  v = graphene_simd4f_madd (graphene_simd4f_splat_z (row), a->z, v);
+
+  return v;
+}
+
+/**
+ * graphene_affine3d_alloc: (constructor)
+ *
+ * Allocates a new #graphene_affine3d_t.
+ *
+ * The contents of the returned value are undefined.
+ *
+ * Returns: (transfer full): the newly allocated #graphene_affine3d_t
+ *
+ * Since: 1.12
+ */
+graphene_affine3d_t *
+graphene_affine3d_alloc (void)
+{
+  return graphene_aligned_alloc (sizeof (graphene_affine3d_t), 1, 16);
+}
+
+/**
+ * graphene_affine3d_free:
+ * @a: a #graphene_affine3d_t
+ *
+ * Frees the resources allocated by graphene_affine3d_alloc().
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine3d_free (graphene_affine3d_t *a)
+{
+  graphene_aligned_free (a);
+}
+
+/**
+ * graphene_affine3d_init_identity:
+ * @a: a #graphene_affine3d_t
+ *
+ * Initializes a #graphene_affine3d_t with the identity transformation.
+ *
+ * Returns: (transfer none): the initialized #graphene_affine3d_t
+ *
+ * Since: 1.12
+ */
+graphene_affine3d_t *
+graphene_affine3d_init_identity (graphene_affine3d_t *a)
+{
+  a->x = graphene_simd4f_init (1.f, 0.f, 0.f, 0.f);
+  a->y = graphene_simd4f_init (0.f, 1.f, 0.f, 0.f);
+  a->z = graphene_simd4f_init (0.f, 0.f, 1.f, 0.f);
+
+  return a;
+}
+
+/**
+ * graphene_affine3d_init_from_float:
+ * @a: a #graphene_affine3d_t
+ * @v: (array fixed-size=12): an array of 12 floating point values
+ *
+ * Initializes a #graphene_affine3d_t with the given array of floating
+ * point values, in row-major order; see #graphene_affine3d_t for the
+ * layout of the matrix.
+ *
+ * Returns: (transfer none): the initialized #graphene_affine3d_t
+ *
+ * Since: 1.12
+ */
+graphene_affine3d_t *
+graphene_affine3d_init_from_float (graphene_affine3d_t *a,
+                                   const float         *v)
+{
+  a->x = graphene_simd4f_init_4f (v);
+  a->y = graphene_simd4f_init_4f (v + 4);
+  a->z = graphene_simd4f_init_4f (v + 8);
+
+  return a;
+}
+
+/**
+ * graphene_affine3d_init_translate:
+ * @a: a #graphene_affine3d_t
+ * @p: the translation coordinates
+ *
+ * Initializes a #graphene_affine3d_t with a translation.
+ *
+ * Returns: (transfer none): the initialized #graphene_affine3d_t
+ *
+ * Since: 1.12
+ */
+graphene_affine3d_t *
+graphene_affine3d_init_translate (graphene_affine3d_t      *a,
+                                  const graphene_point3d_t *p)
+{
+  a->x = graphene_simd4f_init (1.f, 0.f, 0.f, p->x);
+  a->y = graphene_simd4f_init (0.f, 1.f, 0.f, p->y);
+  a->z = graphene_simd4f_init (0.f, 0.f, 1.f, p->z);
+
+  return a;
+}
+
+/**
+ * graphene_affine3d_init_scale:
+ * @a: a #graphene_affine3d_t
+ * @x: the scale factor on the X axis
+ * @y: the scale factor on the Y axis
+ * @z: the scale factor on the Z axis
+ *
+ * Initializes a #graphene_affine3d_t with a scaling transformation.
+ *
+ * Returns: (transfer none): the initialized #graphene_affine3d_t
+ *
+ * Since: 1.12
+ */
+graphene_affine3d_t *
+graphene_affine3d_init_scale (graphene_affine3d_t *a,
+                              float                x,
+                              float                y,
+                              float                z)
+{
+  a->x = graphene_simd4f_init (x, 0.f, 0.f, 0.f);
+  a->y = graphene_simd4f_init (0.f, y, 0.f, 0.f);
+  a->z = graphene_simd4f_init (0.f, 0.f, z, 0.f);
+
+  return a;
+}
+
+/**
+ * graphene_affine3d_init_rotate:
+ * @a: a #graphene_affine3d_t
+ * @angle: the rotation angle, in degrees
+ * @axis: the axis vector as a #graphene_vec3_t
+ *
+ * Initializes a #graphene_affine3d_t with a rotation of the given
+ * @angle around the given @axis; see graphene_matrix_init_rotate().
+ *
+ * Returns: (transfer none): the initialized #graphene_affine3d_t
+ *
+ * Since: 1.12
+ */
+graphene_affine3d_t *
+graphene_affine3d_init_rotate (graphene_affine3d_t   *a,
+                               float                  angle,
+                               const graphene_vec3_t *axis)
+{
+  graphene_simd4x4f_t m;
+
+  graphene_simd4x4f_rotation (&m, GRAPHENE_DEG_TO_RAD (angle), axis->value);
+  affine3d_from_simd4x4f (a, &m);
+
+  return a;
+}
+
+/**
+ * graphene_affine3d_init_from_affine3d:
+ * @a: a #graphene_affine3d_t
+ * @src: the #graphene_affine3d_t to copy
+ *
+ * Initializes a #graphene_affine3d_t using the values of another
+ * #graphene_affine3d_t.
+ *
+ * Returns: (transfer none): the initialized #graphene_affine3d_t
+ *
+ * Since: 1.12
+ */
+graphene_affine3d_t *
+graphene_affine3d_init_from_affine3d (graphene_affine3d_t       *a,
+                                      const graphene_affine3d_t *src)
+{
+  *a = *src;
+
+  return a;
+}
+
+/**
+ * graphene_affine3d_init_from_matrix:
+ * @a: a #graphene_affine3d_t
+ * @m: a #graphene_matrix_t
+ *
+ * Initializes a #graphene_affine3d_t from a #graphene_matrix_t, if the
+ * last column of the matrix is exactly (0, 0, 0, 1).
+ *
+ * If the matrix is not affine, @a is initialized with the identity.
+ *
+ * Returns: `true` if the matrix is an affine transformation
+ *
+ * Since: 1.12
+ */
+bool
+graphene_affine3d_init_from_matrix (graphene_affine3d_t     *a,
+                                    const graphene_matrix_t *m)
+{
+  const graphene_simd4f_t w_axis = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+  graphene_simd4x4f_t t = m->value;
+
+  graphene_simd4x4f_transpose_in_place (&t);
+
+  if (!graphene_simd4f_cmp_eq (t.w, w_axis))
+    {
+      graphene_affine3d_init_identity (a);
+      return false;
+    }
+
+  a->x = t.x;
+  a->y = t.y;
+  a->z = t.z;
+
+  return true;
+}
+
+/**
+ * graphene_affine3d_to_matrix:
+ * @a: a #graphene_affine3d_t
+ * @m: (out caller-allocates): return location for the matrix
+ *
+ * Converts a #graphene_affine3d_t into the equivalent #graphene_matrix_t.
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine3d_to_matrix (const graphene_affine3d_t *a,
+                             graphene_matrix_t         *m)
+{
+  affine3d_to_simd4x4f (a, &m->value);
+}
+
+/**
+ * graphene_affine3d_to_float:
+ * @a: a #graphene_affine3d_t
+ * @v: (array fixed-size=12) (out caller-allocates): return location
+ *   for an array of 12 floating point values
+ *
+ * Stores the values of the 3x4 matrix of the #graphene_affine3d_t into
+ * the given array, in row-major order.
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine3d_to_float (const graphene_affine3d_t *a,
+                            float                     *v)
+{
+  graphene_simd4f_dup_4f (a->x, v);
+  graphene_simd4f_dup_4f (a->y, v + 4);
+  graphene_simd4f_dup_4f (a->z, v + 8);
+}
+
+/**
+ * graphene_affine3d_is_identity:
+ * @a: a #graphene_affine3d_t
+ *
+ * Checks whether the given #graphene_affine3d_t is the identity.
+ *
+ * Returns: `true` if the transformation is the identity
+ *
+ * Since: 1.12
+ */
+bool
+graphene_affine3d_is_identity (const graphene_affine3d_t *a)
+{
+  return graphene_simd4f_cmp_eq (a->x, graphene_simd4f_init (1.f, 0.f, 0.f, 0.f)) &&
+         graphene_simd4f_cmp_eq (a->y, graphene_simd4f_init (0.f, 1.f, 0.f, 0.f)) &&
+         graphene_simd4f_cmp_eq (a->z, graphene_simd4f_init (0.f, 0.f, 1.f, 0.f));
+}
+
+/**
+ * graphene_affine3d_near:
+ * @a: a #graphene_affine3d_t
+ * @b: a #graphene_affine3d_t
+ * @epsilon: the threshold between the two transformations
+ *
+ * Compares the two given #graphene_affine3d_t and checks whether their
+ * values are within the given @epsilon of each other.
+ *
+ * Returns: `true` if the two transformations are near each other
+ *
+ * Since: 1.12
+ */
+bool
+graphene_affine3d_near (const graphene_affine3d_t *a,
+                        const graphene_affine3d_t *b,
+                        float                      epsilon)
+{
+  float va[12], vb[12];
+
+  if (a == b)
+    return true;
+
+  graphene_affine3d_to_float (a, va);
+  graphene_affine3d_to_float (b, vb);
+
+  for (int i = 0; i < 12; i++)
+    {
+      if (fabsf (va[i] - vb[i]) >= epsilon)
+        return false;
+    }
+
+  return true;
+}
+
+/**
+ * graphene_affine3d_multiply:
+ * @a: a #graphene_affine3d_t
+ * @b: a #graphene_affine3d_t
+ * @res: (out caller-allocates): return location for the result
+ *
+ * Multiplies two #graphene_affine3d_t.
+ *
+ * Like graphene_matrix_multiply(), the resulting transformation applies
+ * @a first, and then @b.
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine3d_multiply (const graphene_affine3d_t *a,
+                            const graphene_affine3d_t *b,
+                            graphene_affine3d_t       *res)
+{
+  graphene_simd4f_t x, y, z;
+
+  x = affine3d_row_mul (b->x, a);
+  y = affine3d_row_mul (b->y, a);
+  z = affine3d_row_mul (b->z, a);
+
+  res->x = x;
+  res->y = y;
+  res->z = z;
+}
+
+/**
+ * graphene_affine3d_inverse:
+ * @a: a #graphene_affine3d_t
+ * @res: (out caller-allocates): return location for the inverse
+ *
+ * Inverts the given transformation.
+ *
+ * Returns: `true` if the transformation is invertible
+ *
+ * Since: 1.12
+ */
+bool
+graphene_affine3d_inverse (const graphene_affine3d_t *a,
+                           graphene_affine3d_t       *res)
+{
+  const graphene_simd4f_t c0 = graphene_simd4f_cross3 (a->y, a->z);
+  const graphene_simd4f_t c1 = graphene_simd4f_cross3 (a->z, a->x);
+  const graphene_simd4f_t c2 = graphene_simd4f_cross3 (a->x, a->y);
+  const float det = graphene_simd4f_get_x (graphene_simd4f_dot3 (a->x, c0));
+  graphene_simd4f_t inv_det, translation;
+  graphene_simd4x4f_t inv;
+
+  /* Same check as graphene_matrix_inverse() */
+  if (fabsf (det) < FLT_EPSILON)
+    return false;
+
+  inv_det = graphene_simd4f_splat (1.f / det);
+
+  /* The rows of @a are the columns of the linear part, so the cross
+   * products are the rows of its inverse
+   */
+  inv.x = graphene_simd4f_mul (c0, inv_det);
+  inv.y = graphene_simd4f_mul (c1, inv_det);
+  inv.z = graphene_simd4f_mul (c2, inv_det);
+
+  translation = graphene_simd4f_mul (graphene_simd4f_splat_w (a->x), inv.x);
+  translation = graphene_simd4f_madd (graphene_simd4f_splat_w (a->y), inv.y, translation);
+  translation = graphene_simd4f_madd (graphene_simd4f_splat_w (a->z), inv.z, translation);
+  inv.w = graphene_simd4f_neg (translation);
+
+  /* Transposing puts the inverse translation in the last column */
+  graphene_simd4x4f_transpose_in_place (&inv);
+
+  res->x = inv.x;
+  res->y = inv.y;
+  res->z = inv.z;
+
+  return true;
+}
+
+/**
+ * graphene_affine3d_transform_point:
+ * @a: a #graphene_affine3d_t
+ * @p: a #graphene_point3d_t
+ * @res: (out caller-allocates): return location for the transformed point
+ *
+ * Transforms the given #graphene_point3d_t.
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine3d_transform_point (const graphene_affine3d_t *a,
+                                   const graphene_point3d_t  *p,
+                                   graphene_point3d_t        *res)
+{
+  graphene_affine3d_transform_points (a, 1, p, res);
+}
+
+/**
+ * graphene_affine3d_transform_points:
+ * @a: a #graphene_affine3d_t
+ * @n_points: the number of points
+ * @points: (array length=n_points): the points to transform
+ * @res: (array length=n_points) (out caller-allocates): return location
+ *   for the transformed points
+ *
+ * Transforms an array of #graphene_point3d_t.
+ *
+ * @points and @res can point to the same array.
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine3d_transform_points (const graphene_affine3d_t *a,
+                                    unsigned int               n_points,
+                                    const graphene_point3d_t  *points,
+                                    graphene_point3d_t        *res)
+{
+  graphene_simd4x4f_t m;
+
+  affine3d_to_simd4x4f (a, &m);
+  graphene_get_kernels ()->matrix_transform_points3d (&m, n_points, points, res);
+}
+
+/**
+ * graphene_affine3d_transform_vec3:
+ * @a: a #graphene_affine3d_t
+ * @v: a #graphene_vec3_t
+ * @res: (out caller-allocates): return location for the transformed vector
+ *
+ * Transforms the given #graphene_vec3_t, ignoring the translation.
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine3d_transform_vec3 (const graphene_affine3d_t *a,
+                                  const graphene_vec3_t     *v,
+                                  graphene_vec3_t           *res)
+{
+  graphene_simd4x4f_t m;
+
+  affine3d_to_simd4x4f (a, &m);
+  graphene_simd4x4f_vec3_mul (&m, &v->value, &res->value);
+}
+
+/**
+ * graphene_affine3d_transform_box:
+ * @a: a #graphene_affine3d_t
+ * @b: a #graphene_box_t
+ * @res: (out caller-allocates): return location for the bounds
+ *   of the transformed box
+ *
+ * Transforms the vertices of a #graphene_box_t and computes the
+ * axis-aligned bounding box of the result; see
+ * graphene_matrix_transform_box().
+ *
+ * Since: 1.12
+ */
+void
+graphene_affine3d_transform_box (const graphene_affine3d_t *a,
+                                 const graphene_box_t      *b,
+                                 graphene_box_t            *res)
+{
+  graphene_simd4x4f_t m;
+
+  affine3d_to_simd4x4f (a, &m);
+  graphene_get_kernels ()->matrix_transform_boxes (&m, 1, b, res);
+}
@@ -23,9 +23,61 @@
  * THE SOFTWARE.
  */
 
+/**
+ * SECTION:graphene-alloc
+ * @Title: Memory allocation
+ * @Short_Description: Counters of the memory allocator
+ *
+ * The `_alloc()` functions of the Graphene types, and the copy functions
+ * of their boxed types, allocate small blocks of a few fixed sizes. These
+ * blocks are recycled through free lists: each thread keeps a cache of
+ * free blocks of each size, and exchanges batches of blocks with a shared
+ * pool when its cache runs empty or grows too large.
+ *
+ * The memory of the pool is never returned to the system. The pool can be
+ * disabled, for instance when using memory debugging tools, by setting the
+ * `GRAPHENE_ALLOC_POOL` environment variable to 0.
+ *
+ * The efficiency of the caches can be inspected using
+ * graphene_alloc_get_stats().
+ *
+ * Temporary objects, like the scratch data computed on each frame, can
+ * instead be allocated from a #graphene_arena_t. An arena hands out memory
+ * from large blocks by bumping a pointer; the objects allocated from an
+ * arena are not freed individually, but all at once by calling
+ * graphene_arena_reset(), which keeps the memory of the arena around for
+ * the next batch of allocations.
+ *
+ * |[<!-- language="C" -->
+ *   graphene_arena_t *arena = graphene_arena_new (0);
+ *
+ *   for (unsigned int i = 0; i < n_objects; i++)
+ *     {
+ *       graphene_box_t *box = graphene_arena_new_box (arena);
+ *
+ *       graphene_box_init_from_points (box, objects[i].n_points, objects[i].points);
+ *       ...
+ *     }
+ *
+ *   // Releases all the boxes
+ *   graphene_arena_reset (arena);
+ * ]|
+ */
+
 #include "graphene-private.h"
 #include "graphene-alloc-private.h"
 
+#include "graphene-alloc.h"
+#include "graphene-box.h"
+#include "graphene-matrix.h"
+#include "graphene-point3d.h"
+#include "graphene-quaternion.h"
+#include "graphene-ray.h"
+#include "graphene-sphere.h"
+#include "graphene-vec2.h"
+#include "graphene-vec3.h"
+#include "graphene-vec4.h"
+
 #if defined(HAVE_POSIX_MEMALIGN) && !defined(_XOPEN_SOURCE)
 # define _XOPEN_SOURCE 600
 #endif
@@ -45,11 +97,401 @@
 # define aligned_free(x) free (x)
 #endif
 
+/* The thread caches require thread-local storage */
+#if defined(HAVE_PTHREAD_H) && (defined(__GNUC__) || defined(__clang__))
+# define USE_ALLOC_POOL 1
+#endif
+
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <errno.h>
 
+#ifdef USE_ALLOC_POOL
+#include <pthread.h>
+#endif
+
+static void *
+system_aligned_alloc (size_t real_size,
+                      size_t alignment)
+{
+  void *res = NULL;
+
+#ifndef G_DISABLE_ASSERT
+  errno = 0;
+#endif
+
+#if defined(HAVE_POSIX_MEMALIGN)
+  errno = posix_memalign (&res, alignment, real_size);
+#elif defined(HAVE_ALIGNED_ALLOC) || defined(HAVE__ALIGNED_MALLOC)
+  /* real_size must be a multiple of alignment */
+  if (real_size % alignment != 0)
+    {
+      size_t offset = real_size % alignment;
+      real_size += (alignment - offset);
+    }
+
+  res = aligned_alloc (alignment, real_size);
+#elif defined(HAVE_MEMALIGN)
+  res = memalign (alignment, real_size);
+#else
+  res = malloc (real_size);
+#endif
+
+#ifndef G_DISABLE_ASSERT
+  if (errno != 0 || res == NULL)
+    {
+      fprintf (stderr, "Allocation error: %s\n", strerror (errno));
+      abort ();
+    }
+#endif
+
+  return res;
+}
+
+#ifdef USE_ALLOC_POOL
+/* Every allocation is preceded by a header, so that graphene_aligned_free()
+ * can tell the blocks of the pool from the memory allocated by the system;
+ * the header is stored at the end of POOL_HEADER_SIZE bytes, to preserve
+ * the alignment of the returned memory
+ */
+typedef struct {
+  /* The size class of the block, plus one; or 0 for system memory */
+  uint32_t size_class;
+
+  /* The offset of the returned memory from the start of the allocation */
+  uint32_t offset;
+} pool_header_t;
+
+#define POOL_HEADER_SIZE        16
+
+#define pool_get_header(mem) \
+  ((pool_header_t *) ((char *) (mem) - sizeof (pool_header_t)))
+
+/* The sizes of the blocks of the pool */
+#define POOL_N_CLASSES          5
+#define POOL_MAX_SIZE           128
+#define POOL_MAX_ALIGNMENT      16
+
+static const size_t pool_class_sizes[POOL_N_CLASSES] = { 16, 32, 64, 96, 128 };
+
+/* Maps the size of an allocation, in units of 16 bytes, to a size class */
+static const uint8_t pool_size_classes[POOL_MAX_SIZE / 16 + 1] = { 0, 0, 1, 2, 2, 3, 3, 4, 4 };
+
+/* The number of blocks moved between a thread cache and the shared pool */
+#define POOL_BATCH_SIZE         32
+
+/* The number of free blocks of each class a thread cache can hold */
+#define POOL_CACHE_SIZE         (2 * POOL_BATCH_SIZE)
+
+/* The size of the slabs new blocks are carved from */
+#define POOL_SLAB_SIZE          (16 * 1024)
+
+/* Free blocks are linked through their first word */
+typedef struct _pool_block_t    pool_block_t;
+
+struct _pool_block_t
+{
+  pool_block_t *next;
+};
+
+typedef enum {
+  POOL_STATE_UNKNOWN,
+  POOL_STATE_ENABLED,
+  POOL_STATE_DISABLED
+} pool_state_t;
+
+typedef struct {
+  pool_block_t *blocks[POOL_N_CLASSES];
+  unsigned int n_blocks[POOL_N_CLASSES];
+
+  /* Collected into the shared counters under the pool lock */
+  uint64_t hits;
+  uint64_t misses;
+
+  pool_state_t state;
+
+  /* Whether the cache is flushed when the thread exits */
+  bool registered;
+} pool_cache_t;
+
+static __thread pool_cache_t pool_cache;
+
+static pthread_once_t pool_once = PTHREAD_ONCE_INIT;
+static pthread_key_t pool_cache_key;
+static bool pool_enabled;
+
+/* The shared pool; protected by pool_lock */
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pool_block_t *pool_blocks[POOL_N_CLASSES];
+static char *pool_slab;
+static size_t pool_slab_left;
+static uint64_t pool_hits;
+static uint64_t pool_misses;
+
+static void
+pool_collect_stats_locked (pool_cache_t *cache)
+{
+  pool_hits += cache->hits;
+  pool_misses += cache->misses;
+
+  cache->hits = 0;
+  cache->misses = 0;
+}
+
+/* Moves up to @n_blocks blocks of @size_class from @cache to the
+ * shared pool
+ */
+static void
+pool_release_locked (pool_cache_t *cache,
+                     unsigned int  size_class,
+                     unsigned int  n_blocks)
+{
+  pool_block_t *first = cache->blocks[size_class];
+  pool_block_t *last = first;
+  unsigned int n = 1;
+
+  if (first == NULL)
+    return;
+
+  while (n < n_blocks && last->next != NULL)
+    {
+      last = last->next;
+      n += 1;
+    }
+
+  cache->blocks[size_class] = last->next;
+  cache->n_blocks[size_class] -= n;
+
+  last->next = pool_blocks[size_class];
+  pool_blocks[size_class] = first;
+}
+
+static void
+pool_cache_destroy (void *data)
+{
+  pool_cache_t *cache = data;
+
+  pthread_mutex_lock (&pool_lock);
+
+  for (unsigned int i = 0; i < POOL_N_CLASSES; i++)
+    pool_release_locked (cache, i, cache->n_blocks[i]);
+
+  pool_collect_stats_locked (cache);
+
+  pthread_mutex_unlock (&pool_lock);
+
+  /* Blocks freed by other destructors register the cache again */
+  cache->registered = false;
+}
+
+static void
+pool_init_once (void)
+{
+  const char *env = getenv ("GRAPHENE_ALLOC_POOL");
+  int status;
+
+  pool_enabled = env == NULL || strcmp (env, "0") != 0;
+  if (!pool_enabled)
+    return;
+
+  status = pthread_key_create (&pool_cache_key, pool_cache_destroy);
+  if (status != 0)
+    {
+      fprintf (stderr, "pthread_key_create failed: %s (errno:%d)\n",
+               strerror (status), status);
+      pool_enabled = false;
+    }
+}
+
+static inline pool_cache_t *
+pool_get_cache (void)
+{
+  pool_cache_t *cache = &pool_cache;
+
+  if (cache->state == POOL_STATE_UNKNOWN)
+    {
+      int status = pthread_once (&pool_once, pool_init_once);
+
+      if (status != 0)
+        {
+          fprintf (stderr, "pthread_once failed: %s (errno:%d)\n",
+                   strerror (status), status);
+          cache->state = POOL_STATE_DISABLED;
+        }
+      else
+        cache->state = pool_enabled ? POOL_STATE_ENABLED : POOL_STATE_DISABLED;
+    }
+
+  return cache;
+}
+
+static void
+pool_cache_register (pool_cache_t *cache)
+{
+  if (pthread_setspecific (pool_cache_key, cache) == 0)
+    cache->registered = true;
+}
+
+/* Carves a new block of @size_class out of the current slab */
+static pool_block_t *
+pool_carve_locked (unsigned int size_class)
+{
+  size_t block_size = POOL_HEADER_SIZE + pool_class_sizes[size_class];
+  pool_header_t *header;
+  char *mem;
+
+  if (pool_slab_left < block_size)
+    {
+      pool_slab = system_aligned_alloc (POOL_SLAB_SIZE, POOL_MAX_ALIGNMENT);
+      pool_slab_left = pool_slab != NULL ? POOL_SLAB_SIZE : 0;
+
+      if (pool_slab == NULL)
+        return NULL;
+    }
+
+  mem = pool_slab + POOL_HEADER_SIZE;
+  pool_slab += block_size;
+  pool_slab_left -= block_size;
+
+  header = pool_get_header (mem);
+  header->size_class = size_class + 1;
+  header->offset = POOL_HEADER_SIZE;
+
+  return (pool_block_t *) mem;
+}
+
+/* Refills the empty cache of @size_class with a batch of blocks, and
+ * returns one of them
+ */
+static void *
+pool_refill (pool_cache_t *cache,
+             unsigned int  size_class)
+{
+  pool_block_t *res;
+
+  if (!cache->registered)
+    pool_cache_register (cache);
+
+  pthread_mutex_lock (&pool_lock);
+
+  cache->misses += 1;
+  pool_collect_stats_locked (cache);
+
+  res = pool_blocks[size_class];
+  if (res != NULL)
+    {
+      pool_block_t *last = res;
+      unsigned int n = 0;
+
+      /* Take the first block, and up to a batch for the cache */
+      while (n < POOL_BATCH_SIZE && last->next != NULL)
+        {
+          last = last->next;
+          n += 1;
+        }
+
+      pool_blocks[size_class] = last->next;
+      last->next = NULL;
+
+      cache->blocks[size_class] = res->next;
+      cache->n_blocks[size_class] = n;
+    }
+  else
+    {
+      res = pool_carve_locked (size_class);
+
+      for (unsigned int i = 0; res != NULL && i < POOL_BATCH_SIZE; i++)
+        {
+          pool_block_t *block = pool_carve_locked (size_class);
+
+          if (block == NULL)
+            break;
+
+          block->next = cache->blocks[size_class];
+          cache->blocks[size_class] = block;
+          cache->n_blocks[size_class] += 1;
+        }
+    }
+
+  pthread_mutex_unlock (&pool_lock);
+
+  return res;
+}
+
+static inline void *
+pool_alloc (pool_cache_t *cache,
+            unsigned int  size_class)
+{
+  pool_block_t *block = cache->blocks[size_class];
+
+  if (block == NULL)
+    return pool_refill (cache, size_class);
+
+  cache->blocks[size_class] = block->next;
+  cache->n_blocks[size_class] -= 1;
+  cache->hits += 1;
+
+  return block;
+}
+
+static inline void
+pool_free (void         *mem,
+           unsigned int  size_class)
+{
+  pool_cache_t *cache = pool_get_cache ();
+  pool_block_t *block = mem;
+
+  if (!cache->registered)
+    pool_cache_register (cache);
+
+  block->next = cache->blocks[size_class];
+  cache->blocks[size_class] = block;
+  cache->n_blocks[size_class] += 1;
+
+  if (cache->n_blocks[size_class] > POOL_CACHE_SIZE)
+    {
+      pthread_mutex_lock (&pool_lock);
+      pool_release_locked (cache, size_class, POOL_BATCH_SIZE);
+      pool_collect_stats_locked (cache);
+      pthread_mutex_unlock (&pool_lock);
+    }
+}
+
+/* Allocates memory from the system, preceded by a header */
+static void *
+pool_system_alloc (size_t real_size,
+                   size_t alignment)
+{
+  size_t offset = MAX (alignment, POOL_HEADER_SIZE);
+  pool_header_t *header;
+  char *res;
+
+  if (real_size > (size_t) -1 - offset)
+    {
+#ifndef G_DISABLE_ASSERT
+      fprintf (stderr, "Overflow in the allocation of %lu bytes\n",
+               (unsigned long) real_size);
+      abort ();
+#else
+      return NULL;
+#endif
+    }
+
+  res = system_aligned_alloc (real_size + offset, alignment);
+  if (res == NULL)
+    return NULL;
+
+  res += offset;
+
+  header = pool_get_header (res);
+  header->size_class = 0;
+  header->offset = (uint32_t) offset;
+
+  return res;
+}
+#endif /* USE_ALLOC_POOL */
+
 /*< private >
  * graphene_aligned_alloc:
  * @size: the size of the memory to allocate
@@ -58,6 +500,9 @@
  *
  * Allocates @number times @size memory, with the given @alignment.
  *
+ * Allocations of up to 128 bytes, with an alignment of up to 16 bytes,
+ * are served from the free lists of the pool.
+ *
  * If the total requested memory overflows %G_MAXSIZE, this function
  * will abort.
  *
@@ -71,7 +516,6 @@ graphene_aligned_alloc (size_t size,
                         size_t number,
                         size_t alignment)
 {
-  void *res = NULL;
   size_t max_size = (size_t) -1;
   size_t real_size;
 
@@ -93,36 +537,19 @@ graphene_aligned_alloc (size_t size,
 
   real_size = size * number;
 
-#ifndef G_DISABLE_ASSERT
-  errno = 0;
-#endif
-
-#if defined(HAVE_POSIX_MEMALIGN)
-  errno = posix_memalign (&res, alignment, real_size);
-#elif defined(HAVE_ALIGNED_ALLOC) || defined(HAVE__ALIGNED_MALLOC)
-  /* real_size must be a multiple of alignment */
-  if (real_size % alignment != 0)
+#ifdef USE_ALLOC_POOL
+  if (real_size <= POOL_MAX_SIZE && alignment <= POOL_MAX_ALIGNMENT)
     {
-      size_t offset = real_size % alignment;
-      real_size += (alignment - offset);
+      pool_cache_t *cache = pool_get_cache ();
+
+      if (cache->state == POOL_STATE_ENABLED)
+        return pool_alloc (cache, pool_size_classes[(real_size + 15) / 16]);
     }
 
-  res = aligned_alloc (alignment, real_size);
-#elif defined(HAVE_MEMALIGN)
-  res = memalign (alignment, real_size);
+  return pool_system_alloc (real_size, alignment);
 #else
-  res = malloc (real_size);
-#endif
-
-#ifndef G_DISABLE_ASSERT
-  if (errno != 0 || res == NULL)
-    {
-      fprintf (stderr, "Allocation error: %s\n", strerror (errno));
-      abort ();
-    }
+  return system_aligned_alloc (real_size, alignment);
 #endif
-
-  return res;
 }
 
 /*< private >
@@ -158,5 +585,421 @@ graphene_aligned_alloc0 (size_t size,
 void
 graphene_aligned_free (void *mem)
 {
+#ifdef USE_ALLOC_POOL
+  pool_header_t *header;
+
+  if (mem == NULL)
+    return;
+
+  header = pool_get_header (mem);
+  if (header->size_class != 0)
+    pool_free (mem, header->size_class - 1);
+  else
+    aligned_free ((char *) mem - header->offset);
+#else
   aligned_free (mem);
+#endif
 }
+
+/**
+ * graphene_alloc_get_stats:
+ * @stats: (out caller-allocates): return location for the counters
+ *
+ * Retrieves the counters of the allocator.
+ *
+ * The counters of each thread are collected whenever the thread goes
+ * through the shared pool, and when it exits; the counters of the
+ * calling thread are always up to date.
+ *
+ * If the pool is disabled, all the counters are zero.
+ *
+ * Since: 1.12
+ */
+void
+graphene_alloc_get_stats (graphene_alloc_stats_t *stats)
+{
+#ifdef USE_ALLOC_POOL
+  pool_cache_t *cache = pool_get_cache ();
+
+  pthread_mutex_lock (&pool_lock);
+  pool_collect_stats_locked (cache);
+  stats->hits = pool_hits;
+  stats->misses = pool_misses;
+  pthread_mutex_unlock (&pool_lock);
+#else
+  stats->hits = 0;
+  stats->misses = 0;
+#endif
+}
+
+/* The arena hands out memory from a list of blocks; the data of each
+ * block starts ARENA_BLOCK_HEADER bytes after the block, so that it is
+ * aligned to GRAPHENE_ARENA_MAX_ALIGNMENT
+ */
+typedef struct _arena_block_t   arena_block_t;
+
+struct _arena_block_t
+{
+  arena_block_t *next;
+  size_t size;
+};
+
+#define ARENA_BLOCK_HEADER      GRAPHENE_ARENA_MAX_ALIGNMENT
+#define ARENA_BLOCK_DATA(b)     ((char *) (b) + ARENA_BLOCK_HEADER)
+
+#define ARENA_DEFAULT_BLOCK_SIZE        (64 * 1024)
+
+struct _graphene_arena_t
+{
+  /* The current block is the first of the list */
+  arena_block_t *blocks;
+
+  char *ptr;
+  char *end;
+
+  size_t block_size;
+
+  /* The size of the blocks before the current one */
+  size_t n_used;
+};
+
+static arena_block_t *
+arena_block_new (size_t size)
+{
+  arena_block_t *res;
+
+  if (size > (size_t) -1 - ARENA_BLOCK_HEADER)
+    {
+#ifndef G_DISABLE_ASSERT
+      fprintf (stderr, "Overflow in the allocation of %lu bytes\n",
+               (unsigned long) size);
+      abort ();
+#else
+      return NULL;
+#endif
+    }
+
+  res = graphene_aligned_alloc (ARENA_BLOCK_HEADER + size, 1, GRAPHENE_ARENA_MAX_ALIGNMENT);
+  if (res == NULL)
+    return NULL;
+
+  res->next = NULL;
+  res->size = size;
+
+  return res;
+}
+
+static void
+arena_use_block (graphene_arena_t *arena,
+                 arena_block_t    *block)
+{
+  arena->ptr = ARENA_BLOCK_DATA (block);
+  arena->end = arena->ptr + block->size;
+}
+
+/**
+ * graphene_arena_new:
+ * @block_size: the size of the blocks of memory of the arena, in bytes;
+ *   or 0 to use the default size
+ *
+ * Creates a new #graphene_arena_t.
+ *
+ * The arena allocates memory in blocks of @block_size bytes; allocations
+ * larger than @block_size get a block of their own.
+ *
+ * Returns: (transfer full): the newly created #graphene_arena_t. Use
+ *   graphene_arena_free() to free the resources allocated by this function
+ *
+ * Since: 1.12
+ */
+graphene_arena_t *
+graphene_arena_new (size_t block_size)
+{
+  graphene_arena_t *res = graphene_aligned_alloc0 (sizeof (graphene_arena_t), 1, 16);
+
+  res->block_size = block_size > 0 ? block_size : ARENA_DEFAULT_BLOCK_SIZE;
+  res->blocks = arena_block_new (res->block_size);
+  if (res->blocks != NULL)
+    arena_use_block (res, res->blocks);
+
+  return res;
+}
+
+/**
+ * graphene_arena_free:
+ * @arena: a #graphene_arena_t
+ *
+ * Frees the resources allocated by graphene_arena_new(), including all
+ * the memory allocated from @arena.
+ *
+ * Since: 1.12
+ */
+void
+graphene_arena_free (graphene_arena_t *arena)
+{
+  arena_block_t *block;
+
+  if (arena == NULL)
+    return;
+
+  block = arena->blocks;
+  while (block != NULL)
+    {
+      arena_block_t *next = block->next;
+
+      graphene_aligned_free (block);
+      block = next;
+    }
+
+  graphene_aligned_free (arena);
+}
+
+static void *
+arena_alloc_slow (graphene_arena_t *arena,
+                  size_t            size,
+                  size_t            alignment)
+{
+  arena_block_t *block = arena_block_new (MAX (size, arena->block_size));
+  char *res;
+
+  if (block == NULL)
+    return NULL;
+
+  if (arena->blocks != NULL)
+    arena->n_used += arena->blocks->size;
+
+  block->next = arena->blocks;
+  arena->blocks = block;
+  arena_use_block (arena, block);
+
+  /* The data of a block is aligned to the largest alignment */
+  res = arena->ptr;
+  arena->ptr += size;
+
+  return res;
+}
+
+/**
+ * graphene_arena_alloc:
+ * @arena: a #graphene_arena_t
+ * @size: the size of the memory to allocate, in bytes
+ * @alignment: the alignment of the memory, as a power of two no larger
+ *   than %GRAPHENE_ARENA_MAX_ALIGNMENT; or 0 for an alignment of 16 bytes
+ *
+ * Allocates @size bytes from @arena.
+ *
+ * The returned memory is not initialized, and it is valid until @arena
+ * is reset with graphene_arena_reset(), or freed.
+ *
+ * The alignment of 16 bytes is enough for all the Graphene types; types
+ * declared with `GRAPHENE_ALIGNED_DECL` may require an alignment of 32
+ * or 64 bytes.
+ *
+ * Returns: (transfer none) (nullable): the allocated memory, or %NULL
+ *   if @size is 0, or @alignment is not valid
+ *
+ * Since: 1.12
+ */
+void *
+graphene_arena_alloc (graphene_arena_t *arena,
+                      size_t            size,
+                      size_t            alignment)
+{
+  uintptr_t ptr;
+
+  if (alignment == 0)
+    alignment = 16;
+
+  if (size == 0 ||
+      alignment > GRAPHENE_ARENA_MAX_ALIGNMENT ||
+      (alignment & (alignment - 1)) != 0)
+    return NULL;
+
+  ptr = ((uintptr_t) arena->ptr + alignment - 1) & ~((uintptr_t) alignment - 1);
+  if (arena->ptr == NULL ||
+      ptr > (uintptr_t) arena->end ||
+      size > (uintptr_t) arena->end - ptr)
+    return arena_alloc_slow (arena, size, alignment);
+
+  arena->ptr = (char *) ptr + size;
+
+  return (void *) ptr;
+}
+
+/**
+ * graphene_arena_reset:
+ * @arena: a #graphene_arena_t
+ *
+ * Releases all the memory allocated from @arena at once, without
+ * returning it to the system, so that it can be reused by the next
+ * allocations.
+ *
+ * If the allocations since the last reset did not fit in a single block,
+ * the blocks are replaced by a single block large enough for all of them.
+ *
+ * Since: 1.12
+ */
+void
+graphene_arena_reset (graphene_arena_t *arena)
+{
+  arena_block_t *block = arena->blocks;
+
+  if (block == NULL)
+    return;
+
+  if (block->next != NULL)
+    {
+      size_t size = arena->n_used + block->size;
+
+      while (block != NULL)
+        {
+          arena_block_t *next = block->next;
+
+          graphene_aligned_free (block);
+          block = next;
+        }
+
+      block = arena->blocks = arena_block_new (size);
+      arena->n_used = 0;
+
+      if (block == NULL)
+        {
+          arena->ptr = arena->end = NULL;
+          return;
+        }
+    }
+
+  arena_use_block (arena, block);
+}
+
+/**
+ * graphene_arena_get_size:
+ * @arena: a #graphene_arena_t
+ *
+ * Retrieves the amount of memory owned by @arena, in bytes.
+ *
+ * Returns: the size of the blocks of the arena
+ *
+ * Since: 1.12
+ */
+size_t
+graphene_arena_get_size (const graphene_arena_t *arena)
+{
+  return arena->n_used + (arena->blocks != NULL ? arena->blocks->size : 0);
+}
+
+#define GRAPHENE_DEFINE_ARENA_NEW(type_name) \
+  graphene_ ## type_name ## _t * \
+  graphene_arena_new_ ## type_name (graphene_arena_t *arena) \
+  { \
+    return graphene_arena_alloc (arena, sizeof (graphene_ ## type_name ## _t), 16); \
+  }
+
+/**
+ * graphene_arena_new_vec2:
+ * @arena: a #graphene_arena_t
+ *
+ * Allocates a #graphene_vec2_t from @arena.
+ *
+ * Returns: (transfer none): the uninitialized #graphene_vec2_t
+ *
+ * Since: 1.12
+ */
+
+/**
+ * graphene_arena_new_vec3:
+ * @arena: a #graphene_arena_t
+ *
+ * Allocates a #graphene_vec3_t from @arena.
+ *
+ * Returns: (transfer none): the uninitialized #graphene_vec3_t
+ *
+ * Since: 1.12
+ */
+
+/**
+ * graphene_arena_new_vec4:
+ * @arena: a #graphene_arena_t
+ *
+ * Allocates a #graphene_vec4_t from @arena.
+ *
+ * Returns: (transfer none): the uninitialized #graphene_vec4_t
+ *
+ * Since: 1.12
+ */
+
+/**
+ * graphene_arena_new_point3d:
+ * @arena: a #graphene_arena_t
+ *
+ * Allocates a #graphene_point3d_t from @arena.
+ *
+ * Returns: (transfer none): the uninitialized #graphene_point3d_t
+ *
+ * Since: 1.12
+ */
+
+/**
+ * graphene_arena_new_matrix:
+ * @arena: a #graphene_arena_t
+ *
+ * Allocates a #graphene_matrix_t from @arena.
+ *
+ * Returns: (transfer none): the uninitialized #graphene_matrix_t
+ *
+ * Since: 1.12
+ */
+
+/**
+ * graphene_arena_new_quaternion:
+ * @arena: a #graphene_arena_t
+ *
+ * Allocates a #graphene_quaternion_t from @arena.
+ *
+ * Returns: (transfer none): the uninitialized #graphene_quaternion_t
+ *
+ * Since: 1.12
+ */
+
+/**
+ * graphene_arena_new_box:
+ * @arena: a #graphene_arena_t
+ *
+ * Allocates a #graphene_box_t from @arena.
+ *
+ * Returns: (transfer none): the uninitialized #graphene_box_t
+ *
+ * Since: 1.12
+ */
+
+/**
+ * graphene_arena_new_sphere:
+ * @arena: a #graphene_arena_t
+ *
+ * Allocates a #graphene_sphere_t from @arena.
+ *
+ * Returns: (transfer none): the uninitialized #graphene_sphere_t
+ *
+ * Since: 1.12
+ */
+
+/**
+ * graphene_arena_new_ray:
+ * @arena: a #graphene_arena_t
+ *
+ * Allocates a #graphene_ray_t from @arena.
+ *
+ * Returns: (transfer none): the uninitialized #graphene_ray_t
+ *
+ * Since: 1.12
+ */
+
+GRAPHENE_DEFINE_ARENA_NEW (vec2)
+GRAPHENE_DEFINE_ARENA_NEW (vec3)
+GRAPHENE_DEFINE_ARENA_NEW (vec4)
+GRAPHENE_DEFINE_ARENA_NEW (point3d)
+GRAPHENE_DEFINE_ARENA_NEW (matrix)
+GRAPHENE_DEFINE_ARENA_NEW (quaternion)
+GRAPHENE_DEFINE_ARENA_NEW (box)
+GRAPHENE_DEFINE_ARENA_NEW (sphere)
+GRAPHENE_DEFINE_ARENA_NEW (ray)
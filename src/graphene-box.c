@@ -37,9 +37,12 @@
 #include "graphene-box.h"
 
 #include "graphene-alloc-private.h"
+#include "graphene-kernels-private.h"
+#include "graphene-parallel-private.h"
 #include "graphene-point3d.h"
 #include "graphene-simd4f.h"
 #include "graphene-sphere.h"
+#include "graphene-strided-private.h"
 
 #include <math.h>
 #include <stdio.h>
@@ -112,6 +115,62 @@ graphene_box_init (graphene_box_t           *box,
   return box;
 }
 
+/* Number of per-chunk bounds stored on the stack */
+#define BOX_STACK_CHUNKS        64
+
+typedef struct {
+  const graphene_strided_view_t *points;
+  graphene_box_t *bounds;
+} box_bounds_batch_t;
+
+static void
+box_strided_range (unsigned int  chunk,
+                   unsigned int  first,
+                   unsigned int  n_items,
+                   void         *data)
+{
+  const box_bounds_batch_t *batch = data;
+  graphene_strided_view_t slice = graphene_strided_view_slice (batch->points, first, n_items);
+
+  graphene_get_kernels ()->box_bounds_strided (&slice, &batch->bounds[chunk]);
+}
+
+/* Computes the bounds of each chunk of the view, possibly in parallel,
+ * and then combines them in order
+ */
+static graphene_box_t *
+box_init_from_strided (graphene_box_t                *box,
+                       const graphene_strided_view_t *points)
+{
+  unsigned int n_items = graphene_strided_view_get_n_elements (points);
+  unsigned int chunk_size = graphene_parallel_chunk_size (graphene_strided_view_item_size (points));
+  unsigned int n_chunks = graphene_parallel_get_n_chunks (n_items, chunk_size);
+  graphene_box_t stack_bounds[BOX_STACK_CHUNKS];
+  box_bounds_batch_t batch = { points, box };
+
+  if (n_chunks <= 1)
+    {
+      box_strided_range (0, 0, n_items, &batch);
+      return box;
+    }
+
+  if (n_chunks <= BOX_STACK_CHUNKS)
+    batch.bounds = stack_bounds;
+  else
+    batch.bounds = graphene_aligned_alloc (sizeof (graphene_box_t), n_chunks, 16);
+
+  graphene_parallel_for (n_items, chunk_size, box_strided_range, &batch);
+
+  graphene_box_init_from_box (box, &batch.bounds[0]);
+  for (unsigned int i = 1; i < n_chunks; i++)
+    graphene_box_union (box, &batch.bounds[i], box);
+
+  if (batch.bounds != stack_bounds)
+    graphene_aligned_free (batch.bounds);
+
+  return box;
+}
+
 /**
  * graphene_box_init_from_points:
  * @box: the #graphene_box_t to initialize
@@ -133,17 +192,10 @@ graphene_box_init_from_points (graphene_box_t           *box,
                                unsigned int              n_points,
                                const graphene_point3d_t *points)
 {
-  graphene_box_init_from_box (box, graphene_box_empty ());
-
-  for (unsigned int i = 0; i < n_points; i++)
-    {
-      graphene_vec3_t v;
-
-      graphene_point3d_to_vec3 (&points[i], &v);
-      graphene_box_expand_vec3 (box, &v, box);
-    }
+  graphene_strided_view_t view =
+    GRAPHENE_STRIDED_VIEW_INIT ((void *) points, sizeof (graphene_point3d_t), 3, n_points);
 
-  return box;
+  return box_init_from_strided (box, &view);
 }
 
 /**
@@ -167,12 +219,64 @@ graphene_box_init_from_vectors (graphene_box_t        *box,
                                 unsigned int           n_vectors,
                                 const graphene_vec3_t *vectors)
 {
-  graphene_box_init_from_box (box, graphene_box_empty ());
+  graphene_strided_view_t view =
+    GRAPHENE_STRIDED_VIEW_INIT ((void *) vectors, sizeof (graphene_vec3_t), 3, n_vectors);
 
-  for (unsigned int i = 0; i < n_vectors; i++)
-    graphene_box_expand_vec3 (box, &vectors[i], box);
+  return box_init_from_strided (box, &view);
+}
 
-  return box;
+/**
+ * graphene_box_init_from_float_array:
+ * @box: the #graphene_box_t to initialize
+ * @n_points: the number of points in the @points array
+ * @points: (array): an array of `3 * n_points` floating point values,
+ *   with the x, y, and z coordinates of each point
+ *
+ * Initializes the given #graphene_box_t with the given array of
+ * packed point coordinates, like the positions of a point cloud.
+ *
+ * If @n_points is 0, the returned box is initialized with
+ * graphene_box_empty().
+ *
+ * Returns: (transfer none): the initialized #graphene_box_t
+ *
+ * Since: 1.12
+ */
+graphene_box_t *
+graphene_box_init_from_float_array (graphene_box_t *box,
+                                    unsigned int    n_points,
+                                    const float    *points)
+{
+  graphene_strided_view_t view =
+    GRAPHENE_STRIDED_VIEW_INIT ((void *) points, sizeof (float) * 3, 3, n_points);
+
+  return box_init_from_strided (box, &view);
+}
+
+/**
+ * graphene_box_init_from_strided:
+ * @box: the #graphene_box_t to initialize
+ * @points: a #graphene_strided_view_t
+ *
+ * Initializes the given #graphene_box_t with the points of a
+ * strided view, for instance the positions inside a buffer of
+ * interleaved vertex attributes.
+ *
+ * Points with two components are on the z = 0 plane, and the
+ * fourth component of points with four components is ignored.
+ *
+ * If @points is empty, the returned box is initialized with
+ * graphene_box_empty().
+ *
+ * Returns: (transfer none): the initialized #graphene_box_t
+ *
+ * Since: 1.12
+ */
+graphene_box_t *
+graphene_box_init_from_strided (graphene_box_t                *box,
+                                const graphene_strided_view_t *points)
+{
+  return box_init_from_strided (box, points);
 }
 
 /**
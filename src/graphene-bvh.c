@@ -0,0 +1,974 @@
+/* graphene-bvh.c: Bounding volume hierarchy
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-bvh
+ * @Title: Bounding volume hierarchy
+ * @Short_Description: Accelerate spatial queries over many primitives
+ *
+ * #graphene_bvh_t is an immutable tree of axis aligned bounding boxes,
+ * built over an array of #graphene_box_t or an indexed triangle mesh,
+ * that accelerates queries over the primitives it contains.
+ *
+ * The tree is built using the surface area heuristic (SAH), and can be
+ * used to find the closest primitive hit by a #graphene_ray_t, to check
+ * whether any primitive is hit by a ray, and to find the primitives
+ * overlapping a #graphene_box_t or inside a #graphene_frustum_t.
+ *
+ * Primitives are identified by their index in the array used to build
+ * the #graphene_bvh_t; for triangle meshes, the index of a triangle is
+ * the index of its first vertex index, divided by three.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-bvh.h"
+
+#include "graphene-alloc-private.h"
+#include "graphene-box.h"
+#include "graphene-frustum.h"
+#include "graphene-point3d.h"
+#include "graphene-ray.h"
+#include "graphene-simd4f.h"
+#include "graphene-triangle.h"
+#include "graphene-vec3.h"
+
+#include <math.h>
+#include <float.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Number of buckets used to evaluate the SAH along each axis */
+#define BVH_N_BINS              16
+
+/* Nodes with at most this many primitives become leaves if splitting
+ * them is not cheaper
+ */
+#define BVH_MAX_LEAF_SIZE       4
+
+/* Relative cost of traversing a node, compared to the intersection of
+ * a primitive
+ */
+#define BVH_TRAVERSAL_COST      1.f
+
+/* Size of the traversal stacks allocated on the stack; deeper trees
+ * use a heap allocation
+ */
+#define BVH_STACK_SIZE          64
+
+typedef enum {
+  BVH_PRIMITIVE_BOX,
+  BVH_PRIMITIVE_TRIANGLE
+} bvh_primitive_t;
+
+typedef struct {
+  graphene_box_t bounds;
+
+  /* For leaves, the first primitive; for interior nodes, the first
+   * child, with the second child following it
+   */
+  unsigned int first;
+
+  /* The number of primitives of a leaf, or 0 for interior nodes */
+  unsigned int count;
+} bvh_node_t;
+
+struct _graphene_bvh_t
+{
+  bvh_primitive_t primitive;
+
+  unsigned int n_primitives;
+  unsigned int n_nodes;
+  unsigned int depth;
+
+  bvh_node_t *nodes;
+
+  /* The primitives, sorted in leaf order, and their original indices */
+  unsigned int *ids;
+  graphene_box_t *boxes;
+  graphene_triangle_t *triangles;
+};
+
+typedef struct {
+  unsigned int node;
+  unsigned int first;
+  unsigned int count;
+  unsigned int depth;
+} bvh_build_task_t;
+
+typedef struct {
+  graphene_simd4f_t min;
+  graphene_simd4f_t max;
+  unsigned int count;
+} bvh_bin_t;
+
+static inline float
+bvh_area (graphene_simd4f_t min,
+          graphene_simd4f_t max)
+{
+  graphene_simd4f_t size = graphene_simd4f_sub (max, min);
+  float x = graphene_simd4f_get_x (size);
+  float y = graphene_simd4f_get_y (size);
+  float z = graphene_simd4f_get_z (size);
+
+  return 2.f * (x * y + y * z + z * x);
+}
+
+static inline float
+bvh_get_axis (graphene_simd4f_t v,
+              int               axis)
+{
+  switch (axis)
+    {
+    case 0:
+      return graphene_simd4f_get_x (v);
+    case 1:
+      return graphene_simd4f_get_y (v);
+    default:
+      return graphene_simd4f_get_z (v);
+    }
+}
+
+static inline unsigned int
+bvh_get_bin (float c,
+             float c_min,
+             float scale)
+{
+  int bin = (int) ((c - c_min) * scale);
+
+  return (unsigned int) CLAMP (bin, 0, BVH_N_BINS - 1);
+}
+
+/* Finds the cheapest split of the primitives in [first, first + count)
+ * using binned SAH; returns false if no split is cheaper than a leaf
+ */
+static bool
+bvh_find_split (const graphene_box_t  *bounds,
+                const graphene_vec3_t *centroids,
+                const unsigned int    *ids,
+                unsigned int           first,
+                unsigned int           count,
+                float                  node_area,
+                graphene_simd4f_t      c_min,
+                graphene_simd4f_t      c_max,
+                int                   *axis_out,
+                unsigned int          *bin_out,
+                float                 *scale_out)
+{
+  float best_cost = (float) count * node_area;
+  bool found = false;
+
+  for (int axis = 0; axis < 3; axis++)
+    {
+      bvh_bin_t bins[BVH_N_BINS];
+      float right_area[BVH_N_BINS];
+      unsigned int right_count[BVH_N_BINS];
+      float axis_min = bvh_get_axis (c_min, axis);
+      float extent = bvh_get_axis (c_max, axis) - axis_min;
+      graphene_simd4f_t min, max;
+      unsigned int n;
+      float scale;
+
+      if (extent <= FLT_EPSILON)
+        continue;
+
+      scale = (float) BVH_N_BINS / extent;
+
+      for (int i = 0; i < BVH_N_BINS; i++)
+        {
+          bins[i].min = graphene_simd4f_splat (FLT_MAX);
+          bins[i].max = graphene_simd4f_splat (-FLT_MAX);
+          bins[i].count = 0;
+        }
+
+      for (unsigned int i = first; i < first + count; i++)
+        {
+          unsigned int id = ids[i];
+          float c = bvh_get_axis (centroids[id].value, axis);
+          bvh_bin_t *bin = &bins[bvh_get_bin (c, axis_min, scale)];
+
+          bin->min = graphene_simd4f_min (bin->min, bounds[id].min.value);
+          bin->max = graphene_simd4f_max (bin->max, bounds[id].max.value);
+          bin->count += 1;
+        }
+
+      /* Sweep from the right to accumulate the right side of each split */
+      min = graphene_simd4f_splat (FLT_MAX);
+      max = graphene_simd4f_splat (-FLT_MAX);
+      n = 0;
+      for (int i = BVH_N_BINS - 1; i > 0; i--)
+        {
+          min = graphene_simd4f_min (min, bins[i].min);
+          max = graphene_simd4f_max (max, bins[i].max);
+          n += bins[i].count;
+
+          right_count[i] = n;
+          right_area[i] = n > 0 ? bvh_area (min, max) : 0.f;
+        }
+
+      /* Then sweep from the left, evaluating the split after each bin */
+      min = graphene_simd4f_splat (FLT_MAX);
+      max = graphene_simd4f_splat (-FLT_MAX);
+      n = 0;
+      for (int i = 0; i < BVH_N_BINS - 1; i++)
+        {
+          float cost;
+
+          min = graphene_simd4f_min (min, bins[i].min);
+          max = graphene_simd4f_max (max, bins[i].max);
+          n += bins[i].count;
+
+          if (n == 0 || right_count[i + 1] == 0)
+            continue;
+
+          cost = BVH_TRAVERSAL_COST * node_area
+               + (float) n * bvh_area (min, max)
+               + (float) right_count[i + 1] * right_area[i + 1];
+
+          if (cost < best_cost)
+            {
+              best_cost = cost;
+              *axis_out = axis;
+              *bin_out = (unsigned int) i;
+              *scale_out = scale;
+              found = true;
+            }
+        }
+    }
+
+  return found;
+}
+
+static void
+bvh_build (graphene_bvh_t        *bvh,
+           const graphene_box_t  *bounds,
+           const graphene_vec3_t *centroids)
+{
+  unsigned int *ids = bvh->ids;
+  bvh_build_task_t *stack;
+  unsigned int stack_size = 64;
+  unsigned int n_tasks = 0;
+
+  stack = graphene_aligned_alloc (sizeof (bvh_build_task_t), stack_size, 16);
+
+  bvh->n_nodes = 1;
+  stack[n_tasks++] = (bvh_build_task_t) { 0, 0, bvh->n_primitives, 1 };
+
+  while (n_tasks > 0)
+    {
+      bvh_build_task_t task = stack[--n_tasks];
+      bvh_node_t *node = &bvh->nodes[task.node];
+      graphene_simd4f_t min, max, c_min, c_max;
+      unsigned int split_bin = 0, mid;
+      int split_axis = 0;
+      float split_scale = 0.f;
+
+      min = c_min = graphene_simd4f_splat (FLT_MAX);
+      max = c_max = graphene_simd4f_splat (-FLT_MAX);
+
+      for (unsigned int i = task.first; i < task.first + task.count; i++)
+        {
+          unsigned int id = ids[i];
+
+          min = graphene_simd4f_min (min, bounds[id].min.value);
+          max = graphene_simd4f_max (max, bounds[id].max.value);
+          c_min = graphene_simd4f_min (c_min, centroids[id].value);
+          c_max = graphene_simd4f_max (c_max, centroids[id].value);
+        }
+
+      node->bounds.min.value = min;
+      node->bounds.max.value = max;
+      node->first = task.first;
+      node->count = task.count;
+
+      bvh->depth = MAX (bvh->depth, task.depth);
+
+      if (task.count == 1)
+        continue;
+
+      if (bvh_find_split (bounds, centroids, ids,
+                          task.first, task.count,
+                          bvh_area (min, max),
+                          c_min, c_max,
+                          &split_axis, &split_bin, &split_scale))
+        {
+          float axis_min = bvh_get_axis (c_min, split_axis);
+          unsigned int i = task.first;
+          unsigned int j = task.first + task.count;
+
+          /* Partition the primitives in place */
+          while (i < j)
+            {
+              float c = bvh_get_axis (centroids[ids[i]].value, split_axis);
+
+              if (bvh_get_bin (c, axis_min, split_scale) <= split_bin)
+                i += 1;
+              else
+                {
+                  unsigned int tmp = ids[i];
+
+                  ids[i] = ids[--j];
+                  ids[j] = tmp;
+                }
+            }
+
+          mid = i;
+        }
+      else if (task.count <= BVH_MAX_LEAF_SIZE)
+        continue;
+      else
+        {
+          /* Splitting is not cheaper, or all the centroids are in the
+           * same place, but the leaf would be too big
+           */
+          mid = task.first + task.count / 2;
+        }
+
+      if (mid == task.first || mid == task.first + task.count)
+        mid = task.first + task.count / 2;
+
+      node->first = bvh->n_nodes;
+      node->count = 0;
+      bvh->n_nodes += 2;
+
+      if (n_tasks + 2 > stack_size)
+        {
+          bvh_build_task_t *tmp = graphene_aligned_alloc (sizeof (bvh_build_task_t), stack_size * 2, 16);
+
+          memcpy (tmp, stack, sizeof (bvh_build_task_t) * n_tasks);
+          graphene_aligned_free (stack);
+
+          stack = tmp;
+          stack_size *= 2;
+        }
+
+      stack[n_tasks++] = (bvh_build_task_t) { node->first + 1, mid, task.first + task.count - mid, task.depth + 1 };
+      stack[n_tasks++] = (bvh_build_task_t) { node->first, task.first, mid - task.first, task.depth + 1 };
+    }
+
+  graphene_aligned_free (stack);
+}
+
+static graphene_bvh_t *
+bvh_new (bvh_primitive_t primitive,
+         unsigned int    n_primitives)
+{
+  graphene_bvh_t *res = graphene_aligned_alloc0 (sizeof (graphene_bvh_t), 1, 16);
+
+  res->primitive = primitive;
+  res->n_primitives = n_primitives;
+
+  if (n_primitives > 0)
+    {
+      /* A binary tree with n leaves has 2n - 1 nodes */
+      res->nodes = graphene_aligned_alloc (sizeof (bvh_node_t), 2 * (size_t) n_primitives, 16);
+      res->ids = graphene_aligned_alloc (sizeof (unsigned int), n_primitives, 16);
+
+      for (unsigned int i = 0; i < n_primitives; i++)
+        res->ids[i] = i;
+    }
+
+  return res;
+}
+
+static inline void
+bvh_triangle_bounds (const graphene_triangle_t *t,
+                     graphene_box_t            *res)
+{
+  graphene_simd4f_t min = graphene_simd4f_min (t->a.value, t->b.value);
+  graphene_simd4f_t max = graphene_simd4f_max (t->a.value, t->b.value);
+
+  res->min.value = graphene_simd4f_min (min, t->c.value);
+  res->max.value = graphene_simd4f_max (max, t->c.value);
+}
+
+static void
+bvh_compute_centroids (unsigned int           n_primitives,
+                       const graphene_box_t  *bounds,
+                       graphene_vec3_t       *centroids)
+{
+  const graphene_simd4f_t half = graphene_simd4f_splat (0.5f);
+
+  for (unsigned int i = 0; i < n_primitives; i++)
+    centroids[i].value = graphene_simd4f_mul (graphene_simd4f_add (bounds[i].min.value,
+                                                                   bounds[i].max.value),
+                                              half);
+}
+
+/**
+ * graphene_bvh_new_from_boxes:
+ * @n_boxes: the number of boxes
+ * @boxes: (array length=n_boxes): an array of #graphene_box_t
+ *
+ * Builds a new #graphene_bvh_t over the given boxes.
+ *
+ * The boxes are copied, so the @boxes array can be freed afterwards.
+ *
+ * Returns: (transfer full): the newly created #graphene_bvh_t. Use
+ *   graphene_bvh_free() to free the resources allocated by this function
+ *
+ * Since: 1.12
+ */
+graphene_bvh_t *
+graphene_bvh_new_from_boxes (unsigned int          n_boxes,
+                             const graphene_box_t *boxes)
+{
+  graphene_bvh_t *res = bvh_new (BVH_PRIMITIVE_BOX, n_boxes);
+  graphene_vec3_t *centroids;
+
+  if (n_boxes == 0)
+    return res;
+
+  centroids = graphene_aligned_alloc (sizeof (graphene_vec3_t), n_boxes, 16);
+  bvh_compute_centroids (n_boxes, boxes, centroids);
+
+  bvh_build (res, boxes, centroids);
+
+  graphene_aligned_free (centroids);
+
+  /* Store the boxes in leaf order, to improve locality */
+  res->boxes = graphene_aligned_alloc (sizeof (graphene_box_t), n_boxes, 16);
+  for (unsigned int i = 0; i < n_boxes; i++)
+    graphene_box_init_from_box (&res->boxes[i], &boxes[res->ids[i]]);
+
+  return res;
+}
+
+/**
+ * graphene_bvh_new_from_triangles:
+ * @n_vertices: the number of vertices
+ * @vertices: (array length=n_vertices): an array of #graphene_point3d_t
+ * @n_indices: the number of indices; must be a multiple of 3
+ * @indices: (array length=n_indices): an array of indices in the
+ *   @vertices array, three for each triangle
+ *
+ * Builds a new #graphene_bvh_t over the triangles of an indexed mesh.
+ *
+ * Each index must be smaller than @n_vertices; if an index is out of
+ * range, a warning is printed and no BVH is built. The triangles are
+ * copied, so the @vertices and @indices arrays can be freed afterwards.
+ * If @n_vertices is 0, the BVH is empty.
+ *
+ * Returns: (transfer full) (nullable): the newly created #graphene_bvh_t,
+ *   or %NULL if the indices are out of range. Use graphene_bvh_free() to
+ *   free the resources allocated by this function
+ *
+ * Since: 1.12
+ */
+graphene_bvh_t *
+graphene_bvh_new_from_triangles (unsigned int              n_vertices,
+                                 const graphene_point3d_t *vertices,
+                                 unsigned int              n_indices,
+                                 const unsigned int       *indices)
+{
+  unsigned int n_triangles = n_indices / 3;
+  graphene_bvh_t *res;
+  graphene_triangle_t *triangles;
+  graphene_vec3_t *centroids;
+  graphene_box_t *bounds;
+
+  if (n_vertices == 0)
+    n_triangles = 0;
+
+  for (unsigned int i = 0; i < n_triangles * 3; i++)
+    {
+      if (indices[i] >= n_vertices)
+        {
+          fprintf (stderr, "graphene_bvh_new_from_triangles: index %u at position %u "
+                           "is out of range for %u vertices\n",
+                   indices[i], i, n_vertices);
+          return NULL;
+        }
+    }
+
+  res = bvh_new (BVH_PRIMITIVE_TRIANGLE, n_triangles);
+  if (n_triangles == 0)
+    return res;
+
+  triangles = graphene_aligned_alloc (sizeof (graphene_triangle_t), n_triangles, 16);
+  bounds = graphene_aligned_alloc (sizeof (graphene_box_t), n_triangles, 16);
+  centroids = graphene_aligned_alloc (sizeof (graphene_vec3_t), n_triangles, 16);
+
+  for (unsigned int i = 0; i < n_triangles; i++)
+    {
+      graphene_triangle_t *t = &triangles[i];
+
+      graphene_triangle_init_from_point3d (t,
+                                           &vertices[indices[i * 3 + 0]],
+                                           &vertices[indices[i * 3 + 1]],
+                                           &vertices[indices[i * 3 + 2]]);
+
+      bvh_triangle_bounds (t, &bounds[i]);
+    }
+
+  bvh_compute_centroids (n_triangles, bounds, centroids);
+
+  bvh_build (res, bounds, centroids);
+
+  graphene_aligned_free (centroids);
+  graphene_aligned_free (bounds);
+
+  /* Store the triangles in leaf order, to improve locality */
+  res->triangles = graphene_aligned_alloc (sizeof (graphene_triangle_t), n_triangles, 16);
+  for (unsigned int i = 0; i < n_triangles; i++)
+    res->triangles[i] = triangles[res->ids[i]];
+
+  graphene_aligned_free (triangles);
+
+  return res;
+}
+
+/**
+ * graphene_bvh_free:
+ * @bvh: a #graphene_bvh_t
+ *
+ * Frees the resources allocated by graphene_bvh_new_from_boxes()
+ * and graphene_bvh_new_from_triangles().
+ *
+ * Since: 1.12
+ */
+void
+graphene_bvh_free (graphene_bvh_t *bvh)
+{
+  if (bvh == NULL)
+    return;
+
+  graphene_aligned_free (bvh->nodes);
+  graphene_aligned_free (bvh->ids);
+  graphene_aligned_free (bvh->boxes);
+  graphene_aligned_free (bvh->triangles);
+  graphene_aligned_free (bvh);
+}
+
+/**
+ * graphene_bvh_get_n_primitives:
+ * @bvh: a #graphene_bvh_t
+ *
+ * Retrieves the number of primitives in the hierarchy.
+ *
+ * Returns: the number of boxes or triangles
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_bvh_get_n_primitives (const graphene_bvh_t *bvh)
+{
+  return bvh->n_primitives;
+}
+
+/**
+ * graphene_bvh_get_bounds:
+ * @bvh: a #graphene_bvh_t
+ * @bounds: (out caller-allocates): return location for the bounds
+ *
+ * Retrieves the box containing all the primitives in the hierarchy.
+ *
+ * If the hierarchy is empty, @bounds is set to graphene_box_empty().
+ *
+ * Since: 1.12
+ */
+void
+graphene_bvh_get_bounds (const graphene_bvh_t *bvh,
+                         graphene_box_t       *bounds)
+{
+  if (bvh->n_nodes == 0)
+    graphene_box_init_from_box (bounds, graphene_box_empty ());
+  else
+    graphene_box_init_from_box (bounds, &bvh->nodes[0].bounds);
+}
+
+static inline void
+bvh_get_primitive_bounds (const graphene_bvh_t *bvh,
+                          unsigned int          i,
+                          graphene_box_t       *res)
+{
+  if (bvh->primitive == BVH_PRIMITIVE_BOX)
+    *res = bvh->boxes[i];
+  else
+    bvh_triangle_bounds (&bvh->triangles[i], res);
+}
+
+static inline bool
+bvh_intersect_primitive (const graphene_bvh_t *bvh,
+                         unsigned int          i,
+                         const graphene_ray_t *r,
+                         float                *t_out)
+{
+  graphene_ray_intersection_kind_t kind;
+
+  if (bvh->primitive == BVH_PRIMITIVE_BOX)
+    kind = graphene_ray_intersect_box (r, &bvh->boxes[i], t_out);
+  else
+    kind = graphene_ray_intersect_triangle (r, &bvh->triangles[i], t_out);
+
+  return kind != GRAPHENE_RAY_INTERSECTION_KIND_NONE;
+}
+
+/* Returns the distance at which the ray enters the node, or a negative
+ * value if the ray misses it
+ */
+static inline float
+bvh_intersect_node (const bvh_node_t     *node,
+                    const graphene_ray_t *r)
+{
+  float t;
+
+  switch (graphene_ray_intersect_box (r, &node->bounds, &t))
+    {
+    case GRAPHENE_RAY_INTERSECTION_KIND_ENTER:
+      return t;
+
+    case GRAPHENE_RAY_INTERSECTION_KIND_LEAVE:
+      return 0.f;
+
+    case GRAPHENE_RAY_INTERSECTION_KIND_NONE:
+    default:
+      return -1.f;
+    }
+}
+
+typedef struct {
+  unsigned int node;
+  float t;
+} bvh_ray_task_t;
+
+static bool
+bvh_traverse_ray (const graphene_bvh_t *bvh,
+                  const graphene_ray_t *r,
+                  bool                  any_hit,
+                  float                 max_distance,
+                  unsigned int         *primitive_out,
+                  float                *t_out)
+{
+  bvh_ray_task_t stack_buf[BVH_STACK_SIZE];
+  bvh_ray_task_t *stack = stack_buf;
+  unsigned int n_tasks = 0;
+  unsigned int best_primitive = 0;
+  float best_t = max_distance;
+  bool hit = false;
+  float t;
+
+  if (bvh->n_nodes == 0)
+    return false;
+
+  t = bvh_intersect_node (&bvh->nodes[0], r);
+  if (t < 0.f || t > best_t)
+    return false;
+
+  /* Each level of the tree pushes at most one extra node */
+  if (bvh->depth + 1 > BVH_STACK_SIZE)
+    stack = graphene_aligned_alloc (sizeof (bvh_ray_task_t), bvh->depth + 1, 16);
+
+  stack[n_tasks++] = (bvh_ray_task_t) { 0, t };
+
+  while (n_tasks > 0)
+    {
+      bvh_ray_task_t task = stack[--n_tasks];
+      const bvh_node_t *node = &bvh->nodes[task.node];
+
+      /* We found a closer hit since this node was pushed */
+      if (task.t > best_t)
+        continue;
+
+      if (node->count > 0)
+        {
+          for (unsigned int i = node->first; i < node->first + node->count; i++)
+            {
+              if (!bvh_intersect_primitive (bvh, i, r, &t) || t > best_t)
+                continue;
+
+              best_t = t;
+              best_primitive = i;
+              hit = true;
+
+              if (any_hit)
+                goto out;
+            }
+        }
+      else
+        {
+          float t_left = bvh_intersect_node (&bvh->nodes[node->first], r);
+          float t_right = bvh_intersect_node (&bvh->nodes[node->first + 1], r);
+          bool has_left = t_left >= 0.f && t_left <= best_t;
+          bool has_right = t_right >= 0.f && t_right <= best_t;
+
+          /* Visit the nearest child first */
+          if (has_left && has_right)
+            {
+              if (t_left <= t_right)
+                {
+                  stack[n_tasks++] = (bvh_ray_task_t) { node->first + 1, t_right };
+                  stack[n_tasks++] = (bvh_ray_task_t) { node->first, t_left };
+                }
+              else
+                {
+                  stack[n_tasks++] = (bvh_ray_task_t) { node->first, t_left };
+                  stack[n_tasks++] = (bvh_ray_task_t) { node->first + 1, t_right };
+                }
+            }
+          else if (has_left)
+            stack[n_tasks++] = (bvh_ray_task_t) { node->first, t_left };
+          else if (has_right)
+            stack[n_tasks++] = (bvh_ray_task_t) { node->first + 1, t_right };
+        }
+    }
+
+out:
+  if (stack != stack_buf)
+    graphene_aligned_free (stack);
+
+  if (hit)
+    {
+      if (primitive_out != NULL)
+        *primitive_out = bvh->ids[best_primitive];
+      if (t_out != NULL)
+        *t_out = best_t;
+    }
+
+  return hit;
+}
+
+/**
+ * graphene_bvh_intersect_ray:
+ * @bvh: a #graphene_bvh_t
+ * @r: a #graphene_ray_t
+ * @primitive_out: (out) (optional): return location for the index
+ *   of the closest primitive hit by the ray
+ * @t_out: (out) (optional): return location for the distance of the
+ *   intersection point along the ray
+ *
+ * Finds the closest primitive intersected by the given ray.
+ *
+ * Boxes are intersected using graphene_ray_intersect_box(), and
+ * triangles using graphene_ray_intersect_triangle(); the returned
+ * distance follows the same rules.
+ *
+ * Returns: `true` if the ray hits any primitive
+ *
+ * Since: 1.12
+ */
+bool
+graphene_bvh_intersect_ray (const graphene_bvh_t *bvh,
+                            const graphene_ray_t *r,
+                            unsigned int         *primitive_out,
+                            float                *t_out)
+{
+  return bvh_traverse_ray (bvh, r, false, INFINITY, primitive_out, t_out);
+}
+
+/**
+ * graphene_bvh_intersects_ray:
+ * @bvh: a #graphene_bvh_t
+ * @r: a #graphene_ray_t
+ * @max_distance: the maximum distance along the ray; use `INFINITY`
+ *   to check the whole ray
+ *
+ * Checks whether the given ray hits any primitive within @max_distance
+ * from its origin.
+ *
+ * This function stops at the first hit it finds, so it is faster than
+ * graphene_bvh_intersect_ray(), for instance for shadow rays.
+ *
+ * Returns: `true` if the ray hits a primitive
+ *
+ * Since: 1.12
+ */
+bool
+graphene_bvh_intersects_ray (const graphene_bvh_t *bvh,
+                             const graphene_ray_t *r,
+                             float                 max_distance)
+{
+  return bvh_traverse_ray (bvh, r, true, max_distance, NULL, NULL);
+}
+
+static inline void
+bvh_add_result (const graphene_bvh_t *bvh,
+                unsigned int          i,
+                unsigned int          max_results,
+                unsigned int         *results,
+                unsigned int         *n_results)
+{
+  if (*n_results < max_results)
+    results[*n_results] = bvh->ids[i];
+
+  *n_results += 1;
+}
+
+/**
+ * graphene_bvh_query_box:
+ * @bvh: a #graphene_bvh_t
+ * @box: a #graphene_box_t
+ * @max_results: the number of elements in the @results array
+ * @results: (array length=max_results) (optional): return location for
+ *   the indices of the primitives overlapping @box
+ *
+ * Finds the primitives whose bounds overlap the given @box.
+ *
+ * At most @max_results indices are written into @results; the
+ * returned value can be larger than @max_results, in which case the
+ * query can be repeated with a bigger array.
+ *
+ * Returns: the number of primitives overlapping @box
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_bvh_query_box (const graphene_bvh_t *bvh,
+                        const graphene_box_t *box,
+                        unsigned int          max_results,
+                        unsigned int         *results)
+{
+  unsigned int stack_buf[BVH_STACK_SIZE];
+  unsigned int *stack = stack_buf;
+  unsigned int n_tasks = 0;
+  unsigned int n_results = 0;
+
+  if (bvh->n_nodes == 0 || !graphene_box_intersection (&bvh->nodes[0].bounds, box, NULL))
+    return 0;
+
+  if (bvh->depth + 1 > BVH_STACK_SIZE)
+    stack = graphene_aligned_alloc (sizeof (unsigned int), bvh->depth + 1, 16);
+
+  stack[n_tasks++] = 0;
+
+  while (n_tasks > 0)
+    {
+      const bvh_node_t *node = &bvh->nodes[stack[--n_tasks]];
+
+      if (node->count > 0)
+        {
+          for (unsigned int i = node->first; i < node->first + node->count; i++)
+            {
+              graphene_box_t bounds;
+
+              bvh_get_primitive_bounds (bvh, i, &bounds);
+              if (graphene_box_intersection (&bounds, box, NULL))
+                bvh_add_result (bvh, i, max_results, results, &n_results);
+            }
+        }
+      else
+        {
+          for (unsigned int i = 0; i < 2; i++)
+            {
+              if (graphene_box_intersection (&bvh->nodes[node->first + i].bounds, box, NULL))
+                stack[n_tasks++] = node->first + i;
+            }
+        }
+    }
+
+  if (stack != stack_buf)
+    graphene_aligned_free (stack);
+
+  return n_results;
+}
+
+typedef struct {
+  unsigned int node;
+  unsigned int plane_mask;
+} bvh_frustum_task_t;
+
+/**
+ * graphene_bvh_query_frustum:
+ * @bvh: a #graphene_bvh_t
+ * @frustum: a #graphene_frustum_t
+ * @max_results: the number of elements in the @results array
+ * @results: (array length=max_results) (optional): return location for
+ *   the indices of the primitives intersecting @frustum
+ *
+ * Finds the primitives whose bounds intersect the given @frustum, like
+ * graphene_frustum_intersects_box().
+ *
+ * Nodes of the hierarchy that are completely inside the frustum are
+ * not tested any further, and their children are only tested against
+ * the clip planes that intersect them.
+ *
+ * At most @max_results indices are written into @results; the
+ * returned value can be larger than @max_results, in which case the
+ * query can be repeated with a bigger array.
+ *
+ * Returns: the number of primitives intersecting @frustum
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_bvh_query_frustum (const graphene_bvh_t     *bvh,
+                            const graphene_frustum_t *frustum,
+                            unsigned int              max_results,
+                            unsigned int             *results)
+{
+  bvh_frustum_task_t stack_buf[BVH_STACK_SIZE];
+  bvh_frustum_task_t *stack = stack_buf;
+  unsigned int n_tasks = 0;
+  unsigned int n_results = 0;
+
+  if (bvh->n_nodes == 0)
+    return 0;
+
+  if (bvh->depth + 1 > BVH_STACK_SIZE)
+    stack = graphene_aligned_alloc (sizeof (bvh_frustum_task_t), bvh->depth + 1, 16);
+
+  stack[n_tasks++] = (bvh_frustum_task_t) { 0, GRAPHENE_FRUSTUM_ALL_PLANES };
+
+  while (n_tasks > 0)
+    {
+      bvh_frustum_task_t task = stack[--n_tasks];
+      const bvh_node_t *node = &bvh->nodes[task.node];
+      unsigned int plane_mask = 0;
+
+      /* An empty mask means that the node is inside the frustum */
+      if (task.plane_mask != 0 &&
+          graphene_frustum_classify_box (frustum, &node->bounds,
+                                         task.plane_mask,
+                                         &plane_mask) == GRAPHENE_FRUSTUM_CONTAINMENT_OUTSIDE)
+        continue;
+
+      if (node->count > 0)
+        {
+          for (unsigned int i = node->first; i < node->first + node->count; i++)
+            {
+              if (plane_mask != 0)
+                {
+                  graphene_box_t bounds;
+
+                  bvh_get_primitive_bounds (bvh, i, &bounds);
+                  if (graphene_frustum_classify_box (frustum, &bounds, plane_mask, NULL) == GRAPHENE_FRUSTUM_CONTAINMENT_OUTSIDE)
+                    continue;
+                }
+
+              bvh_add_result (bvh, i, max_results, results, &n_results);
+            }
+        }
+      else
+        {
+          stack[n_tasks++] = (bvh_frustum_task_t) { node->first + 1, plane_mask };
+          stack[n_tasks++] = (bvh_frustum_task_t) { node->first, plane_mask };
+        }
+    }
+
+  if (stack != stack_buf)
+    graphene_aligned_free (stack);
+
+  return n_results;
+}
@@ -0,0 +1,246 @@
+/* graphene-cpu.c: run time CPU feature detection
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-kernels-private.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#include <errno.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+const graphene_kernels_t *graphene_kernels_active;
+
+#if defined(HAVE_KERNELS_SSE4_1) || defined(HAVE_KERNELS_AVX2)
+# if defined(__GNUC__)
+static inline bool
+cpu_supports_sse4_1 (void)
+{
+  __builtin_cpu_init ();
+
+  return __builtin_cpu_supports ("sse4.1");
+}
+
+static inline bool
+cpu_supports_avx2 (void)
+{
+  __builtin_cpu_init ();
+
+  /* The AVX2 variant uses fused multiply-add instructions as well */
+  return __builtin_cpu_supports ("avx2") && __builtin_cpu_supports ("fma");
+}
+# elif defined(_MSC_VER)
+static inline bool
+cpu_supports_sse4_1 (void)
+{
+  int info[4];
+
+  __cpuid (info, 1);
+
+  return (info[2] & (1 << 19)) != 0;
+}
+
+static inline bool
+cpu_supports_avx2 (void)
+{
+  int info[4];
+
+  __cpuid (info, 1);
+
+  /* FMA, OSXSAVE, and AVX */
+  if ((info[2] & ((1 << 12) | (1 << 27) | (1 << 28))) != ((1 << 12) | (1 << 27) | (1 << 28)))
+    return false;
+
+  /* The OS must save the YMM registers on context switch */
+  if ((_xgetbv (0) & 0x6) != 0x6)
+    return false;
+
+  __cpuidex (info, 7, 0);
+
+  return (info[1] & (1 << 5)) != 0;
+}
+# else
+#  error "Need GCC-compatible or Visual Studio compiler for run time CPU detection."
+# endif
+#endif
+
+static void
+init_kernels_once (void)
+{
+  const graphene_kernels_t *candidates[3];
+  const char *override;
+  unsigned int n_candidates = 0;
+
+  /* In order of preference */
+#ifdef HAVE_KERNELS_AVX2
+  if (cpu_supports_avx2 ())
+    candidates[n_candidates++] = &graphene_kernels_avx2;
+#endif
+#ifdef HAVE_KERNELS_SSE4_1
+  if (cpu_supports_sse4_1 ())
+    candidates[n_candidates++] = &graphene_kernels_sse4_1;
+#endif
+  candidates[n_candidates++] = &graphene_kernels_baseline;
+
+  graphene_kernels_active = candidates[0];
+
+  /* Allow selecting a less capable backend, for testing and benchmarking */
+  override = getenv ("GRAPHENE_SIMD_BACKEND");
+  if (override == NULL || *override == '\0')
+    return;
+
+  for (unsigned int i = 0; i < n_candidates; i++)
+    {
+      if (strcmp (candidates[i]->name, override) == 0)
+        {
+          graphene_kernels_active = candidates[i];
+          return;
+        }
+    }
+
+  fprintf (stderr, "Unsupported SIMD backend '%s'; using '%s' instead\n",
+           override,
+           graphene_kernels_active->name);
+}
+
+#ifdef HAVE_PTHREAD_H
+static pthread_once_t kernels_once = PTHREAD_ONCE_INIT;
+
+static inline void
+init_kernels (void)
+{
+  int status = pthread_once (&kernels_once, init_kernels_once);
+
+  if (status < 0)
+    {
+      int saved_errno = errno;
+
+      fprintf (stderr, "pthread_once failed: %s (errno:%d)\n",
+               strerror (saved_errno),
+               saved_errno);
+    }
+}
+
+#elif defined(HAVE_INIT_ONCE)
+static INIT_ONCE kernels_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK
+InitKernelsFunc (PINIT_ONCE InitOnce,
+                 PVOID      param,
+                 PVOID     *ctx)
+{
+  init_kernels_once ();
+  return TRUE;
+}
+
+static inline void
+init_kernels (void)
+{
+  BOOL bStatus = InitOnceExecuteOnce (&kernels_once,
+                                      InitKernelsFunc,
+                                      NULL,
+                                      NULL);
+
+  if (!bStatus)
+    fprintf (stderr, "InitOnceExecuteOnce failed\n");
+}
+
+#else /* !HAVE_PTHREAD_H */
+static inline void
+init_kernels (void)
+{
+  if (graphene_kernels_active != NULL)
+    return;
+
+  init_kernels_once ();
+}
+
+#endif /* HAVE_PTHREAD_H */
+
+#if defined(__GNUC__)
+/* Select the kernels when the library is loaded, so that the common
+ * path in graphene_get_kernels() is a single load
+ */
+static void __attribute__((constructor))
+graphene_kernels_constructor (void)
+{
+  init_kernels ();
+}
+#endif
+
+const graphene_kernels_t *
+graphene_kernels_init (void)
+{
+  init_kernels ();
+
+  return graphene_kernels_active;
+}
+
+/**
+ * graphene_simd_get_active_backend:
+ *
+ * Retrieves the name of the SIMD implementation used by the
+ * performance critical functions of Graphene, like matrix
+ * multiplication and inversion, vector normalization, and the
+ * functions operating on arrays.
+ *
+ * On x86, Graphene compiles those functions for more than one
+ * instruction set, and picks the best one supported by the CPU
+ * when the library is loaded; the result of this function can
+ * be different from the backend used by the inline
+ * #graphene_simd4f_t operations, which is fixed at compile time.
+ *
+ * The possible values are:
+ *
+ *  - "avx2": AVX2 and FMA
+ *  - "sse4.1": SSE 4.1
+ *  - "sse": SSE2
+ *  - "neon": ARM NEON
+ *  - "intrinsics": GCC vector intrinsics
+ *  - "scalar": no SIMD instructions
+ *
+ * The `GRAPHENE_SIMD_BACKEND` environment variable can be set to
+ * one of the values above to select a different implementation, as
+ * long as it's supported by the CPU; this is mostly useful for
+ * testing and benchmarking.
+ *
+ * Returns: (transfer none): the name of the SIMD implementation
+ *
+ * Since: 1.12
+ */
+const char *
+graphene_simd_get_active_backend (void)
+{
+  return graphene_get_kernels ()->name;
+}
@@ -39,10 +39,14 @@
 #include "graphene-frustum.h"
 
 #include "graphene-alloc-private.h"
+#include "graphene-kernels-private.h"
+#include "graphene-parallel-private.h"
 #include "graphene-box.h"
 #include "graphene-matrix.h"
+#include "graphene-obb.h"
 #include "graphene-sphere.h"
 #include "graphene-point3d.h"
+#include "graphene-strided-private.h"
 #include "graphene-vec4.h"
 
 #define N_CLIP_PLANES 6
@@ -319,6 +323,435 @@ graphene_frustum_intersects_box (const graphene_frustum_t *f,
   return true;
 }
 
+/* Computes the point where three planes meet; returns false if two of
+ * the planes are parallel
+ */
+static bool
+frustum_planes_intersection (const graphene_plane_t *a,
+                             const graphene_plane_t *b,
+                             const graphene_plane_t *c,
+                             graphene_vec3_t        *res)
+{
+  graphene_vec3_t bc, ca, ab, tmp;
+  float denom;
+
+  graphene_vec3_cross (&b->normal, &c->normal, &bc);
+  graphene_vec3_cross (&c->normal, &a->normal, &ca);
+  graphene_vec3_cross (&a->normal, &b->normal, &ab);
+
+  denom = graphene_vec3_dot (&a->normal, &bc);
+  if (fabsf (denom) < FLT_EPSILON)
+    return false;
+
+  graphene_vec3_scale (&bc, -a->constant / denom, res);
+  graphene_vec3_scale (&ca, -b->constant / denom, &tmp);
+  graphene_vec3_add (res, &tmp, res);
+  graphene_vec3_scale (&ab, -c->constant / denom, &tmp);
+  graphene_vec3_add (res, &tmp, res);
+
+  return true;
+}
+
+/**
+ * graphene_frustum_intersects_obb:
+ * @f: a #graphene_frustum_t
+ * @obb: a #graphene_obb_t
+ *
+ * Checks whether the given oriented box intersects a #graphene_frustum_t.
+ *
+ * The box is first tested against the planes of the frustum; boxes that
+ * are not rejected by a plane are then tested against the axes of the
+ * box, using the corners of the frustum. This removes most of the false
+ * positives of a plane-only test, like large boxes near the corners of
+ * the frustum; the test does not check the cross products of the edges
+ * of the box and of the frustum, so it can still return `true` for some
+ * boxes that do not intersect the frustum.
+ *
+ * Returns: `true` if the box intersects the frustum
+ *
+ * Since: 1.12
+ */
+bool
+graphene_frustum_intersects_obb (const graphene_frustum_t *f,
+                                 const graphene_obb_t     *obb)
+{
+  graphene_vec3_t center, axes[3], half_extents;
+  graphene_vec3_t corners[8];
+  graphene_point3d_t c;
+  float e[3];
+  bool inside = true;
+
+  graphene_obb_get_center (obb, &c);
+  graphene_point3d_to_vec3 (&c, &center);
+  graphene_obb_get_half_extents (obb, &half_extents);
+  graphene_vec3_to_float (&half_extents, e);
+  graphene_obb_get_axes (obb, &axes[0], &axes[1], &axes[2]);
+
+  /* The planes of the frustum: the projection of the box on the normal
+   * of each plane is an interval of radius r around the center
+   */
+  for (int i = 0; i < N_CLIP_PLANES; i++)
+    {
+      const graphene_plane_t *plane = &f->planes[i];
+      float d = graphene_vec3_dot (&plane->normal, &center) + plane->constant;
+      float r = e[0] * fabsf (graphene_vec3_dot (&plane->normal, &axes[0]))
+              + e[1] * fabsf (graphene_vec3_dot (&plane->normal, &axes[1]))
+              + e[2] * fabsf (graphene_vec3_dot (&plane->normal, &axes[2]));
+
+      if (d < -r)
+        return false;
+
+      if (d < r)
+        inside = false;
+    }
+
+  if (inside)
+    return true;
+
+  /* The axes of the box: the corners of the frustum are where the
+   * left/right, top/bottom, and near/far planes meet
+   */
+  for (int i = 0; i < 8; i++)
+    {
+      if (!frustum_planes_intersection (&f->planes[(i >> 2) & 1],
+                                        &f->planes[2 + ((i >> 1) & 1)],
+                                        &f->planes[4 + (i & 1)],
+                                        &corners[i]))
+        return true;
+
+      graphene_vec3_subtract (&corners[i], &center, &corners[i]);
+    }
+
+  for (int i = 0; i < 3; i++)
+    {
+      float min_v = INFINITY, max_v = -INFINITY;
+
+      for (int j = 0; j < 8; j++)
+        {
+          float d = graphene_vec3_dot (&corners[j], &axes[i]);
+
+          min_v = MIN (min_v, d);
+          max_v = MAX (max_v, d);
+        }
+
+      if (min_v > e[i] || max_v < -e[i])
+        return false;
+    }
+
+  return true;
+}
+
+/**
+ * graphene_frustum_classify_sphere:
+ * @f: a #graphene_frustum_t
+ * @sphere: a #graphene_sphere_t
+ * @plane_mask: a bitmask of the clip planes to test; use
+ *   %GRAPHENE_FRUSTUM_ALL_PLANES to test all planes
+ * @out_mask: (out) (optional): return location for the bitmask of
+ *   the tested clip planes intersecting the @sphere
+ *
+ * Classifies the given @sphere against the clip planes of
+ * a #graphene_frustum_t selected by @plane_mask.
+ *
+ * Planes that are not in @plane_mask are assumed to have been passed,
+ * for instance because a volume containing @sphere is fully on their
+ * inner side. When traversing a hierarchy of bounding volumes, the
+ * @out_mask of a parent can be used as the @plane_mask of its children,
+ * and children of a parent classified as inside do not need to be
+ * tested at all.
+ *
+ * Returns: the classification of the sphere
+ *
+ * Since: 1.12
+ */
+graphene_frustum_containment_t
+graphene_frustum_classify_sphere (const graphene_frustum_t *f,
+                                  const graphene_sphere_t  *sphere,
+                                  unsigned int              plane_mask,
+                                  unsigned int             *out_mask)
+{
+  unsigned int res_mask = 0;
+
+  for (int i = 0; i < N_CLIP_PLANES; i++)
+    {
+      const graphene_plane_t *plane = &f->planes[i];
+      float distance;
+
+      if ((plane_mask & (1u << i)) == 0)
+        continue;
+
+      distance = graphene_simd4f_dot3_scalar (plane->normal.value, sphere->center.value)
+               + plane->constant;
+
+      if (distance < -sphere->radius)
+        {
+          if (out_mask != NULL)
+            *out_mask = 0;
+
+          return GRAPHENE_FRUSTUM_CONTAINMENT_OUTSIDE;
+        }
+
+      if (distance < sphere->radius)
+        res_mask |= 1u << i;
+    }
+
+  if (out_mask != NULL)
+    *out_mask = res_mask;
+
+  return res_mask != 0 ? GRAPHENE_FRUSTUM_CONTAINMENT_INTERSECTING
+                       : GRAPHENE_FRUSTUM_CONTAINMENT_INSIDE;
+}
+
+/**
+ * graphene_frustum_classify_box:
+ * @f: a #graphene_frustum_t
+ * @box: a #graphene_box_t
+ * @plane_mask: a bitmask of the clip planes to test; use
+ *   %GRAPHENE_FRUSTUM_ALL_PLANES to test all planes
+ * @out_mask: (out) (optional): return location for the bitmask of
+ *   the tested clip planes intersecting the @box
+ *
+ * Classifies the given @box against the clip planes of
+ * a #graphene_frustum_t selected by @plane_mask.
+ *
+ * See graphene_frustum_classify_sphere() for how to use the plane
+ * masks when traversing a hierarchy of bounding volumes.
+ *
+ * Returns: the classification of the box
+ *
+ * Since: 1.12
+ */
+graphene_frustum_containment_t
+graphene_frustum_classify_box (const graphene_frustum_t *f,
+                               const graphene_box_t     *box,
+                               unsigned int              plane_mask,
+                               unsigned int             *out_mask)
+{
+  const graphene_simd4f_t one = graphene_simd4f_splat (1.f);
+  unsigned int res_mask = 0;
+
+  for (int i = 0; i < N_CLIP_PLANES; i++)
+    {
+      const graphene_plane_t *plane = &f->planes[i];
+      graphene_simd4f_t a, b;
+      float d_min, d_max;
+
+      if ((plane_mask & (1u << i)) == 0)
+        continue;
+
+      /* The distances of the n-vertex and p-vertex of the box, i.e.
+       * the corners that are nearest and farthest along the normal
+       * of the plane
+       */
+      a = graphene_simd4f_mul (plane->normal.value, box->min.value);
+      b = graphene_simd4f_mul (plane->normal.value, box->max.value);
+      d_max = graphene_simd4f_dot3_scalar (graphene_simd4f_max (a, b), one) + plane->constant;
+
+      if (d_max < 0.f)
+        {
+          if (out_mask != NULL)
+            *out_mask = 0;
+
+          return GRAPHENE_FRUSTUM_CONTAINMENT_OUTSIDE;
+        }
+
+      d_min = graphene_simd4f_dot3_scalar (graphene_simd4f_min (a, b), one) + plane->constant;
+      if (d_min < 0.f)
+        res_mask |= 1u << i;
+    }
+
+  if (out_mask != NULL)
+    *out_mask = res_mask;
+
+  return res_mask != 0 ? GRAPHENE_FRUSTUM_CONTAINMENT_INTERSECTING
+                       : GRAPHENE_FRUSTUM_CONTAINMENT_INSIDE;
+}
+
+typedef struct {
+  const graphene_frustum_t *f;
+  const void *items;
+  uint32_t *visible;
+} frustum_batch_t;
+
+/* The chunks start at multiples of 32 items, so each of them writes its
+ * own words of the bitmask
+ */
+static unsigned int
+frustum_cull_points_range (unsigned int  first,
+                           unsigned int  n_items,
+                           void         *data)
+{
+  const frustum_batch_t *batch = data;
+
+  return graphene_get_kernels ()->frustum_cull_points (batch->f, n_items,
+                                                       (const graphene_point3d_t *) batch->items + first,
+                                                       batch->visible + first / 32);
+}
+
+static unsigned int
+frustum_cull_strided_range (unsigned int  first,
+                            unsigned int  n_items,
+                            void         *data)
+{
+  const frustum_batch_t *batch = data;
+  graphene_strided_view_t slice = graphene_strided_view_slice (batch->items, first, n_items);
+
+  return graphene_get_kernels ()->frustum_cull_strided (batch->f, &slice,
+                                                        batch->visible + first / 32);
+}
+
+static unsigned int
+frustum_cull_spheres_range (unsigned int  first,
+                            unsigned int  n_items,
+                            void         *data)
+{
+  const frustum_batch_t *batch = data;
+
+  return graphene_get_kernels ()->frustum_cull_spheres (batch->f, n_items,
+                                                        (const graphene_sphere_t *) batch->items + first,
+                                                        batch->visible + first / 32);
+}
+
+static unsigned int
+frustum_cull_boxes_range (unsigned int  first,
+                          unsigned int  n_items,
+                          void         *data)
+{
+  const frustum_batch_t *batch = data;
+
+  return graphene_get_kernels ()->frustum_cull_boxes (batch->f, n_items,
+                                                      (const graphene_box_t *) batch->items + first,
+                                                      batch->visible + first / 32);
+}
+
+/**
+ * graphene_frustum_cull_points:
+ * @f: a #graphene_frustum_t
+ * @n_points: the number of points in the @points array
+ * @points: (array length=n_points): an array of #graphene_point3d_t
+ * @visible: (out caller-allocates): return location for a bitmask with
+ *   at least `(n_points + 31) / 32` elements
+ *
+ * Checks whether each point in the @points array is inside the volume
+ * defined by the given #graphene_frustum_t, like
+ * graphene_frustum_contains_point().
+ *
+ * The result for the point at index `i` is stored in the `i % 32` bit
+ * of the `i / 32` element of the @visible array; the bit is set if
+ * the point is inside the frustum.
+ *
+ * Returns: the number of points inside the frustum
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_frustum_cull_points (const graphene_frustum_t *f,
+                              unsigned int              n_points,
+                              const graphene_point3d_t *points,
+                              uint32_t                 *visible)
+{
+  frustum_batch_t batch = { f, points, visible };
+
+  return graphene_parallel_count (n_points, graphene_parallel_chunk_size (sizeof (graphene_point3d_t)),
+                                  frustum_cull_points_range,
+                                  &batch);
+}
+
+/**
+ * graphene_frustum_cull_strided:
+ * @f: a #graphene_frustum_t
+ * @points: a #graphene_strided_view_t
+ * @visible: (out caller-allocates): return location for a bitmask with
+ *   at least `(n_elements + 31) / 32` elements
+ *
+ * Checks whether each point of the @points view is inside the volume
+ * defined by the given #graphene_frustum_t, like
+ * graphene_frustum_cull_points().
+ *
+ * Points with two components are on the z = 0 plane, and the fourth
+ * component of points with four components is ignored.
+ *
+ * Returns: the number of points inside the frustum
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_frustum_cull_strided (const graphene_frustum_t      *f,
+                               const graphene_strided_view_t *points,
+                               uint32_t                      *visible)
+{
+  frustum_batch_t batch = { f, points, visible };
+
+  return graphene_parallel_count (graphene_strided_view_get_n_elements (points),
+                                  graphene_parallel_chunk_size (graphene_strided_view_item_size (points)),
+                                  frustum_cull_strided_range,
+                                  &batch);
+}
+
+/**
+ * graphene_frustum_cull_spheres:
+ * @f: a #graphene_frustum_t
+ * @n_spheres: the number of spheres in the @spheres array
+ * @spheres: (array length=n_spheres): an array of #graphene_sphere_t
+ * @visible: (out caller-allocates): return location for a bitmask with
+ *   at least `(n_spheres + 31) / 32` elements
+ *
+ * Checks whether each sphere in the @spheres array intersects the
+ * given #graphene_frustum_t, like graphene_frustum_intersects_sphere().
+ *
+ * The result for the sphere at index `i` is stored in the `i % 32` bit
+ * of the `i / 32` element of the @visible array; the bit is set if
+ * the sphere intersects the frustum.
+ *
+ * Returns: the number of spheres intersecting the frustum
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_frustum_cull_spheres (const graphene_frustum_t *f,
+                               unsigned int              n_spheres,
+                               const graphene_sphere_t  *spheres,
+                               uint32_t                 *visible)
+{
+  frustum_batch_t batch = { f, spheres, visible };
+
+  return graphene_parallel_count (n_spheres, graphene_parallel_chunk_size (sizeof (graphene_sphere_t)),
+                                  frustum_cull_spheres_range,
+                                  &batch);
+}
+
+/**
+ * graphene_frustum_cull_boxes:
+ * @f: a #graphene_frustum_t
+ * @n_boxes: the number of boxes in the @boxes array
+ * @boxes: (array length=n_boxes): an array of #graphene_box_t
+ * @visible: (out caller-allocates): return location for a bitmask with
+ *   at least `(n_boxes + 31) / 32` elements
+ *
+ * Checks whether each box in the @boxes array intersects the given
+ * #graphene_frustum_t, like graphene_frustum_intersects_box().
+ *
+ * The result for the box at index `i` is stored in the `i % 32` bit
+ * of the `i / 32` element of the @visible array; the bit is set if
+ * the box intersects the frustum.
+ *
+ * Returns: the number of boxes intersecting the frustum
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_frustum_cull_boxes (const graphene_frustum_t *f,
+                             unsigned int              n_boxes,
+                             const graphene_box_t     *boxes,
+                             uint32_t                 *visible)
+{
+  frustum_batch_t batch = { f, boxes, visible };
+
+  return graphene_parallel_count (n_boxes, graphene_parallel_chunk_size (sizeof (graphene_box_t)),
+                                  frustum_cull_boxes_range,
+                                  &batch);
+}
+
 static bool
 frustum_equal (const void *p1,
                const void *p2)
@@ -187,3 +187,11 @@ GRAPHENE_DEFINE_BOXED_TYPE (GrapheneEuler, graphene_euler)
 GRAPHENE_DEFINE_BOXED_TYPE (GrapheneRay, graphene_ray)
 
 GRAPHENE_DEFINE_BOXED_TYPE (GrapheneBox2D, graphene_box2d)
+
+GRAPHENE_DEFINE_BOXED_TYPE (GrapheneTransform, graphene_transform)
+
+GRAPHENE_DEFINE_BOXED_TYPE (GrapheneAffine2D, graphene_affine2d)
+
+GRAPHENE_DEFINE_BOXED_TYPE (GrapheneAffine3D, graphene_affine3d)
+
+GRAPHENE_DEFINE_BOXED_TYPE (GrapheneOBB, graphene_obb)
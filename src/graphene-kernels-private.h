@@ -0,0 +1,208 @@
+/* graphene-kernels-private.h: hot kernels selected at run time
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "graphene-types.h"
+#include "graphene-simd4x4f.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/* The hot, out-of-line kernels of the library.
+ *
+ * graphene-kernels.c is compiled once for the baseline instruction set
+ * of the build, and, on x86, once more for each of the instruction sets
+ * we know how to detect at run time; each build provides a table named
+ * after its variant. The table matching the CPU is selected once, the
+ * first time it's needed, and every public entry point that wraps a
+ * kernel calls through it.
+ */
+typedef struct {
+  /* Returned by graphene_simd_get_active_backend() */
+  const char *name;
+
+  void (* vec3_normalize) (const graphene_simd4f_t *v,
+                           graphene_simd4f_t       *res);
+  void (* vec4_normalize) (const graphene_simd4f_t *v,
+                           graphene_simd4f_t       *res);
+
+  void (* matrix_multiply) (const graphene_simd4x4f_t *a,
+                            const graphene_simd4x4f_t *b,
+                            graphene_simd4x4f_t       *res);
+  bool (* matrix_inverse) (const graphene_simd4x4f_t *m,
+                           graphene_simd4x4f_t       *res);
+  bool (* matrix_inverse_affine) (const graphene_simd4x4f_t *m,
+                                  graphene_simd4x4f_t       *res);
+  void (* matrix_transform_points3d) (const graphene_simd4x4f_t *m,
+                                      unsigned int               n_points,
+                                      const graphene_point3d_t  *points,
+                                      graphene_point3d_t        *res);
+  void (* matrix_transform_vec3_array) (const graphene_simd4x4f_t *m,
+                                        unsigned int               n_vectors,
+                                        const graphene_vec3_t     *vectors,
+                                        graphene_vec3_t           *res);
+  void (* matrix_transform_vec4_array) (const graphene_simd4x4f_t *m,
+                                        unsigned int               n_vectors,
+                                        const graphene_vec4_t     *vectors,
+                                        graphene_vec4_t           *res);
+  void (* matrix_transform_strided) (const graphene_simd4x4f_t     *m,
+                                     const graphene_strided_view_t *view);
+  void (* matrix_transform_bounds_array) (const graphene_simd4x4f_t *m,
+                                          unsigned int               n_rects,
+                                          const graphene_rect_t     *r,
+                                          graphene_rect_t           *res);
+  void (* matrix_transform_boxes) (const graphene_simd4x4f_t *m,
+                                   unsigned int               n_boxes,
+                                   const graphene_box_t      *boxes,
+                                   graphene_box_t            *res);
+
+  void (* box_bounds_strided) (const graphene_strided_view_t *points,
+                               graphene_box_t                *res);
+  /* The index of the first point outside of @s, or @n_points */
+  unsigned int (* sphere_find_outside) (const graphene_sphere_t  *s,
+                                        unsigned int              n_points,
+                                        const graphene_point3d_t *points);
+  float (* points_max_distance_sq) (const graphene_vec3_t    *center,
+                                    unsigned int              n_points,
+                                    const graphene_point3d_t *points);
+
+  unsigned int (* frustum_cull_points) (const graphene_frustum_t *f,
+                                        unsigned int              n_points,
+                                        const graphene_point3d_t *points,
+                                        uint32_t                 *visible);
+  unsigned int (* frustum_cull_strided) (const graphene_frustum_t      *f,
+                                         const graphene_strided_view_t *points,
+                                         uint32_t                      *visible);
+  unsigned int (* frustum_cull_spheres) (const graphene_frustum_t *f,
+                                         unsigned int              n_spheres,
+                                         const graphene_sphere_t  *spheres,
+                                         uint32_t                 *visible);
+  unsigned int (* frustum_cull_boxes) (const graphene_frustum_t *f,
+                                       unsigned int              n_boxes,
+                                       const graphene_box_t     *boxes,
+                                       uint32_t                 *visible);
+
+  unsigned int (* ray_intersect_boxes) (const graphene_ray_t *r,
+                                        unsigned int          n_boxes,
+                                        const graphene_box_t *boxes,
+                                        float                *t_out,
+                                        uint32_t             *hits);
+
+  /* Kernels over "structure of arrays" vectors; @n_components is 3 or 4,
+   * and each component is stored in a separate array of @n floats
+   */
+  void (* soa_add) (unsigned int  n,
+                    const float  *a,
+                    const float  *b,
+                    float        *res);
+  void (* soa_subtract) (unsigned int  n,
+                         const float  *a,
+                         const float  *b,
+                         float        *res);
+  void (* soa_scale) (unsigned int  n,
+                      const float  *a,
+                      float         factor,
+                      float        *res);
+  void (* soa_lerp) (unsigned int  n,
+                     const float  *a,
+                     const float  *b,
+                     float         factor,
+                     float        *res);
+  void (* soa_min_max) (unsigned int  n,
+                        const float  *a,
+                        float        *min,
+                        float        *max);
+  void (* soa_dot) (unsigned int        n,
+                    unsigned int        n_components,
+                    const float * const *a,
+                    const float * const *b,
+                    float              *res);
+  void (* soa_length) (unsigned int        n,
+                       unsigned int        n_components,
+                       const float * const *a,
+                       float              *res);
+  void (* soa_normalize) (unsigned int        n,
+                          unsigned int        n_components,
+                          const float * const *a,
+                          float * const       *res);
+  void (* soa_cross) (unsigned int        n,
+                      const float * const *a,
+                      const float * const *b,
+                      float * const       *res);
+  void (* soa_transform) (const graphene_simd4x4f_t *m,
+                          unsigned int               n,
+                          unsigned int               n_components,
+                          const float * const       *a,
+                          float                      w,
+                          float * const             *res);
+  void (* soa_from_simd4f) (unsigned int             n,
+                            unsigned int             n_components,
+                            const graphene_simd4f_t *v,
+                            float * const           *res);
+
+  /* Kernels over "structure of arrays" matrices; each of the 16 elements
+   * is stored in a separate array of @n floats, in row-major order
+   */
+  void (* soa_matrix_multiply) (unsigned int         n,
+                                const float * const *a,
+                                const float * const *b,
+                                float * const       *res);
+  void (* soa_matrix_determinant) (unsigned int         n,
+                                   const float * const *a,
+                                   float               *res);
+  unsigned int (* soa_matrix_inverse) (unsigned int         n,
+                                       const float * const *a,
+                                       float * const       *res);
+  void (* soa_matrix_transform_points) (unsigned int         n,
+                                        const float * const *m,
+                                        const float * const *a,
+                                        float * const       *res);
+  void (* soa_matrix_from_simd4x4f) (unsigned int               n,
+                                     const graphene_simd4x4f_t *m,
+                                     float * const             *res);
+} graphene_kernels_t;
+
+extern const graphene_kernels_t graphene_kernels_baseline;
+#ifdef HAVE_KERNELS_SSE4_1
+extern const graphene_kernels_t graphene_kernels_sse4_1;
+#endif
+#ifdef HAVE_KERNELS_AVX2
+extern const graphene_kernels_t graphene_kernels_avx2;
+#endif
+
+extern const graphene_kernels_t *graphene_kernels_active;
+
+const graphene_kernels_t *      graphene_kernels_init   (void);
+
+static inline const graphene_kernels_t *
+graphene_get_kernels (void)
+{
+  if (likely (graphene_kernels_active != NULL))
+    return graphene_kernels_active;
+
+  return graphene_kernels_init ();
+}
+
+GRAPHENE_END_DECLS
@@ -0,0 +1,1773 @@
+/* graphene-kernels.c: hot kernels selected at run time
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/* This file is compiled once for each instruction set variant of the
+ * kernels; see graphene-kernels-private.h.
+ *
+ * Only the exported table may have external linkage, and its type must
+ * not depend on the instruction set: all the kernels use types whose
+ * layout is the same in every variant, like #graphene_simd4f_t, while
+ * #graphene_simd8f_t only appears inside their bodies.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-kernels-private.h"
+
+#include "graphene-box.h"
+#include "graphene-frustum.h"
+#include "graphene-matrix.h"
+#include "graphene-plane.h"
+#include "graphene-point3d.h"
+#include "graphene-ray.h"
+#include "graphene-rect.h"
+#include "graphene-simd8f.h"
+#include "graphene-sphere.h"
+#include "graphene-strided-private.h"
+#include "graphene-vec3.h"
+#include "graphene-vec4.h"
+
+#include <string.h>
+
+#ifndef GRAPHENE_KERNELS_VARIANT
+# define GRAPHENE_KERNELS_VARIANT baseline
+#endif
+
+#define GRAPHENE_KERNELS_PASTE(variant) graphene_kernels_ ## variant
+#define GRAPHENE_KERNELS_TABLE(variant) GRAPHENE_KERNELS_PASTE (variant)
+
+#if defined(GRAPHENE_USE_AVX2)
+# define GRAPHENE_KERNELS_NAME "avx2"
+#elif defined(GRAPHENE_USE_SSE) && defined(GRAPHENE_USE_SSE4_1)
+# define GRAPHENE_KERNELS_NAME "sse4.1"
+#else
+# define GRAPHENE_KERNELS_NAME GRAPHENE_SIMD_S
+#endif
+
+#define N_CLIP_PLANES 6
+
+static void
+vec3_normalize (const graphene_simd4f_t *v,
+                graphene_simd4f_t       *res)
+{
+  if (fabsf (graphene_simd4f_get_x (graphene_simd4f_length3 (*v))) > FLT_EPSILON)
+    *res = graphene_simd4f_normalize3 (*v);
+  else
+    *res = graphene_simd4f_init_zero ();
+}
+
+static void
+vec4_normalize (const graphene_simd4f_t *v,
+                graphene_simd4f_t       *res)
+{
+  if (fabsf (graphene_simd4f_get_x (graphene_simd4f_length4 (*v))) > FLT_EPSILON)
+    *res = graphene_simd4f_normalize4 (*v);
+  else
+    *res = graphene_simd4f_init_zero ();
+}
+
+static void
+matrix_multiply (const graphene_simd4x4f_t *a,
+                 const graphene_simd4x4f_t *b,
+                 graphene_simd4x4f_t       *res)
+{
+  graphene_simd4x4f_matrix_mul (a, b, res);
+}
+
+/* Inverts the upper 3x3 part of @m using the cross products of its rows,
+ * and applies the inverse to the negated translation; the last column of
+ * @m is assumed to be (0, 0, 0, 1)
+ */
+static bool
+matrix_inverse_affine (const graphene_simd4x4f_t *m,
+                       graphene_simd4x4f_t       *res)
+{
+  const graphene_simd4f_t w_axis = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+  const graphene_simd4f_t c0 = graphene_simd4f_cross3 (m->y, m->z);
+  const graphene_simd4f_t c1 = graphene_simd4f_cross3 (m->z, m->x);
+  const graphene_simd4f_t c2 = graphene_simd4f_cross3 (m->x, m->y);
+  const graphene_simd4f_t det = graphene_simd4f_dot3 (m->x, c0);
+  const float det_x = graphene_simd4f_get_x (det);
+  graphene_simd4f_t inv_det, translation;
+  graphene_simd4x4f_t inv;
+
+  /* Same check as graphene_simd4x4f_inverse() */
+  if (fabsf (det_x) < FLT_EPSILON)
+    return false;
+
+  inv_det = graphene_simd4f_splat (1.f / det_x);
+
+  /* The cross products are the columns of the inverse */
+  inv.x = graphene_simd4f_mul (c0, inv_det);
+  inv.y = graphene_simd4f_mul (c1, inv_det);
+  inv.z = graphene_simd4f_mul (c2, inv_det);
+  inv.w = graphene_simd4f_init_zero ();
+  graphene_simd4x4f_transpose_in_place (&inv);
+
+  graphene_simd4x4f_vec3_mul (&inv, &m->w, &translation);
+  inv.w = graphene_simd4f_sub (w_axis, translation);
+
+  *res = inv;
+
+  return true;
+}
+
+static bool
+matrix_inverse (const graphene_simd4x4f_t *m,
+                graphene_simd4x4f_t       *res)
+{
+  const graphene_simd4f_t w_axis = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+  const float xw = graphene_simd4f_get_w (m->x);
+  const float yw = graphene_simd4f_get_w (m->y);
+  const float zw = graphene_simd4f_get_w (m->z);
+  const float ww = graphene_simd4f_get_w (m->w);
+  const graphene_simd4f_t last_column = graphene_simd4f_init (xw, yw, zw, ww);
+
+  /* Most matrices are affine, and don't need the full cofactor expansion */
+  if (graphene_simd4f_cmp_eq (last_column, w_axis))
+    return matrix_inverse_affine (m, res);
+
+  return graphene_simd4x4f_inverse (m, res);
+}
+
+/* Transforms @n_elements elements of @n_components floats; elements with
+ * less than four components are transformed as points
+ */
+static inline void
+matrix_transform_elements (const graphene_simd4x4f_t *m,
+                           unsigned int               n_elements,
+                           unsigned int               n_components,
+                           const char                *src,
+                           size_t                     src_stride,
+                           char                      *dst,
+                           size_t                     dst_stride)
+{
+  const graphene_simd4x4f_t mat = *m;
+
+  for (unsigned int i = 0; i < n_elements; i++)
+    {
+      const float *p = (const float *) (src + i * src_stride);
+      float *r = (float *) (dst + i * dst_stride);
+      graphene_simd4f_t v;
+
+      if (n_components == 4)
+        {
+          v = graphene_simd4f_init (p[0], p[1], p[2], p[3]);
+          graphene_simd4x4f_vec4_mul (&mat, &v, &v);
+
+          r[3] = graphene_simd4f_get_w (v);
+        }
+      else
+        {
+          v = graphene_simd4f_init (p[0], p[1], n_components > 2 ? p[2] : 0.f, 1.f);
+          graphene_simd4x4f_point3_mul (&mat, &v, &v);
+        }
+
+      r[0] = graphene_simd4f_get_x (v);
+      r[1] = graphene_simd4f_get_y (v);
+      if (n_components > 2)
+        r[2] = graphene_simd4f_get_z (v);
+    }
+}
+
+static void
+matrix_transform_points3d (const graphene_simd4x4f_t *m,
+                           unsigned int               n_points,
+                           const graphene_point3d_t  *points,
+                           graphene_point3d_t        *res)
+{
+  matrix_transform_elements (m, n_points, 3,
+                             (const char *) points, sizeof (graphene_point3d_t),
+                             (char *) res, sizeof (graphene_point3d_t));
+}
+
+static void
+matrix_transform_strided (const graphene_simd4x4f_t     *m,
+                          const graphene_strided_view_t *view)
+{
+  unsigned int n_elements = graphene_strided_view_get_n_elements (view);
+  char *data = view->data;
+
+  switch (view->n_components)
+    {
+    case 2:
+      matrix_transform_elements (m, n_elements, 2, data, view->stride, data, view->stride);
+      break;
+
+    case 3:
+      matrix_transform_elements (m, n_elements, 3, data, view->stride, data, view->stride);
+      break;
+
+    default:
+      matrix_transform_elements (m, n_elements, 4, data, view->stride, data, view->stride);
+      break;
+    }
+}
+
+static void
+matrix_transform_vec3_array (const graphene_simd4x4f_t *m,
+                             unsigned int               n_vectors,
+                             const graphene_vec3_t     *vectors,
+                             graphene_vec3_t           *res)
+{
+  const graphene_simd4x4f_t mat = *m;
+
+  for (unsigned int i = 0; i < n_vectors; i++)
+    graphene_simd4x4f_vec3_mul (&mat, &vectors[i].value, &res[i].value);
+}
+
+static void
+matrix_transform_vec4_array (const graphene_simd4x4f_t *m,
+                             unsigned int               n_vectors,
+                             const graphene_vec4_t     *vectors,
+                             graphene_vec4_t           *res)
+{
+  const graphene_simd4x4f_t mat = *m;
+
+  for (unsigned int i = 0; i < n_vectors; i++)
+    graphene_simd4x4f_vec4_mul (&mat, &vectors[i].value, &res[i].value);
+}
+
+/* Transforms up to four rectangles at a time.
+ *
+ * The rectangles are transposed so that each SIMD register holds the
+ * same component of four rectangles. Since the projection ignores the
+ * w component, as in graphene_matrix_transform_bounds(), the transformed
+ * coordinates are a separable sum of the x and y contributions, and the
+ * extents can be computed from the two edges of each axis instead of the
+ * four corners.
+ */
+static inline void
+matrix_transform_bounds_x4 (const graphene_simd4x4f_t *mat,
+                            bool                       scale_translate,
+                            const graphene_rect_t     *r,
+                            unsigned int               n_rects,
+                            graphene_rect_t           *res)
+{
+  const graphene_simd4f_t zero = graphene_simd4f_init_zero ();
+  graphene_simd4x4f_t rects;
+  graphene_simd4f_t rows[4];
+  graphene_simd4f_t x0, x1, y0, y1;
+  graphene_simd4f_t min_x, min_y, max_x, max_y;
+
+  for (unsigned int i = 0; i < 4; i++)
+    {
+      if (i < n_rects)
+        rows[i] = graphene_simd4f_init (r[i].origin.x, r[i].origin.y,
+                                        r[i].size.width, r[i].size.height);
+      else
+        rows[i] = zero;
+    }
+
+  rects = graphene_simd4x4f_init (rows[0], rows[1], rows[2], rows[3]);
+  graphene_simd4x4f_transpose_in_place (&rects);
+
+  /* Normalize the rectangles */
+  x1 = graphene_simd4f_add (rects.x, rects.z);
+  y1 = graphene_simd4f_add (rects.y, rects.w);
+  x0 = graphene_simd4f_min (rects.x, x1);
+  x1 = graphene_simd4f_max (rects.x, x1);
+  y0 = graphene_simd4f_min (rects.y, y1);
+  y1 = graphene_simd4f_max (rects.y, y1);
+
+  if (scale_translate)
+    {
+      const graphene_simd4f_t sx = graphene_simd4f_splat_x (mat->x);
+      const graphene_simd4f_t sy = graphene_simd4f_splat_y (mat->y);
+      const graphene_simd4f_t tx = graphene_simd4f_splat_x (mat->w);
+      const graphene_simd4f_t ty = graphene_simd4f_splat_y (mat->w);
+      const graphene_simd4f_t ax0 = graphene_simd4f_mul (sx, x0);
+      const graphene_simd4f_t ax1 = graphene_simd4f_mul (sx, x1);
+      const graphene_simd4f_t dy0 = graphene_simd4f_mul (sy, y0);
+      const graphene_simd4f_t dy1 = graphene_simd4f_mul (sy, y1);
+
+      min_x = graphene_simd4f_add (graphene_simd4f_min (ax0, ax1), tx);
+      max_x = graphene_simd4f_add (graphene_simd4f_max (ax0, ax1), tx);
+      min_y = graphene_simd4f_add (graphene_simd4f_min (dy0, dy1), ty);
+      max_y = graphene_simd4f_add (graphene_simd4f_max (dy0, dy1), ty);
+    }
+  else
+    {
+      const graphene_simd4f_t xx = graphene_simd4f_splat_x (mat->x);
+      const graphene_simd4f_t xy = graphene_simd4f_splat_y (mat->x);
+      const graphene_simd4f_t yx = graphene_simd4f_splat_x (mat->y);
+      const graphene_simd4f_t yy = graphene_simd4f_splat_y (mat->y);
+      const graphene_simd4f_t tx = graphene_simd4f_splat_x (mat->w);
+      const graphene_simd4f_t ty = graphene_simd4f_splat_y (mat->w);
+      graphene_simd4f_t p0, p1, q0, q1;
+
+      p0 = graphene_simd4f_mul (xx, x0);
+      p1 = graphene_simd4f_mul (xx, x1);
+      q0 = graphene_simd4f_mul (yx, y0);
+      q1 = graphene_simd4f_mul (yx, y1);
+      min_x = graphene_simd4f_add (graphene_simd4f_add (graphene_simd4f_min (p0, p1),
+                                                        graphene_simd4f_min (q0, q1)),
+                                   tx);
+      max_x = graphene_simd4f_add (graphene_simd4f_add (graphene_simd4f_max (p0, p1),
+                                                        graphene_simd4f_max (q0, q1)),
+                                   tx);
+
+      p0 = graphene_simd4f_mul (xy, x0);
+      p1 = graphene_simd4f_mul (xy, x1);
+      q0 = graphene_simd4f_mul (yy, y0);
+      q1 = graphene_simd4f_mul (yy, y1);
+      min_y = graphene_simd4f_add (graphene_simd4f_add (graphene_simd4f_min (p0, p1),
+                                                        graphene_simd4f_min (q0, q1)),
+                                   ty);
+      max_y = graphene_simd4f_add (graphene_simd4f_add (graphene_simd4f_max (p0, p1),
+                                                        graphene_simd4f_max (q0, q1)),
+                                   ty);
+    }
+
+  rects = graphene_simd4x4f_init (min_x,
+                                  min_y,
+                                  graphene_simd4f_sub (max_x, min_x),
+                                  graphene_simd4f_sub (max_y, min_y));
+  graphene_simd4x4f_transpose_in_place (&rects);
+
+  rows[0] = rects.x;
+  rows[1] = rects.y;
+  rows[2] = rects.z;
+  rows[3] = rects.w;
+
+  for (unsigned int i = 0; i < n_rects; i++)
+    {
+      float f[4];
+
+      graphene_simd4f_dup_4f (rows[i], f);
+      graphene_rect_init (&res[i], f[0], f[1], f[2], f[3]);
+    }
+}
+
+static void
+matrix_transform_bounds_array (const graphene_simd4x4f_t *m,
+                               unsigned int               n_rects,
+                               const graphene_rect_t     *r,
+                               graphene_rect_t           *res)
+{
+  const graphene_simd4x4f_t mat = *m;
+  bool scale_translate;
+  unsigned int i;
+
+  /* 2D scale and translation only: the x and y axes do not mix */
+  scale_translate = fabsf (graphene_simd4f_get_y (mat.x)) < FLT_EPSILON &&
+                    fabsf (graphene_simd4f_get_x (mat.y)) < FLT_EPSILON;
+
+  for (i = 0; i + 4 <= n_rects; i += 4)
+    matrix_transform_bounds_x4 (&mat, scale_translate, &r[i], 4, &res[i]);
+
+  if (i < n_rects)
+    matrix_transform_bounds_x4 (&mat, scale_translate, &r[i], n_rects - i, &res[i]);
+}
+
+/* Transforms boxes in their center and half extents form; the center
+ * is transformed as a point, and the half extents by the absolute value
+ * of the linear part of the matrix, which gives the same bounds as the
+ * eight transformed vertices for a quarter of the work; see
+ * "Transforming Axis-Aligned Bounding Boxes", J. Arvo, Graphics Gems,
+ * 1990. Empty boxes stay empty, and unbounded boxes become infinite
+ */
+static void
+matrix_transform_boxes (const graphene_simd4x4f_t *m,
+                        unsigned int               n_boxes,
+                        const graphene_box_t      *boxes,
+                        graphene_box_t            *res)
+{
+  const graphene_simd4x4f_t mat = *m;
+  const graphene_simd4f_t half = graphene_simd4f_splat (0.5f);
+  const graphene_simd4f_t limit = graphene_simd4f_splat (INFINITY);
+  const graphene_simd4f_t inf = graphene_simd4f_zero_w (limit);
+  const graphene_simd4f_t abs_x = graphene_simd4f_max (mat.x, graphene_simd4f_neg (mat.x));
+  const graphene_simd4f_t abs_y = graphene_simd4f_max (mat.y, graphene_simd4f_neg (mat.y));
+  const graphene_simd4f_t abs_z = graphene_simd4f_max (mat.z, graphene_simd4f_neg (mat.z));
+  const graphene_simd4f_t w = graphene_simd4f_zero_w (mat.w);
+
+  for (unsigned int i = 0; i < n_boxes; i++)
+    {
+      const graphene_simd4f_t b_min = graphene_simd4f_zero_w (boxes[i].min.value);
+      const graphene_simd4f_t b_max = graphene_simd4f_zero_w (boxes[i].max.value);
+      const graphene_simd4f_t size = graphene_simd4f_sub (b_max, b_min);
+      graphene_simd4f_t c, e, r_c, r_e;
+
+      if (unlikely (!graphene_simd4f_cmp_le (b_min, b_max)))
+        {
+          res[i].min.value = inf;
+          res[i].max.value = graphene_simd4f_neg (inf);
+          continue;
+        }
+
+      if (unlikely (!graphene_simd4f_cmp_lt (size, limit)))
+        {
+          res[i].min.value = graphene_simd4f_neg (inf);
+          res[i].max.value = inf;
+          continue;
+        }
+
+      c = graphene_simd4f_mul (graphene_simd4f_add (b_min, b_max), half);
+      e = graphene_simd4f_mul (size, half);
+
+      r_c = graphene_simd4f_madd (graphene_simd4f_splat_x (c), mat.x,
+                                  graphene_simd4f_madd (graphene_simd4f_splat_y (c), mat.y,
+                                                        graphene_simd4f_madd (graphene_simd4f_splat_z (c), mat.z, w)));
+      r_e = graphene_simd4f_madd (graphene_simd4f_splat_x (e), abs_x,
+                                  graphene_simd4f_madd (graphene_simd4f_splat_y (e), abs_y,
+                                                        graphene_simd4f_mul (graphene_simd4f_splat_z (e), abs_z)));
+
+      res[i].min.value = graphene_simd4f_zero_w (graphene_simd4f_sub (r_c, r_e));
+      res[i].max.value = graphene_simd4f_zero_w (graphene_simd4f_add (r_c, r_e));
+    }
+}
+
+/* The bounds of packed elements of three floats; each block of eight
+ * elements is loaded as three vectors, and lane k of the j-th vector
+ * always holds the component (8 * j + k) % 3, so each vector has its
+ * own accumulators and no shuffling is needed until the end
+ */
+static unsigned int
+box_bounds_packed3 (unsigned int  n_elements,
+                    const float  *p,
+                    float         min_v[4],
+                    float         max_v[4])
+{
+  graphene_simd8f_t min_0, min_1, min_2, max_0, max_1, max_2;
+  float min_f[24], max_f[24];
+  unsigned int i;
+
+  if (n_elements < 8)
+    return 0;
+
+  min_0 = min_1 = min_2 = graphene_simd8f_splat (INFINITY);
+  max_0 = max_1 = max_2 = graphene_simd8f_splat (-INFINITY);
+
+  for (i = 0; i + 8 <= n_elements; i += 8, p += 24)
+    {
+      graphene_simd8f_t v0 = graphene_simd8f_init_8f (p);
+      graphene_simd8f_t v1 = graphene_simd8f_init_8f (p + 8);
+      graphene_simd8f_t v2 = graphene_simd8f_init_8f (p + 16);
+
+      min_0 = graphene_simd8f_min (min_0, v0);
+      max_0 = graphene_simd8f_max (max_0, v0);
+      min_1 = graphene_simd8f_min (min_1, v1);
+      max_1 = graphene_simd8f_max (max_1, v1);
+      min_2 = graphene_simd8f_min (min_2, v2);
+      max_2 = graphene_simd8f_max (max_2, v2);
+    }
+
+  graphene_simd8f_dup_8f (min_0, min_f);
+  graphene_simd8f_dup_8f (min_1, min_f + 8);
+  graphene_simd8f_dup_8f (min_2, min_f + 16);
+  graphene_simd8f_dup_8f (max_0, max_f);
+  graphene_simd8f_dup_8f (max_1, max_f + 8);
+  graphene_simd8f_dup_8f (max_2, max_f + 16);
+
+  for (unsigned int j = 0; j < 24; j++)
+    {
+      min_v[j % 3] = MIN (min_v[j % 3], min_f[j]);
+      max_v[j % 3] = MAX (max_v[j % 3], max_f[j]);
+    }
+
+  return i;
+}
+
+/* Like box_bounds_packed3(), for elements of @n_floats floats, with
+ * @n_floats being 2 or 4; every vector has the same lane layout, so
+ * the four vectors of each block use independent accumulators only to
+ * break the dependency chains
+ */
+static unsigned int
+box_bounds_packed_pow2 (unsigned int  n_elements,
+                        unsigned int  n_floats,
+                        const float  *p,
+                        float         min_v[4],
+                        float         max_v[4])
+{
+  unsigned int block_size = 32 / n_floats;
+  graphene_simd8f_t min_0, min_1, min_2, min_3, max_0, max_1, max_2, max_3;
+  float min_f[8], max_f[8];
+  unsigned int i;
+
+  if (n_elements < block_size)
+    return 0;
+
+  min_0 = min_1 = min_2 = min_3 = graphene_simd8f_splat (INFINITY);
+  max_0 = max_1 = max_2 = max_3 = graphene_simd8f_splat (-INFINITY);
+
+  for (i = 0; i + block_size <= n_elements; i += block_size, p += 32)
+    {
+      graphene_simd8f_t v0 = graphene_simd8f_init_8f (p);
+      graphene_simd8f_t v1 = graphene_simd8f_init_8f (p + 8);
+      graphene_simd8f_t v2 = graphene_simd8f_init_8f (p + 16);
+      graphene_simd8f_t v3 = graphene_simd8f_init_8f (p + 24);
+
+      min_0 = graphene_simd8f_min (min_0, v0);
+      max_0 = graphene_simd8f_max (max_0, v0);
+      min_1 = graphene_simd8f_min (min_1, v1);
+      max_1 = graphene_simd8f_max (max_1, v1);
+      min_2 = graphene_simd8f_min (min_2, v2);
+      max_2 = graphene_simd8f_max (max_2, v2);
+      min_3 = graphene_simd8f_min (min_3, v3);
+      max_3 = graphene_simd8f_max (max_3, v3);
+    }
+
+  min_0 = graphene_simd8f_min (graphene_simd8f_min (min_0, min_1),
+                               graphene_simd8f_min (min_2, min_3));
+  max_0 = graphene_simd8f_max (graphene_simd8f_max (max_0, max_1),
+                               graphene_simd8f_max (max_2, max_3));
+
+  graphene_simd8f_dup_8f (min_0, min_f);
+  graphene_simd8f_dup_8f (max_0, max_f);
+
+  for (unsigned int j = 0; j < 8; j++)
+    {
+      min_v[j % n_floats] = MIN (min_v[j % n_floats], min_f[j]);
+      max_v[j % n_floats] = MAX (max_v[j % n_floats], max_f[j]);
+    }
+
+  return i;
+}
+
+/* Any stride; two sets of accumulators for the even and odd elements */
+static unsigned int
+box_bounds_generic (const graphene_strided_view_t *points,
+                    unsigned int                   n_elements,
+                    float                          min_v[4],
+                    float                          max_v[4])
+{
+  graphene_simd4f_t min_0, min_1, max_0, max_1;
+  float f[4];
+  unsigned int i;
+
+  if (n_elements < 2)
+    return 0;
+
+  min_0 = min_1 = graphene_simd4f_splat (INFINITY);
+  max_0 = max_1 = graphene_simd4f_splat (-INFINITY);
+
+  for (i = 0; i + 2 <= n_elements; i += 2)
+    {
+      const float *p0 = graphene_strided_view_get_element (points, i);
+      const float *p1 = graphene_strided_view_get_element (points, i + 1);
+      graphene_simd4f_t v0, v1;
+
+      if (points->n_components > 2)
+        {
+          v0 = graphene_simd4f_init (p0[0], p0[1], p0[2], 0.f);
+          v1 = graphene_simd4f_init (p1[0], p1[1], p1[2], 0.f);
+        }
+      else
+        {
+          v0 = graphene_simd4f_init (p0[0], p0[1], 0.f, 0.f);
+          v1 = graphene_simd4f_init (p1[0], p1[1], 0.f, 0.f);
+        }
+
+      min_0 = graphene_simd4f_min (min_0, v0);
+      max_0 = graphene_simd4f_max (max_0, v0);
+      min_1 = graphene_simd4f_min (min_1, v1);
+      max_1 = graphene_simd4f_max (max_1, v1);
+    }
+
+  graphene_simd4f_dup_4f (graphene_simd4f_min (min_0, min_1), f);
+  for (unsigned int j = 0; j < 3; j++)
+    min_v[j] = MIN (min_v[j], f[j]);
+
+  graphene_simd4f_dup_4f (graphene_simd4f_max (max_0, max_1), f);
+  for (unsigned int j = 0; j < 3; j++)
+    max_v[j] = MAX (max_v[j], f[j]);
+
+  return i;
+}
+
+static void
+box_bounds_strided (const graphene_strided_view_t *points,
+                    graphene_box_t                *res)
+{
+  unsigned int n_elements = graphene_strided_view_get_n_elements (points);
+  unsigned int n_components = MIN (points->n_components, 3);
+  float min_v[4] = { INFINITY, INFINITY, INFINITY, INFINITY };
+  float max_v[4] = { -INFINITY, -INFINITY, -INFINITY, -INFINITY };
+  unsigned int i;
+
+  if (n_components == 3 && points->stride == sizeof (float) * 3)
+    i = box_bounds_packed3 (n_elements, points->data, min_v, max_v);
+  else if (n_components == 3 && points->stride == sizeof (float) * 4)
+    {
+      /* The blocks also load the unused fourth float of each element;
+       * for the last element, it may be past the end of the buffer, so
+       * the last element is left to the loop below
+       */
+      unsigned int n_blocked = points->n_components == 4 ? n_elements : MAX (n_elements, 1) - 1;
+
+      i = box_bounds_packed_pow2 (n_blocked, 4, points->data, min_v, max_v);
+    }
+  else if (n_components == 2 && points->stride == sizeof (float) * 2)
+    i = box_bounds_packed_pow2 (n_elements, 2, points->data, min_v, max_v);
+  else
+    i = box_bounds_generic (points, n_elements, min_v, max_v);
+
+  for (; i < n_elements; i++)
+    {
+      const float *p = graphene_strided_view_get_element (points, i);
+
+      for (unsigned int j = 0; j < n_components; j++)
+        {
+          min_v[j] = MIN (min_v[j], p[j]);
+          max_v[j] = MAX (max_v[j], p[j]);
+        }
+    }
+
+  /* Points with two components are on the z = 0 plane */
+  if (n_components == 2 && n_elements > 0)
+    min_v[2] = max_v[2] = 0.f;
+
+  res->min.value = graphene_simd4f_init (min_v[0], min_v[1], min_v[2], 0.f);
+  res->max.value = graphene_simd4f_init (max_v[0], max_v[1], max_v[2], 0.f);
+}
+
+/* Loads up to eight of the @n_points points in "structure of arrays"
+ * form; the missing lanes repeat the last point
+ */
+static inline void
+points_load_x8 (const graphene_point3d_t *points,
+                unsigned int              n_points,
+                graphene_simd8f_t        *x,
+                graphene_simd8f_t        *y,
+                graphene_simd8f_t        *z)
+{
+  unsigned int n_lanes = MIN (n_points, 8);
+  graphene_simd4f_t rows[8];
+  graphene_simd8f_t w;
+
+  /* If another point follows the eighth, loading four floats for each
+   * point stays inside the array; the w lane is ignored
+   */
+  if (n_points > 8)
+    {
+      for (unsigned int j = 0; j < 8; j++)
+        rows[j] = graphene_simd4f_init_4f (&points[j].x);
+    }
+  else
+    {
+      for (unsigned int j = 0; j < 8; j++)
+        {
+          const graphene_point3d_t *pt = &points[MIN (j, n_lanes - 1)];
+
+          rows[j] = graphene_simd4f_init (pt->x, pt->y, pt->z, 0.f);
+        }
+    }
+
+  graphene_simd8f_transpose_simd4f (rows, x, y, z, &w);
+}
+
+static inline graphene_simd8f_t
+points_distance_sq_x8 (graphene_simd8f_t x,
+                       graphene_simd8f_t y,
+                       graphene_simd8f_t z,
+                       graphene_simd8f_t cx,
+                       graphene_simd8f_t cy,
+                       graphene_simd8f_t cz)
+{
+  graphene_simd8f_t dx = graphene_simd8f_sub (x, cx);
+  graphene_simd8f_t dy = graphene_simd8f_sub (y, cy);
+  graphene_simd8f_t dz = graphene_simd8f_sub (z, cz);
+  graphene_simd8f_t d = graphene_simd8f_mul (dx, dx);
+
+  d = graphene_simd8f_madd (dy, dy, d);
+  d = graphene_simd8f_madd (dz, dz, d);
+
+  return d;
+}
+
+static unsigned int
+sphere_find_outside (const graphene_sphere_t  *s,
+                     unsigned int              n_points,
+                     const graphene_point3d_t *points)
+{
+  graphene_simd8f_t cx = graphene_simd8f_splat (graphene_simd4f_get_x (s->center.value));
+  graphene_simd8f_t cy = graphene_simd8f_splat (graphene_simd4f_get_y (s->center.value));
+  graphene_simd8f_t cz = graphene_simd8f_splat (graphene_simd4f_get_z (s->center.value));
+  graphene_simd8f_t radius_sq = graphene_simd8f_splat (s->radius * s->radius);
+
+  for (unsigned int i = 0; i < n_points; i += 8)
+    {
+      unsigned int n_lanes = MIN (n_points - i, 8);
+      graphene_simd8f_t x, y, z, d;
+      unsigned int bits;
+
+      points_load_x8 (&points[i], n_points - i, &x, &y, &z);
+
+      d = points_distance_sq_x8 (x, y, z, cx, cy, cz);
+
+      bits = ~graphene_simd8f_mask_le (d, radius_sq) & ((1u << n_lanes) - 1);
+      if (bits != 0)
+        {
+          unsigned int j = 0;
+
+          while ((bits & (1u << j)) == 0)
+            j++;
+
+          return i + j;
+        }
+    }
+
+  return n_points;
+}
+
+static float
+points_max_distance_sq (const graphene_vec3_t    *center,
+                        unsigned int              n_points,
+                        const graphene_point3d_t *points)
+{
+  graphene_simd8f_t cx = graphene_simd8f_splat (graphene_simd4f_get_x (center->value));
+  graphene_simd8f_t cy = graphene_simd8f_splat (graphene_simd4f_get_y (center->value));
+  graphene_simd8f_t cz = graphene_simd8f_splat (graphene_simd4f_get_z (center->value));
+  graphene_simd8f_t max_d = graphene_simd8f_init_zero ();
+  float f[8], res = 0.f;
+
+  for (unsigned int i = 0; i < n_points; i += 8)
+    {
+      graphene_simd8f_t x, y, z;
+
+      points_load_x8 (&points[i], n_points - i, &x, &y, &z);
+
+      max_d = graphene_simd8f_max (max_d, points_distance_sq_x8 (x, y, z, cx, cy, cz));
+    }
+
+  graphene_simd8f_dup_8f (max_d, f);
+  for (unsigned int j = 0; j < 8; j++)
+    res = MAX (res, f[j]);
+
+  return res;
+}
+
+/* The clip planes of a frustum, transposed so that each SIMD register
+ * holds one component of a plane, splatted across all lanes; this
+ * allows testing eight volumes at a time against each plane
+ */
+typedef struct {
+  graphene_simd8f_t nx[N_CLIP_PLANES];
+  graphene_simd8f_t ny[N_CLIP_PLANES];
+  graphene_simd8f_t nz[N_CLIP_PLANES];
+  graphene_simd8f_t d[N_CLIP_PLANES];
+} frustum_planes_soa_t;
+
+static inline void
+frustum_planes_to_soa (const graphene_frustum_t *f,
+                       frustum_planes_soa_t     *res)
+{
+  for (int i = 0; i < N_CLIP_PLANES; i++)
+    {
+      float n[4];
+
+      graphene_simd4f_dup_4f (f->planes[i].normal.value, n);
+
+      res->nx[i] = graphene_simd8f_splat (n[0]);
+      res->ny[i] = graphene_simd8f_splat (n[1]);
+      res->nz[i] = graphene_simd8f_splat (n[2]);
+      res->d[i] = graphene_simd8f_splat (f->planes[i].constant);
+    }
+}
+
+/* Packs the results for up to eight lanes into the visibility bitmask,
+ * and returns the number of visible lanes; a lane is visible if its
+ * smallest distance from the clip planes is not negative
+ */
+static inline unsigned int
+frustum_store_visible (graphene_simd8f_t  min_distance,
+                       unsigned int       first,
+                       unsigned int       n_lanes,
+                       uint32_t          *visible)
+{
+  unsigned int n_visible = 0;
+  uint32_t bits;
+
+  bits = graphene_simd8f_mask_ge (min_distance, graphene_simd8f_init_zero ());
+  bits &= (1u << n_lanes) - 1;
+
+  /* Groups of eight never straddle two words */
+  visible[first / 32] |= bits << (first % 32);
+
+  for (uint32_t b = bits; b != 0; b &= b - 1)
+    n_visible += 1;
+
+  return n_visible;
+}
+
+static inline void
+frustum_clear_visible (unsigned int  n_elements,
+                       uint32_t     *visible)
+{
+  memset (visible, 0, sizeof (uint32_t) * ((n_elements + 31) / 32));
+}
+
+/* Culls @n_points points of @n_components floats; only the first three
+ * components are used
+ */
+static inline unsigned int
+frustum_cull_elements (const graphene_frustum_t *f,
+                       unsigned int              n_points,
+                       unsigned int              n_components,
+                       const char               *points,
+                       size_t                    stride,
+                       uint32_t                 *visible)
+{
+  frustum_planes_soa_t planes;
+  unsigned int n_visible = 0;
+
+  frustum_planes_to_soa (f, &planes);
+  frustum_clear_visible (n_points, visible);
+
+  for (unsigned int i = 0; i < n_points; i += 8)
+    {
+      unsigned int n_lanes = MIN (n_points - i, 8);
+      graphene_simd4f_t rows[8];
+      graphene_simd8f_t x, y, z, w;
+      graphene_simd8f_t min_d = graphene_simd8f_splat (FLT_MAX);
+
+      for (unsigned int j = 0; j < 8; j++)
+        {
+          const float *pt = (const float *) (points + (i + MIN (j, n_lanes - 1)) * stride);
+
+          rows[j] = graphene_simd4f_init (pt[0], pt[1], n_components > 2 ? pt[2] : 0.f, 0.f);
+        }
+
+      graphene_simd8f_transpose_simd4f (rows, &x, &y, &z, &w);
+
+      for (int k = 0; k < N_CLIP_PLANES; k++)
+        {
+          graphene_simd8f_t d;
+
+          d = graphene_simd8f_madd (planes.nx[k], x, planes.d[k]);
+          d = graphene_simd8f_madd (planes.ny[k], y, d);
+          d = graphene_simd8f_madd (planes.nz[k], z, d);
+
+          min_d = graphene_simd8f_min (min_d, d);
+        }
+
+      n_visible += frustum_store_visible (min_d, i, n_lanes, visible);
+    }
+
+  return n_visible;
+}
+
+static unsigned int
+frustum_cull_points (const graphene_frustum_t *f,
+                     unsigned int              n_points,
+                     const graphene_point3d_t *points,
+                     uint32_t                 *visible)
+{
+  return frustum_cull_elements (f, n_points, 3,
+                                (const char *) points, sizeof (graphene_point3d_t),
+                                visible);
+}
+
+static unsigned int
+frustum_cull_strided (const graphene_frustum_t      *f,
+                      const graphene_strided_view_t *points,
+                      uint32_t                      *visible)
+{
+  unsigned int n_points = graphene_strided_view_get_n_elements (points);
+
+  if (points->n_components == 2)
+    return frustum_cull_elements (f, n_points, 2, points->data, points->stride, visible);
+
+  return frustum_cull_elements (f, n_points, 3, points->data, points->stride, visible);
+}
+
+static unsigned int
+frustum_cull_spheres (const graphene_frustum_t *f,
+                      unsigned int              n_spheres,
+                      const graphene_sphere_t  *spheres,
+                      uint32_t                 *visible)
+{
+  frustum_planes_soa_t planes;
+  unsigned int n_visible = 0;
+
+  frustum_planes_to_soa (f, &planes);
+  frustum_clear_visible (n_spheres, visible);
+
+  for (unsigned int i = 0; i < n_spheres; i += 8)
+    {
+      unsigned int n_lanes = MIN (n_spheres - i, 8);
+      graphene_simd4f_t rows[8];
+      graphene_simd8f_t x, y, z, radius;
+      graphene_simd8f_t min_d = graphene_simd8f_splat (FLT_MAX);
+
+      /* Pack the radius in the w component of the center */
+      for (unsigned int j = 0; j < 8; j++)
+        {
+          const graphene_sphere_t *sphere = &spheres[i + MIN (j, n_lanes - 1)];
+
+          rows[j] = graphene_simd4f_merge_w (sphere->center.value, sphere->radius);
+        }
+
+      graphene_simd8f_transpose_simd4f (rows, &x, &y, &z, &radius);
+
+      for (int k = 0; k < N_CLIP_PLANES; k++)
+        {
+          graphene_simd8f_t d;
+
+          d = graphene_simd8f_madd (planes.nx[k], x, planes.d[k]);
+          d = graphene_simd8f_madd (planes.ny[k], y, d);
+          d = graphene_simd8f_madd (planes.nz[k], z, d);
+
+          min_d = graphene_simd8f_min (min_d, d);
+        }
+
+      min_d = graphene_simd8f_add (min_d, radius);
+
+      n_visible += frustum_store_visible (min_d, i, n_lanes, visible);
+    }
+
+  return n_visible;
+}
+
+static unsigned int
+frustum_cull_boxes (const graphene_frustum_t *f,
+                    unsigned int              n_boxes,
+                    const graphene_box_t     *boxes,
+                    uint32_t                 *visible)
+{
+  frustum_planes_soa_t planes;
+  unsigned int n_visible = 0;
+
+  frustum_planes_to_soa (f, &planes);
+  frustum_clear_visible (n_boxes, visible);
+
+  for (unsigned int i = 0; i < n_boxes; i += 8)
+    {
+      unsigned int n_lanes = MIN (n_boxes - i, 8);
+      graphene_simd4f_t min_rows[8], max_rows[8];
+      graphene_simd8f_t min_x, min_y, min_z, max_x, max_y, max_z, w;
+      graphene_simd8f_t min_d = graphene_simd8f_splat (FLT_MAX);
+
+      for (unsigned int j = 0; j < 8; j++)
+        {
+          const graphene_box_t *b = &boxes[i + MIN (j, n_lanes - 1)];
+
+          min_rows[j] = b->min.value;
+          max_rows[j] = b->max.value;
+        }
+
+      graphene_simd8f_transpose_simd4f (min_rows, &min_x, &min_y, &min_z, &w);
+      graphene_simd8f_transpose_simd4f (max_rows, &max_x, &max_y, &max_z, &w);
+
+      /* The distance of the p-vertex, i.e. the corner of the box that
+       * is farthest along the normal of each plane; if it's behind any
+       * plane, then the whole box is outside of the frustum
+       */
+      for (int k = 0; k < N_CLIP_PLANES; k++)
+        {
+          graphene_simd8f_t d;
+
+          d = graphene_simd8f_add (graphene_simd8f_max (graphene_simd8f_mul (planes.nx[k], min_x),
+                                                        graphene_simd8f_mul (planes.nx[k], max_x)),
+                                   planes.d[k]);
+          d = graphene_simd8f_add (graphene_simd8f_max (graphene_simd8f_mul (planes.ny[k], min_y),
+                                                        graphene_simd8f_mul (planes.ny[k], max_y)),
+                                   d);
+          d = graphene_simd8f_add (graphene_simd8f_max (graphene_simd8f_mul (planes.nz[k], min_z),
+                                                        graphene_simd8f_mul (planes.nz[k], max_z)),
+                                   d);
+
+          min_d = graphene_simd8f_min (min_d, d);
+        }
+
+      n_visible += frustum_store_visible (min_d, i, n_lanes, visible);
+    }
+
+  return n_visible;
+}
+
+static unsigned int
+ray_intersect_boxes (const graphene_ray_t *r,
+                     unsigned int          n_boxes,
+                     const graphene_box_t *boxes,
+                     float                *t_out,
+                     uint32_t             *hits)
+{
+  graphene_simd8f_t origin_x, origin_y, origin_z;
+  graphene_simd8f_t inv_dir_x, inv_dir_y, inv_dir_z;
+  graphene_simd4f_t inv_dir_v = graphene_simd4f_reciprocal (r->direction.value);
+  unsigned int n_hits = 0;
+  float o[4], inv_dir[4];
+
+  graphene_simd4f_dup_4f (r->origin.value, o);
+  graphene_simd4f_dup_4f (inv_dir_v, inv_dir);
+
+  origin_x = graphene_simd8f_splat (o[0]);
+  origin_y = graphene_simd8f_splat (o[1]);
+  origin_z = graphene_simd8f_splat (o[2]);
+  inv_dir_x = graphene_simd8f_splat (inv_dir[0]);
+  inv_dir_y = graphene_simd8f_splat (inv_dir[1]);
+  inv_dir_z = graphene_simd8f_splat (inv_dir[2]);
+
+  memset (hits, 0, sizeof (uint32_t) * ((n_boxes + 31) / 32));
+
+  for (unsigned int i = 0; i < n_boxes; i += 8)
+    {
+      unsigned int n_lanes = MIN (n_boxes - i, 8);
+      graphene_simd4f_t min_rows[8], max_rows[8];
+      graphene_simd8f_t min_x, min_y, min_z, max_x, max_y, max_z, w;
+      graphene_simd8f_t t0, t1, t_near, t_far, t_min, t_max;
+      unsigned int bits;
+
+      for (unsigned int j = 0; j < 8; j++)
+        {
+          const graphene_box_t *b = &boxes[i + MIN (j, n_lanes - 1)];
+
+          min_rows[j] = b->min.value;
+          max_rows[j] = b->max.value;
+        }
+
+      graphene_simd8f_transpose_simd4f (min_rows, &min_x, &min_y, &min_z, &w);
+      graphene_simd8f_transpose_simd4f (max_rows, &max_x, &max_y, &max_z, &w);
+
+      /* Slab test, like graphene_ray_packet_intersect_box() */
+      t0 = graphene_simd8f_mul (graphene_simd8f_sub (min_x, origin_x), inv_dir_x);
+      t1 = graphene_simd8f_mul (graphene_simd8f_sub (max_x, origin_x), inv_dir_x);
+      t_min = graphene_simd8f_min (t0, t1);
+      t_max = graphene_simd8f_max (t0, t1);
+
+      t0 = graphene_simd8f_mul (graphene_simd8f_sub (min_y, origin_y), inv_dir_y);
+      t1 = graphene_simd8f_mul (graphene_simd8f_sub (max_y, origin_y), inv_dir_y);
+      t_near = graphene_simd8f_min (t0, t1);
+      t_far = graphene_simd8f_max (t0, t1);
+      t_min = graphene_simd8f_max (t_min, t_near);
+      t_max = graphene_simd8f_min (t_max, t_far);
+
+      t0 = graphene_simd8f_mul (graphene_simd8f_sub (min_z, origin_z), inv_dir_z);
+      t1 = graphene_simd8f_mul (graphene_simd8f_sub (max_z, origin_z), inv_dir_z);
+      t_near = graphene_simd8f_min (t0, t1);
+      t_far = graphene_simd8f_max (t0, t1);
+      t_min = graphene_simd8f_max (t_min, t_near);
+      t_max = graphene_simd8f_min (t_max, t_far);
+
+      bits = graphene_simd8f_mask_le (t_min, t_max) &
+             graphene_simd8f_mask_ge (t_max, graphene_simd8f_init_zero ()) &
+             ((1u << n_lanes) - 1);
+
+      hits[i / 32] |= bits << (i % 32);
+
+      if (t_out != NULL)
+        {
+          float t_min_v[8], t_max_v[8];
+
+          graphene_simd8f_dup_8f (t_min, t_min_v);
+          graphene_simd8f_dup_8f (t_max, t_max_v);
+
+          /* return the point closest to the ray (positive side) */
+          for (unsigned int j = 0; j < n_lanes; j++)
+            {
+              if ((bits & (1u << j)) == 0)
+                t_out[i + j] = 0.f;
+              else
+                t_out[i + j] = t_min_v[j] >= 0.f ? t_min_v[j] : t_max_v[j];
+            }
+        }
+
+      for (; bits != 0; bits &= bits - 1)
+        n_hits += 1;
+    }
+
+  return n_hits;
+}
+
+/* Loads up to eight floats, padding the missing lanes with zeroes */
+static inline graphene_simd8f_t
+soa_load (const float  *v,
+          unsigned int  n)
+{
+  float tmp[8] = { 0.f, };
+
+  if (n >= 8)
+    return graphene_simd8f_init_8f (v);
+
+  memcpy (tmp, v, sizeof (float) * n);
+
+  return graphene_simd8f_init_8f (tmp);
+}
+
+/* Stores up to eight floats */
+static inline void
+soa_store (graphene_simd8f_t  s,
+           float             *v,
+           unsigned int       n)
+{
+  float tmp[8];
+
+  if (n >= 8)
+    {
+      graphene_simd8f_dup_8f (s, v);
+      return;
+    }
+
+  graphene_simd8f_dup_8f (s, tmp);
+  memcpy (v, tmp, sizeof (float) * n);
+}
+
+static void
+soa_add (unsigned int  n,
+         const float  *a,
+         const float  *b,
+         float        *res)
+{
+  for (unsigned int i = 0; i < n; i += 8)
+    soa_store (graphene_simd8f_add (soa_load (a + i, n - i), soa_load (b + i, n - i)),
+               res + i, n - i);
+}
+
+static void
+soa_subtract (unsigned int  n,
+              const float  *a,
+              const float  *b,
+              float        *res)
+{
+  for (unsigned int i = 0; i < n; i += 8)
+    soa_store (graphene_simd8f_sub (soa_load (a + i, n - i), soa_load (b + i, n - i)),
+               res + i, n - i);
+}
+
+static void
+soa_scale (unsigned int  n,
+           const float  *a,
+           float         factor,
+           float        *res)
+{
+  const graphene_simd8f_t f = graphene_simd8f_splat (factor);
+
+  for (unsigned int i = 0; i < n; i += 8)
+    soa_store (graphene_simd8f_mul (soa_load (a + i, n - i), f), res + i, n - i);
+}
+
+static void
+soa_lerp (unsigned int  n,
+          const float  *a,
+          const float  *b,
+          float         factor,
+          float        *res)
+{
+  const graphene_simd8f_t f = graphene_simd8f_splat (factor);
+
+  for (unsigned int i = 0; i < n; i += 8)
+    {
+      graphene_simd8f_t va = soa_load (a + i, n - i);
+      graphene_simd8f_t vb = soa_load (b + i, n - i);
+
+      soa_store (graphene_simd8f_madd (graphene_simd8f_sub (vb, va), f, va), res + i, n - i);
+    }
+}
+
+/* @n must be greater than zero */
+static void
+soa_min_max (unsigned int  n,
+             const float  *a,
+             float        *min,
+             float        *max)
+{
+  graphene_simd8f_t v_min = graphene_simd8f_splat (a[0]);
+  graphene_simd8f_t v_max = v_min;
+  float min_v[8], max_v[8];
+  unsigned int i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      graphene_simd8f_t v = graphene_simd8f_init_8f (a + i);
+
+      v_min = graphene_simd8f_min (v_min, v);
+      v_max = graphene_simd8f_max (v_max, v);
+    }
+
+  graphene_simd8f_dup_8f (v_min, min_v);
+  graphene_simd8f_dup_8f (v_max, max_v);
+
+  for (; i < n; i++)
+    {
+      min_v[0] = MIN (min_v[0], a[i]);
+      max_v[0] = MAX (max_v[0], a[i]);
+    }
+
+  *min = min_v[0];
+  *max = max_v[0];
+
+  for (unsigned int j = 1; j < 8; j++)
+    {
+      *min = MIN (*min, min_v[j]);
+      *max = MAX (*max, max_v[j]);
+    }
+}
+
+static inline graphene_simd8f_t
+soa_dot_block (unsigned int         n_components,
+               const float * const *a,
+               const float * const *b,
+               unsigned int         i,
+               unsigned int         n_lanes)
+{
+  graphene_simd8f_t res = graphene_simd8f_mul (soa_load (a[0] + i, n_lanes),
+                                               soa_load (b[0] + i, n_lanes));
+
+  for (unsigned int c = 1; c < n_components; c++)
+    res = graphene_simd8f_madd (soa_load (a[c] + i, n_lanes), soa_load (b[c] + i, n_lanes), res);
+
+  return res;
+}
+
+static void
+soa_dot (unsigned int         n,
+         unsigned int         n_components,
+         const float * const *a,
+         const float * const *b,
+         float               *res)
+{
+  for (unsigned int i = 0; i < n; i += 8)
+    soa_store (soa_dot_block (n_components, a, b, i, n - i), res + i, n - i);
+}
+
+static void
+soa_length (unsigned int         n,
+            unsigned int         n_components,
+            const float * const *a,
+            float               *res)
+{
+  for (unsigned int i = 0; i < n; i += 8)
+    soa_store (graphene_simd8f_sqrt (soa_dot_block (n_components, a, a, i, n - i)),
+               res + i, n - i);
+}
+
+/* Like vec3_normalize() and vec4_normalize(), vectors whose length is
+ * not greater than FLT_EPSILON are normalized to zero
+ */
+static void
+soa_normalize (unsigned int         n,
+               unsigned int         n_components,
+               const float * const *a,
+               float * const       *res)
+{
+  const graphene_simd8f_t epsilon = graphene_simd8f_splat (FLT_EPSILON);
+  const graphene_simd8f_t one = graphene_simd8f_splat (1.f);
+
+  for (unsigned int i = 0; i < n; i += 8)
+    {
+      unsigned int n_lanes = MIN (n - i, 8);
+      graphene_simd8f_t len = graphene_simd8f_sqrt (soa_dot_block (n_components, a, a, i, n_lanes));
+      unsigned int zero_bits = graphene_simd8f_mask_le (len, epsilon) & ((1u << n_lanes) - 1);
+      graphene_simd8f_t inv_len = graphene_simd8f_div (one, len);
+      graphene_simd8f_t v[4];
+
+      for (unsigned int c = 0; c < n_components; c++)
+        v[c] = graphene_simd8f_mul (soa_load (a[c] + i, n_lanes), inv_len);
+
+      for (unsigned int c = 0; c < n_components; c++)
+        soa_store (v[c], res[c] + i, n_lanes);
+
+      if (zero_bits == 0)
+        continue;
+
+      for (unsigned int j = 0; j < n_lanes; j++)
+        {
+          if ((zero_bits & (1u << j)) == 0)
+            continue;
+
+          for (unsigned int c = 0; c < n_components; c++)
+            res[c][i + j] = 0.f;
+        }
+    }
+}
+
+static void
+soa_cross (unsigned int         n,
+           const float * const *a,
+           const float * const *b,
+           float * const       *res)
+{
+  for (unsigned int i = 0; i < n; i += 8)
+    {
+      graphene_simd8f_t ax = soa_load (a[0] + i, n - i);
+      graphene_simd8f_t ay = soa_load (a[1] + i, n - i);
+      graphene_simd8f_t az = soa_load (a[2] + i, n - i);
+      graphene_simd8f_t bx = soa_load (b[0] + i, n - i);
+      graphene_simd8f_t by = soa_load (b[1] + i, n - i);
+      graphene_simd8f_t bz = soa_load (b[2] + i, n - i);
+
+      soa_store (graphene_simd8f_sub (graphene_simd8f_mul (ay, bz), graphene_simd8f_mul (az, by)),
+                 res[0] + i, n - i);
+      soa_store (graphene_simd8f_sub (graphene_simd8f_mul (az, bx), graphene_simd8f_mul (ax, bz)),
+                 res[1] + i, n - i);
+      soa_store (graphene_simd8f_sub (graphene_simd8f_mul (ax, by), graphene_simd8f_mul (ay, bx)),
+                 res[2] + i, n - i);
+    }
+}
+
+/* Multiplies the row vectors (x, y, z, @w) by @m; the last row of @m,
+ * scaled by the constant @w, is a translation
+ */
+static void
+soa_transform3 (const graphene_simd4x4f_t *m,
+                unsigned int               n,
+                const float * const       *a,
+                float                      w,
+                float * const             *res)
+{
+  const graphene_simd8f_t m_xx = graphene_simd8f_splat (graphene_simd4f_get_x (m->x));
+  const graphene_simd8f_t m_xy = graphene_simd8f_splat (graphene_simd4f_get_y (m->x));
+  const graphene_simd8f_t m_xz = graphene_simd8f_splat (graphene_simd4f_get_z (m->x));
+  const graphene_simd8f_t m_yx = graphene_simd8f_splat (graphene_simd4f_get_x (m->y));
+  const graphene_simd8f_t m_yy = graphene_simd8f_splat (graphene_simd4f_get_y (m->y));
+  const graphene_simd8f_t m_yz = graphene_simd8f_splat (graphene_simd4f_get_z (m->y));
+  const graphene_simd8f_t m_zx = graphene_simd8f_splat (graphene_simd4f_get_x (m->z));
+  const graphene_simd8f_t m_zy = graphene_simd8f_splat (graphene_simd4f_get_y (m->z));
+  const graphene_simd8f_t m_zz = graphene_simd8f_splat (graphene_simd4f_get_z (m->z));
+  const graphene_simd8f_t t_x = graphene_simd8f_splat (graphene_simd4f_get_x (m->w) * w);
+  const graphene_simd8f_t t_y = graphene_simd8f_splat (graphene_simd4f_get_y (m->w) * w);
+  const graphene_simd8f_t t_z = graphene_simd8f_splat (graphene_simd4f_get_z (m->w) * w);
+
+  for (unsigned int i = 0; i < n; i += 8)
+    {
+      graphene_simd8f_t x = soa_load (a[0] + i, n - i);
+      graphene_simd8f_t y = soa_load (a[1] + i, n - i);
+      graphene_simd8f_t z = soa_load (a[2] + i, n - i);
+      graphene_simd8f_t r_x, r_y, r_z;
+
+      r_x = graphene_simd8f_madd (x, m_xx, t_x);
+      r_y = graphene_simd8f_madd (x, m_xy, t_y);
+      r_z = graphene_simd8f_madd (x, m_xz, t_z);
+      r_x = graphene_simd8f_madd (y, m_yx, r_x);
+      r_y = graphene_simd8f_madd (y, m_yy, r_y);
+      r_z = graphene_simd8f_madd (y, m_yz, r_z);
+      r_x = graphene_simd8f_madd (z, m_zx, r_x);
+      r_y = graphene_simd8f_madd (z, m_zy, r_y);
+      r_z = graphene_simd8f_madd (z, m_zz, r_z);
+
+      soa_store (r_x, res[0] + i, n - i);
+      soa_store (r_y, res[1] + i, n - i);
+      soa_store (r_z, res[2] + i, n - i);
+    }
+}
+
+/* Multiplies the row vectors (x, y, z, w) by @m */
+static void
+soa_transform4 (const graphene_simd4x4f_t *m,
+                unsigned int               n,
+                const float * const       *a,
+                float * const             *res)
+{
+  graphene_simd8f_t mat[4][4];
+  float rows[4][4];
+
+  graphene_simd4f_dup_4f (m->x, rows[0]);
+  graphene_simd4f_dup_4f (m->y, rows[1]);
+  graphene_simd4f_dup_4f (m->z, rows[2]);
+  graphene_simd4f_dup_4f (m->w, rows[3]);
+
+  for (unsigned int r = 0; r < 4; r++)
+    for (unsigned int c = 0; c < 4; c++)
+      mat[r][c] = graphene_simd8f_splat (rows[r][c]);
+
+  for (unsigned int i = 0; i < n; i += 8)
+    {
+      graphene_simd8f_t x = soa_load (a[0] + i, n - i);
+      graphene_simd8f_t y = soa_load (a[1] + i, n - i);
+      graphene_simd8f_t z = soa_load (a[2] + i, n - i);
+      graphene_simd8f_t w = soa_load (a[3] + i, n - i);
+
+      for (unsigned int c = 0; c < 4; c++)
+        {
+          graphene_simd8f_t r = graphene_simd8f_mul (w, mat[3][c]);
+
+          r = graphene_simd8f_madd (x, mat[0][c], r);
+          r = graphene_simd8f_madd (y, mat[1][c], r);
+          r = graphene_simd8f_madd (z, mat[2][c], r);
+
+          soa_store (r, res[c] + i, n - i);
+        }
+    }
+}
+
+/* If @n_components is 3, the w component of every vector is @w, and the
+ * w component of the result is discarded
+ */
+static void
+soa_transform (const graphene_simd4x4f_t *m,
+               unsigned int               n,
+               unsigned int               n_components,
+               const float * const       *a,
+               float                      w,
+               float * const             *res)
+{
+  if (n_components == 3)
+    soa_transform3 (m, n, a, w, res);
+  else
+    soa_transform4 (m, n, a, res);
+}
+
+static void
+soa_from_simd4f (unsigned int             n,
+                 unsigned int             n_components,
+                 const graphene_simd4f_t *v,
+                 float * const           *res)
+{
+  for (unsigned int i = 0; i < n; i += 8)
+    {
+      unsigned int n_lanes = MIN (n - i, 8);
+      graphene_simd4f_t rows[8];
+      graphene_simd8f_t out[4];
+
+      for (unsigned int j = 0; j < 8; j++)
+        rows[j] = v[i + MIN (j, n_lanes - 1)];
+
+      graphene_simd8f_transpose_simd4f (rows, &out[0], &out[1], &out[2], &out[3]);
+
+      for (unsigned int c = 0; c < n_components; c++)
+        soa_store (out[c], res[c] + i, n_lanes);
+    }
+}
+
+/* Kernels over "structure of arrays" matrices; each of the 16 elements
+ * of the matrices is stored in a separate array, with the element in
+ * row r and column c at index 4 * r + c, so each register holds the
+ * same element of eight matrices
+ */
+static inline void
+soa_matrix_load (const float * const *a,
+                 unsigned int         i,
+                 unsigned int         n,
+                 graphene_simd8f_t    m[16])
+{
+  for (unsigned int e = 0; e < 16; e++)
+    m[e] = soa_load (a[e] + i, n - i);
+}
+
+static inline void
+soa_matrix_store (const graphene_simd8f_t  m[16],
+                  float * const           *res,
+                  unsigned int             i,
+                  unsigned int             n)
+{
+  for (unsigned int e = 0; e < 16; e++)
+    soa_store (m[e], res[e] + i, n - i);
+}
+
+static void
+soa_matrix_multiply (unsigned int         n,
+                     const float * const *a,
+                     const float * const *b,
+                     float * const       *res)
+{
+  for (unsigned int i = 0; i < n; i += 8)
+    {
+      graphene_simd8f_t m_b[16];
+
+      /* All of @b is loaded before storing anything, and each row of @a
+       * right before storing the same row, so @res can be @a or @b
+       */
+      soa_matrix_load (b, i, n, m_b);
+
+      for (unsigned int row = 0; row < 4; row++)
+        {
+          graphene_simd8f_t a0 = soa_load (a[4 * row + 0] + i, n - i);
+          graphene_simd8f_t a1 = soa_load (a[4 * row + 1] + i, n - i);
+          graphene_simd8f_t a2 = soa_load (a[4 * row + 2] + i, n - i);
+          graphene_simd8f_t a3 = soa_load (a[4 * row + 3] + i, n - i);
+
+          for (unsigned int col = 0; col < 4; col++)
+            {
+              graphene_simd8f_t v = graphene_simd8f_mul (a3, m_b[12 + col]);
+
+              v = graphene_simd8f_madd (a2, m_b[8 + col], v);
+              v = graphene_simd8f_madd (a1, m_b[4 + col], v);
+              v = graphene_simd8f_madd (a0, m_b[col], v);
+
+              soa_store (v, res[4 * row + col] + i, n - i);
+            }
+        }
+    }
+}
+
+/* The 2x2 determinants of the first two rows, and of the last two rows,
+ * of the matrices in @m; see "The Laplace expansion theorem: Computing
+ * the determinants and inverses of matrices", D. Eberly, 2008
+ */
+static inline void
+soa_matrix_minors (const graphene_simd8f_t m[16],
+                   graphene_simd8f_t       s[6],
+                   graphene_simd8f_t       c[6])
+{
+#define DET2(a,b,c,d) \
+  graphene_simd8f_sub (graphene_simd8f_mul (m[a], m[b]), graphene_simd8f_mul (m[c], m[d]))
+
+  s[0] = DET2 (0, 5, 4, 1);
+  s[1] = DET2 (0, 6, 4, 2);
+  s[2] = DET2 (0, 7, 4, 3);
+  s[3] = DET2 (1, 6, 5, 2);
+  s[4] = DET2 (1, 7, 5, 3);
+  s[5] = DET2 (2, 7, 6, 3);
+
+  c[5] = DET2 (10, 15, 14, 11);
+  c[4] = DET2 (9, 15, 13, 11);
+  c[3] = DET2 (9, 14, 13, 10);
+  c[2] = DET2 (8, 15, 12, 11);
+  c[1] = DET2 (8, 14, 12, 10);
+  c[0] = DET2 (8, 13, 12, 9);
+
+#undef DET2
+}
+
+static inline graphene_simd8f_t
+soa_matrix_det (const graphene_simd8f_t s[6],
+                const graphene_simd8f_t c[6])
+{
+  graphene_simd8f_t det = graphene_simd8f_mul (s[0], c[5]);
+
+  det = graphene_simd8f_sub (det, graphene_simd8f_mul (s[1], c[4]));
+  det = graphene_simd8f_madd (s[2], c[3], det);
+  det = graphene_simd8f_madd (s[3], c[2], det);
+  det = graphene_simd8f_sub (det, graphene_simd8f_mul (s[4], c[1]));
+
+  return graphene_simd8f_madd (s[5], c[0], det);
+}
+
+static void
+soa_matrix_determinant (unsigned int         n,
+                        const float * const *a,
+                        float               *res)
+{
+  for (unsigned int i = 0; i < n; i += 8)
+    {
+      graphene_simd8f_t m[16], s[6], c[6];
+
+      soa_matrix_load (a, i, n, m);
+      soa_matrix_minors (m, s, c);
+      soa_store (soa_matrix_det (s, c), res + i, n - i);
+    }
+}
+
+/* Like graphene_matrix_inverse(), matrices whose determinant is smaller
+ * than FLT_EPSILON are not inverted, and are copied to @res unchanged;
+ * returns the number of inverted matrices
+ */
+static unsigned int
+soa_matrix_inverse (unsigned int         n,
+                    const float * const *a,
+                    float * const       *res)
+{
+  const graphene_simd8f_t zero = graphene_simd8f_init_zero ();
+  const graphene_simd8f_t epsilon = graphene_simd8f_splat (FLT_EPSILON);
+  const graphene_simd8f_t one = graphene_simd8f_splat (1.f);
+  unsigned int n_inverted = 0;
+
+  for (unsigned int i = 0; i < n; i += 8)
+    {
+      unsigned int n_lanes = MIN (n - i, 8);
+      unsigned int lanes = (1u << n_lanes) - 1;
+      graphene_simd8f_t m[16], s[6], c[6], r[16];
+      graphene_simd8f_t det, inv_det;
+      unsigned int invertible;
+
+#define TERM3(a0,b0,a1,b1,a2,b2) \
+  graphene_simd8f_mul (graphene_simd8f_madd (m[a2], b2, \
+                                             graphene_simd8f_madd (m[a1], b1, \
+                                                                   graphene_simd8f_mul (m[a0], b0))), \
+                       inv_det)
+
+      soa_matrix_load (a, i, n, m);
+      soa_matrix_minors (m, s, c);
+
+      det = soa_matrix_det (s, c);
+      invertible = graphene_simd8f_mask_ge (graphene_simd8f_max (det, graphene_simd8f_sub (zero, det)),
+                                            epsilon) & lanes;
+      inv_det = graphene_simd8f_div (one, det);
+
+      /* The adjugate matrix; the signs of the cofactors are folded in
+       * the negated minors, so each element only needs multiply-adds
+       */
+      {
+        const graphene_simd8f_t nc[6] = {
+          graphene_simd8f_sub (zero, c[0]), graphene_simd8f_sub (zero, c[1]),
+          graphene_simd8f_sub (zero, c[2]), graphene_simd8f_sub (zero, c[3]),
+          graphene_simd8f_sub (zero, c[4]), graphene_simd8f_sub (zero, c[5]),
+        };
+        const graphene_simd8f_t ns[6] = {
+          graphene_simd8f_sub (zero, s[0]), graphene_simd8f_sub (zero, s[1]),
+          graphene_simd8f_sub (zero, s[2]), graphene_simd8f_sub (zero, s[3]),
+          graphene_simd8f_sub (zero, s[4]), graphene_simd8f_sub (zero, s[5]),
+        };
+
+        r[0] = TERM3 (5, c[5], 6, nc[4], 7, c[3]);
+        r[1] = TERM3 (1, nc[5], 2, c[4], 3, nc[3]);
+        r[2] = TERM3 (13, s[5], 14, ns[4], 15, s[3]);
+        r[3] = TERM3 (9, ns[5], 10, s[4], 11, ns[3]);
+
+        r[4] = TERM3 (4, nc[5], 6, c[2], 7, nc[1]);
+        r[5] = TERM3 (0, c[5], 2, nc[2], 3, c[1]);
+        r[6] = TERM3 (12, ns[5], 14, s[2], 15, ns[1]);
+        r[7] = TERM3 (8, s[5], 10, ns[2], 11, s[1]);
+
+        r[8] = TERM3 (4, c[4], 5, nc[2], 7, c[0]);
+        r[9] = TERM3 (0, nc[4], 1, c[2], 3, nc[0]);
+        r[10] = TERM3 (12, s[4], 13, ns[2], 15, s[0]);
+        r[11] = TERM3 (8, ns[4], 9, s[2], 11, ns[0]);
+
+        r[12] = TERM3 (4, nc[3], 5, c[1], 6, nc[0]);
+        r[13] = TERM3 (0, c[3], 1, nc[1], 2, c[0]);
+        r[14] = TERM3 (12, ns[3], 13, s[1], 14, ns[0]);
+        r[15] = TERM3 (8, s[3], 9, ns[1], 10, s[0]);
+      }
+
+#undef TERM3
+
+      /* Singular matrices are rare, so fix them up after the fact */
+      if (unlikely (invertible != lanes))
+        {
+          for (unsigned int e = 0; e < 16; e++)
+            {
+              float r_f[8], m_f[8];
+
+              graphene_simd8f_dup_8f (r[e], r_f);
+              graphene_simd8f_dup_8f (m[e], m_f);
+
+              for (unsigned int j = 0; j < n_lanes; j++)
+                {
+                  if ((invertible & (1u << j)) == 0)
+                    r_f[j] = m_f[j];
+                }
+
+              r[e] = graphene_simd8f_init_8f (r_f);
+            }
+        }
+
+      soa_matrix_store (r, res, i, n);
+
+      for (unsigned int b = invertible; b != 0; b &= b - 1)
+        n_inverted += 1;
+    }
+
+  return n_inverted;
+}
+
+/* Transforms the point (x, y, z) of each lane by the matrix of the same
+ * lane, like graphene_matrix_transform_point3d()
+ */
+static void
+soa_matrix_transform_points (unsigned int         n,
+                             const float * const *m,
+                             const float * const *a,
+                             float * const       *res)
+{
+  for (unsigned int i = 0; i < n; i += 8)
+    {
+      graphene_simd8f_t mat[16];
+      graphene_simd8f_t x = soa_load (a[0] + i, n - i);
+      graphene_simd8f_t y = soa_load (a[1] + i, n - i);
+      graphene_simd8f_t z = soa_load (a[2] + i, n - i);
+
+      soa_matrix_load (m, i, n, mat);
+
+      for (unsigned int c = 0; c < 3; c++)
+        {
+          graphene_simd8f_t r = graphene_simd8f_madd (z, mat[8 + c], mat[12 + c]);
+
+          r = graphene_simd8f_madd (y, mat[4 + c], r);
+          r = graphene_simd8f_madd (x, mat[c], r);
+
+          soa_store (r, res[c] + i, n - i);
+        }
+    }
+}
+
+/* Packs the rows of eight matrices at a time */
+static void
+soa_matrix_from_simd4x4f (unsigned int               n,
+                          const graphene_simd4x4f_t *m,
+                          float * const             *res)
+{
+  for (unsigned int i = 0; i < n; i += 8)
+    {
+      unsigned int n_lanes = MIN (n - i, 8);
+
+      for (unsigned int row = 0; row < 4; row++)
+        {
+          graphene_simd4f_t rows[8];
+          graphene_simd8f_t out[4];
+
+          for (unsigned int j = 0; j < 8; j++)
+            {
+              const graphene_simd4x4f_t *mat = &m[i + MIN (j, n_lanes - 1)];
+
+              rows[j] = row == 0 ? mat->x : row == 1 ? mat->y : row == 2 ? mat->z : mat->w;
+            }
+
+          graphene_simd8f_transpose_simd4f (rows, &out[0], &out[1], &out[2], &out[3]);
+
+          for (unsigned int col = 0; col < 4; col++)
+            soa_store (out[col], res[4 * row + col] + i, n_lanes);
+        }
+    }
+}
+
+const graphene_kernels_t GRAPHENE_KERNELS_TABLE (GRAPHENE_KERNELS_VARIANT) = {
+  .name = GRAPHENE_KERNELS_NAME,
+
+  .vec3_normalize = vec3_normalize,
+  .vec4_normalize = vec4_normalize,
+
+  .matrix_multiply = matrix_multiply,
+  .matrix_inverse = matrix_inverse,
+  .matrix_inverse_affine = matrix_inverse_affine,
+  .matrix_transform_points3d = matrix_transform_points3d,
+  .matrix_transform_vec3_array = matrix_transform_vec3_array,
+  .matrix_transform_vec4_array = matrix_transform_vec4_array,
+  .matrix_transform_strided = matrix_transform_strided,
+  .matrix_transform_bounds_array = matrix_transform_bounds_array,
+  .matrix_transform_boxes = matrix_transform_boxes,
+
+  .box_bounds_strided = box_bounds_strided,
+  .sphere_find_outside = sphere_find_outside,
+  .points_max_distance_sq = points_max_distance_sq,
+
+  .frustum_cull_points = frustum_cull_points,
+  .frustum_cull_strided = frustum_cull_strided,
+  .frustum_cull_spheres = frustum_cull_spheres,
+  .frustum_cull_boxes = frustum_cull_boxes,
+
+  .ray_intersect_boxes = ray_intersect_boxes,
+
+  .soa_add = soa_add,
+  .soa_subtract = soa_subtract,
+  .soa_scale = soa_scale,
+  .soa_lerp = soa_lerp,
+  .soa_min_max = soa_min_max,
+  .soa_dot = soa_dot,
+  .soa_length = soa_length,
+  .soa_normalize = soa_normalize,
+  .soa_cross = soa_cross,
+  .soa_transform = soa_transform,
+  .soa_from_simd4f = soa_from_simd4f,
+
+  .soa_matrix_multiply = soa_matrix_multiply,
+  .soa_matrix_determinant = soa_matrix_determinant,
+  .soa_matrix_inverse = soa_matrix_inverse,
+  .soa_matrix_transform_points = soa_matrix_transform_points,
+  .soa_matrix_from_simd4x4f = soa_matrix_from_simd4x4f,
+};
@@ -92,6 +92,9 @@
 #include "graphene-alloc-private.h"
 #include "graphene-box.h"
 #include "graphene-euler.h"
+#include "graphene-kernels-private.h"
+#include "graphene-obb.h"
+#include "graphene-parallel-private.h"
 #include "graphene-point.h"
 #include "graphene-point3d.h"
 #include "graphene-quad.h"
@@ -100,6 +103,7 @@
 #include "graphene-rect.h"
 #include "graphene-simd4x4f.h"
 #include "graphene-sphere.h"
+#include "graphene-strided-private.h"
 #include "graphene-vectors-private.h"
 
 #include <stdio.h>
@@ -490,6 +494,110 @@ graphene_matrix_init_rotate (graphene_matrix_t     *m,
   return m;
 }
 
+/* Writes S * R * T, with the rows of the rotation matrix of @q, like
+ * graphene_quaternion_to_matrix(), scaled by @s, and @t as the last row
+ */
+static inline void
+matrix_init_trs (graphene_simd4x4f_t         *m,
+                 const graphene_vec3_t       *t,
+                 const graphene_quaternion_t *q,
+                 const graphene_vec3_t       *s)
+{
+  float x2 = q->x + q->x;
+  float y2 = q->y + q->y;
+  float z2 = q->z + q->z;
+  float xx = q->x * x2, xy = q->x * y2, xz = q->x * z2;
+  float yy = q->y * y2, yz = q->y * z2, zz = q->z * z2;
+  float wx = q->w * x2, wy = q->w * y2, wz = q->w * z2;
+
+  m->x = graphene_simd4f_mul (graphene_simd4f_init (1.f - (yy + zz), xy + wz, xz - wy, 0.f),
+                              graphene_simd4f_splat_x (s->value));
+  m->y = graphene_simd4f_mul (graphene_simd4f_init (xy - wz, 1.f - (xx + zz), yz + wx, 0.f),
+                              graphene_simd4f_splat_y (s->value));
+  m->z = graphene_simd4f_mul (graphene_simd4f_init (xz + wy, yz - wx, 1.f - (xx + yy), 0.f),
+                              graphene_simd4f_splat_z (s->value));
+  m->w = graphene_simd4f_merge_w (t->value, 1.f);
+}
+
+/**
+ * graphene_matrix_init_trs:
+ * @m: a #graphene_matrix_t
+ * @translate: the translation
+ * @rotate: the rotation, as a unit quaternion
+ * @scale: the scale factors
+ *
+ * Initializes @m to scale by @scale, then rotate by @rotate, and then
+ * translate by @translate.
+ *
+ * This is the same matrix as the one obtained by calling
+ * graphene_matrix_init_scale(), graphene_matrix_rotate_quaternion(), and
+ * graphene_matrix_translate(), but it is written directly, without any
+ * matrix multiplication.
+ *
+ * See also: graphene_matrix_decompose()
+ *
+ * Returns: (transfer none): the initialized matrix
+ *
+ * Since: 1.12
+ */
+graphene_matrix_t *
+graphene_matrix_init_trs (graphene_matrix_t           *m,
+                          const graphene_vec3_t       *translate,
+                          const graphene_quaternion_t *rotate,
+                          const graphene_vec3_t       *scale)
+{
+  matrix_init_trs (&m->value, translate, rotate, scale);
+
+  return m;
+}
+
+typedef struct {
+  const graphene_vec3_t *translate;
+  const graphene_quaternion_t *rotate;
+  const graphene_vec3_t *scale;
+  graphene_matrix_t *res;
+} matrix_trs_batch_t;
+
+static void
+matrix_init_trs_range (unsigned int  chunk,
+                       unsigned int  first,
+                       unsigned int  n_items,
+                       void         *data)
+{
+  const matrix_trs_batch_t *batch = data;
+
+  for (unsigned int i = first; i < first + n_items; i++)
+    matrix_init_trs (&batch->res[i].value, &batch->translate[i], &batch->rotate[i], &batch->scale[i]);
+}
+
+/**
+ * graphene_matrix_init_trs_array:
+ * @n_matrices: the number of matrices
+ * @translate: (array length=n_matrices): an array of translations
+ * @rotate: (array length=n_matrices): an array of unit quaternions
+ * @scale: (array length=n_matrices): an array of scale factors
+ * @res: (out caller-allocates) (array length=n_matrices): return location
+ *   for the matrices
+ *
+ * Initializes each matrix of @res from the corresponding elements of
+ * @translate, @rotate, and @scale, like graphene_matrix_init_trs().
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_init_trs_array (unsigned int                 n_matrices,
+                                const graphene_vec3_t       *translate,
+                                const graphene_quaternion_t *rotate,
+                                const graphene_vec3_t       *scale,
+                                graphene_matrix_t           *res)
+{
+  matrix_trs_batch_t batch = { translate, rotate, scale, res };
+
+  graphene_parallel_for (n_matrices, graphene_parallel_chunk_size (sizeof (graphene_matrix_t)),
+                         matrix_init_trs_range,
+                         &batch);
+}
+
 /**
  * graphene_matrix_is_identity:
  * @m: a #graphene_matrix_t
@@ -827,7 +935,7 @@ graphene_matrix_multiply (const graphene_matrix_t *a,
                           const graphene_matrix_t *b,
                           graphene_matrix_t       *res)
 {
-  graphene_simd4x4f_matrix_mul (&a->value, &b->value, &res->value);
+  graphene_get_kernels ()->matrix_multiply (&a->value, &b->value, &res->value);
 }
 
 /**
@@ -1117,6 +1225,12 @@ graphene_matrix_transform_sphere (const graphene_matrix_t *m,
  * The result is the axis aligned bounding box containing the transformed
  * vertices.
  *
+ * The vertices are transformed like graphene_matrix_transform_point3d(),
+ * without a perspective division, so the bounds are computed from the
+ * center and the half extents of the box instead of from its eight
+ * vertices. An empty box stays empty, and a box with an infinite extent
+ * becomes an infinite box.
+ *
  * Since: 1.2
  */
 void
@@ -1124,14 +1238,74 @@ graphene_matrix_transform_box (const graphene_matrix_t *m,
                                const graphene_box_t    *b,
                                graphene_box_t          *res)
 {
-  graphene_vec3_t points[8];
+  graphene_get_kernels ()->matrix_transform_boxes (&m->value, 1, b, res);
+}
 
-  graphene_box_get_vertices (b, points);
+/**
+ * graphene_matrix_transform_obb:
+ * @m: a #graphene_matrix_t
+ * @obb: a #graphene_obb_t
+ * @res: (out caller-allocates): return location for the bounds
+ *   of the transformed oriented box
+ *
+ * Transforms the vertices of a #graphene_obb_t using the given matrix @m,
+ * and computes an oriented box that contains them.
+ *
+ * Unlike graphene_matrix_transform_box(), the axes of the box follow
+ * the rotation of @m; if @m is a combination of rotations, translations
+ * and uniform scales, the transformed box has the same shape as the
+ * original one, instead of growing to contain it. For other affine
+ * transformations, like non-uniform scales and shears, the resulting
+ * box is oriented along the first transformed axes of @obb, and grown
+ * to contain the transformed box.
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_transform_obb (const graphene_matrix_t *m,
+                               const graphene_obb_t    *obb,
+                               graphene_obb_t          *res)
+{
+  graphene_vec3_t w[3], u[3], tmp;
+  float e[3], res_e[3];
 
-  for (int i = 0; i < 8; i++)
-    graphene_simd4x4f_point3_mul (&m->value, &(points[i].value), &(points[i].value));
+  graphene_vec3_to_float (&obb->half_extents, e);
 
-  graphene_box_init_from_vectors (res, 8, points);
+  for (int i = 0; i < 3; i++)
+    graphene_matrix_transform_vec3 (m, &obb->axes[i], &w[i]);
+
+  /* Make the transformed axes orthonormal again; with a shear, or a
+   * non-uniform scale, the box is aligned on the first transformed axis
+   */
+  graphene_vec3_normalize (&w[0], &u[0]);
+  graphene_vec3_scale (&u[0], graphene_vec3_dot (&u[0], &w[1]), &tmp);
+  graphene_vec3_subtract (&w[1], &tmp, &u[1]);
+  graphene_vec3_normalize (&u[1], &u[1]);
+  graphene_vec3_cross (&u[0], &u[1], &u[2]);
+
+  if (graphene_vec3_length (&u[2]) < 0.5f)
+    {
+      /* A projection, or a singular matrix */
+      graphene_vec3_init_from_vec3 (&u[0], graphene_vec3_x_axis ());
+      graphene_vec3_init_from_vec3 (&u[1], graphene_vec3_y_axis ());
+      graphene_vec3_init_from_vec3 (&u[2], graphene_vec3_z_axis ());
+    }
+
+  /* The half extent along each new axis is the sum of the projections
+   * of the transformed half extents on that axis
+   */
+  for (int j = 0; j < 3; j++)
+    {
+      res_e[j] = e[0] * fabsf (graphene_vec3_dot (&u[j], &w[0]))
+               + e[1] * fabsf (graphene_vec3_dot (&u[j], &w[1]))
+               + e[2] * fabsf (graphene_vec3_dot (&u[j], &w[2]));
+    }
+
+  graphene_simd4x4f_point3_mul (&m->value, &obb->center.value, &res->center.value);
+  graphene_vec3_init_from_float (&res->half_extents, res_e);
+  res->axes[0] = u[0];
+  res->axes[1] = u[1];
+  res->axes[2] = u[2];
 }
 
 /**
@@ -1162,6 +1336,278 @@ graphene_matrix_transform_ray (const graphene_matrix_t *m,
   graphene_ray_init_from_vec3 (res, &origin, &direction);
 }
 
+typedef struct {
+  const graphene_simd4x4f_t *m;
+  const void *src;
+  void *dst;
+} matrix_batch_t;
+
+static void
+matrix_transform_points3d_range (unsigned int  chunk,
+                                 unsigned int  first,
+                                 unsigned int  n_items,
+                                 void         *data)
+{
+  const matrix_batch_t *batch = data;
+
+  graphene_get_kernels ()->matrix_transform_points3d (batch->m, n_items,
+                                                      (const graphene_point3d_t *) batch->src + first,
+                                                      (graphene_point3d_t *) batch->dst + first);
+}
+
+static void
+matrix_transform_vec3_range (unsigned int  chunk,
+                             unsigned int  first,
+                             unsigned int  n_items,
+                             void         *data)
+{
+  const matrix_batch_t *batch = data;
+
+  graphene_get_kernels ()->matrix_transform_vec3_array (batch->m, n_items,
+                                                        (const graphene_vec3_t *) batch->src + first,
+                                                        (graphene_vec3_t *) batch->dst + first);
+}
+
+static void
+matrix_transform_vec4_range (unsigned int  chunk,
+                             unsigned int  first,
+                             unsigned int  n_items,
+                             void         *data)
+{
+  const matrix_batch_t *batch = data;
+
+  graphene_get_kernels ()->matrix_transform_vec4_array (batch->m, n_items,
+                                                        (const graphene_vec4_t *) batch->src + first,
+                                                        (graphene_vec4_t *) batch->dst + first);
+}
+
+static void
+matrix_transform_bounds_range (unsigned int  chunk,
+                               unsigned int  first,
+                               unsigned int  n_items,
+                               void         *data)
+{
+  const matrix_batch_t *batch = data;
+
+  graphene_get_kernels ()->matrix_transform_bounds_array (batch->m, n_items,
+                                                          (const graphene_rect_t *) batch->src + first,
+                                                          (graphene_rect_t *) batch->dst + first);
+}
+
+static void
+matrix_transform_boxes_range (unsigned int  chunk,
+                              unsigned int  first,
+                              unsigned int  n_items,
+                              void         *data)
+{
+  const matrix_batch_t *batch = data;
+
+  graphene_get_kernels ()->matrix_transform_boxes (batch->m, n_items,
+                                                   (const graphene_box_t *) batch->src + first,
+                                                   (graphene_box_t *) batch->dst + first);
+}
+
+static void
+matrix_transform_strided_range (unsigned int  chunk,
+                                unsigned int  first,
+                                unsigned int  n_items,
+                                void         *data)
+{
+  const matrix_batch_t *batch = data;
+  graphene_strided_view_t slice = graphene_strided_view_slice (batch->src, first, n_items);
+
+  graphene_get_kernels ()->matrix_transform_strided (batch->m, &slice);
+}
+
+/**
+ * graphene_matrix_transform_points3d:
+ * @m: a #graphene_matrix_t
+ * @n_points: the number of #graphene_point3d_t in the @points array
+ * @points: (array length=n_points): an array of #graphene_point3d_t
+ * @res: (out caller-allocates) (array length=n_points): return location
+ *   for the transformed points
+ *
+ * Transforms each #graphene_point3d_t in the @points array using the
+ * matrix @m.
+ *
+ * This function is the equivalent of calling graphene_matrix_transform_point3d()
+ * for each point, but it loads the matrix only once, which makes it
+ * considerably faster when transforming large arrays.
+ *
+ * The @res array can be the same as the @points array, in order to
+ * transform the points in place; otherwise the two arrays must not
+ * overlap.
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_transform_points3d (const graphene_matrix_t  *m,
+                                    unsigned int              n_points,
+                                    const graphene_point3d_t *points,
+                                    graphene_point3d_t       *res)
+{
+  matrix_batch_t batch = { &m->value, points, res };
+
+  graphene_parallel_for (n_points, graphene_parallel_chunk_size (sizeof (graphene_point3d_t)),
+                         matrix_transform_points3d_range,
+                         &batch);
+}
+
+/**
+ * graphene_matrix_transform_strided:
+ * @m: a #graphene_matrix_t
+ * @points: a #graphene_strided_view_t
+ *
+ * Transforms each element of the @points view in place, using the
+ * matrix @m.
+ *
+ * Elements with two or three components are transformed as points,
+ * like graphene_matrix_transform_point3d(); the missing Z coordinate
+ * of elements with two components is 0. Elements with four components
+ * are transformed as vectors, like graphene_matrix_transform_vec4().
+ *
+ * Only the components of each element are written, so the other
+ * attributes of a buffer of interleaved vertices are left untouched.
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_transform_strided (const graphene_matrix_t       *m,
+                                   const graphene_strided_view_t *points)
+{
+  matrix_batch_t batch = { &m->value, points, NULL };
+
+  graphene_parallel_for (graphene_strided_view_get_n_elements (points),
+                         graphene_parallel_chunk_size (graphene_strided_view_item_size (points)),
+                         matrix_transform_strided_range,
+                         &batch);
+}
+
+/**
+ * graphene_matrix_transform_vec3_array:
+ * @m: a #graphene_matrix_t
+ * @n_vectors: the number of #graphene_vec3_t in the @vectors array
+ * @vectors: (array length=n_vectors): an array of #graphene_vec3_t
+ * @res: (out caller-allocates) (array length=n_vectors): return location
+ *   for the transformed vectors
+ *
+ * Transforms each #graphene_vec3_t in the @vectors array using the
+ * matrix @m.
+ *
+ * This function is the equivalent of calling graphene_matrix_transform_vec3()
+ * for each vector; just like that function, the W row vector of the matrix
+ * is ignored.
+ *
+ * The @res array can be the same as the @vectors array, in order to
+ * transform the vectors in place; otherwise the two arrays must not
+ * overlap.
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_transform_vec3_array (const graphene_matrix_t *m,
+                                      unsigned int             n_vectors,
+                                      const graphene_vec3_t   *vectors,
+                                      graphene_vec3_t         *res)
+{
+  matrix_batch_t batch = { &m->value, vectors, res };
+
+  graphene_parallel_for (n_vectors, graphene_parallel_chunk_size (sizeof (graphene_vec3_t)),
+                         matrix_transform_vec3_range,
+                         &batch);
+}
+
+/**
+ * graphene_matrix_transform_vec4_array:
+ * @m: a #graphene_matrix_t
+ * @n_vectors: the number of #graphene_vec4_t in the @vectors array
+ * @vectors: (array length=n_vectors): an array of #graphene_vec4_t
+ * @res: (out caller-allocates) (array length=n_vectors): return location
+ *   for the transformed vectors
+ *
+ * Transforms each #graphene_vec4_t in the @vectors array using the
+ * matrix @m.
+ *
+ * This function is the equivalent of calling graphene_matrix_transform_vec4()
+ * for each vector.
+ *
+ * The @res array can be the same as the @vectors array, in order to
+ * transform the vectors in place; otherwise the two arrays must not
+ * overlap.
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_transform_vec4_array (const graphene_matrix_t *m,
+                                      unsigned int             n_vectors,
+                                      const graphene_vec4_t   *vectors,
+                                      graphene_vec4_t         *res)
+{
+  matrix_batch_t batch = { &m->value, vectors, res };
+
+  graphene_parallel_for (n_vectors, graphene_parallel_chunk_size (sizeof (graphene_vec4_t)),
+                         matrix_transform_vec4_range,
+                         &batch);
+}
+
+/**
+ * graphene_matrix_transform_bounds_array:
+ * @m: a #graphene_matrix_t
+ * @n_rects: the number of rectangles in @r and @res
+ * @r: (array length=n_rects): an array of #graphene_rect_t
+ * @res: (out caller-allocates) (array length=n_rects): return location
+ *   for the bounds of the transformed rectangles
+ *
+ * Computes the bounds of each rectangle in the @r array transformed
+ * by the matrix @m, like graphene_matrix_transform_bounds().
+ *
+ * The @res array can be the same as @r; otherwise, the two arrays
+ * must not overlap.
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_transform_bounds_array (const graphene_matrix_t *m,
+                                        unsigned int             n_rects,
+                                        const graphene_rect_t   *r,
+                                        graphene_rect_t         *res)
+{
+  matrix_batch_t batch = { &m->value, r, res };
+
+  graphene_parallel_for (n_rects, graphene_parallel_chunk_size (sizeof (graphene_rect_t)),
+                         matrix_transform_bounds_range,
+                         &batch);
+}
+
+/**
+ * graphene_matrix_transform_boxes:
+ * @m: a #graphene_matrix_t
+ * @n_boxes: the number of boxes in @boxes and @res
+ * @boxes: (array length=n_boxes): an array of #graphene_box_t
+ * @res: (out caller-allocates) (array length=n_boxes): return location
+ *   for the bounds of the transformed boxes
+ *
+ * Computes the bounds of each box in the @boxes array transformed
+ * by the matrix @m, like graphene_matrix_transform_box().
+ *
+ * The @res array can be the same as @boxes; otherwise, the two arrays
+ * must not overlap.
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_transform_boxes (const graphene_matrix_t *m,
+                                 unsigned int             n_boxes,
+                                 const graphene_box_t    *boxes,
+                                 graphene_box_t          *res)
+{
+  matrix_batch_t batch = { &m->value, boxes, res };
+
+  graphene_parallel_for (n_boxes, graphene_parallel_chunk_size (sizeof (graphene_box_t)),
+                         matrix_transform_boxes_range,
+                         &batch);
+}
+
 /**
  * graphene_matrix_project_point:
  * @m: a #graphene_matrix_t
@@ -1684,6 +2130,9 @@ graphene_matrix_transpose (const graphene_matrix_t *m,
  *
  * Inverts the given matrix.
  *
+ * If the last column of the matrix is (0, 0, 0, 1), the matrix is
+ * inverted using graphene_matrix_inverse_affine().
+ *
  * Returns: `true` if the matrix is invertible
  *
  * Since: 1.0
@@ -1692,7 +2141,64 @@ bool
 graphene_matrix_inverse (const graphene_matrix_t *m,
                          graphene_matrix_t       *res)
 {
-  return graphene_simd4x4f_inverse (&m->value, &res->value);
+  return graphene_get_kernels ()->matrix_inverse (&m->value, &res->value);
+}
+
+/**
+ * graphene_matrix_inverse_affine:
+ * @m: a #graphene_matrix_t
+ * @res: (out caller-allocates): return location for the
+ *   inverse matrix
+ *
+ * Inverts the given affine transformation matrix.
+ *
+ * This function only computes the inverse of the upper 3x3 part of the
+ * matrix, and applies it to the translation, which is considerably
+ * cheaper than inverting a generic 4x4 matrix. The last column of @m
+ * is assumed to be (0, 0, 0, 1) and is not read.
+ *
+ * Returns: `true` if the matrix is invertible
+ *
+ * Since: 1.12
+ */
+bool
+graphene_matrix_inverse_affine (const graphene_matrix_t *m,
+                                graphene_matrix_t       *res)
+{
+  return graphene_get_kernels ()->matrix_inverse_affine (&m->value, &res->value);
+}
+
+/**
+ * graphene_matrix_inverse_rigid:
+ * @m: a #graphene_matrix_t
+ * @res: (out caller-allocates): return location for the
+ *   inverse matrix
+ *
+ * Inverts the given rigid body transformation matrix, that is, a
+ * rotation followed by a translation.
+ *
+ * The inverse of a rotation is its transpose, so this function is
+ * cheaper than graphene_matrix_inverse_affine(); the upper 3x3 part of
+ * @m is assumed to be orthonormal, and the last column of @m is assumed
+ * to be (0, 0, 0, 1). If that's not the case, the result is undefined.
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_inverse_rigid (const graphene_matrix_t *m,
+                               graphene_matrix_t       *res)
+{
+  const graphene_simd4f_t w_axis = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+  graphene_simd4f_t translation;
+  graphene_simd4x4f_t inv = m->value;
+
+  inv.w = graphene_simd4f_init_zero ();
+  graphene_simd4x4f_transpose_in_place (&inv);
+
+  graphene_simd4x4f_vec3_mul (&inv, &m->value.w, &translation);
+  inv.w = graphene_simd4f_sub (w_axis, translation);
+
+  res->value = inv;
 }
 
 /**
@@ -1921,6 +2427,71 @@ matrix_decompose_2d (const graphene_matrix_t *m,
   return true;
 }
 
+/* Decomposes the upper 3x3 part of @local, with no perspective and no
+ * translation, into scale, shear, and rotation; @local is modified
+ */
+static void
+matrix_decompose_rows (graphene_matrix_t     *local,
+                       graphene_vec3_t       *scale_r,
+                       graphene_vec3_t       *shear_r,
+                       graphene_quaternion_t *rotate_r)
+{
+  float shear_xy, shear_xz, shear_yz;
+  float scale_x, scale_y, scale_z;
+  graphene_simd4f_t cross;
+
+  /* now get scale and shear */
+
+  /* compute the X scale factor and normalize the first row */
+  scale_x = graphene_simd4f_get_x (graphene_simd4f_length4 (local->value.x));
+  local->value.x = graphene_simd4f_normalize4 (local->value.x);
+
+  /* compute XY shear factor and the second row orthogonal to the first */
+  shear_xy = graphene_simd4f_get_x (graphene_simd4f_dot4 (local->value.x, local->value.y));
+  local->value.y = graphene_simd4f_sub (local->value.y, graphene_simd4f_mul (local->value.x, graphene_simd4f_splat (shear_xy)));
+
+  /* now, compute the Y scale factor and normalize the second row */
+  scale_y = graphene_simd4f_get_x (graphene_simd4f_length4 (local->value.y));
+  local->value.y = graphene_simd4f_normalize4 (local->value.y);
+  shear_xy /= scale_y;
+
+  /* compute XZ and YZ shears, make the third row orthogonal */
+  shear_xz = graphene_simd4f_get_x (graphene_simd4f_dot4 (local->value.x, local->value.z));
+  local->value.z = graphene_simd4f_sub (local->value.z, graphene_simd4f_mul (local->value.x, graphene_simd4f_splat (shear_xz)));
+  shear_yz = graphene_simd4f_get_x (graphene_simd4f_dot4 (local->value.y, local->value.z));
+  local->value.z = graphene_simd4f_sub (local->value.z, graphene_simd4f_mul (local->value.y, graphene_simd4f_splat (shear_yz)));
+
+  /* next, get the Z scale and normalize the third row */
+  scale_z = graphene_simd4f_get_x (graphene_simd4f_length4 (local->value.z));
+  local->value.z = graphene_simd4f_normalize4 (local->value.z);
+
+  shear_xz /= scale_z;
+  shear_yz /= scale_z;
+
+  graphene_vec3_init (shear_r, shear_xy, shear_xz, shear_yz);
+
+  /* at this point, the matrix is orthonormal. we check for a
+   * coordinate system flip. if the determinant is -1, then
+   * negate the matrix and the scaling factors
+   */
+  cross = graphene_simd4f_dot3 (local->value.x, graphene_simd4f_cross3 (local->value.y, local->value.z));
+  if (graphene_simd4f_get_x (cross) < 0.f)
+    {
+      scale_x *= -1.f;
+      scale_y *= -1.f;
+      scale_z *= -1.f;
+
+      local->value.x = graphene_simd4f_neg (local->value.x);
+      local->value.y = graphene_simd4f_neg (local->value.y);
+      local->value.z = graphene_simd4f_neg (local->value.z);
+    }
+
+  graphene_vec3_init (scale_r, scale_x, scale_y, scale_z);
+
+  /* get the rotations out */
+  graphene_quaternion_init_from_matrix (rotate_r, local);
+}
+
 static bool
 matrix_decompose_3d (const graphene_matrix_t *m,
                      graphene_vec3_t         *scale_r,
@@ -1930,10 +2501,7 @@ matrix_decompose_3d (const graphene_matrix_t *m,
                      graphene_vec4_t         *perspective_r)
 {
   graphene_matrix_t local;
-  float shear_xy, shear_xz, shear_yz;
-  float scale_x, scale_y, scale_z;
   graphene_simd4f_t perspective_v;
-  graphene_simd4f_t cross;
 
   if (graphene_approx_val (graphene_simd4f_get_w (m->value.w), 0.f))
     return false;
@@ -1984,56 +2552,51 @@ matrix_decompose_3d (const graphene_matrix_t *m,
   translate_r->value = graphene_simd4f_merge_w (local.value.w, 0.f);
   local.value.w = graphene_simd4f_init (0.f, 0.f, 0.f, graphene_simd4f_get_w (local.value.w));
 
-  /* now get scale and shear */
-
-  /* compute the X scale factor and normalize the first row */
-  scale_x = graphene_simd4f_get_x (graphene_simd4f_length4 (local.value.x));
-  local.value.x = graphene_simd4f_normalize4 (local.value.x);
-
-  /* compute XY shear factor and the second row orthogonal to the first */
-  shear_xy = graphene_simd4f_get_x (graphene_simd4f_dot4 (local.value.x, local.value.y));
-  local.value.y = graphene_simd4f_sub (local.value.y, graphene_simd4f_mul (local.value.x, graphene_simd4f_splat (shear_xy)));
-
-  /* now, compute the Y scale factor and normalize the second row */
-  scale_y = graphene_simd4f_get_x (graphene_simd4f_length4 (local.value.y));
-  local.value.y = graphene_simd4f_normalize4 (local.value.y);
-  shear_xy /= scale_y;
+  matrix_decompose_rows (&local, scale_r, shear_r, rotate_r);
 
-  /* compute XZ and YZ shears, make the third row orthogonal */
-  shear_xz = graphene_simd4f_get_x (graphene_simd4f_dot4 (local.value.x, local.value.z));
-  local.value.z = graphene_simd4f_sub (local.value.z, graphene_simd4f_mul (local.value.x, graphene_simd4f_splat (shear_xz)));
-  shear_yz = graphene_simd4f_get_x (graphene_simd4f_dot4 (local.value.y, local.value.z));
-  local.value.z = graphene_simd4f_sub (local.value.z, graphene_simd4f_mul (local.value.y, graphene_simd4f_splat (shear_yz)));
+  return true;
+}
 
-  /* next, get the Z scale and normalize the third row */
-  scale_z = graphene_simd4f_get_x (graphene_simd4f_length4 (local.value.z));
-  local.value.z = graphene_simd4f_normalize4 (local.value.z);
+/* Affine matrices, like the ones created by graphene_matrix_init_trs(),
+ * have no perspective to solve for, and do not need to be normalized
+ */
+static inline bool
+matrix_is_affine (const graphene_matrix_t *m)
+{
+  const graphene_simd4f_t w_axis = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+  const graphene_simd4f_t last_column = graphene_simd4f_init (graphene_simd4f_get_w (m->value.x),
+                                                              graphene_simd4f_get_w (m->value.y),
+                                                              graphene_simd4f_get_w (m->value.z),
+                                                              graphene_simd4f_get_w (m->value.w));
 
-  shear_xz /= scale_z;
-  shear_yz /= scale_z;
+  return graphene_simd4f_cmp_eq (last_column, w_axis);
+}
 
-  graphene_vec3_init (shear_r, shear_xy, shear_xz, shear_yz);
+static bool
+matrix_decompose_affine (const graphene_matrix_t *m,
+                         graphene_vec3_t         *scale_r,
+                         graphene_vec3_t         *shear_r,
+                         graphene_quaternion_t   *rotate_r,
+                         graphene_vec3_t         *translate_r,
+                         graphene_vec4_t         *perspective_r)
+{
+  graphene_matrix_t local;
+  graphene_simd4f_t det;
 
-  /* at this point, the matrix is orthonormal. we check for a
-   * coordinate system flip. if the determinant is -1, then
-   * negate the matrix and the scaling factors
-   */
-  cross = graphene_simd4f_dot3 (local.value.x, graphene_simd4f_cross3 (local.value.y, local.value.z));
-  if (graphene_simd4f_get_x (cross) < 0.f)
-    {
-      scale_x *= -1.f;
-      scale_y *= -1.f;
-      scale_z *= -1.f;
+  /* The determinant of the upper 3x3 part is the one of the matrix */
+  det = graphene_simd4f_dot3 (m->value.x, graphene_simd4f_cross3 (m->value.y, m->value.z));
+  if (graphene_approx_val (graphene_simd4f_get_x (det), 0.f))
+    return false;
 
-      local.value.x = graphene_simd4f_neg (local.value.x);
-      local.value.y = graphene_simd4f_neg (local.value.y);
-      local.value.z = graphene_simd4f_neg (local.value.z);
-    }
+  graphene_vec4_init (perspective_r, 0.f, 0.f, 0.f, 1.f);
+  translate_r->value = graphene_simd4f_merge_w (m->value.w, 0.f);
 
-  graphene_vec3_init (scale_r, scale_x, scale_y, scale_z);
+  local.value.x = m->value.x;
+  local.value.y = m->value.y;
+  local.value.z = m->value.z;
+  local.value.w = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
 
-  /* get the rotations out */
-  graphene_quaternion_init_from_matrix (rotate_r, &local);
+  matrix_decompose_rows (&local, scale_r, shear_r, rotate_r);
 
   return true;
 }
@@ -2055,6 +2618,10 @@ matrix_decompose_3d (const graphene_matrix_t *m,
  * published in "Graphics Gems II", edited by Jim Arvo, and
  * [available online](http://web.archive.org/web/20150512160205/http://tog.acm.org/resources/GraphicsGems/gemsii/unmatrix.c).
  *
+ * Affine matrices, whose last column is (0, 0, 0, 1), like the ones
+ * created by graphene_matrix_init_trs(), are decomposed without solving
+ * for the perspective.
+ *
  * Returns: `true` if the matrix could be decomposed
  */
 bool
@@ -2089,6 +2656,11 @@ graphene_matrix_decompose (const graphene_matrix_t *m,
       graphene_vec3_init_from_vec3 (shear, graphene_vec3_zero ());
       graphene_vec4_init_from_vec4 (perspective, graphene_vec4_zero ());
     }
+  else if (matrix_is_affine (m))
+    {
+      if (!matrix_decompose_affine (m, scale, shear, rotate, translate, perspective))
+        return false;
+    }
   else if (!matrix_decompose_3d (m, scale, shear, rotate, translate, perspective))
     return false;
 
@@ -0,0 +1,662 @@
+/* graphene-obb.c: An oriented bounding box
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-obb
+ * @Title: OBB
+ * @Short_Description: An oriented bounding box
+ *
+ * #graphene_obb_t is an oriented bounding box: a box with a center, three
+ * orthonormal axes, and the half extents of the box along each axis.
+ *
+ * Unlike a #graphene_box_t, an oriented box can follow the rotation of the
+ * object it bounds: graphene_matrix_transform_obb() rotates the axes of
+ * the box instead of growing it to contain the rotated volume, and
+ * graphene_obb_init_from_points() aligns the axes of the box with the
+ * principal directions of a set of points.
+ *
+ * Oriented boxes can be tested against each other with
+ * graphene_obb_intersects_obb(), against a frustum with
+ * graphene_frustum_intersects_obb(), and against a ray with
+ * graphene_ray_intersect_obb(); all of these use the separating axis
+ * theorem.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-obb.h"
+
+#include "graphene-alloc-private.h"
+#include "graphene-box.h"
+#include "graphene-point3d.h"
+#include "graphene-simd4f.h"
+#include "graphene-vec3.h"
+
+#include <math.h>
+
+/**
+ * graphene_obb_alloc: (constructor)
+ *
+ * Allocates a new #graphene_obb_t.
+ *
+ * The contents of the returned structure are undefined.
+ *
+ * Returns: (transfer full): the newly allocated #graphene_obb_t. Use
+ *   graphene_obb_free() to free the resources allocated by this function
+ *
+ * Since: 1.12
+ */
+graphene_obb_t *
+graphene_obb_alloc (void)
+{
+  return graphene_aligned_alloc0 (sizeof (graphene_obb_t), 1, 16);
+}
+
+/**
+ * graphene_obb_free:
+ * @obb: a #graphene_obb_t
+ *
+ * Frees the resources allocated by graphene_obb_alloc().
+ *
+ * Since: 1.12
+ */
+void
+graphene_obb_free (graphene_obb_t *obb)
+{
+  graphene_aligned_free (obb);
+}
+
+/**
+ * graphene_obb_init:
+ * @obb: the #graphene_obb_t to initialize
+ * @center: (nullable): the center of the box, or %NULL for the origin
+ * @half_extents: (nullable): the half extents of the box along each
+ *   axis, or %NULL for an empty box
+ * @x_axis: (nullable): the first axis of the box, or %NULL for the
+ *   X axis
+ * @y_axis: (nullable): the second axis of the box, or %NULL for the
+ *   Y axis
+ * @z_axis: (nullable): the third axis of the box, or %NULL for the
+ *   Z axis
+ *
+ * Initializes the given #graphene_obb_t.
+ *
+ * The axes must be orthonormal.
+ *
+ * Returns: (transfer none): the initialized #graphene_obb_t
+ *
+ * Since: 1.12
+ */
+graphene_obb_t *
+graphene_obb_init (graphene_obb_t           *obb,
+                   const graphene_point3d_t *center,
+                   const graphene_vec3_t    *half_extents,
+                   const graphene_vec3_t    *x_axis,
+                   const graphene_vec3_t    *y_axis,
+                   const graphene_vec3_t    *z_axis)
+{
+  if (center != NULL)
+    graphene_point3d_to_vec3 (center, &obb->center);
+  else
+    graphene_vec3_init_from_vec3 (&obb->center, graphene_vec3_zero ());
+
+  if (half_extents != NULL)
+    graphene_vec3_init_from_vec3 (&obb->half_extents, half_extents);
+  else
+    graphene_vec3_init_from_vec3 (&obb->half_extents, graphene_vec3_zero ());
+
+  graphene_vec3_init_from_vec3 (&obb->axes[0], x_axis != NULL ? x_axis : graphene_vec3_x_axis ());
+  graphene_vec3_init_from_vec3 (&obb->axes[1], y_axis != NULL ? y_axis : graphene_vec3_y_axis ());
+  graphene_vec3_init_from_vec3 (&obb->axes[2], z_axis != NULL ? z_axis : graphene_vec3_z_axis ());
+
+  return obb;
+}
+
+/**
+ * graphene_obb_init_from_box:
+ * @obb: the #graphene_obb_t to initialize
+ * @box: a #graphene_box_t
+ *
+ * Initializes the given #graphene_obb_t with the same volume as the
+ * axis aligned @box.
+ *
+ * If @box is empty, the oriented box has no extents, and it is
+ * centered on the origin.
+ *
+ * Returns: (transfer none): the initialized #graphene_obb_t
+ *
+ * Since: 1.12
+ */
+graphene_obb_t *
+graphene_obb_init_from_box (graphene_obb_t       *obb,
+                            const graphene_box_t *box)
+{
+  graphene_point3d_t min, max;
+  graphene_point3d_t center;
+  graphene_vec3_t half_extents;
+
+  graphene_box_get_minmax (box, &min, &max);
+  if (min.x > max.x || min.y > max.y || min.z > max.z)
+    return graphene_obb_init (obb, NULL, NULL, NULL, NULL, NULL);
+
+  graphene_point3d_init (&center,
+                         (min.x + max.x) * 0.5f,
+                         (min.y + max.y) * 0.5f,
+                         (min.z + max.z) * 0.5f);
+  graphene_vec3_init (&half_extents,
+                      (max.x - min.x) * 0.5f,
+                      (max.y - min.y) * 0.5f,
+                      (max.z - min.z) * 0.5f);
+
+  return graphene_obb_init (obb, &center, &half_extents, NULL, NULL, NULL);
+}
+
+/* Diagonalizes the symmetric matrix @a with Jacobi rotations; the
+ * eigenvalues end up on the diagonal of @a, and the eigenvectors in
+ * the columns of @v
+ */
+static void
+obb_jacobi (double a[3][3],
+            double v[3][3])
+{
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      v[i][j] = i == j ? 1. : 0.;
+
+  for (int sweep = 0; sweep < 32; sweep++)
+    {
+      double off = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+      double diag = a[0][0] * a[0][0] + a[1][1] * a[1][1] + a[2][2] * a[2][2];
+
+      /* Also covers the case of an all zero matrix */
+      if (off <= 1e-24 * diag)
+        break;
+
+      for (int p = 0; p < 2; p++)
+        {
+          for (int q = p + 1; q < 3; q++)
+            {
+              double theta, t, c, s;
+
+              /* Already diagonal in this plane, relative to the magnitude
+               * of the diagonal elements
+               */
+              if (fabs (a[p][q]) <= 1e-12 * sqrt (diag))
+                continue;
+
+              theta = (a[q][q] - a[p][p]) / (2. * a[p][q]);
+              t = (theta >= 0. ? 1. : -1.) / (fabs (theta) + sqrt (theta * theta + 1.));
+              c = 1. / sqrt (t * t + 1.);
+              s = t * c;
+
+              /* A' = J^T A J, with J the rotation in the (p, q) plane */
+              for (int k = 0; k < 3; k++)
+                {
+                  double a_kp = a[k][p], a_kq = a[k][q];
+
+                  a[k][p] = c * a_kp - s * a_kq;
+                  a[k][q] = s * a_kp + c * a_kq;
+                }
+
+              for (int k = 0; k < 3; k++)
+                {
+                  double a_pk = a[p][k], a_qk = a[q][k];
+
+                  a[p][k] = c * a_pk - s * a_qk;
+                  a[q][k] = s * a_pk + c * a_qk;
+                }
+
+              for (int k = 0; k < 3; k++)
+                {
+                  double v_kp = v[k][p], v_kq = v[k][q];
+
+                  v[k][p] = c * v_kp - s * v_kq;
+                  v[k][q] = s * v_kp + c * v_kq;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * graphene_obb_init_from_points:
+ * @obb: the #graphene_obb_t to initialize
+ * @n_points: the number of #graphene_point3d_t in the @points array
+ * @points: (array length=n_points): an array of #graphene_point3d_t
+ *
+ * Initializes the given #graphene_obb_t so that it includes the given
+ * array of points.
+ *
+ * The axes of the box are the principal axes of the points, computed
+ * from the eigenvectors of their covariance matrix, sorted by decreasing
+ * variance; the box is then fitted tightly around the points along
+ * those axes.
+ *
+ * If @n_points is 0, the oriented box has no extents, and it is centered
+ * on the origin.
+ *
+ * Returns: (transfer none): the initialized #graphene_obb_t
+ *
+ * Since: 1.12
+ */
+graphene_obb_t *
+graphene_obb_init_from_points (graphene_obb_t           *obb,
+                               unsigned int              n_points,
+                               const graphene_point3d_t *points)
+{
+  double mean[3] = { 0., 0., 0. };
+  double cov[3][3] = { { 0., }, };
+  double v[3][3];
+  int order[3] = { 0, 1, 2 };
+  float min_v[3] = { INFINITY, INFINITY, INFINITY };
+  float max_v[3] = { -INFINITY, -INFINITY, -INFINITY };
+  graphene_vec3_t axes[3], tmp;
+
+  if (n_points == 0)
+    return graphene_obb_init (obb, NULL, NULL, NULL, NULL, NULL);
+
+  for (unsigned int i = 0; i < n_points; i++)
+    {
+      mean[0] += points[i].x;
+      mean[1] += points[i].y;
+      mean[2] += points[i].z;
+    }
+
+  for (int j = 0; j < 3; j++)
+    mean[j] /= n_points;
+
+  for (unsigned int i = 0; i < n_points; i++)
+    {
+      double d[3] = {
+        points[i].x - mean[0],
+        points[i].y - mean[1],
+        points[i].z - mean[2],
+      };
+
+      for (int j = 0; j < 3; j++)
+        for (int k = j; k < 3; k++)
+          cov[j][k] += d[j] * d[k];
+    }
+
+  cov[1][0] = cov[0][1];
+  cov[2][0] = cov[0][2];
+  cov[2][1] = cov[1][2];
+
+  obb_jacobi (cov, v);
+
+  /* Sort the eigenvectors by decreasing eigenvalue */
+  for (int i = 0; i < 2; i++)
+    for (int j = i + 1; j < 3; j++)
+      if (cov[order[j]][order[j]] > cov[order[i]][order[i]])
+        {
+          int t = order[i];
+
+          order[i] = order[j];
+          order[j] = t;
+        }
+
+  /* Make the axes orthonormal and right handed, to remove the rounding
+   * errors of the eigenvectors
+   */
+  graphene_vec3_init (&axes[0],
+                      (float) v[0][order[0]],
+                      (float) v[1][order[0]],
+                      (float) v[2][order[0]]);
+  graphene_vec3_normalize (&axes[0], &axes[0]);
+
+  graphene_vec3_init (&axes[1],
+                      (float) v[0][order[1]],
+                      (float) v[1][order[1]],
+                      (float) v[2][order[1]]);
+  graphene_vec3_scale (&axes[0], graphene_vec3_dot (&axes[0], &axes[1]), &tmp);
+  graphene_vec3_subtract (&axes[1], &tmp, &axes[1]);
+  graphene_vec3_normalize (&axes[1], &axes[1]);
+
+  graphene_vec3_cross (&axes[0], &axes[1], &axes[2]);
+
+  for (unsigned int i = 0; i < n_points; i++)
+    {
+      graphene_vec3_t p;
+
+      graphene_point3d_to_vec3 (&points[i], &p);
+
+      for (int j = 0; j < 3; j++)
+        {
+          float d = graphene_vec3_dot (&p, &axes[j]);
+
+          min_v[j] = MIN (min_v[j], d);
+          max_v[j] = MAX (max_v[j], d);
+        }
+    }
+
+  graphene_vec3_init_from_vec3 (&obb->center, graphene_vec3_zero ());
+  for (int j = 0; j < 3; j++)
+    {
+      graphene_vec3_scale (&axes[j], (min_v[j] + max_v[j]) * 0.5f, &tmp);
+      graphene_vec3_add (&obb->center, &tmp, &obb->center);
+
+      obb->axes[j] = axes[j];
+    }
+
+  graphene_vec3_init (&obb->half_extents,
+                      (max_v[0] - min_v[0]) * 0.5f,
+                      (max_v[1] - min_v[1]) * 0.5f,
+                      (max_v[2] - min_v[2]) * 0.5f);
+
+  return obb;
+}
+
+/**
+ * graphene_obb_init_from_obb:
+ * @obb: the #graphene_obb_t to initialize
+ * @src: a #graphene_obb_t
+ *
+ * Initializes the given #graphene_obb_t with the contents of
+ * another #graphene_obb_t.
+ *
+ * Returns: (transfer none): the initialized #graphene_obb_t
+ *
+ * Since: 1.12
+ */
+graphene_obb_t *
+graphene_obb_init_from_obb (graphene_obb_t       *obb,
+                            const graphene_obb_t *src)
+{
+  *obb = *src;
+
+  return obb;
+}
+
+/**
+ * graphene_obb_get_center:
+ * @obb: a #graphene_obb_t
+ * @center: (out caller-allocates): return location for the center
+ *
+ * Retrieves the center of the given #graphene_obb_t.
+ *
+ * Since: 1.12
+ */
+void
+graphene_obb_get_center (const graphene_obb_t *obb,
+                         graphene_point3d_t   *center)
+{
+  graphene_point3d_init_from_vec3 (center, &obb->center);
+}
+
+/**
+ * graphene_obb_get_half_extents:
+ * @obb: a #graphene_obb_t
+ * @half_extents: (out caller-allocates): return location for the
+ *   half extents
+ *
+ * Retrieves the half extents of the given #graphene_obb_t along each
+ * of its axes.
+ *
+ * Since: 1.12
+ */
+void
+graphene_obb_get_half_extents (const graphene_obb_t *obb,
+                               graphene_vec3_t      *half_extents)
+{
+  graphene_vec3_init_from_vec3 (half_extents, &obb->half_extents);
+}
+
+/**
+ * graphene_obb_get_axes:
+ * @obb: a #graphene_obb_t
+ * @x_axis: (out caller-allocates) (optional): return location for
+ *   the first axis
+ * @y_axis: (out caller-allocates) (optional): return location for
+ *   the second axis
+ * @z_axis: (out caller-allocates) (optional): return location for
+ *   the third axis
+ *
+ * Retrieves the orthonormal axes of the given #graphene_obb_t.
+ *
+ * Since: 1.12
+ */
+void
+graphene_obb_get_axes (const graphene_obb_t *obb,
+                       graphene_vec3_t      *x_axis,
+                       graphene_vec3_t      *y_axis,
+                       graphene_vec3_t      *z_axis)
+{
+  if (x_axis != NULL)
+    graphene_vec3_init_from_vec3 (x_axis, &obb->axes[0]);
+  if (y_axis != NULL)
+    graphene_vec3_init_from_vec3 (y_axis, &obb->axes[1]);
+  if (z_axis != NULL)
+    graphene_vec3_init_from_vec3 (z_axis, &obb->axes[2]);
+}
+
+/**
+ * graphene_obb_get_volume:
+ * @obb: a #graphene_obb_t
+ *
+ * Computes the volume of the given #graphene_obb_t.
+ *
+ * Returns: the volume of the box
+ *
+ * Since: 1.12
+ */
+float
+graphene_obb_get_volume (const graphene_obb_t *obb)
+{
+  return 8.f * graphene_vec3_get_x (&obb->half_extents)
+             * graphene_vec3_get_y (&obb->half_extents)
+             * graphene_vec3_get_z (&obb->half_extents);
+}
+
+/**
+ * graphene_obb_get_vertices:
+ * @obb: a #graphene_obb_t
+ * @vertices: (out) (array fixed-size=8): return location for an array
+ *   of 8 #graphene_vec3_t
+ *
+ * Computes the vertices of the given #graphene_obb_t, in the same
+ * order as graphene_box_get_vertices().
+ *
+ * Since: 1.12
+ */
+void
+graphene_obb_get_vertices (const graphene_obb_t *obb,
+                           graphene_vec3_t       vertices[])
+{
+  graphene_vec3_t x, y, z;
+
+  graphene_vec3_scale (&obb->axes[0], graphene_vec3_get_x (&obb->half_extents), &x);
+  graphene_vec3_scale (&obb->axes[1], graphene_vec3_get_y (&obb->half_extents), &y);
+  graphene_vec3_scale (&obb->axes[2], graphene_vec3_get_z (&obb->half_extents), &z);
+
+  for (int i = 0; i < 8; i++)
+    {
+      graphene_vec3_t v = obb->center;
+
+      if (i & 4)
+        graphene_vec3_add (&v, &x, &v);
+      else
+        graphene_vec3_subtract (&v, &x, &v);
+
+      if (i & 2)
+        graphene_vec3_add (&v, &y, &v);
+      else
+        graphene_vec3_subtract (&v, &y, &v);
+
+      if (i & 1)
+        graphene_vec3_add (&v, &z, &v);
+      else
+        graphene_vec3_subtract (&v, &z, &v);
+
+      vertices[i] = v;
+    }
+}
+
+/**
+ * graphene_obb_get_bounding_box:
+ * @obb: a #graphene_obb_t
+ * @box: (out caller-allocates): return location for the bounding box
+ *
+ * Computes the smallest axis aligned #graphene_box_t that contains
+ * the given #graphene_obb_t.
+ *
+ * Since: 1.12
+ */
+void
+graphene_obb_get_bounding_box (const graphene_obb_t *obb,
+                               graphene_box_t       *box)
+{
+  graphene_vec3_t extent, tmp;
+  graphene_vec3_t min, max;
+  float e[3];
+
+  graphene_vec3_to_float (&obb->half_extents, e);
+  graphene_vec3_init_from_vec3 (&extent, graphene_vec3_zero ());
+
+  /* The extent along each world axis is the sum of the absolute
+   * values of the scaled axes of the box
+   */
+  for (int i = 0; i < 3; i++)
+    {
+      graphene_vec3_scale (&obb->axes[i], e[i], &tmp);
+      tmp.value = graphene_simd4f_max (tmp.value, graphene_simd4f_neg (tmp.value));
+      graphene_vec3_add (&extent, &tmp, &extent);
+    }
+
+  graphene_vec3_subtract (&obb->center, &extent, &min);
+  graphene_vec3_add (&obb->center, &extent, &max);
+
+  graphene_box_init_from_vec3 (box, &min, &max);
+}
+
+/**
+ * graphene_obb_contains_point:
+ * @obb: a #graphene_obb_t
+ * @point: the coordinates to check
+ *
+ * Checks whether the given #graphene_obb_t contains the given @point.
+ *
+ * Returns: `true` if the point is inside the box
+ *
+ * Since: 1.12
+ */
+bool
+graphene_obb_contains_point (const graphene_obb_t     *obb,
+                             const graphene_point3d_t *point)
+{
+  graphene_vec3_t d;
+  float e[3];
+
+  graphene_vec3_to_float (&obb->half_extents, e);
+  graphene_point3d_to_vec3 (point, &d);
+  graphene_vec3_subtract (&d, &obb->center, &d);
+
+  for (int i = 0; i < 3; i++)
+    {
+      if (fabsf (graphene_vec3_dot (&d, &obb->axes[i])) > e[i])
+        return false;
+    }
+
+  return true;
+}
+
+/* Avoids false separations along the cross products of nearly parallel
+ * axes, whose length is close to zero
+ */
+#define OBB_PARALLEL_EPSILON    1e-6f
+
+/**
+ * graphene_obb_intersects_obb:
+ * @a: a #graphene_obb_t
+ * @b: a #graphene_obb_t
+ *
+ * Checks whether two oriented boxes intersect, using the separating
+ * axis theorem: the boxes are disjoint if and only if their projections
+ * are disjoint on one of the three axes of @a, the three axes of @b,
+ * or the nine cross products of an axis of @a and an axis of @b.
+ *
+ * Returns: `true` if the boxes intersect
+ *
+ * Since: 1.12
+ */
+bool
+graphene_obb_intersects_obb (const graphene_obb_t *a,
+                             const graphene_obb_t *b)
+{
+  float ea[3], eb[3], r[3][3], abs_r[3][3], t[3];
+  graphene_vec3_t d;
+  float ra, rb;
+
+  graphene_vec3_to_float (&a->half_extents, ea);
+  graphene_vec3_to_float (&b->half_extents, eb);
+
+  /* The axes of @b, and the distance between the centers, in the
+   * frame of @a
+   */
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      {
+        r[i][j] = graphene_vec3_dot (&a->axes[i], &b->axes[j]);
+        abs_r[i][j] = fabsf (r[i][j]) + OBB_PARALLEL_EPSILON;
+      }
+
+  graphene_vec3_subtract (&b->center, &a->center, &d);
+  for (int i = 0; i < 3; i++)
+    t[i] = graphene_vec3_dot (&d, &a->axes[i]);
+
+  /* The axes of @a */
+  for (int i = 0; i < 3; i++)
+    {
+      rb = eb[0] * abs_r[i][0] + eb[1] * abs_r[i][1] + eb[2] * abs_r[i][2];
+      if (fabsf (t[i]) > ea[i] + rb)
+        return false;
+    }
+
+  /* The axes of @b */
+  for (int j = 0; j < 3; j++)
+    {
+      ra = ea[0] * abs_r[0][j] + ea[1] * abs_r[1][j] + ea[2] * abs_r[2][j];
+      if (fabsf (t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j]) > ra + eb[j])
+        return false;
+    }
+
+  /* The cross products of the axes of @a and @b */
+  for (int i = 0; i < 3; i++)
+    {
+      int i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+
+      for (int j = 0; j < 3; j++)
+        {
+          int j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+
+          ra = ea[i1] * abs_r[i2][j] + ea[i2] * abs_r[i1][j];
+          rb = eb[j1] * abs_r[i][j2] + eb[j2] * abs_r[i][j1];
+
+          if (fabsf (t[i2] * r[i1][j] - t[i1] * r[i2][j]) > ra + rb)
+            return false;
+        }
+    }
+
+  return true;
+}
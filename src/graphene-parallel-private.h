@@ -0,0 +1,88 @@
+/* graphene-parallel-private.h: Parallel execution of batch operations
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "graphene-types.h"
+
+#include <stddef.h>
+
+GRAPHENE_BEGIN_DECLS
+
+/* The amount of input data processed by each chunk of a batch operation;
+ * small enough to stay in the L2 cache, and large enough to make the cost
+ * of scheduling a chunk negligible
+ */
+#define GRAPHENE_PARALLEL_CHUNK_BYTES   (64 * 1024)
+
+/* The number of items of @item_size bytes in each chunk; always a multiple
+ * of 32, so that each chunk writes whole words of a visibility bitmask
+ */
+#define graphene_parallel_chunk_size(item_size) \
+  ((unsigned int) MAX ((GRAPHENE_PARALLEL_CHUNK_BYTES / (item_size)) & ~((size_t) 31), 32))
+
+/* Processes the items in [@first, @first + @n_items) of the chunk with
+ * index @chunk
+ */
+typedef void (* graphene_parallel_range_func_t) (unsigned int  chunk,
+                                                 unsigned int  first,
+                                                 unsigned int  n_items,
+                                                 void         *data);
+
+/* Processes the items in [@first, @first + @n_items), and returns the
+ * number of items matching some condition
+ */
+typedef unsigned int (* graphene_parallel_count_func_t) (unsigned int  first,
+                                                         unsigned int  n_items,
+                                                         void         *data);
+
+static inline unsigned int
+graphene_parallel_get_n_chunks (unsigned int n_items,
+                                unsigned int chunk_size)
+{
+  return (n_items + chunk_size - 1) / chunk_size;
+}
+
+bool            graphene_parallel_is_enabled    (void);
+
+/* Splits @n_items into chunks of @chunk_size items, and calls @func once
+ * for each chunk, possibly on multiple threads; the chunks only depend on
+ * @n_items and @chunk_size, so reductions over per-chunk results return
+ * the same value regardless of the number of threads
+ */
+void            graphene_parallel_for           (unsigned int                   n_items,
+                                                 unsigned int                   chunk_size,
+                                                 graphene_parallel_range_func_t func,
+                                                 void                          *data);
+
+/* Like graphene_parallel_for(), and returns the sum of the values
+ * returned by @func for each chunk
+ */
+unsigned int    graphene_parallel_count         (unsigned int                   n_items,
+                                                 unsigned int                   chunk_size,
+                                                 graphene_parallel_count_func_t func,
+                                                 void                          *data);
+
+GRAPHENE_END_DECLS
@@ -0,0 +1,521 @@
+/* graphene-parallel.c: Parallel execution of batch operations
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-parallel
+ * @Title: Parallel execution
+ * @Short_Description: Run batch operations on multiple threads
+ *
+ * The batch operations of Graphene, like transforming arrays of points
+ * with graphene_matrix_transform_points3d(), culling arrays of boxes with
+ * graphene_frustum_cull_boxes(), or computing the bounds of an array of
+ * points with graphene_box_init_from_points(), can split large arrays into
+ * chunks that fit in the cache, and process them on multiple threads.
+ *
+ * Parallel execution is disabled by default. Calling
+ * graphene_parallel_set_n_threads() enables a thread pool owned by
+ * Graphene; alternatively, applications with their own scheduler can use
+ * graphene_parallel_set_executor() to run the chunks on it. The number of
+ * threads can also be set using the `GRAPHENE_PARALLEL_THREADS`
+ * environment variable.
+ *
+ * The chunks of an operation only depend on the size of its input, and
+ * the results of each chunk are combined in order, so the results do not
+ * depend on the number of threads.
+ *
+ * Only one parallel operation runs at a time; batch operations called
+ * while another one is running, including from within an executor, are
+ * processed on the calling thread.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-parallel.h"
+
+#include "graphene-alloc-private.h"
+#include "graphene-parallel-private.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/* Upper bound for the number of threads of the pool */
+#define PARALLEL_MAX_THREADS    64
+
+/* Number of per-chunk results stored on the stack by reductions */
+#define PARALLEL_STACK_CHUNKS   64
+
+typedef struct {
+  unsigned int n_items;
+  unsigned int chunk_size;
+  graphene_parallel_range_func_t func;
+  void *data;
+} parallel_range_t;
+
+static void
+parallel_run_chunk (unsigned int  chunk,
+                    void         *data)
+{
+  const parallel_range_t *range = data;
+  unsigned int first = chunk * range->chunk_size;
+
+  range->func (chunk, first, MIN (range->chunk_size, range->n_items - first), range->data);
+}
+
+#ifdef HAVE_PTHREAD_H
+/* A pool of worker threads; the tasks of a job are claimed, one at a
+ * time, by the workers and by the thread that submitted the job
+ */
+typedef struct {
+  pthread_mutex_t lock;
+  pthread_cond_t work_cond;
+  pthread_cond_t done_cond;
+
+  pthread_t *threads;
+  unsigned int n_threads;
+  bool quit;
+
+  /* The current job */
+  unsigned long job_id;
+  graphene_parallel_task_func_t func;
+  void *data;
+  unsigned int n_tasks;
+  unsigned int next_task;
+  unsigned int n_pending;
+} parallel_pool_t;
+
+/* Held while a job is running, and while changing the configuration */
+static pthread_mutex_t parallel_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static parallel_pool_t *parallel_pool;
+
+/* Runs the tasks of the current job until there are none left to claim;
+ * called with the pool lock held
+ */
+static void
+parallel_pool_run_tasks (parallel_pool_t *pool)
+{
+  while (pool->next_task < pool->n_tasks)
+    {
+      unsigned int task = pool->next_task++;
+
+      pthread_mutex_unlock (&pool->lock);
+      pool->func (task, pool->data);
+      pthread_mutex_lock (&pool->lock);
+
+      pool->n_pending -= 1;
+      if (pool->n_pending == 0)
+        pthread_cond_signal (&pool->done_cond);
+    }
+}
+
+static void *
+parallel_pool_worker (void *data)
+{
+  parallel_pool_t *pool = data;
+  unsigned long last_job = 0;
+
+  pthread_mutex_lock (&pool->lock);
+
+  for (;;)
+    {
+      while (pool->job_id == last_job && !pool->quit)
+        pthread_cond_wait (&pool->work_cond, &pool->lock);
+
+      if (pool->quit)
+        break;
+
+      last_job = pool->job_id;
+      parallel_pool_run_tasks (pool);
+    }
+
+  pthread_mutex_unlock (&pool->lock);
+
+  return NULL;
+}
+
+static parallel_pool_t *
+parallel_pool_new (unsigned int n_threads)
+{
+  parallel_pool_t *pool = graphene_aligned_alloc0 (sizeof (parallel_pool_t), 1, 16);
+
+  pthread_mutex_init (&pool->lock, NULL);
+  pthread_cond_init (&pool->work_cond, NULL);
+  pthread_cond_init (&pool->done_cond, NULL);
+
+  /* The thread submitting a job works as well */
+  pool->threads = graphene_aligned_alloc0 (sizeof (pthread_t), n_threads - 1, 16);
+
+  for (unsigned int i = 0; i < n_threads - 1; i++)
+    {
+      int status = pthread_create (&pool->threads[pool->n_threads], NULL, parallel_pool_worker, pool);
+
+      if (status != 0)
+        {
+          fprintf (stderr, "pthread_create failed: %s (errno:%d)\n",
+                   strerror (status),
+                   status);
+          break;
+        }
+
+      pool->n_threads += 1;
+    }
+
+  return pool;
+}
+
+static void
+parallel_pool_free (parallel_pool_t *pool)
+{
+  pthread_mutex_lock (&pool->lock);
+  pool->quit = true;
+  pthread_cond_broadcast (&pool->work_cond);
+  pthread_mutex_unlock (&pool->lock);
+
+  for (unsigned int i = 0; i < pool->n_threads; i++)
+    pthread_join (pool->threads[i], NULL);
+
+  pthread_cond_destroy (&pool->done_cond);
+  pthread_cond_destroy (&pool->work_cond);
+  pthread_mutex_destroy (&pool->lock);
+
+  graphene_aligned_free (pool->threads);
+  graphene_aligned_free (pool);
+}
+
+static void
+parallel_pool_run (parallel_pool_t               *pool,
+                   unsigned int                   n_tasks,
+                   graphene_parallel_task_func_t  func,
+                   void                          *data)
+{
+  pthread_mutex_lock (&pool->lock);
+
+  pool->job_id += 1;
+  pool->func = func;
+  pool->data = data;
+  pool->n_tasks = n_tasks;
+  pool->next_task = 0;
+  pool->n_pending = n_tasks;
+
+  pthread_cond_broadcast (&pool->work_cond);
+
+  parallel_pool_run_tasks (pool);
+
+  while (pool->n_pending > 0)
+    pthread_cond_wait (&pool->done_cond, &pool->lock);
+
+  pthread_mutex_unlock (&pool->lock);
+}
+
+static inline bool
+parallel_lock_acquire (bool wait)
+{
+  if (wait)
+    return pthread_mutex_lock (&parallel_lock) == 0;
+
+  return pthread_mutex_trylock (&parallel_lock) == 0;
+}
+
+static inline void
+parallel_lock_release (void)
+{
+  pthread_mutex_unlock (&parallel_lock);
+}
+
+static unsigned int
+parallel_get_n_cpus (void)
+{
+  long n_cpus = sysconf (_SC_NPROCESSORS_ONLN);
+
+  return n_cpus > 0 ? (unsigned int) n_cpus : 1;
+}
+#else /* !HAVE_PTHREAD_H */
+/* Without threads, the only way to run in parallel is an executor */
+static bool parallel_busy;
+
+static inline bool
+parallel_lock_acquire (bool wait)
+{
+  if (parallel_busy && !wait)
+    return false;
+
+  parallel_busy = true;
+
+  return true;
+}
+
+static inline void
+parallel_lock_release (void)
+{
+  parallel_busy = false;
+}
+
+static unsigned int
+parallel_get_n_cpus (void)
+{
+  return 1;
+}
+#endif /* HAVE_PTHREAD_H */
+
+/* 0 until the configuration is initialized */
+static unsigned int parallel_n_threads;
+
+static graphene_parallel_executor_func_t parallel_executor;
+static void *parallel_executor_data;
+
+static unsigned int
+parallel_clamp_n_threads (unsigned int n_threads)
+{
+  if (n_threads == 0)
+    n_threads = parallel_get_n_cpus ();
+
+#ifdef HAVE_PTHREAD_H
+  return MIN (n_threads, PARALLEL_MAX_THREADS);
+#else
+  return 1;
+#endif
+}
+
+/* Called with the parallel lock held */
+static void
+parallel_ensure_config (void)
+{
+  const char *env;
+
+  if (parallel_n_threads != 0)
+    return;
+
+  env = getenv ("GRAPHENE_PARALLEL_THREADS");
+  if (env != NULL && *env != '\0')
+    parallel_n_threads = parallel_clamp_n_threads ((unsigned int) strtoul (env, NULL, 10));
+  else
+    parallel_n_threads = 1;
+}
+
+/**
+ * graphene_parallel_set_n_threads:
+ * @n_threads: the number of threads to use, or 0 to use one thread
+ *   for each CPU
+ *
+ * Sets the number of threads used by the batch operations of Graphene,
+ * including the calling thread; setting it to 1 disables parallel
+ * execution.
+ *
+ * If an executor was set with graphene_parallel_set_executor(), it is
+ * used instead of the threads owned by Graphene.
+ *
+ * This function waits for the running parallel operation, if any, to
+ * complete.
+ *
+ * Since: 1.12
+ */
+void
+graphene_parallel_set_n_threads (unsigned int n_threads)
+{
+  n_threads = parallel_clamp_n_threads (n_threads);
+
+  parallel_lock_acquire (true);
+
+  parallel_n_threads = n_threads;
+
+#ifdef HAVE_PTHREAD_H
+  /* The pool is created again, with the new size, when needed */
+  if (parallel_pool != NULL && parallel_pool->n_threads + 1 != n_threads)
+    {
+      parallel_pool_free (parallel_pool);
+      parallel_pool = NULL;
+    }
+#endif
+
+  parallel_lock_release ();
+}
+
+/**
+ * graphene_parallel_get_n_threads:
+ *
+ * Retrieves the number of threads used by the batch operations of
+ * Graphene, as set by graphene_parallel_set_n_threads() or by the
+ * `GRAPHENE_PARALLEL_THREADS` environment variable.
+ *
+ * Returns: the number of threads, including the calling thread
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_parallel_get_n_threads (void)
+{
+  unsigned int res;
+
+  parallel_lock_acquire (true);
+  parallel_ensure_config ();
+  res = parallel_n_threads;
+  parallel_lock_release ();
+
+  return res;
+}
+
+/**
+ * graphene_parallel_set_executor:
+ * @executor: (nullable) (scope forever): the function used to run the
+ *   tasks of parallel operations, or %NULL to use the threads owned by
+ *   Graphene
+ * @user_data: (closure executor): data to pass to @executor
+ *
+ * Sets a function that runs the tasks of the parallel batch operations
+ * of Graphene, for instance on the thread pool of the application.
+ *
+ * The executor is used regardless of the number of threads set with
+ * graphene_parallel_set_n_threads().
+ *
+ * This function waits for the running parallel operation, if any, to
+ * complete.
+ *
+ * Since: 1.12
+ */
+void
+graphene_parallel_set_executor (graphene_parallel_executor_func_t executor,
+                                void                             *user_data)
+{
+  parallel_lock_acquire (true);
+
+  parallel_executor = executor;
+  parallel_executor_data = executor != NULL ? user_data : NULL;
+
+  parallel_lock_release ();
+}
+
+/*< private >
+ * graphene_parallel_is_enabled:
+ *
+ * Checks whether batch operations may run on multiple threads; callers
+ * can use it to skip the work needed to split an operation when it would
+ * run on the calling thread anyway.
+ *
+ * Returns: %true if parallel execution is enabled
+ */
+bool
+graphene_parallel_is_enabled (void)
+{
+  bool res;
+
+  if (!parallel_lock_acquire (false))
+    return false;
+
+  parallel_ensure_config ();
+  res = parallel_executor != NULL || parallel_n_threads > 1;
+
+  parallel_lock_release ();
+
+  return res;
+}
+
+void
+graphene_parallel_for (unsigned int                   n_items,
+                       unsigned int                   chunk_size,
+                       graphene_parallel_range_func_t func,
+                       void                          *data)
+{
+  unsigned int n_chunks = graphene_parallel_get_n_chunks (n_items, chunk_size);
+  parallel_range_t range = { n_items, chunk_size, func, data };
+
+  if (n_chunks > 1 && parallel_lock_acquire (false))
+    {
+      parallel_ensure_config ();
+
+      if (parallel_executor != NULL)
+        {
+          parallel_executor (n_chunks, parallel_run_chunk, &range, parallel_executor_data);
+          parallel_lock_release ();
+          return;
+        }
+
+#ifdef HAVE_PTHREAD_H
+      if (parallel_n_threads > 1)
+        {
+          if (parallel_pool == NULL)
+            parallel_pool = parallel_pool_new (parallel_n_threads);
+
+          parallel_pool_run (parallel_pool, n_chunks, parallel_run_chunk, &range);
+          parallel_lock_release ();
+          return;
+        }
+#endif
+
+      parallel_lock_release ();
+    }
+
+  for (unsigned int i = 0; i < n_chunks; i++)
+    parallel_run_chunk (i, &range);
+}
+
+typedef struct {
+  graphene_parallel_count_func_t func;
+  void *data;
+  unsigned int *counts;
+} parallel_count_t;
+
+static void
+parallel_count_chunk (unsigned int  chunk,
+                      unsigned int  first,
+                      unsigned int  n_items,
+                      void         *data)
+{
+  const parallel_count_t *count = data;
+
+  count->counts[chunk] = count->func (first, n_items, count->data);
+}
+
+unsigned int
+graphene_parallel_count (unsigned int                   n_items,
+                         unsigned int                   chunk_size,
+                         graphene_parallel_count_func_t func,
+                         void                          *data)
+{
+  unsigned int n_chunks = graphene_parallel_get_n_chunks (n_items, chunk_size);
+  unsigned int stack_counts[PARALLEL_STACK_CHUNKS];
+  parallel_count_t count = { func, data, stack_counts };
+  unsigned int res = 0;
+
+  if (n_chunks <= 1)
+    return n_items > 0 ? func (0, n_items, data) : 0;
+
+  if (n_chunks > PARALLEL_STACK_CHUNKS)
+    count.counts = graphene_aligned_alloc (sizeof (unsigned int), n_chunks, 16);
+
+  graphene_parallel_for (n_items, chunk_size, parallel_count_chunk, &count);
+
+  for (unsigned int i = 0; i < n_chunks; i++)
+    res += count.counts[i];
+
+  if (count.counts != stack_counts)
+    graphene_aligned_free (count.counts);
+
+  return res;
+}
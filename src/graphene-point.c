@@ -36,6 +36,7 @@
  */
 
 #include "graphene-private.h"
+#include "graphene-alloc-private.h"
 
 #include "graphene-point.h"
 
@@ -77,7 +78,7 @@
 graphene_point_t *
 graphene_point_alloc (void)
 {
-  return calloc (1, sizeof (graphene_point_t));
+  return graphene_aligned_alloc0 (sizeof (graphene_point_t), 1, 16);
 }
 
 /**
@@ -91,7 +92,7 @@ graphene_point_alloc (void)
 void
 graphene_point_free (graphene_point_t *p)
 {
-  free (p);
+  graphene_aligned_free (p);
 }
 
 /**
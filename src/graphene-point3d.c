@@ -37,6 +37,7 @@
  */
 
 #include "graphene-private.h"
+#include "graphene-alloc-private.h"
 #include "graphene-point3d.h"
 #include "graphene-rect.h"
 #include "graphene-simd4f.h"
@@ -58,7 +59,7 @@
 graphene_point3d_t *
 graphene_point3d_alloc (void)
 {
-  return calloc (1, sizeof (graphene_point3d_t));
+  return graphene_aligned_alloc0 (sizeof (graphene_point3d_t), 1, 16);
 }
 
 /**
@@ -72,7 +73,7 @@ graphene_point3d_alloc (void)
 void
 graphene_point3d_free (graphene_point3d_t *p)
 {
-  free (p);
+  graphene_aligned_free (p);
 }
 
 /**
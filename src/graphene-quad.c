@@ -32,6 +32,7 @@
  */
 
 #include "graphene-private.h"
+#include "graphene-alloc-private.h"
 
 #include "graphene-quad.h"
 
@@ -55,7 +56,7 @@
 graphene_quad_t *
 graphene_quad_alloc (void)
 {
-  return calloc (1, sizeof (graphene_quad_t));
+  return graphene_aligned_alloc0 (sizeof (graphene_quad_t), 1, 16);
 }
 
 /**
@@ -69,7 +70,7 @@ graphene_quad_alloc (void)
 void
 graphene_quad_free (graphene_quad_t *q)
 {
-  free (q);
+  graphene_aligned_free (q);
 }
 
 /**
@@ -37,6 +37,7 @@
  */
 
 #include "graphene-private.h"
+#include "graphene-alloc-private.h"
 
 #include "graphene-quaternion.h"
 
@@ -64,7 +65,7 @@
 graphene_quaternion_t *
 graphene_quaternion_alloc (void)
 {
-  return calloc (1, sizeof (graphene_quaternion_t));
+  return graphene_aligned_alloc0 (sizeof (graphene_quaternion_t), 1, 16);
 }
 
 /**
@@ -78,7 +79,7 @@ graphene_quaternion_alloc (void)
 void
 graphene_quaternion_free (graphene_quaternion_t *q)
 {
-  free (q);
+  graphene_aligned_free (q);
 }
 
 /**
@@ -41,10 +41,15 @@
 #include "graphene-ray.h"
 
 #include "graphene-alloc-private.h"
+#include "graphene-kernels-private.h"
+#include "graphene-parallel-private.h"
 #include "graphene-box.h"
+#include "graphene-obb.h"
 #include "graphene-plane.h"
 #include "graphene-point3d.h"
 #include "graphene-simd4f.h"
+#include "graphene-simd4x4f.h"
+#include "graphene-simd8f.h"
 #include "graphene-sphere.h"
 #include "graphene-vec3.h"
 #include "graphene-triangle.h"
@@ -590,6 +595,142 @@ graphene_ray_intersects_box (const graphene_ray_t *r,
   return graphene_ray_intersect_box (r, b, NULL) != GRAPHENE_RAY_INTERSECTION_KIND_NONE;
 }
 
+/**
+ * graphene_ray_intersect_obb:
+ * @r: a #graphene_ray_t
+ * @obb: a #graphene_obb_t
+ * @t_out: (out): the distance of the point on the ray that intersects the box
+ *
+ * Intersects the given #graphene_ray_t @r with the given
+ * #graphene_obb_t @obb.
+ *
+ * The ray is transformed in the frame of the oriented box, and then
+ * intersected with an axis aligned box, like graphene_ray_intersect_box().
+ *
+ * Returns: the type of intersection
+ *
+ * Since: 1.12
+ */
+graphene_ray_intersection_kind_t
+graphene_ray_intersect_obb (const graphene_ray_t *r,
+                            const graphene_obb_t *obb,
+                            float                *t_out)
+{
+  graphene_vec3_t center, half_extents, axes[3], d;
+  graphene_point3d_t p, min, max;
+  graphene_vec3_t origin, direction;
+  graphene_ray_t local;
+  graphene_box_t box;
+
+  graphene_obb_get_center (obb, &p);
+  graphene_point3d_to_vec3 (&p, &center);
+  graphene_obb_get_half_extents (obb, &half_extents);
+  graphene_obb_get_axes (obb, &axes[0], &axes[1], &axes[2]);
+
+  /* The axes are orthonormal, so the distances along the ray are the
+   * same in the frame of the box
+   */
+  graphene_vec3_subtract (&r->origin, &center, &d);
+  graphene_vec3_init (&origin,
+                      graphene_vec3_dot (&d, &axes[0]),
+                      graphene_vec3_dot (&d, &axes[1]),
+                      graphene_vec3_dot (&d, &axes[2]));
+  graphene_vec3_init (&direction,
+                      graphene_vec3_dot (&r->direction, &axes[0]),
+                      graphene_vec3_dot (&r->direction, &axes[1]),
+                      graphene_vec3_dot (&r->direction, &axes[2]));
+  graphene_ray_init_from_vec3 (&local, &origin, &direction);
+
+  graphene_point3d_init (&max,
+                         graphene_vec3_get_x (&half_extents),
+                         graphene_vec3_get_y (&half_extents),
+                         graphene_vec3_get_z (&half_extents));
+  graphene_point3d_init (&min, -max.x, -max.y, -max.z);
+  graphene_box_init (&box, &min, &max);
+
+  return graphene_ray_intersect_box (&local, &box, t_out);
+}
+
+/**
+ * graphene_ray_intersects_obb:
+ * @r: a #graphene_ray_t
+ * @obb: a #graphene_obb_t
+ *
+ * Checks whether the given #graphene_ray_t @r intersects the
+ * given #graphene_obb_t @obb.
+ *
+ * See also: graphene_ray_intersect_obb()
+ *
+ * Returns: `true` if the ray intersects the box
+ *
+ * Since: 1.12
+ */
+bool
+graphene_ray_intersects_obb (const graphene_ray_t *r,
+                             const graphene_obb_t *obb)
+{
+  return graphene_ray_intersect_obb (r, obb, NULL) != GRAPHENE_RAY_INTERSECTION_KIND_NONE;
+}
+
+typedef struct {
+  const graphene_ray_t *r;
+  const graphene_box_t *boxes;
+  float *t_out;
+  uint32_t *hits;
+} ray_boxes_batch_t;
+
+static unsigned int
+ray_intersect_boxes_range (unsigned int  first,
+                           unsigned int  n_items,
+                           void         *data)
+{
+  const ray_boxes_batch_t *batch = data;
+
+  return graphene_get_kernels ()->ray_intersect_boxes (batch->r, n_items,
+                                                       batch->boxes + first,
+                                                       batch->t_out != NULL ? batch->t_out + first : NULL,
+                                                       batch->hits + first / 32);
+}
+
+/**
+ * graphene_ray_intersect_boxes:
+ * @r: a #graphene_ray_t
+ * @n_boxes: the number of boxes in the @boxes array
+ * @boxes: (array length=n_boxes): an array of #graphene_box_t
+ * @t_out: (out caller-allocates) (array length=n_boxes) (optional): return
+ *   location for the distance of the intersection point along the ray
+ *   for each box
+ * @hits: (out caller-allocates): return location for a bitmask with
+ *   at least `(n_boxes + 31) / 32` elements
+ *
+ * Intersects the given #graphene_ray_t @r with each box in the
+ * @boxes array, like graphene_ray_intersect_box().
+ *
+ * The boxes are tested eight at a time, using #graphene_simd8f_t.
+ *
+ * The result for the box at index `i` is stored in the `i % 32` bit
+ * of the `i / 32` element of the @hits array; the bit is set if the
+ * ray intersects the box. If the ray does not intersect a box, the
+ * corresponding distance is set to 0.
+ *
+ * Returns: the number of boxes intersected by the ray
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_ray_intersect_boxes (const graphene_ray_t *r,
+                              unsigned int          n_boxes,
+                              const graphene_box_t *boxes,
+                              float                *t_out,
+                              uint32_t             *hits)
+{
+  ray_boxes_batch_t batch = { r, boxes, t_out, hits };
+
+  return graphene_parallel_count (n_boxes, graphene_parallel_chunk_size (sizeof (graphene_box_t)),
+                                  ray_intersect_boxes_range,
+                                  &batch);
+}
+
 /**
  * graphene_ray_intersect_triangle:
  * @r: a #graphene_ray_t
@@ -710,3 +851,717 @@ graphene_ray_intersects_triangle (const graphene_ray_t      *r,
 {
   return graphene_ray_intersect_triangle (r, t, NULL) != GRAPHENE_RAY_INTERSECTION_KIND_NONE;
 }
+
+/**
+ * graphene_ray_packet_alloc: (constructor)
+ *
+ * Allocates a new #graphene_ray_packet_t structure.
+ *
+ * The contents of the returned structure are undefined.
+ *
+ * Returns: (transfer full): the newly allocated #graphene_ray_packet_t.
+ *   Use graphene_ray_packet_free() to free the resources allocated by
+ *   this function
+ *
+ * Since: 1.12
+ */
+graphene_ray_packet_t *
+graphene_ray_packet_alloc (void)
+{
+  return graphene_aligned_alloc (sizeof (graphene_ray_packet_t), 1, 16);
+}
+
+/**
+ * graphene_ray_packet_free:
+ * @p: a #graphene_ray_packet_t
+ *
+ * Frees the resources allocated by graphene_ray_packet_alloc().
+ *
+ * Since: 1.12
+ */
+void
+graphene_ray_packet_free (graphene_ray_packet_t *p)
+{
+  graphene_aligned_free (p);
+}
+
+/* Transposes four rays, starting at @first, into the components of
+ * @origins and @directions; unused lanes replicate the last ray, and are
+ * masked out of the results
+ */
+static inline void
+ray_packet_transpose (unsigned int          n_rays,
+                      const graphene_ray_t *rays,
+                      unsigned int          first,
+                      graphene_simd4x4f_t  *origins,
+                      graphene_simd4x4f_t  *directions)
+{
+  graphene_simd4f_t o[4], d[4];
+
+  for (unsigned int i = 0; i < 4; i++)
+    {
+      const graphene_ray_t *r = &rays[MIN (first + i, n_rays - 1)];
+
+      o[i] = r->origin.value;
+      d[i] = r->direction.value;
+    }
+
+  *origins = graphene_simd4x4f_init (o[0], o[1], o[2], o[3]);
+  *directions = graphene_simd4x4f_init (d[0], d[1], d[2], d[3]);
+  graphene_simd4x4f_transpose_in_place (origins);
+  graphene_simd4x4f_transpose_in_place (directions);
+}
+
+/**
+ * graphene_ray_packet_init:
+ * @p: the #graphene_ray_packet_t to initialize
+ * @n_rays: the number of rays, between 1 and %GRAPHENE_RAY_PACKET_SIZE
+ * @rays: (array length=n_rays): the rays of the packet
+ *
+ * Initializes a #graphene_ray_packet_t using the given rays.
+ *
+ * The origins and directions of the rays are stored so that each
+ * component of all rays can be processed at the same time, along
+ * with the reciprocal of the directions.
+ *
+ * Returns: (transfer none): the initialized ray packet
+ *
+ * Since: 1.12
+ */
+graphene_ray_packet_t *
+graphene_ray_packet_init (graphene_ray_packet_t *p,
+                          unsigned int           n_rays,
+                          const graphene_ray_t  *rays)
+{
+  graphene_simd4x4f_t origins, directions;
+
+  n_rays = CLAMP (n_rays, 1, GRAPHENE_RAY_PACKET_SIZE);
+
+  ray_packet_transpose (n_rays, rays, 0, &origins, &directions);
+
+  p->origin_x = origins.x;
+  p->origin_y = origins.y;
+  p->origin_z = origins.z;
+  p->direction_x = directions.x;
+  p->direction_y = directions.y;
+  p->direction_z = directions.z;
+  p->inv_direction_x = graphene_simd4f_reciprocal (directions.x);
+  p->inv_direction_y = graphene_simd4f_reciprocal (directions.y);
+  p->inv_direction_z = graphene_simd4f_reciprocal (directions.z);
+  p->n_rays = n_rays;
+
+  return p;
+}
+
+/**
+ * graphene_ray_packet_get_n_rays:
+ * @p: a #graphene_ray_packet_t
+ *
+ * Retrieves the number of rays in the packet.
+ *
+ * Returns: the number of rays
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_ray_packet_get_n_rays (const graphene_ray_packet_t *p)
+{
+  return p->n_rays;
+}
+
+static inline graphene_simd4f_t
+soa_dot3 (graphene_simd4f_t ax,
+          graphene_simd4f_t ay,
+          graphene_simd4f_t az,
+          graphene_simd4f_t bx,
+          graphene_simd4f_t by,
+          graphene_simd4f_t bz)
+{
+  return graphene_simd4f_add (graphene_simd4f_add (graphene_simd4f_mul (ax, bx),
+                                                   graphene_simd4f_mul (ay, by)),
+                              graphene_simd4f_mul (az, bz));
+}
+
+static inline void
+soa_cross3 (graphene_simd4f_t  ax,
+            graphene_simd4f_t  ay,
+            graphene_simd4f_t  az,
+            graphene_simd4f_t  bx,
+            graphene_simd4f_t  by,
+            graphene_simd4f_t  bz,
+            graphene_simd4f_t *rx,
+            graphene_simd4f_t *ry,
+            graphene_simd4f_t *rz)
+{
+  *rx = graphene_simd4f_sub (graphene_simd4f_mul (ay, bz), graphene_simd4f_mul (az, by));
+  *ry = graphene_simd4f_sub (graphene_simd4f_mul (az, bx), graphene_simd4f_mul (ax, bz));
+  *rz = graphene_simd4f_sub (graphene_simd4f_mul (ax, by), graphene_simd4f_mul (ay, bx));
+}
+
+/* The per-lane results of the packet intersections; the comparisons are
+ * done on the extracted lanes, as there are no lane-wise comparison
+ * operations for every SIMD backend
+ */
+static unsigned int
+ray_packet_sphere_hits (unsigned int  n_rays,
+                        const float  *tca,
+                        const float  *d2,
+                        const float  *thc,
+                        float         radius2,
+                        float        *t_out)
+{
+  unsigned int res = 0;
+
+  for (unsigned int i = 0; i < n_rays; i++)
+    {
+      float t0 = tca[i] - thc[i];
+      float t1 = tca[i] + thc[i];
+
+      if (t_out != NULL)
+        t_out[i] = 0.f;
+
+      if (d2[i] > radius2 || t1 < 0.f)
+        continue;
+
+      if (t_out != NULL)
+        t_out[i] = t0 < 0.f ? t1 : t0;
+
+      res |= 1u << i;
+    }
+
+  return res;
+}
+
+static unsigned int
+ray_packet_box_hits (unsigned int  n_rays,
+                     const float  *t_min,
+                     const float  *t_max,
+                     float        *t_out)
+{
+  unsigned int res = 0;
+
+  for (unsigned int i = 0; i < n_rays; i++)
+    {
+      if (t_out != NULL)
+        t_out[i] = 0.f;
+
+      if (t_min[i] > t_max[i] || t_max[i] < 0.f)
+        continue;
+
+      /* return the point closest to the ray (positive side) */
+      if (t_out != NULL)
+        t_out[i] = t_min[i] >= 0.f ? t_min[i] : t_max[i];
+
+      res |= 1u << i;
+    }
+
+  return res;
+}
+
+static unsigned int
+ray_packet_triangle_hits (unsigned int  n_rays,
+                          const float  *DdN,
+                          const float  *DdQxE2,
+                          const float  *DdE1xQ,
+                          const float  *QdN,
+                          float        *t_out)
+{
+  unsigned int res = 0;
+
+  for (unsigned int i = 0; i < n_rays; i++)
+    {
+      float sign = DdN[i] > 0.f ? 1.f : -1.f;
+      float abs_DdN = fabsf (DdN[i]);
+      float b1 = sign * DdQxE2[i];
+      float b2 = sign * DdE1xQ[i];
+      float t_n = -sign * QdN[i];
+
+      if (t_out != NULL)
+        t_out[i] = 0.f;
+
+      /* Ray and triangle are parallel, call it a "no intersection"
+       * even if the ray does intersect
+       */
+      if (graphene_approx_val (DdN[i], 0.f))
+        continue;
+
+      if (b1 < 0.f || b2 < 0.f || b1 + b2 > abs_DdN || t_n < 0.f)
+        continue;
+
+      if (t_out != NULL)
+        t_out[i] = t_n / abs_DdN;
+
+      res |= 1u << i;
+    }
+
+  return res;
+}
+
+/**
+ * graphene_ray_packet_intersect_sphere:
+ * @p: a #graphene_ray_packet_t
+ * @s: a #graphene_sphere_t
+ * @t_out: (out caller-allocates) (array fixed-size=4) (optional): return
+ *   location for the distance of the intersection point along each ray
+ *
+ * Intersects all the rays of the packet with the given #graphene_sphere_t,
+ * like graphene_ray_intersect_sphere().
+ *
+ * If a ray does not intersect the sphere, its distance is set to 0.
+ *
+ * Returns: a bitmask with the bit `i` set if the ray `i` intersects
+ *   the sphere
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_ray_packet_intersect_sphere (const graphene_ray_packet_t *p,
+                                      const graphene_sphere_t     *s,
+                                      float                       *t_out)
+{
+  graphene_simd4f_t v1x, v1y, v1z, tca, d2, thc;
+  float tca_v[4], d2_v[4], thc_v[4];
+  float radius2 = s->radius * s->radius;
+
+  /* Vector from each origin to the center of the sphere */
+  v1x = graphene_simd4f_sub (graphene_simd4f_splat_x (s->center.value), p->origin_x);
+  v1y = graphene_simd4f_sub (graphene_simd4f_splat_y (s->center.value), p->origin_y);
+  v1z = graphene_simd4f_sub (graphene_simd4f_splat_z (s->center.value), p->origin_z);
+
+  /* (signed) distance along each ray to the point nearest the center */
+  tca = soa_dot3 (v1x, v1y, v1z, p->direction_x, p->direction_y, p->direction_z);
+
+  /* square of the distance from each ray line to the center */
+  d2 = graphene_simd4f_sub (soa_dot3 (v1x, v1y, v1z, v1x, v1y, v1z),
+                            graphene_simd4f_mul (tca, tca));
+
+  /* distance to the entry/exit points, clamped for missing rays */
+  thc = graphene_simd4f_sqrt (graphene_simd4f_max (graphene_simd4f_sub (graphene_simd4f_splat (radius2), d2),
+                                                   graphene_simd4f_init_zero ()));
+
+  graphene_simd4f_dup_4f (tca, tca_v);
+  graphene_simd4f_dup_4f (d2, d2_v);
+  graphene_simd4f_dup_4f (thc, thc_v);
+
+  return ray_packet_sphere_hits (p->n_rays, tca_v, d2_v, thc_v, radius2, t_out);
+}
+
+/**
+ * graphene_ray_packet_intersect_box:
+ * @p: a #graphene_ray_packet_t
+ * @b: a #graphene_box_t
+ * @t_out: (out caller-allocates) (array fixed-size=4) (optional): return
+ *   location for the distance of the intersection point along each ray
+ *
+ * Intersects all the rays of the packet with the given #graphene_box_t,
+ * like graphene_ray_intersect_box().
+ *
+ * If a ray does not intersect the box, its distance is set to 0.
+ *
+ * Returns: a bitmask with the bit `i` set if the ray `i` intersects
+ *   the box
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_ray_packet_intersect_box (const graphene_ray_packet_t *p,
+                                   const graphene_box_t        *b,
+                                   float                       *t_out)
+{
+  graphene_simd4f_t t0, t1, t_near, t_far, t_min, t_max;
+  float t_min_v[4], t_max_v[4];
+
+  /* Slab test: the distances at which each ray crosses the planes of
+   * the box on each axis, ordered using min/max instead of branching
+   * on the sign of the direction
+   */
+  t0 = graphene_simd4f_mul (graphene_simd4f_sub (graphene_simd4f_splat_x (b->min.value), p->origin_x),
+                            p->inv_direction_x);
+  t1 = graphene_simd4f_mul (graphene_simd4f_sub (graphene_simd4f_splat_x (b->max.value), p->origin_x),
+                            p->inv_direction_x);
+  t_min = graphene_simd4f_min (t0, t1);
+  t_max = graphene_simd4f_max (t0, t1);
+
+  t0 = graphene_simd4f_mul (graphene_simd4f_sub (graphene_simd4f_splat_y (b->min.value), p->origin_y),
+                            p->inv_direction_y);
+  t1 = graphene_simd4f_mul (graphene_simd4f_sub (graphene_simd4f_splat_y (b->max.value), p->origin_y),
+                            p->inv_direction_y);
+  t_near = graphene_simd4f_min (t0, t1);
+  t_far = graphene_simd4f_max (t0, t1);
+  t_min = graphene_simd4f_max (t_min, t_near);
+  t_max = graphene_simd4f_min (t_max, t_far);
+
+  t0 = graphene_simd4f_mul (graphene_simd4f_sub (graphene_simd4f_splat_z (b->min.value), p->origin_z),
+                            p->inv_direction_z);
+  t1 = graphene_simd4f_mul (graphene_simd4f_sub (graphene_simd4f_splat_z (b->max.value), p->origin_z),
+                            p->inv_direction_z);
+  t_near = graphene_simd4f_min (t0, t1);
+  t_far = graphene_simd4f_max (t0, t1);
+  t_min = graphene_simd4f_max (t_min, t_near);
+  t_max = graphene_simd4f_min (t_max, t_far);
+
+  graphene_simd4f_dup_4f (t_min, t_min_v);
+  graphene_simd4f_dup_4f (t_max, t_max_v);
+
+  return ray_packet_box_hits (p->n_rays, t_min_v, t_max_v, t_out);
+}
+
+/**
+ * graphene_ray_packet_intersect_triangle:
+ * @p: a #graphene_ray_packet_t
+ * @t: a #graphene_triangle_t
+ * @t_out: (out caller-allocates) (array fixed-size=4) (optional): return
+ *   location for the distance of the intersection point along each ray
+ *
+ * Intersects all the rays of the packet with the given #graphene_triangle_t,
+ * like graphene_ray_intersect_triangle().
+ *
+ * If a ray does not intersect the triangle, its distance is set to 0.
+ *
+ * Returns: a bitmask with the bit `i` set if the ray `i` intersects
+ *   the triangle
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_ray_packet_intersect_triangle (const graphene_ray_packet_t *p,
+                                        const graphene_triangle_t   *t,
+                                        float                       *t_out)
+{
+  graphene_simd4f_t edge1, edge2, normal;
+  graphene_simd4f_t e1x, e1y, e1z, e2x, e2y, e2z;
+  graphene_simd4f_t qx, qy, qz, cx, cy, cz;
+  graphene_simd4f_t DdN, DdQxE2, DdE1xQ, QdN;
+  float DdN_v[4], DdQxE2_v[4], DdE1xQ_v[4], QdN_v[4];
+
+  /* See graphene_ray_intersect_triangle() for the derivation */
+  edge1 = graphene_simd4f_sub (t->b.value, t->a.value);
+  edge2 = graphene_simd4f_sub (t->c.value, t->a.value);
+  normal = graphene_simd4f_cross3 (edge1, edge2);
+
+  e1x = graphene_simd4f_splat_x (edge1);
+  e1y = graphene_simd4f_splat_y (edge1);
+  e1z = graphene_simd4f_splat_z (edge1);
+  e2x = graphene_simd4f_splat_x (edge2);
+  e2y = graphene_simd4f_splat_y (edge2);
+  e2z = graphene_simd4f_splat_z (edge2);
+
+  DdN = soa_dot3 (p->direction_x, p->direction_y, p->direction_z,
+                  graphene_simd4f_splat_x (normal),
+                  graphene_simd4f_splat_y (normal),
+                  graphene_simd4f_splat_z (normal));
+
+  qx = graphene_simd4f_sub (p->origin_x, graphene_simd4f_splat_x (t->a.value));
+  qy = graphene_simd4f_sub (p->origin_y, graphene_simd4f_splat_y (t->a.value));
+  qz = graphene_simd4f_sub (p->origin_z, graphene_simd4f_splat_z (t->a.value));
+
+  soa_cross3 (qx, qy, qz, e2x, e2y, e2z, &cx, &cy, &cz);
+  DdQxE2 = soa_dot3 (p->direction_x, p->direction_y, p->direction_z, cx, cy, cz);
+
+  soa_cross3 (e1x, e1y, e1z, qx, qy, qz, &cx, &cy, &cz);
+  DdE1xQ = soa_dot3 (p->direction_x, p->direction_y, p->direction_z, cx, cy, cz);
+
+  QdN = soa_dot3 (qx, qy, qz,
+                  graphene_simd4f_splat_x (normal),
+                  graphene_simd4f_splat_y (normal),
+                  graphene_simd4f_splat_z (normal));
+
+  graphene_simd4f_dup_4f (DdN, DdN_v);
+  graphene_simd4f_dup_4f (DdQxE2, DdQxE2_v);
+  graphene_simd4f_dup_4f (DdE1xQ, DdE1xQ_v);
+  graphene_simd4f_dup_4f (QdN, QdN_v);
+
+  return ray_packet_triangle_hits (p->n_rays, DdN_v, DdQxE2_v, DdE1xQ_v, QdN_v, t_out);
+}
+
+/**
+ * graphene_ray_packet8_alloc: (constructor)
+ *
+ * Allocates a new #graphene_ray_packet8_t structure.
+ *
+ * The contents of the returned structure are undefined.
+ *
+ * Returns: (transfer full): the newly allocated #graphene_ray_packet8_t.
+ *   Use graphene_ray_packet8_free() to free the resources allocated by
+ *   this function
+ *
+ * Since: 1.12
+ */
+graphene_ray_packet8_t *
+graphene_ray_packet8_alloc (void)
+{
+  return graphene_aligned_alloc (sizeof (graphene_ray_packet8_t), 1, 16);
+}
+
+/**
+ * graphene_ray_packet8_free:
+ * @p: a #graphene_ray_packet8_t
+ *
+ * Frees the resources allocated by graphene_ray_packet8_alloc().
+ *
+ * Since: 1.12
+ */
+void
+graphene_ray_packet8_free (graphene_ray_packet8_t *p)
+{
+  graphene_aligned_free (p);
+}
+
+/**
+ * graphene_ray_packet8_init:
+ * @p: the #graphene_ray_packet8_t to initialize
+ * @n_rays: the number of rays, between 1 and %GRAPHENE_RAY_PACKET8_SIZE
+ * @rays: (array length=n_rays): the rays of the packet
+ *
+ * Initializes a #graphene_ray_packet8_t using the given rays, like
+ * graphene_ray_packet_init().
+ *
+ * Returns: (transfer none): the initialized ray packet
+ *
+ * Since: 1.12
+ */
+graphene_ray_packet8_t *
+graphene_ray_packet8_init (graphene_ray_packet8_t *p,
+                           unsigned int            n_rays,
+                           const graphene_ray_t   *rays)
+{
+  n_rays = CLAMP (n_rays, 1, GRAPHENE_RAY_PACKET8_SIZE);
+
+  for (unsigned int i = 0; i < 2; i++)
+    {
+      graphene_simd4x4f_t origins, directions;
+
+      ray_packet_transpose (n_rays, rays, i * 4, &origins, &directions);
+
+      p->origin_x[i] = origins.x;
+      p->origin_y[i] = origins.y;
+      p->origin_z[i] = origins.z;
+      p->direction_x[i] = directions.x;
+      p->direction_y[i] = directions.y;
+      p->direction_z[i] = directions.z;
+      p->inv_direction_x[i] = graphene_simd4f_reciprocal (directions.x);
+      p->inv_direction_y[i] = graphene_simd4f_reciprocal (directions.y);
+      p->inv_direction_z[i] = graphene_simd4f_reciprocal (directions.z);
+    }
+
+  p->n_rays = n_rays;
+
+  return p;
+}
+
+/**
+ * graphene_ray_packet8_get_n_rays:
+ * @p: a #graphene_ray_packet8_t
+ *
+ * Retrieves the number of rays in the packet.
+ *
+ * Returns: the number of rays
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_ray_packet8_get_n_rays (const graphene_ray_packet8_t *p)
+{
+  return p->n_rays;
+}
+
+static inline graphene_simd8f_t
+packet8_load (const graphene_simd4f_t v[2])
+{
+  return graphene_simd8f_init_simd4f (v[0], v[1]);
+}
+
+static inline graphene_simd8f_t
+soa8_dot3 (graphene_simd8f_t ax,
+           graphene_simd8f_t ay,
+           graphene_simd8f_t az,
+           graphene_simd8f_t bx,
+           graphene_simd8f_t by,
+           graphene_simd8f_t bz)
+{
+  return graphene_simd8f_add (graphene_simd8f_add (graphene_simd8f_mul (ax, bx),
+                                                   graphene_simd8f_mul (ay, by)),
+                              graphene_simd8f_mul (az, bz));
+}
+
+static inline void
+soa8_cross3 (graphene_simd8f_t  ax,
+             graphene_simd8f_t  ay,
+             graphene_simd8f_t  az,
+             graphene_simd8f_t  bx,
+             graphene_simd8f_t  by,
+             graphene_simd8f_t  bz,
+             graphene_simd8f_t *rx,
+             graphene_simd8f_t *ry,
+             graphene_simd8f_t *rz)
+{
+  *rx = graphene_simd8f_sub (graphene_simd8f_mul (ay, bz), graphene_simd8f_mul (az, by));
+  *ry = graphene_simd8f_sub (graphene_simd8f_mul (az, bx), graphene_simd8f_mul (ax, bz));
+  *rz = graphene_simd8f_sub (graphene_simd8f_mul (ax, by), graphene_simd8f_mul (ay, bx));
+}
+
+/**
+ * graphene_ray_packet8_intersect_sphere:
+ * @p: a #graphene_ray_packet8_t
+ * @s: a #graphene_sphere_t
+ * @t_out: (out caller-allocates) (array fixed-size=8) (optional): return
+ *   location for the distance of the intersection point along each ray
+ *
+ * Intersects all the rays of the packet with the given #graphene_sphere_t,
+ * like graphene_ray_packet_intersect_sphere().
+ *
+ * Returns: a bitmask with the bit `i` set if the ray `i` intersects
+ *   the sphere
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_ray_packet8_intersect_sphere (const graphene_ray_packet8_t *p,
+                                       const graphene_sphere_t      *s,
+                                       float                        *t_out)
+{
+  graphene_simd8f_t v1x, v1y, v1z, tca, d2, thc;
+  float tca_v[8], d2_v[8], thc_v[8];
+  float radius2 = s->radius * s->radius;
+
+  v1x = graphene_simd8f_sub (graphene_simd8f_splat (graphene_simd4f_get_x (s->center.value)),
+                             packet8_load (p->origin_x));
+  v1y = graphene_simd8f_sub (graphene_simd8f_splat (graphene_simd4f_get_y (s->center.value)),
+                             packet8_load (p->origin_y));
+  v1z = graphene_simd8f_sub (graphene_simd8f_splat (graphene_simd4f_get_z (s->center.value)),
+                             packet8_load (p->origin_z));
+
+  tca = soa8_dot3 (v1x, v1y, v1z,
+                   packet8_load (p->direction_x),
+                   packet8_load (p->direction_y),
+                   packet8_load (p->direction_z));
+  d2 = graphene_simd8f_sub (soa8_dot3 (v1x, v1y, v1z, v1x, v1y, v1z),
+                            graphene_simd8f_mul (tca, tca));
+  thc = graphene_simd8f_sqrt (graphene_simd8f_max (graphene_simd8f_sub (graphene_simd8f_splat (radius2), d2),
+                                                   graphene_simd8f_init_zero ()));
+
+  graphene_simd8f_dup_8f (tca, tca_v);
+  graphene_simd8f_dup_8f (d2, d2_v);
+  graphene_simd8f_dup_8f (thc, thc_v);
+
+  return ray_packet_sphere_hits (p->n_rays, tca_v, d2_v, thc_v, radius2, t_out);
+}
+
+/**
+ * graphene_ray_packet8_intersect_box:
+ * @p: a #graphene_ray_packet8_t
+ * @b: a #graphene_box_t
+ * @t_out: (out caller-allocates) (array fixed-size=8) (optional): return
+ *   location for the distance of the intersection point along each ray
+ *
+ * Intersects all the rays of the packet with the given #graphene_box_t,
+ * like graphene_ray_packet_intersect_box().
+ *
+ * Returns: a bitmask with the bit `i` set if the ray `i` intersects
+ *   the box
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_ray_packet8_intersect_box (const graphene_ray_packet8_t *p,
+                                    const graphene_box_t         *b,
+                                    float                        *t_out)
+{
+  const graphene_simd4f_t *origins[3] = { p->origin_x, p->origin_y, p->origin_z };
+  const graphene_simd4f_t *inv_directions[3] = { p->inv_direction_x, p->inv_direction_y, p->inv_direction_z };
+  float b_min[3], b_max[3];
+  graphene_simd8f_t t_min, t_max;
+  float t_min_v[8], t_max_v[8];
+
+  graphene_simd4f_dup_3f (b->min.value, b_min);
+  graphene_simd4f_dup_3f (b->max.value, b_max);
+
+  /* Slab test, see graphene_ray_packet_intersect_box() */
+  for (unsigned int i = 0; i < 3; i++)
+    {
+      graphene_simd8f_t origin = packet8_load (origins[i]);
+      graphene_simd8f_t inv_direction = packet8_load (inv_directions[i]);
+      graphene_simd8f_t t0, t1, t_near, t_far;
+
+      t0 = graphene_simd8f_mul (graphene_simd8f_sub (graphene_simd8f_splat (b_min[i]), origin), inv_direction);
+      t1 = graphene_simd8f_mul (graphene_simd8f_sub (graphene_simd8f_splat (b_max[i]), origin), inv_direction);
+      t_near = graphene_simd8f_min (t0, t1);
+      t_far = graphene_simd8f_max (t0, t1);
+
+      t_min = i == 0 ? t_near : graphene_simd8f_max (t_min, t_near);
+      t_max = i == 0 ? t_far : graphene_simd8f_min (t_max, t_far);
+    }
+
+  graphene_simd8f_dup_8f (t_min, t_min_v);
+  graphene_simd8f_dup_8f (t_max, t_max_v);
+
+  return ray_packet_box_hits (p->n_rays, t_min_v, t_max_v, t_out);
+}
+
+/**
+ * graphene_ray_packet8_intersect_triangle:
+ * @p: a #graphene_ray_packet8_t
+ * @t: a #graphene_triangle_t
+ * @t_out: (out caller-allocates) (array fixed-size=8) (optional): return
+ *   location for the distance of the intersection point along each ray
+ *
+ * Intersects all the rays of the packet with the given #graphene_triangle_t,
+ * like graphene_ray_packet_intersect_triangle().
+ *
+ * Returns: a bitmask with the bit `i` set if the ray `i` intersects
+ *   the triangle
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_ray_packet8_intersect_triangle (const graphene_ray_packet8_t *p,
+                                         const graphene_triangle_t    *t,
+                                         float                        *t_out)
+{
+  graphene_simd4f_t edge1, edge2, normal;
+  graphene_simd8f_t dx, dy, dz, nx, ny, nz;
+  graphene_simd8f_t e1x, e1y, e1z, e2x, e2y, e2z;
+  graphene_simd8f_t qx, qy, qz, cx, cy, cz;
+  graphene_simd8f_t DdN, DdQxE2, DdE1xQ, QdN;
+  float DdN_v[8], DdQxE2_v[8], DdE1xQ_v[8], QdN_v[8];
+
+  /* See graphene_ray_intersect_triangle() for the derivation */
+  edge1 = graphene_simd4f_sub (t->b.value, t->a.value);
+  edge2 = graphene_simd4f_sub (t->c.value, t->a.value);
+  normal = graphene_simd4f_cross3 (edge1, edge2);
+
+  e1x = graphene_simd8f_splat (graphene_simd4f_get_x (edge1));
+  e1y = graphene_simd8f_splat (graphene_simd4f_get_y (edge1));
+  e1z = graphene_simd8f_splat (graphene_simd4f_get_z (edge1));
+  e2x = graphene_simd8f_splat (graphene_simd4f_get_x (edge2));
+  e2y = graphene_simd8f_splat (graphene_simd4f_get_y (edge2));
+  e2z = graphene_simd8f_splat (graphene_simd4f_get_z (edge2));
+  nx = graphene_simd8f_splat (graphene_simd4f_get_x (normal));
+  ny = graphene_simd8f_splat (graphene_simd4f_get_y (normal));
+  nz = graphene_simd8f_splat (graphene_simd4f_get_z (normal));
+
+  dx = packet8_load (p->direction_x);
+  dy = packet8_load (p->direction_y);
+  dz = packet8_load (p->direction_z);
+
+  DdN = soa8_dot3 (dx, dy, dz, nx, ny, nz);
+
+  qx = graphene_simd8f_sub (packet8_load (p->origin_x), graphene_simd8f_splat (graphene_simd4f_get_x (t->a.value)));
+  qy = graphene_simd8f_sub (packet8_load (p->origin_y), graphene_simd8f_splat (graphene_simd4f_get_y (t->a.value)));
+  qz = graphene_simd8f_sub (packet8_load (p->origin_z), graphene_simd8f_splat (graphene_simd4f_get_z (t->a.value)));
+
+  soa8_cross3 (qx, qy, qz, e2x, e2y, e2z, &cx, &cy, &cz);
+  DdQxE2 = soa8_dot3 (dx, dy, dz, cx, cy, cz);
+
+  soa8_cross3 (e1x, e1y, e1z, qx, qy, qz, &cx, &cy, &cz);
+  DdE1xQ = soa8_dot3 (dx, dy, dz, cx, cy, cz);
+
+  QdN = soa8_dot3 (qx, qy, qz, nx, ny, nz);
+
+  graphene_simd8f_dup_8f (DdN, DdN_v);
+  graphene_simd8f_dup_8f (DdQxE2, DdQxE2_v);
+  graphene_simd8f_dup_8f (DdE1xQ, DdE1xQ_v);
+  graphene_simd8f_dup_8f (QdN, QdN_v);
+
+  return ray_packet_triangle_hits (p->n_rays, DdN_v, DdQxE2_v, DdE1xQ_v, QdN_v, t_out);
+}
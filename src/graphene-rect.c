@@ -39,6 +39,7 @@
  */
 
 #include "graphene-private.h"
+#include "graphene-alloc-private.h"
 
 #include "graphene-rect.h"
 
@@ -84,7 +85,7 @@ graphene_rect_normalize_in_place (graphene_rect_t *r)
 graphene_rect_t *
 graphene_rect_alloc (void)
 {
-  return calloc (1, sizeof (graphene_rect_t));
+  return graphene_aligned_alloc0 (sizeof (graphene_rect_t), 1, 16);
 }
 
 /**
@@ -98,7 +99,7 @@ graphene_rect_alloc (void)
 void
 graphene_rect_free (graphene_rect_t *r)
 {
-  free (r);
+  graphene_aligned_free (r);
 }
 
 /**
@@ -33,6 +33,7 @@
  */
 
 #include "graphene-private.h"
+#include "graphene-alloc-private.h"
 #include "graphene-size.h"
 
 #include <math.h>
@@ -51,7 +52,7 @@
 graphene_size_t *
 graphene_size_alloc (void)
 {
-  return calloc (1, sizeof (graphene_size_t));
+  return graphene_aligned_alloc0 (sizeof (graphene_size_t), 1, 16);
 }
 
 /**
@@ -65,7 +66,7 @@ graphene_size_alloc (void)
 void
 graphene_size_free (graphene_size_t *s)
 {
-  free (s);
+  graphene_aligned_free (s);
 }
 
 /**
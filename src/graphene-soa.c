@@ -0,0 +1,1358 @@
+/* graphene-soa.c: Structure of arrays vectors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-soa
+ * @Title: Vector arrays
+ * @Short_Description: Arrays of vectors in a "structure of arrays" layout
+ *
+ * #graphene_vec3_soa_t and #graphene_vec4_soa_t store arrays of vectors
+ * with each component in a separate, aligned array of floats: all the x
+ * components, followed by all the y components, and so on. This layout
+ * lets each SIMD register hold the same component of eight vectors, so
+ * operations over large arrays of vectors, like the positions of the
+ * particles of a simulation, or the vertices of a mesh, do not waste any
+ * lane, and do not need a call per vector.
+ *
+ * The components can be read and written directly, using the pointers
+ * returned by functions like graphene_vec3_soa_get_x(); arrays of
+ * #graphene_vec3_t and #graphene_vec4_t can be converted from and to
+ * this layout.
+ *
+ * #graphene_matrix_soa_t stores arrays of matrices in the same layout,
+ * with each of the sixteen elements of the matrices in a separate array,
+ * so that operations like graphene_matrix_soa_multiply() and
+ * graphene_matrix_soa_inverse() process eight matrices at a time, without
+ * any shuffling between the lanes.
+ *
+ * The operations on multiple arrays, like graphene_vec3_soa_add(),
+ * operate on as many elements as the smallest of the arrays holds; the
+ * result array can be the same as one of the operands.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-soa.h"
+
+#include "graphene-alloc-private.h"
+#include "graphene-kernels-private.h"
+#include "graphene-matrix.h"
+#include "graphene-vec3.h"
+#include "graphene-vec4.h"
+
+#include <string.h>
+
+/* Each component is padded to a multiple of this many floats, and
+ * aligned to the size of an AVX register
+ */
+#define SOA_ALIGNMENT           32
+#define SOA_PADDING             (SOA_ALIGNMENT / sizeof (float))
+
+struct _graphene_vec3_soa_t
+{
+  float *components[3];
+  unsigned int n_elements;
+};
+
+struct _graphene_vec4_soa_t
+{
+  float *components[4];
+  unsigned int n_elements;
+};
+
+#define SOA_COMPONENTS(soa)     ((const float * const *) (soa)->components)
+
+static void
+soa_init (unsigned int   n_components,
+          unsigned int   n_elements,
+          float        **components)
+{
+  size_t stride = ((size_t) n_elements + SOA_PADDING - 1) & ~(SOA_PADDING - 1);
+  float *data = graphene_aligned_alloc0 (sizeof (float) * stride, n_components, SOA_ALIGNMENT);
+
+  for (unsigned int c = 0; c < n_components; c++)
+    components[c] = data != NULL ? data + c * stride : NULL;
+}
+
+static void
+soa_add (unsigned int         n_components,
+         unsigned int         n,
+         const float * const *a,
+         const float * const *b,
+         float * const       *res)
+{
+  const graphene_kernels_t *kernels = graphene_get_kernels ();
+
+  for (unsigned int c = 0; c < n_components; c++)
+    kernels->soa_add (n, a[c], b[c], res[c]);
+}
+
+static void
+soa_subtract (unsigned int         n_components,
+              unsigned int         n,
+              const float * const *a,
+              const float * const *b,
+              float * const       *res)
+{
+  const graphene_kernels_t *kernels = graphene_get_kernels ();
+
+  for (unsigned int c = 0; c < n_components; c++)
+    kernels->soa_subtract (n, a[c], b[c], res[c]);
+}
+
+static void
+soa_scale (unsigned int         n_components,
+           unsigned int         n,
+           const float * const *a,
+           float                factor,
+           float * const       *res)
+{
+  const graphene_kernels_t *kernels = graphene_get_kernels ();
+
+  for (unsigned int c = 0; c < n_components; c++)
+    kernels->soa_scale (n, a[c], factor, res[c]);
+}
+
+static void
+soa_lerp (unsigned int         n_components,
+          unsigned int         n,
+          const float * const *a,
+          const float * const *b,
+          float                factor,
+          float * const       *res)
+{
+  const graphene_kernels_t *kernels = graphene_get_kernels ();
+
+  for (unsigned int c = 0; c < n_components; c++)
+    kernels->soa_lerp (n, a[c], b[c], factor, res[c]);
+}
+
+/* The minimum and maximum of each component; zero for empty arrays */
+static void
+soa_min_max (unsigned int         n_components,
+             unsigned int         n,
+             const float * const *a,
+             float               *min,
+             float               *max)
+{
+  const graphene_kernels_t *kernels = graphene_get_kernels ();
+
+  for (unsigned int c = 0; c < n_components; c++)
+    {
+      if (n == 0)
+        min[c] = max[c] = 0.f;
+      else
+        kernels->soa_min_max (n, a[c], &min[c], &max[c]);
+    }
+}
+
+/**
+ * graphene_vec3_soa_new:
+ * @n_elements: the number of vectors
+ *
+ * Creates a new #graphene_vec3_soa_t holding @n_elements vectors, all
+ * initialized to zero.
+ *
+ * Returns: (transfer full): the newly created #graphene_vec3_soa_t. Use
+ *   graphene_vec3_soa_free() to free the resources allocated by this
+ *   function
+ *
+ * Since: 1.12
+ */
+graphene_vec3_soa_t *
+graphene_vec3_soa_new (unsigned int n_elements)
+{
+  graphene_vec3_soa_t *res = graphene_aligned_alloc0 (sizeof (graphene_vec3_soa_t), 1, 16);
+
+  res->n_elements = n_elements;
+  soa_init (3, n_elements, res->components);
+
+  return res;
+}
+
+/**
+ * graphene_vec3_soa_free:
+ * @soa: a #graphene_vec3_soa_t
+ *
+ * Frees the resources allocated by graphene_vec3_soa_new().
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_free (graphene_vec3_soa_t *soa)
+{
+  if (soa == NULL)
+    return;
+
+  graphene_aligned_free (soa->components[0]);
+  graphene_aligned_free (soa);
+}
+
+/**
+ * graphene_vec3_soa_get_size:
+ * @soa: a #graphene_vec3_soa_t
+ *
+ * Retrieves the number of vectors of @soa.
+ *
+ * Returns: the number of vectors
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_vec3_soa_get_size (const graphene_vec3_soa_t *soa)
+{
+  return soa->n_elements;
+}
+
+/**
+ * graphene_vec3_soa_get_x:
+ * @soa: a #graphene_vec3_soa_t
+ *
+ * Retrieves the array of the X components of the vectors of @soa.
+ *
+ * The array is aligned to 32 bytes, and it can be modified.
+ *
+ * Returns: (transfer none): the X components
+ *
+ * Since: 1.12
+ */
+float *
+graphene_vec3_soa_get_x (graphene_vec3_soa_t *soa)
+{
+  return soa->components[0];
+}
+
+/**
+ * graphene_vec3_soa_get_y:
+ * @soa: a #graphene_vec3_soa_t
+ *
+ * Retrieves the array of the Y components of the vectors of @soa.
+ *
+ * The array is aligned to 32 bytes, and it can be modified.
+ *
+ * Returns: (transfer none): the Y components
+ *
+ * Since: 1.12
+ */
+float *
+graphene_vec3_soa_get_y (graphene_vec3_soa_t *soa)
+{
+  return soa->components[1];
+}
+
+/**
+ * graphene_vec3_soa_get_z:
+ * @soa: a #graphene_vec3_soa_t
+ *
+ * Retrieves the array of the Z components of the vectors of @soa.
+ *
+ * The array is aligned to 32 bytes, and it can be modified.
+ *
+ * Returns: (transfer none): the Z components
+ *
+ * Since: 1.12
+ */
+float *
+graphene_vec3_soa_get_z (graphene_vec3_soa_t *soa)
+{
+  return soa->components[2];
+}
+
+/**
+ * graphene_vec3_soa_get:
+ * @soa: a #graphene_vec3_soa_t
+ * @index_: the index of the vector
+ * @res: (out caller-allocates): return location for the vector
+ *
+ * Retrieves the vector at @index_ in @soa.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_get (const graphene_vec3_soa_t *soa,
+                       unsigned int               index_,
+                       graphene_vec3_t           *res)
+{
+  if (index_ >= soa->n_elements)
+    return;
+
+  graphene_vec3_init (res,
+                      soa->components[0][index_],
+                      soa->components[1][index_],
+                      soa->components[2][index_]);
+}
+
+/**
+ * graphene_vec3_soa_set:
+ * @soa: a #graphene_vec3_soa_t
+ * @index_: the index of the vector
+ * @v: the vector
+ *
+ * Sets the vector at @index_ in @soa.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_set (graphene_vec3_soa_t   *soa,
+                       unsigned int           index_,
+                       const graphene_vec3_t *v)
+{
+  if (index_ >= soa->n_elements)
+    return;
+
+  soa->components[0][index_] = graphene_vec3_get_x (v);
+  soa->components[1][index_] = graphene_vec3_get_y (v);
+  soa->components[2][index_] = graphene_vec3_get_z (v);
+}
+
+/**
+ * graphene_vec3_soa_init_from_vec3:
+ * @soa: a #graphene_vec3_soa_t
+ * @vectors: (array): an array of #graphene_vec3_t, with as many vectors
+ *   as @soa
+ *
+ * Copies the @vectors into @soa.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_init_from_vec3 (graphene_vec3_soa_t   *soa,
+                                  const graphene_vec3_t *vectors)
+{
+  if (soa->n_elements == 0)
+    return;
+
+  graphene_get_kernels ()->soa_from_simd4f (soa->n_elements, 3,
+                                            &vectors[0].value,
+                                            soa->components);
+}
+
+/**
+ * graphene_vec3_soa_to_vec3:
+ * @soa: a #graphene_vec3_soa_t
+ * @vectors: (array) (out caller-allocates): return location for an
+ *   array of #graphene_vec3_t, with as many vectors as @soa
+ *
+ * Copies the vectors of @soa into @vectors.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_to_vec3 (const graphene_vec3_soa_t *soa,
+                           graphene_vec3_t           *vectors)
+{
+  const float *x = soa->components[0];
+  const float *y = soa->components[1];
+  const float *z = soa->components[2];
+
+  for (unsigned int i = 0; i < soa->n_elements; i++)
+    vectors[i].value = graphene_simd4f_init (x[i], y[i], z[i], 0.f);
+}
+
+/**
+ * graphene_vec3_soa_add:
+ * @a: a #graphene_vec3_soa_t
+ * @b: a #graphene_vec3_soa_t
+ * @res: return location for the results
+ *
+ * Adds each vector of @b to the corresponding vector of @a.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_add (const graphene_vec3_soa_t *a,
+                       const graphene_vec3_soa_t *b,
+                       graphene_vec3_soa_t       *res)
+{
+  unsigned int n = MIN (MIN (a->n_elements, b->n_elements), res->n_elements);
+
+  soa_add (3, n, SOA_COMPONENTS (a), SOA_COMPONENTS (b), res->components);
+}
+
+/**
+ * graphene_vec3_soa_subtract:
+ * @a: a #graphene_vec3_soa_t
+ * @b: a #graphene_vec3_soa_t
+ * @res: return location for the results
+ *
+ * Subtracts each vector of @b from the corresponding vector of @a.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_subtract (const graphene_vec3_soa_t *a,
+                            const graphene_vec3_soa_t *b,
+                            graphene_vec3_soa_t       *res)
+{
+  unsigned int n = MIN (MIN (a->n_elements, b->n_elements), res->n_elements);
+
+  soa_subtract (3, n, SOA_COMPONENTS (a), SOA_COMPONENTS (b), res->components);
+}
+
+/**
+ * graphene_vec3_soa_scale:
+ * @a: a #graphene_vec3_soa_t
+ * @factor: the scale factor
+ * @res: return location for the results
+ *
+ * Multiplies each vector of @a by @factor.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_scale (const graphene_vec3_soa_t *a,
+                         float                      factor,
+                         graphene_vec3_soa_t       *res)
+{
+  unsigned int n = MIN (a->n_elements, res->n_elements);
+
+  soa_scale (3, n, SOA_COMPONENTS (a), factor, res->components);
+}
+
+/**
+ * graphene_vec3_soa_lerp:
+ * @a: a #graphene_vec3_soa_t
+ * @b: a #graphene_vec3_soa_t
+ * @factor: the interpolation factor
+ * @res: return location for the results
+ *
+ * Linearly interpolates each vector of @a and the corresponding vector
+ * of @b, like graphene_vec3_interpolate().
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_lerp (const graphene_vec3_soa_t *a,
+                        const graphene_vec3_soa_t *b,
+                        float                      factor,
+                        graphene_vec3_soa_t       *res)
+{
+  unsigned int n = MIN (MIN (a->n_elements, b->n_elements), res->n_elements);
+
+  soa_lerp (3, n, SOA_COMPONENTS (a), SOA_COMPONENTS (b), factor, res->components);
+}
+
+/**
+ * graphene_vec3_soa_dot:
+ * @a: a #graphene_vec3_soa_t
+ * @b: a #graphene_vec3_soa_t
+ * @res: (array): return location for an array of floats, with as many
+ *   elements as the smallest of @a and @b
+ *
+ * Computes the dot product of each vector of @a and the corresponding
+ * vector of @b.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_dot (const graphene_vec3_soa_t *a,
+                       const graphene_vec3_soa_t *b,
+                       float                     *res)
+{
+  unsigned int n = MIN (a->n_elements, b->n_elements);
+
+  graphene_get_kernels ()->soa_dot (n, 3, SOA_COMPONENTS (a), SOA_COMPONENTS (b), res);
+}
+
+/**
+ * graphene_vec3_soa_cross:
+ * @a: a #graphene_vec3_soa_t
+ * @b: a #graphene_vec3_soa_t
+ * @res: return location for the results
+ *
+ * Computes the cross product of each vector of @a and the corresponding
+ * vector of @b.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_cross (const graphene_vec3_soa_t *a,
+                         const graphene_vec3_soa_t *b,
+                         graphene_vec3_soa_t       *res)
+{
+  unsigned int n = MIN (MIN (a->n_elements, b->n_elements), res->n_elements);
+
+  graphene_get_kernels ()->soa_cross (n, SOA_COMPONENTS (a), SOA_COMPONENTS (b), res->components);
+}
+
+/**
+ * graphene_vec3_soa_length:
+ * @a: a #graphene_vec3_soa_t
+ * @res: (array): return location for an array of floats, with as many
+ *   elements as @a
+ *
+ * Computes the length of each vector of @a.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_length (const graphene_vec3_soa_t *a,
+                          float                     *res)
+{
+  graphene_get_kernels ()->soa_length (a->n_elements, 3, SOA_COMPONENTS (a), res);
+}
+
+/**
+ * graphene_vec3_soa_normalize:
+ * @a: a #graphene_vec3_soa_t
+ * @res: return location for the results
+ *
+ * Normalizes each vector of @a, like graphene_vec3_normalize().
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_normalize (const graphene_vec3_soa_t *a,
+                             graphene_vec3_soa_t       *res)
+{
+  unsigned int n = MIN (a->n_elements, res->n_elements);
+
+  graphene_get_kernels ()->soa_normalize (n, 3, SOA_COMPONENTS (a), res->components);
+}
+
+/**
+ * graphene_vec3_soa_get_min:
+ * @a: a #graphene_vec3_soa_t
+ * @res: (out caller-allocates): return location for the minimum
+ *
+ * Computes the minimum of each component over all the vectors of @a.
+ *
+ * If @a is empty, @res is set to zero.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_get_min (const graphene_vec3_soa_t *a,
+                           graphene_vec3_t           *res)
+{
+  float min[3], max[3];
+
+  soa_min_max (3, a->n_elements, SOA_COMPONENTS (a), min, max);
+  graphene_vec3_init_from_float (res, min);
+}
+
+/**
+ * graphene_vec3_soa_get_max:
+ * @a: a #graphene_vec3_soa_t
+ * @res: (out caller-allocates): return location for the maximum
+ *
+ * Computes the maximum of each component over all the vectors of @a.
+ *
+ * If @a is empty, @res is set to zero.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_get_max (const graphene_vec3_soa_t *a,
+                           graphene_vec3_t           *res)
+{
+  float min[3], max[3];
+
+  soa_min_max (3, a->n_elements, SOA_COMPONENTS (a), min, max);
+  graphene_vec3_init_from_float (res, max);
+}
+
+/**
+ * graphene_vec3_soa_transform:
+ * @a: a #graphene_vec3_soa_t
+ * @m: a #graphene_matrix_t
+ * @res: return location for the results
+ *
+ * Transforms each vector of @a using @m, like
+ * graphene_matrix_transform_vec3(); the translation of @m is ignored.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_transform (const graphene_vec3_soa_t *a,
+                             const graphene_matrix_t   *m,
+                             graphene_vec3_soa_t       *res)
+{
+  unsigned int n = MIN (a->n_elements, res->n_elements);
+
+  graphene_get_kernels ()->soa_transform (&m->value, n, 3, SOA_COMPONENTS (a), 0.f, res->components);
+}
+
+/**
+ * graphene_vec3_soa_transform_points:
+ * @a: a #graphene_vec3_soa_t
+ * @m: a #graphene_matrix_t
+ * @res: return location for the results
+ *
+ * Transforms each vector of @a as a point using @m, like
+ * graphene_matrix_transform_point3d().
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec3_soa_transform_points (const graphene_vec3_soa_t *a,
+                                    const graphene_matrix_t   *m,
+                                    graphene_vec3_soa_t       *res)
+{
+  unsigned int n = MIN (a->n_elements, res->n_elements);
+
+  graphene_get_kernels ()->soa_transform (&m->value, n, 3, SOA_COMPONENTS (a), 1.f, res->components);
+}
+
+/**
+ * graphene_vec4_soa_new:
+ * @n_elements: the number of vectors
+ *
+ * Creates a new #graphene_vec4_soa_t holding @n_elements vectors, all
+ * initialized to zero.
+ *
+ * Returns: (transfer full): the newly created #graphene_vec4_soa_t. Use
+ *   graphene_vec4_soa_free() to free the resources allocated by this
+ *   function
+ *
+ * Since: 1.12
+ */
+graphene_vec4_soa_t *
+graphene_vec4_soa_new (unsigned int n_elements)
+{
+  graphene_vec4_soa_t *res = graphene_aligned_alloc0 (sizeof (graphene_vec4_soa_t), 1, 16);
+
+  res->n_elements = n_elements;
+  soa_init (4, n_elements, res->components);
+
+  return res;
+}
+
+/**
+ * graphene_vec4_soa_free:
+ * @soa: a #graphene_vec4_soa_t
+ *
+ * Frees the resources allocated by graphene_vec4_soa_new().
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec4_soa_free (graphene_vec4_soa_t *soa)
+{
+  if (soa == NULL)
+    return;
+
+  graphene_aligned_free (soa->components[0]);
+  graphene_aligned_free (soa);
+}
+
+/**
+ * graphene_vec4_soa_get_size:
+ * @soa: a #graphene_vec4_soa_t
+ *
+ * Retrieves the number of vectors of @soa.
+ *
+ * Returns: the number of vectors
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_vec4_soa_get_size (const graphene_vec4_soa_t *soa)
+{
+  return soa->n_elements;
+}
+
+/**
+ * graphene_vec4_soa_get_x:
+ * @soa: a #graphene_vec4_soa_t
+ *
+ * Retrieves the array of the X components of the vectors of @soa.
+ *
+ * The array is aligned to 32 bytes, and it can be modified.
+ *
+ * Returns: (transfer none): the X components
+ *
+ * Since: 1.12
+ */
+float *
+graphene_vec4_soa_get_x (graphene_vec4_soa_t *soa)
+{
+  return soa->components[0];
+}
+
+/**
+ * graphene_vec4_soa_get_y:
+ * @soa: a #graphene_vec4_soa_t
+ *
+ * Retrieves the array of the Y components of the vectors of @soa.
+ *
+ * The array is aligned to 32 bytes, and it can be modified.
+ *
+ * Returns: (transfer none): the Y components
+ *
+ * Since: 1.12
+ */
+float *
+graphene_vec4_soa_get_y (graphene_vec4_soa_t *soa)
+{
+  return soa->components[1];
+}
+
+/**
+ * graphene_vec4_soa_get_z:
+ * @soa: a #graphene_vec4_soa_t
+ *
+ * Retrieves the array of the Z components of the vectors of @soa.
+ *
+ * The array is aligned to 32 bytes, and it can be modified.
+ *
+ * Returns: (transfer none): the Z components
+ *
+ * Since: 1.12
+ */
+float *
+graphene_vec4_soa_get_z (graphene_vec4_soa_t *soa)
+{
+  return soa->components[2];
+}
+
+/**
+ * graphene_vec4_soa_get_w:
+ * @soa: a #graphene_vec4_soa_t
+ *
+ * Retrieves the array of the W components of the vectors of @soa.
+ *
+ * The array is aligned to 32 bytes, and it can be modified.
+ *
+ * Returns: (transfer none): the W components
+ *
+ * Since: 1.12
+ */
+float *
+graphene_vec4_soa_get_w (graphene_vec4_soa_t *soa)
+{
+  return soa->components[3];
+}
+
+/**
+ * graphene_vec4_soa_get:
+ * @soa: a #graphene_vec4_soa_t
+ * @index_: the index of the vector
+ * @res: (out caller-allocates): return location for the vector
+ *
+ * Retrieves the vector at @index_ in @soa.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec4_soa_get (const graphene_vec4_soa_t *soa,
+                       unsigned int               index_,
+                       graphene_vec4_t           *res)
+{
+  if (index_ >= soa->n_elements)
+    return;
+
+  graphene_vec4_init (res,
+                      soa->components[0][index_],
+                      soa->components[1][index_],
+                      soa->components[2][index_],
+                      soa->components[3][index_]);
+}
+
+/**
+ * graphene_vec4_soa_set:
+ * @soa: a #graphene_vec4_soa_t
+ * @index_: the index of the vector
+ * @v: the vector
+ *
+ * Sets the vector at @index_ in @soa.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec4_soa_set (graphene_vec4_soa_t   *soa,
+                       unsigned int           index_,
+                       const graphene_vec4_t *v)
+{
+  if (index_ >= soa->n_elements)
+    return;
+
+  soa->components[0][index_] = graphene_vec4_get_x (v);
+  soa->components[1][index_] = graphene_vec4_get_y (v);
+  soa->components[2][index_] = graphene_vec4_get_z (v);
+  soa->components[3][index_] = graphene_vec4_get_w (v);
+}
+
+/**
+ * graphene_vec4_soa_init_from_vec4:
+ * @soa: a #graphene_vec4_soa_t
+ * @vectors: (array): an array of #graphene_vec4_t, with as many vectors
+ *   as @soa
+ *
+ * Copies the @vectors into @soa.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec4_soa_init_from_vec4 (graphene_vec4_soa_t   *soa,
+                                  const graphene_vec4_t *vectors)
+{
+  if (soa->n_elements == 0)
+    return;
+
+  graphene_get_kernels ()->soa_from_simd4f (soa->n_elements, 4,
+                                            &vectors[0].value,
+                                            soa->components);
+}
+
+/**
+ * graphene_vec4_soa_to_vec4:
+ * @soa: a #graphene_vec4_soa_t
+ * @vectors: (array) (out caller-allocates): return location for an
+ *   array of #graphene_vec4_t, with as many vectors as @soa
+ *
+ * Copies the vectors of @soa into @vectors.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec4_soa_to_vec4 (const graphene_vec4_soa_t *soa,
+                           graphene_vec4_t           *vectors)
+{
+  const float *x = soa->components[0];
+  const float *y = soa->components[1];
+  const float *z = soa->components[2];
+  const float *w = soa->components[3];
+
+  for (unsigned int i = 0; i < soa->n_elements; i++)
+    vectors[i].value = graphene_simd4f_init (x[i], y[i], z[i], w[i]);
+}
+
+/**
+ * graphene_vec4_soa_add:
+ * @a: a #graphene_vec4_soa_t
+ * @b: a #graphene_vec4_soa_t
+ * @res: return location for the results
+ *
+ * Adds each vector of @b to the corresponding vector of @a.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec4_soa_add (const graphene_vec4_soa_t *a,
+                       const graphene_vec4_soa_t *b,
+                       graphene_vec4_soa_t       *res)
+{
+  unsigned int n = MIN (MIN (a->n_elements, b->n_elements), res->n_elements);
+
+  soa_add (4, n, SOA_COMPONENTS (a), SOA_COMPONENTS (b), res->components);
+}
+
+/**
+ * graphene_vec4_soa_subtract:
+ * @a: a #graphene_vec4_soa_t
+ * @b: a #graphene_vec4_soa_t
+ * @res: return location for the results
+ *
+ * Subtracts each vector of @b from the corresponding vector of @a.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec4_soa_subtract (const graphene_vec4_soa_t *a,
+                            const graphene_vec4_soa_t *b,
+                            graphene_vec4_soa_t       *res)
+{
+  unsigned int n = MIN (MIN (a->n_elements, b->n_elements), res->n_elements);
+
+  soa_subtract (4, n, SOA_COMPONENTS (a), SOA_COMPONENTS (b), res->components);
+}
+
+/**
+ * graphene_vec4_soa_scale:
+ * @a: a #graphene_vec4_soa_t
+ * @factor: the scale factor
+ * @res: return location for the results
+ *
+ * Multiplies each vector of @a by @factor.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec4_soa_scale (const graphene_vec4_soa_t *a,
+                         float                      factor,
+                         graphene_vec4_soa_t       *res)
+{
+  unsigned int n = MIN (a->n_elements, res->n_elements);
+
+  soa_scale (4, n, SOA_COMPONENTS (a), factor, res->components);
+}
+
+/**
+ * graphene_vec4_soa_lerp:
+ * @a: a #graphene_vec4_soa_t
+ * @b: a #graphene_vec4_soa_t
+ * @factor: the interpolation factor
+ * @res: return location for the results
+ *
+ * Linearly interpolates each vector of @a and the corresponding vector
+ * of @b, like graphene_vec4_interpolate().
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec4_soa_lerp (const graphene_vec4_soa_t *a,
+                        const graphene_vec4_soa_t *b,
+                        float                      factor,
+                        graphene_vec4_soa_t       *res)
+{
+  unsigned int n = MIN (MIN (a->n_elements, b->n_elements), res->n_elements);
+
+  soa_lerp (4, n, SOA_COMPONENTS (a), SOA_COMPONENTS (b), factor, res->components);
+}
+
+/**
+ * graphene_vec4_soa_dot:
+ * @a: a #graphene_vec4_soa_t
+ * @b: a #graphene_vec4_soa_t
+ * @res: (array): return location for an array of floats, with as many
+ *   elements as the smallest of @a and @b
+ *
+ * Computes the dot product of each vector of @a and the corresponding
+ * vector of @b.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec4_soa_dot (const graphene_vec4_soa_t *a,
+                       const graphene_vec4_soa_t *b,
+                       float                     *res)
+{
+  unsigned int n = MIN (a->n_elements, b->n_elements);
+
+  graphene_get_kernels ()->soa_dot (n, 4, SOA_COMPONENTS (a), SOA_COMPONENTS (b), res);
+}
+
+/**
+ * graphene_vec4_soa_length:
+ * @a: a #graphene_vec4_soa_t
+ * @res: (array): return location for an array of floats, with as many
+ *   elements as @a
+ *
+ * Computes the length of each vector of @a.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec4_soa_length (const graphene_vec4_soa_t *a,
+                          float                     *res)
+{
+  graphene_get_kernels ()->soa_length (a->n_elements, 4, SOA_COMPONENTS (a), res);
+}
+
+/**
+ * graphene_vec4_soa_normalize:
+ * @a: a #graphene_vec4_soa_t
+ * @res: return location for the results
+ *
+ * Normalizes each vector of @a, like graphene_vec4_normalize().
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec4_soa_normalize (const graphene_vec4_soa_t *a,
+                             graphene_vec4_soa_t       *res)
+{
+  unsigned int n = MIN (a->n_elements, res->n_elements);
+
+  graphene_get_kernels ()->soa_normalize (n, 4, SOA_COMPONENTS (a), res->components);
+}
+
+/**
+ * graphene_vec4_soa_get_min:
+ * @a: a #graphene_vec4_soa_t
+ * @res: (out caller-allocates): return location for the minimum
+ *
+ * Computes the minimum of each component over all the vectors of @a.
+ *
+ * If @a is empty, @res is set to zero.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec4_soa_get_min (const graphene_vec4_soa_t *a,
+                           graphene_vec4_t           *res)
+{
+  float min[4], max[4];
+
+  soa_min_max (4, a->n_elements, SOA_COMPONENTS (a), min, max);
+  graphene_vec4_init_from_float (res, min);
+}
+
+/**
+ * graphene_vec4_soa_get_max:
+ * @a: a #graphene_vec4_soa_t
+ * @res: (out caller-allocates): return location for the maximum
+ *
+ * Computes the maximum of each component over all the vectors of @a.
+ *
+ * If @a is empty, @res is set to zero.
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec4_soa_get_max (const graphene_vec4_soa_t *a,
+                           graphene_vec4_t           *res)
+{
+  float min[4], max[4];
+
+  soa_min_max (4, a->n_elements, SOA_COMPONENTS (a), min, max);
+  graphene_vec4_init_from_float (res, max);
+}
+
+/**
+ * graphene_vec4_soa_transform:
+ * @a: a #graphene_vec4_soa_t
+ * @m: a #graphene_matrix_t
+ * @res: return location for the results
+ *
+ * Transforms each vector of @a using @m, like
+ * graphene_matrix_transform_vec4().
+ *
+ * Since: 1.12
+ */
+void
+graphene_vec4_soa_transform (const graphene_vec4_soa_t *a,
+                             const graphene_matrix_t   *m,
+                             graphene_vec4_soa_t       *res)
+{
+  unsigned int n = MIN (a->n_elements, res->n_elements);
+
+  graphene_get_kernels ()->soa_transform (&m->value, n, 4, SOA_COMPONENTS (a), 0.f, res->components);
+}
+
+struct _graphene_matrix_soa_t
+{
+  /* The element in row r and column c of the matrices is stored in
+   * components[4 * r + c]
+   */
+  float *components[16];
+  unsigned int n_elements;
+};
+
+/**
+ * graphene_matrix_soa_new:
+ * @n_elements: the number of matrices
+ *
+ * Creates a new #graphene_matrix_soa_t holding @n_elements matrices, all
+ * initialized to zero.
+ *
+ * Returns: (transfer full): the newly created #graphene_matrix_soa_t. Use
+ *   graphene_matrix_soa_free() to free the resources allocated by this
+ *   function
+ *
+ * Since: 1.12
+ */
+graphene_matrix_soa_t *
+graphene_matrix_soa_new (unsigned int n_elements)
+{
+  graphene_matrix_soa_t *res = graphene_aligned_alloc0 (sizeof (graphene_matrix_soa_t), 1, 16);
+
+  res->n_elements = n_elements;
+  soa_init (16, n_elements, res->components);
+
+  return res;
+}
+
+/**
+ * graphene_matrix_soa_free:
+ * @soa: a #graphene_matrix_soa_t
+ *
+ * Frees the resources allocated by graphene_matrix_soa_new().
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_soa_free (graphene_matrix_soa_t *soa)
+{
+  if (soa == NULL)
+    return;
+
+  graphene_aligned_free (soa->components[0]);
+  graphene_aligned_free (soa);
+}
+
+/**
+ * graphene_matrix_soa_get_size:
+ * @soa: a #graphene_matrix_soa_t
+ *
+ * Retrieves the number of matrices of @soa.
+ *
+ * Returns: the number of matrices
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_matrix_soa_get_size (const graphene_matrix_soa_t *soa)
+{
+  return soa->n_elements;
+}
+
+/**
+ * graphene_matrix_soa_get_element:
+ * @soa: a #graphene_matrix_soa_t
+ * @row: the row of the element, between 0 and 3
+ * @col: the column of the element, between 0 and 3
+ *
+ * Retrieves the array of the elements in the given @row and @col of
+ * the matrices of @soa.
+ *
+ * The array is aligned to 32 bytes, and it can be modified.
+ *
+ * Returns: (transfer none) (nullable): the elements, or %NULL if @row
+ *   or @col are out of range
+ *
+ * Since: 1.12
+ */
+float *
+graphene_matrix_soa_get_element (graphene_matrix_soa_t *soa,
+                                 unsigned int           row,
+                                 unsigned int           col)
+{
+  if (row > 3 || col > 3)
+    return NULL;
+
+  return soa->components[4 * row + col];
+}
+
+/**
+ * graphene_matrix_soa_get:
+ * @soa: a #graphene_matrix_soa_t
+ * @index_: the index of the matrix
+ * @res: (out caller-allocates): return location for the matrix
+ *
+ * Retrieves the matrix at @index_ in @soa.
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_soa_get (const graphene_matrix_soa_t *soa,
+                         unsigned int                 index_,
+                         graphene_matrix_t           *res)
+{
+  float v[16];
+
+  if (index_ >= soa->n_elements)
+    return;
+
+  for (unsigned int e = 0; e < 16; e++)
+    v[e] = soa->components[e][index_];
+
+  graphene_matrix_init_from_float (res, v);
+}
+
+/**
+ * graphene_matrix_soa_set:
+ * @soa: a #graphene_matrix_soa_t
+ * @index_: the index of the matrix
+ * @m: the matrix
+ *
+ * Sets the matrix at @index_ in @soa.
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_soa_set (graphene_matrix_soa_t   *soa,
+                         unsigned int             index_,
+                         const graphene_matrix_t *m)
+{
+  float v[16];
+
+  if (index_ >= soa->n_elements)
+    return;
+
+  graphene_matrix_to_float (m, v);
+
+  for (unsigned int e = 0; e < 16; e++)
+    soa->components[e][index_] = v[e];
+}
+
+/**
+ * graphene_matrix_soa_init_from_matrices:
+ * @soa: a #graphene_matrix_soa_t
+ * @matrices: (array): an array of #graphene_matrix_t, with as many
+ *   matrices as @soa
+ *
+ * Copies the @matrices into @soa.
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_soa_init_from_matrices (graphene_matrix_soa_t   *soa,
+                                        const graphene_matrix_t *matrices)
+{
+  if (soa->n_elements == 0)
+    return;
+
+  graphene_get_kernels ()->soa_matrix_from_simd4x4f (soa->n_elements,
+                                                     &matrices[0].value,
+                                                     soa->components);
+}
+
+/**
+ * graphene_matrix_soa_to_matrices:
+ * @soa: a #graphene_matrix_soa_t
+ * @matrices: (array) (out caller-allocates): return location for an
+ *   array of #graphene_matrix_t, with as many matrices as @soa
+ *
+ * Copies the matrices of @soa into @matrices.
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_soa_to_matrices (const graphene_matrix_soa_t *soa,
+                                 graphene_matrix_t           *matrices)
+{
+  float * const *c = soa->components;
+
+  for (unsigned int i = 0; i < soa->n_elements; i++)
+    {
+      matrices[i].value =
+        graphene_simd4x4f_init (graphene_simd4f_init (c[0][i], c[1][i], c[2][i], c[3][i]),
+                                graphene_simd4f_init (c[4][i], c[5][i], c[6][i], c[7][i]),
+                                graphene_simd4f_init (c[8][i], c[9][i], c[10][i], c[11][i]),
+                                graphene_simd4f_init (c[12][i], c[13][i], c[14][i], c[15][i]));
+    }
+}
+
+/**
+ * graphene_matrix_soa_multiply:
+ * @a: a #graphene_matrix_soa_t
+ * @b: a #graphene_matrix_soa_t
+ * @res: return location for the results
+ *
+ * Multiplies each matrix of @a by the corresponding matrix of @b, like
+ * graphene_matrix_multiply().
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_soa_multiply (const graphene_matrix_soa_t *a,
+                              const graphene_matrix_soa_t *b,
+                              graphene_matrix_soa_t       *res)
+{
+  unsigned int n = MIN (MIN (a->n_elements, b->n_elements), res->n_elements);
+
+  graphene_get_kernels ()->soa_matrix_multiply (n, SOA_COMPONENTS (a), SOA_COMPONENTS (b), res->components);
+}
+
+/**
+ * graphene_matrix_soa_transpose:
+ * @a: a #graphene_matrix_soa_t
+ * @res: return location for the results
+ *
+ * Transposes each matrix of @a.
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_soa_transpose (const graphene_matrix_soa_t *a,
+                               graphene_matrix_soa_t       *res)
+{
+  unsigned int n = MIN (a->n_elements, res->n_elements);
+
+  /* In this layout transposing only swaps the element arrays; swapping
+   * each pair in turn also works when @res is @a
+   */
+  for (unsigned int r = 0; r < 4; r++)
+    {
+      memmove (res->components[5 * r], a->components[5 * r], sizeof (float) * n);
+
+      for (unsigned int c = r + 1; c < 4; c++)
+        {
+          float *a_rc = a->components[4 * r + c], *a_cr = a->components[4 * c + r];
+          float *res_rc = res->components[4 * r + c], *res_cr = res->components[4 * c + r];
+
+          for (unsigned int i = 0; i < n; i++)
+            {
+              float rc = a_rc[i], cr = a_cr[i];
+
+              res_rc[i] = cr;
+              res_cr[i] = rc;
+            }
+        }
+    }
+}
+
+/**
+ * graphene_matrix_soa_determinant:
+ * @a: a #graphene_matrix_soa_t
+ * @res: (array): return location for an array of floats, with as many
+ *   elements as @a
+ *
+ * Computes the determinant of each matrix of @a.
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_soa_determinant (const graphene_matrix_soa_t *a,
+                                 float                       *res)
+{
+  graphene_get_kernels ()->soa_matrix_determinant (a->n_elements, SOA_COMPONENTS (a), res);
+}
+
+/**
+ * graphene_matrix_soa_inverse:
+ * @a: a #graphene_matrix_soa_t
+ * @res: return location for the results
+ *
+ * Inverts each matrix of @a.
+ *
+ * Like graphene_matrix_inverse(), matrices that are not invertible are
+ * left unchanged; unlike it, they are copied into @res.
+ *
+ * Returns: the number of matrices that were inverted
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_matrix_soa_inverse (const graphene_matrix_soa_t *a,
+                             graphene_matrix_soa_t       *res)
+{
+  unsigned int n = MIN (a->n_elements, res->n_elements);
+
+  return graphene_get_kernels ()->soa_matrix_inverse (n, SOA_COMPONENTS (a), res->components);
+}
+
+/**
+ * graphene_matrix_soa_transform_points:
+ * @m: a #graphene_matrix_soa_t
+ * @points: a #graphene_vec3_soa_t
+ * @res: return location for the results
+ *
+ * Transforms each point of @points using the corresponding matrix of @m,
+ * like graphene_matrix_transform_point3d().
+ *
+ * Since: 1.12
+ */
+void
+graphene_matrix_soa_transform_points (const graphene_matrix_soa_t *m,
+                                      const graphene_vec3_soa_t   *points,
+                                      graphene_vec3_soa_t         *res)
+{
+  unsigned int n = MIN (MIN (m->n_elements, points->n_elements), res->n_elements);
+
+  graphene_get_kernels ()->soa_matrix_transform_points (n, SOA_COMPONENTS (m), SOA_COMPONENTS (points), res->components);
+}
@@ -38,10 +38,13 @@
 
 #include "graphene-alloc-private.h"
 #include "graphene-box.h"
+#include "graphene-kernels-private.h"
 #include "graphene-point3d.h"
 #include "graphene-simd4f.h"
+#include "graphene-strided-private.h"
 
 #include <math.h>
+#include <string.h>
 
 /**
  * graphene_sphere_alloc: (constructor)
@@ -211,6 +214,419 @@ graphene_sphere_init_from_vectors (graphene_sphere_t        *s,
   return s;
 }
 
+/**
+ * graphene_sphere_init_from_strided:
+ * @s: the #graphene_sphere_t to initialize
+ * @points: a #graphene_strided_view_t
+ * @center: (nullable): the center of the sphere
+ *
+ * Initializes the given #graphene_sphere_t using the points of
+ * a strided view, so that the sphere includes them.
+ *
+ * The center of the sphere can either be specified, or will be center
+ * of the 3D volume that encompasses all @points.
+ *
+ * See also: graphene_box_init_from_strided()
+ *
+ * Returns: (transfer none): the initialized #graphene_sphere_t
+ *
+ * Since: 1.12
+ */
+graphene_sphere_t *
+graphene_sphere_init_from_strided (graphene_sphere_t             *s,
+                                   const graphene_strided_view_t *points,
+                                   const graphene_point3d_t      *center)
+{
+  unsigned int n_points = graphene_strided_view_get_n_elements (points);
+  float max_radius_sq = 0.f;
+
+  if (center != NULL)
+    graphene_point3d_to_vec3 (center, &s->center);
+  else
+    {
+      graphene_box_t box;
+      graphene_point3d_t c;
+
+      graphene_box_init_from_strided (&box, points);
+      graphene_box_get_center (&box, &c);
+
+      graphene_point3d_to_vec3 (&c, &s->center);
+    }
+
+  for (unsigned int i = 0; i < n_points; i++)
+    {
+      const float *v = graphene_strided_view_get_element (points, i);
+      graphene_vec3_t p;
+
+      graphene_vec3_init (&p, v[0], v[1], points->n_components > 2 ? v[2] : 0.f);
+
+      max_radius_sq = fmaxf (max_radius_sq, distance_sq (&s->center, &p));
+    }
+
+  s->radius = sqrtf (max_radius_sq);
+
+  return s;
+}
+
+/* Grows @s to include @p, keeping the opposite side of the sphere fixed */
+static void
+sphere_grow (graphene_sphere_t        *s,
+             const graphene_point3d_t *p)
+{
+  graphene_vec3_t v, delta;
+  float d, radius;
+
+  graphene_point3d_to_vec3 (p, &v);
+  graphene_vec3_subtract (&v, &s->center, &delta);
+
+  d = graphene_vec3_length (&delta);
+  if (d <= s->radius)
+    return;
+
+  radius = (s->radius + d) * 0.5f;
+  graphene_vec3_scale (&delta, (radius - s->radius) / d, &delta);
+  graphene_vec3_add (&s->center, &delta, &s->center);
+  s->radius = radius;
+}
+
+/* Ritter's bounding sphere: starts from the sphere centered on the
+ * bounding box of the points, with the largest extent of the box as its
+ * diameter, and grows it to include every point left outside of it
+ */
+static void
+sphere_ritter (graphene_sphere_t        *s,
+               unsigned int              n_points,
+               const graphene_point3d_t *points)
+{
+  const graphene_kernels_t *kernels = graphene_get_kernels ();
+  graphene_box_t box;
+  graphene_point3d_t center;
+  float width, height, depth;
+  unsigned int i;
+
+  graphene_box_init_from_points (&box, n_points, points);
+  graphene_box_get_center (&box, &center);
+  width = graphene_box_get_width (&box);
+  height = graphene_box_get_height (&box);
+  depth = graphene_box_get_depth (&box);
+
+  graphene_point3d_to_vec3 (&center, &s->center);
+  s->radius = MAX (MAX (width, height), depth) * 0.5f;
+
+  i = kernels->sphere_find_outside (s, n_points, points);
+  while (i < n_points)
+    {
+      sphere_grow (s, &points[i]);
+
+      i += 1;
+      i += kernels->sphere_find_outside (s, n_points - i, points + i);
+    }
+}
+
+/* Solves the smallest sphere with all the @n_support points on its
+ * surface, in double precision; returns false for degenerate sets,
+ * like collinear or coplanar points
+ */
+static bool
+sphere_circumscribe (const graphene_point3d_t *support[],
+                     unsigned int              n_support,
+                     graphene_sphere_t        *s)
+{
+  double a[3], u[3][3], len_sq[3], c[3] = { 0., 0., 0. };
+
+  a[0] = support[0]->x;
+  a[1] = support[0]->y;
+  a[2] = support[0]->z;
+
+  for (unsigned int i = 1; i < n_support; i++)
+    {
+      u[i - 1][0] = support[i]->x - a[0];
+      u[i - 1][1] = support[i]->y - a[1];
+      u[i - 1][2] = support[i]->z - a[2];
+      len_sq[i - 1] = u[i - 1][0] * u[i - 1][0] +
+                      u[i - 1][1] * u[i - 1][1] +
+                      u[i - 1][2] * u[i - 1][2];
+    }
+
+#define CROSS(r,p,q) \
+  r[0] = p[1] * q[2] - p[2] * q[1]; \
+  r[1] = p[2] * q[0] - p[0] * q[2]; \
+  r[2] = p[0] * q[1] - p[1] * q[0]
+
+  if (n_support == 2)
+    {
+      for (unsigned int j = 0; j < 3; j++)
+        c[j] = u[0][j] * 0.5;
+    }
+  else if (n_support == 3)
+    {
+      double n[3], n_u0[3], u1_n[3], denom;
+
+      CROSS (n, u[0], u[1]);
+      denom = 2. * (n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+      if (denom <= 1e-12 * len_sq[0] * len_sq[1])
+        return false;
+
+      CROSS (n_u0, n, u[0]);
+      CROSS (u1_n, u[1], n);
+      for (unsigned int j = 0; j < 3; j++)
+        c[j] = (len_sq[1] * n_u0[j] + len_sq[0] * u1_n[j]) / denom;
+    }
+  else if (n_support == 4)
+    {
+      double u0_u1[3], u2_u0[3], u1_u2[3], denom;
+
+      CROSS (u0_u1, u[0], u[1]);
+      CROSS (u2_u0, u[2], u[0]);
+      CROSS (u1_u2, u[1], u[2]);
+      denom = 2. * (u[0][0] * u1_u2[0] + u[0][1] * u1_u2[1] + u[0][2] * u1_u2[2]);
+      if (fabs (denom) <= 1e-9 * sqrt (len_sq[0] * len_sq[1] * len_sq[2]))
+        return false;
+
+      for (unsigned int j = 0; j < 3; j++)
+        c[j] = (len_sq[2] * u0_u1[j] + len_sq[1] * u2_u0[j] + len_sq[0] * u1_u2[j]) / denom;
+    }
+
+#undef CROSS
+
+  graphene_vec3_init (&s->center, (float) (a[0] + c[0]), (float) (a[1] + c[1]), (float) (a[2] + c[2]));
+  s->radius = (float) sqrt (c[0] * c[0] + c[1] * c[1] + c[2] * c[2]);
+
+  return true;
+}
+
+static bool
+sphere_contains_support (const graphene_sphere_t  *s,
+                         const graphene_point3d_t *support[],
+                         unsigned int              n_support)
+{
+  float radius_sq = s->radius * s->radius * (1.f + 1e-4f);
+
+  for (unsigned int i = 0; i < n_support; i++)
+    {
+      graphene_vec3_t v;
+
+      graphene_point3d_to_vec3 (support[i], &v);
+      if (distance_sq (&s->center, &v) > radius_sq)
+        return false;
+    }
+
+  return true;
+}
+
+/* The smallest sphere with the @n_support points on its surface; for
+ * degenerate sets, the smallest sphere through a subset of the points
+ * that contains all of them
+ */
+static void
+sphere_from_support (const graphene_point3d_t *support[],
+                     unsigned int              n_support,
+                     graphene_sphere_t        *s)
+{
+  const graphene_point3d_t *subset[3];
+  graphene_sphere_t tmp;
+
+  if (n_support == 0)
+    {
+      graphene_vec3_init_from_vec3 (&s->center, graphene_vec3_zero ());
+      s->radius = 0.f;
+      return;
+    }
+
+  if (n_support == 1)
+    {
+      graphene_point3d_to_vec3 (support[0], &s->center);
+      s->radius = 0.f;
+      return;
+    }
+
+  if (sphere_circumscribe (support, n_support, s))
+    return;
+
+  s->radius = INFINITY;
+
+  /* Every pair, and every triple of a set of four */
+  for (unsigned int i = 0; i < n_support; i++)
+    {
+      for (unsigned int j = i + 1; j < n_support; j++)
+        {
+          subset[0] = support[i];
+          subset[1] = support[j];
+
+          if (sphere_circumscribe (subset, 2, &tmp) &&
+              tmp.radius < s->radius &&
+              sphere_contains_support (&tmp, support, n_support))
+            *s = tmp;
+
+          for (unsigned int k = j + 1; n_support == 4 && k < n_support; k++)
+            {
+              subset[2] = support[k];
+
+              if (sphere_circumscribe (subset, 3, &tmp) &&
+                  tmp.radius < s->radius &&
+                  sphere_contains_support (&tmp, support, n_support))
+                *s = tmp;
+            }
+        }
+    }
+
+  /* Rounding errors can make every subset fail the containment check;
+   * the sphere through the two most distant points is close enough
+   */
+  if (isinf (s->radius))
+    {
+      float max_d = -1.f;
+
+      for (unsigned int i = 0; i < n_support; i++)
+        {
+          for (unsigned int j = i + 1; j < n_support; j++)
+            {
+              subset[0] = support[i];
+              subset[1] = support[j];
+              sphere_circumscribe (subset, 2, &tmp);
+
+              if (tmp.radius > max_d)
+                {
+                  *s = tmp;
+                  max_d = tmp.radius;
+                }
+            }
+        }
+    }
+}
+
+/* The first point outside of @s, with some tolerance for the rounding
+ * errors of the points on its surface
+ */
+static unsigned int
+welzl_find_outside (const graphene_sphere_t  *s,
+                     unsigned int              n_points,
+                     const graphene_point3d_t *points)
+{
+  graphene_sphere_t check = *s;
+
+  check.radius = s->radius * (1.f + 1e-5f) + 1e-6f;
+
+  return graphene_get_kernels ()->sphere_find_outside (&check, n_points, points);
+}
+
+/* Welzl's algorithm, in its incremental form: the recursion only goes
+ * as deep as the four points that can define a sphere, and the running
+ * time is linear on average if the points are in random order
+ */
+static void
+sphere_welzl (graphene_sphere_t        *s,
+              unsigned int              n_points,
+              const graphene_point3d_t *points,
+              const graphene_point3d_t *support[],
+              unsigned int              n_support)
+{
+  unsigned int i;
+
+  sphere_from_support (support, n_support, s);
+  if (n_support == 4)
+    return;
+
+  /* Nothing is inside an empty set of support points */
+  i = n_support > 0 ? welzl_find_outside (s, n_points, points) : 0;
+  while (i < n_points)
+    {
+      support[n_support] = &points[i];
+      sphere_welzl (s, i, points, support, n_support + 1);
+
+      i += 1;
+      i += welzl_find_outside (s, n_points - i, points + i);
+    }
+}
+
+static void
+sphere_exact (graphene_sphere_t        *s,
+              unsigned int              n_points,
+              const graphene_point3d_t *points)
+{
+  const graphene_point3d_t *support[4];
+  graphene_point3d_t *shuffled;
+  unsigned int state = 1;
+
+  shuffled = graphene_aligned_alloc (sizeof (graphene_point3d_t), n_points, 16);
+  memcpy (shuffled, points, sizeof (graphene_point3d_t) * n_points);
+
+  for (unsigned int i = n_points - 1; i > 0; i--)
+    {
+      graphene_point3d_t tmp;
+      unsigned int j;
+
+      state = state * 1103515245u + 12345u;
+      j = (state >> 8) % (i + 1);
+
+      tmp = shuffled[i];
+      shuffled[i] = shuffled[j];
+      shuffled[j] = tmp;
+    }
+
+  sphere_welzl (s, n_points, shuffled, support, 0);
+
+  graphene_aligned_free (shuffled);
+}
+
+/**
+ * graphene_sphere_init_from_points_tight:
+ * @s: the #graphene_sphere_t to initialize
+ * @n_points: the number of #graphene_point3d_t in the @points array
+ * @points: (array length=n_points): an array of #graphene_point3d_t
+ * @fit: the algorithm used to fit the sphere around the points
+ *
+ * Initializes the given #graphene_sphere_t so that it includes the
+ * given array of 3D coordinates, and is as small as possible.
+ *
+ * Unlike graphene_sphere_init_from_points(), which centers the sphere
+ * on the bounding box of the points, the center of the sphere depends
+ * on the points themselves; the resulting spheres are often much
+ * smaller, which makes tests like graphene_frustum_intersects_sphere()
+ * reject more volumes.
+ *
+ * With %GRAPHENE_SPHERE_FIT_FAST, the sphere is computed with Ritter's
+ * algorithm, in two passes over the points, and it is usually no more
+ * than a few percent larger than the smallest sphere. With
+ * %GRAPHENE_SPHERE_FIT_EXACT, the sphere is the smallest enclosing
+ * sphere, computed with Welzl's algorithm; this takes more time, and
+ * requires a temporary copy of the points.
+ *
+ * If @n_points is 0, the sphere has a radius of 0 and is centered in
+ * the origin.
+ *
+ * Returns: (transfer none): the initialized #graphene_sphere_t
+ *
+ * Since: 1.12
+ */
+graphene_sphere_t *
+graphene_sphere_init_from_points_tight (graphene_sphere_t        *s,
+                                        unsigned int              n_points,
+                                        const graphene_point3d_t *points,
+                                        graphene_sphere_fit_t     fit)
+{
+  float max_radius_sq;
+
+  if (n_points == 0)
+    return graphene_sphere_init (s, NULL, 0.f);
+
+  if (fit == GRAPHENE_SPHERE_FIT_EXACT)
+    sphere_exact (s, n_points, points);
+  else
+    sphere_ritter (s, n_points, points);
+
+  /* Both algorithms leave the points on the surface of the sphere up
+   * to rounding errors, and the distances computed by the kernels can
+   * differ by a few ulps from the ones of graphene_sphere_contains_point(),
+   * so grow the radius by a few ulps to make sure all points are inside
+   */
+  max_radius_sq = graphene_get_kernels ()->points_max_distance_sq (&s->center, n_points, points);
+
+  s->radius = sqrtf (max_radius_sq) * (1.f + 4.f * FLT_EPSILON);
+
+  return s;
+}
+
 /**
  * graphene_sphere_get_center:
  * @s: a #graphene_sphere_t
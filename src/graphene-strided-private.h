@@ -0,0 +1,62 @@
+/* graphene-strided-private.h: Strided views over interleaved buffers
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "graphene-strided.h"
+
+GRAPHENE_BEGIN_DECLS
+
+/* Views with less than two components are empty */
+static inline unsigned int
+graphene_strided_view_get_n_elements (const graphene_strided_view_t *view)
+{
+  return view->n_components >= 2 ? view->n_elements : 0;
+}
+
+static inline float *
+graphene_strided_view_get_element (const graphene_strided_view_t *view,
+                                   unsigned int                   index_)
+{
+  return (float *) ((char *) view->data + (size_t) index_ * view->stride);
+}
+
+/* The view over @n_elements elements of @view, starting at @first */
+static inline graphene_strided_view_t
+graphene_strided_view_slice (const graphene_strided_view_t *view,
+                             unsigned int                   first,
+                             unsigned int                   n_elements)
+{
+  return GRAPHENE_STRIDED_VIEW_INIT (graphene_strided_view_get_element (view, first),
+                                     view->stride,
+                                     view->n_components,
+                                     n_elements);
+}
+
+/* Splitting views in chunks requires a non-zero item size */
+#define graphene_strided_view_item_size(view) \
+  MAX ((view)->stride, sizeof (float))
+
+GRAPHENE_END_DECLS
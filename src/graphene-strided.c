@@ -0,0 +1,87 @@
+/* graphene-strided.c: Strided views over interleaved buffers
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-strided
+ * @Title: Strided views
+ * @Short_Description: Views over interleaved buffers
+ *
+ * A #graphene_strided_view_t describes where the elements of a buffer
+ * are, without copying them: a pointer to the first element, the
+ * distance in bytes between two elements, and the number of floating
+ * point components of each element. For instance, the positions of an
+ * interleaved vertex buffer, with a position at offset 0 of each 32 bytes
+ * vertex, can be described by:
+ *
+ * |[<!-- language="C" -->
+ *   graphene_strided_view_t positions;
+ *
+ *   graphene_strided_view_init (&positions, mapped_buffer, 32, 3, n_vertices);
+ * ]|
+ *
+ * Strided views can be used to compute bounds with
+ * graphene_box_init_from_strided() and graphene_sphere_init_from_strided(),
+ * to transform elements in place with graphene_matrix_transform_strided(),
+ * and to cull elements with graphene_frustum_cull_strided(), directly on
+ * mapped buffers.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-strided.h"
+
+/**
+ * graphene_strided_view_init:
+ * @view: the #graphene_strided_view_t to initialize
+ * @data: a pointer to the first component of the first element
+ * @stride: the distance between the first components of two consecutive
+ *   elements, in bytes
+ * @n_components: the number of floating point components of each element,
+ *   between 2 and 4
+ * @n_elements: the number of elements
+ *
+ * Initializes a #graphene_strided_view_t.
+ *
+ * If @n_components is smaller than 2, the view is empty; if it is larger
+ * than 4, only the first 4 components of each element are used.
+ *
+ * Returns: (transfer none): the initialized #graphene_strided_view_t
+ *
+ * Since: 1.12
+ */
+graphene_strided_view_t *
+graphene_strided_view_init (graphene_strided_view_t *view,
+                            void                    *data,
+                            size_t                   stride,
+                            unsigned int             n_components,
+                            unsigned int             n_elements)
+{
+  view->data = data;
+  view->stride = stride;
+  view->n_components = MIN (n_components, 4);
+  view->n_elements = n_components >= 2 ? n_elements : 0;
+
+  return view;
+}
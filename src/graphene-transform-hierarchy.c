@@ -0,0 +1,595 @@
+/* graphene-transform-hierarchy.c: A flat hierarchy of transformations
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-transform-hierarchy
+ * @Title: Transform hierarchy
+ * @Short_Description: Compute the world transformations of a scene graph
+ *
+ * #graphene_transform_hierarchy_t stores the local transformations of
+ * the nodes of a tree, like a scene graph, in a flat array, and computes
+ * the world transformation of each node by composing its local
+ * transformation with the world transformation of its parent.
+ *
+ * The nodes are identified by their index; the parent of each node must
+ * have a smaller index than the node itself, so that the array is sorted
+ * with parents before their children.
+ *
+ * Changing the local transformation of a node marks it as dirty, and
+ * graphene_transform_hierarchy_update() only recomputes the world
+ * transformations of the dirty nodes and their descendants. Disjoint
+ * subtrees do not depend on each other, so if parallel execution is
+ * enabled with graphene_parallel_set_n_threads(), large updates are split
+ * into independent subtrees, and updated using multiple threads.
+ *
+ * The world transformations are stored contiguously, in node order, and
+ * can be retrieved with graphene_transform_hierarchy_get_world_matrices(),
+ * for instance to upload them to the GPU in one go.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-transform-hierarchy.h"
+
+#include "graphene-alloc-private.h"
+#include "graphene-kernels-private.h"
+#include "graphene-matrix.h"
+#include "graphene-parallel-private.h"
+
+/* Updates touching fewer nodes than this are not split, as the cost of
+ * scheduling the chunks would dominate
+ */
+#define HIERARCHY_PARALLEL_THRESHOLD    8192
+
+/* The number of nodes updated by each chunk of a parallel update */
+#define HIERARCHY_CHUNK_SIZE            2048
+
+struct _graphene_transform_hierarchy_t
+{
+  unsigned int n_nodes;
+
+  unsigned int *parents;
+
+  /* The nodes in depth-first order, so that the descendants of each node
+   * follow it; the subtree of a node covers subtree_size[node] entries,
+   * starting at pre_index[node]
+   */
+  unsigned int *pre_order;
+  unsigned int *pre_index;
+  unsigned int *subtree_size;
+
+  /* The nodes marked as dirty since the last update */
+  unsigned int *dirty_nodes;
+  unsigned int n_dirty;
+  uint8_t *dirty;
+
+  /* Scratch space for the roots of the subtrees to update */
+  unsigned int *subtrees;
+
+  graphene_matrix_t *local;
+  graphene_matrix_t *world;
+};
+
+typedef struct {
+  const graphene_transform_hierarchy_t *h;
+  const unsigned int *subtrees;
+
+  /* The first subtree of each chunk, followed by the end of the list */
+  const unsigned int *chunk_starts;
+} hierarchy_chunks_t;
+
+static inline void
+hierarchy_update_node (const graphene_transform_hierarchy_t *h,
+                       const graphene_kernels_t             *kernels,
+                       unsigned int                          node)
+{
+  unsigned int parent = h->parents[node];
+
+  if (parent == GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT)
+    h->world[node] = h->local[node];
+  else
+    kernels->matrix_multiply (&h->local[node].value,
+                              &h->world[parent].value,
+                              &h->world[node].value);
+}
+
+/* Updates whole subtrees; the world transformations of the parents of
+ * their roots must be up to date
+ */
+static void
+hierarchy_update_subtrees (const graphene_transform_hierarchy_t *h,
+                           const unsigned int                   *subtrees,
+                           unsigned int                          n_subtrees)
+{
+  const graphene_kernels_t *kernels = graphene_get_kernels ();
+
+  for (unsigned int i = 0; i < n_subtrees; i++)
+    {
+      unsigned int first = h->pre_index[subtrees[i]];
+      unsigned int last = first + h->subtree_size[subtrees[i]];
+
+      for (unsigned int j = first; j < last; j++)
+        hierarchy_update_node (h, kernels, h->pre_order[j]);
+    }
+}
+
+static void
+hierarchy_update_chunk (unsigned int  chunk,
+                        unsigned int  first,
+                        unsigned int  n_items,
+                        void         *data)
+{
+  const hierarchy_chunks_t *chunks = data;
+  unsigned int start = chunks->chunk_starts[chunk];
+
+  hierarchy_update_subtrees (chunks->h,
+                             chunks->subtrees + start,
+                             chunks->chunk_starts[chunk + 1] - start);
+}
+
+/* Splits the subtrees larger than @max_size, by updating their root and
+ * replacing them with the subtrees of their children; returns the new
+ * number of subtrees
+ */
+static unsigned int
+hierarchy_split_subtrees (const graphene_transform_hierarchy_t *h,
+                          unsigned int                         *subtrees,
+                          unsigned int                          n_subtrees,
+                          unsigned int                          max_size)
+{
+  const graphene_kernels_t *kernels = graphene_get_kernels ();
+  unsigned int n_res = 0;
+
+  /* Every node is appended at most once, so the list cannot overflow */
+  for (unsigned int i = 0; i < n_subtrees; i++)
+    {
+      unsigned int root = subtrees[i];
+      unsigned int size = h->subtree_size[root];
+      unsigned int child, end;
+
+      if (size <= max_size)
+        {
+          subtrees[n_res++] = root;
+          continue;
+        }
+
+      hierarchy_update_node (h, kernels, root);
+
+      child = h->pre_index[root] + 1;
+      end = h->pre_index[root] + size;
+      while (child < end)
+        {
+          unsigned int node = h->pre_order[child];
+
+          subtrees[n_subtrees++] = node;
+          child += h->subtree_size[node];
+        }
+    }
+
+  return n_res;
+}
+
+/* Splits the update in chunks of independent subtrees, and runs them
+ * using the parallel executor
+ */
+static void
+hierarchy_update_parallel (const graphene_transform_hierarchy_t *h,
+                           unsigned int                         *subtrees,
+                           unsigned int                          n_subtrees,
+                           unsigned int                          n_updated)
+{
+  hierarchy_chunks_t chunks;
+  unsigned int *chunk_starts;
+  unsigned int n_chunks = 0, size = 0;
+
+  if (n_updated < HIERARCHY_PARALLEL_THRESHOLD || !graphene_parallel_is_enabled ())
+    {
+      hierarchy_update_subtrees (h, subtrees, n_subtrees);
+      return;
+    }
+
+  n_subtrees = hierarchy_split_subtrees (h, subtrees, n_subtrees, HIERARCHY_CHUNK_SIZE);
+
+  /* Every chunk but the last has at least HIERARCHY_CHUNK_SIZE nodes */
+  chunk_starts = graphene_aligned_alloc (sizeof (unsigned int), n_updated / HIERARCHY_CHUNK_SIZE + 2, 16);
+
+  for (unsigned int i = 0; i < n_subtrees; i++)
+    {
+      if (size == 0)
+        chunk_starts[n_chunks++] = i;
+
+      size += h->subtree_size[subtrees[i]];
+      if (size >= HIERARCHY_CHUNK_SIZE)
+        size = 0;
+    }
+
+  chunk_starts[n_chunks] = n_subtrees;
+
+  chunks.h = h;
+  chunks.subtrees = subtrees;
+  chunks.chunk_starts = chunk_starts;
+
+  graphene_parallel_for (n_chunks, 1, hierarchy_update_chunk, &chunks);
+
+  graphene_aligned_free (chunk_starts);
+}
+
+static int
+compare_indices (const void *a,
+                 const void *b)
+{
+  unsigned int ia = *(const unsigned int *) a;
+  unsigned int ib = *(const unsigned int *) b;
+
+  return ia < ib ? -1 : ia > ib ? 1 : 0;
+}
+
+/**
+ * graphene_transform_hierarchy_new:
+ * @n_nodes: the number of nodes
+ * @parents: (array length=n_nodes) (nullable): the index of the parent
+ *   of each node, or %GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT for the
+ *   root nodes
+ *
+ * Creates a new #graphene_transform_hierarchy_t with the given structure.
+ *
+ * The parent of each node must have a smaller index than the node; nodes
+ * with an invalid parent are treated as root nodes. If @parents is %NULL,
+ * all nodes are root nodes.
+ *
+ * The local transformation of every node is initialized to the identity,
+ * and every node is marked as dirty.
+ *
+ * Returns: (transfer full): the newly created #graphene_transform_hierarchy_t.
+ *   Use graphene_transform_hierarchy_free() to free the resources allocated
+ *   by this function
+ *
+ * Since: 1.12
+ */
+graphene_transform_hierarchy_t *
+graphene_transform_hierarchy_new (unsigned int        n_nodes,
+                                  const unsigned int *parents)
+{
+  graphene_transform_hierarchy_t *res;
+  unsigned int *next_index;
+  unsigned int n_alloc = MAX (n_nodes, 1);
+  unsigned int n_roots = 0;
+
+  res = graphene_aligned_alloc0 (sizeof (graphene_transform_hierarchy_t), 1, 16);
+  res->n_nodes = n_nodes;
+
+  res->parents = graphene_aligned_alloc (sizeof (unsigned int), n_alloc, 16);
+  res->pre_order = graphene_aligned_alloc (sizeof (unsigned int), n_alloc, 16);
+  res->pre_index = graphene_aligned_alloc (sizeof (unsigned int), n_alloc, 16);
+  res->subtree_size = graphene_aligned_alloc (sizeof (unsigned int), n_alloc, 16);
+  res->dirty_nodes = graphene_aligned_alloc (sizeof (unsigned int), n_alloc, 16);
+  res->dirty = graphene_aligned_alloc (sizeof (uint8_t), n_alloc, 16);
+  res->subtrees = graphene_aligned_alloc (sizeof (unsigned int), n_alloc, 16);
+  res->local = graphene_aligned_alloc (sizeof (graphene_matrix_t), n_alloc, 16);
+  res->world = graphene_aligned_alloc (sizeof (graphene_matrix_t), n_alloc, 16);
+
+  for (unsigned int i = 0; i < n_nodes; i++)
+    {
+      unsigned int parent = parents != NULL ? parents[i] : GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT;
+
+      if (parent >= i)
+        parent = GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT;
+
+      res->parents[i] = parent;
+      res->subtree_size[i] = 1;
+
+      graphene_matrix_init_identity (&res->local[i]);
+      graphene_matrix_init_identity (&res->world[i]);
+
+      res->dirty_nodes[i] = i;
+      res->dirty[i] = 1;
+    }
+
+  res->n_dirty = n_nodes;
+
+  /* Children come after their parents, so a reverse pass accumulates
+   * the size of each subtree
+   */
+  for (unsigned int i = n_nodes; i-- > 0;)
+    {
+      if (res->parents[i] != GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT)
+        res->subtree_size[res->parents[i]] += res->subtree_size[i];
+    }
+
+  /* Then a forward pass places each node in the first free slot of the
+   * subtree of its parent, keeping the node order among siblings
+   */
+  next_index = graphene_aligned_alloc (sizeof (unsigned int), n_alloc, 16);
+
+  for (unsigned int i = 0; i < n_nodes; i++)
+    {
+      unsigned int parent = res->parents[i];
+      unsigned int index;
+
+      if (parent == GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT)
+        {
+          index = n_roots;
+          n_roots += res->subtree_size[i];
+        }
+      else
+        {
+          index = next_index[parent];
+          next_index[parent] += res->subtree_size[i];
+        }
+
+      res->pre_index[i] = index;
+      res->pre_order[index] = i;
+      next_index[i] = index + 1;
+    }
+
+  graphene_aligned_free (next_index);
+
+  return res;
+}
+
+/**
+ * graphene_transform_hierarchy_free:
+ * @h: a #graphene_transform_hierarchy_t
+ *
+ * Frees the resources allocated by graphene_transform_hierarchy_new().
+ *
+ * Since: 1.12
+ */
+void
+graphene_transform_hierarchy_free (graphene_transform_hierarchy_t *h)
+{
+  if (h == NULL)
+    return;
+
+  graphene_aligned_free (h->parents);
+  graphene_aligned_free (h->pre_order);
+  graphene_aligned_free (h->pre_index);
+  graphene_aligned_free (h->subtree_size);
+  graphene_aligned_free (h->dirty_nodes);
+  graphene_aligned_free (h->dirty);
+  graphene_aligned_free (h->subtrees);
+  graphene_aligned_free (h->local);
+  graphene_aligned_free (h->world);
+  graphene_aligned_free (h);
+}
+
+/**
+ * graphene_transform_hierarchy_get_n_nodes:
+ * @h: a #graphene_transform_hierarchy_t
+ *
+ * Retrieves the number of nodes in the hierarchy.
+ *
+ * Returns: the number of nodes
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_transform_hierarchy_get_n_nodes (const graphene_transform_hierarchy_t *h)
+{
+  return h->n_nodes;
+}
+
+/**
+ * graphene_transform_hierarchy_get_parent:
+ * @h: a #graphene_transform_hierarchy_t
+ * @node: the index of a node
+ *
+ * Retrieves the index of the parent of the given node.
+ *
+ * Returns: the index of the parent, or %GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT
+ *   if @node is a root node, or if it's not a valid index
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_transform_hierarchy_get_parent (const graphene_transform_hierarchy_t *h,
+                                         unsigned int                          node)
+{
+  if (node >= h->n_nodes)
+    return GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT;
+
+  return h->parents[node];
+}
+
+/**
+ * graphene_transform_hierarchy_set_local:
+ * @h: a #graphene_transform_hierarchy_t
+ * @node: the index of a node
+ * @m: the local transformation of the node
+ *
+ * Sets the transformation of @node, relative to its parent, and marks
+ * the node as dirty.
+ *
+ * The world transformations of the node and its descendants are not
+ * updated until graphene_transform_hierarchy_update() is called.
+ *
+ * Since: 1.12
+ */
+void
+graphene_transform_hierarchy_set_local (graphene_transform_hierarchy_t *h,
+                                        unsigned int                    node,
+                                        const graphene_matrix_t        *m)
+{
+  if (node >= h->n_nodes)
+    return;
+
+  graphene_matrix_init_from_matrix (&h->local[node], m);
+
+  if (!h->dirty[node])
+    {
+      h->dirty[node] = 1;
+      h->dirty_nodes[h->n_dirty++] = node;
+    }
+}
+
+/**
+ * graphene_transform_hierarchy_get_local:
+ * @h: a #graphene_transform_hierarchy_t
+ * @node: the index of a node
+ * @res: (out caller-allocates): return location for the local
+ *   transformation of the node
+ *
+ * Retrieves the transformation of @node, relative to its parent.
+ *
+ * Since: 1.12
+ */
+void
+graphene_transform_hierarchy_get_local (const graphene_transform_hierarchy_t *h,
+                                        unsigned int                          node,
+                                        graphene_matrix_t                    *res)
+{
+  if (node >= h->n_nodes)
+    {
+      graphene_matrix_init_identity (res);
+      return;
+    }
+
+  graphene_matrix_init_from_matrix (res, &h->local[node]);
+}
+
+/**
+ * graphene_transform_hierarchy_update:
+ * @h: a #graphene_transform_hierarchy_t
+ *
+ * Recomputes the world transformations of the dirty nodes, and of all
+ * their descendants, and clears the dirty state of every node.
+ *
+ * The world transformation of a node is the product of its local
+ * transformation and the world transformation of its parent; the world
+ * transformation of a root node is its local transformation.
+ *
+ * Returns: the number of updated nodes
+ *
+ * Since: 1.12
+ */
+unsigned int
+graphene_transform_hierarchy_update (graphene_transform_hierarchy_t *h)
+{
+  unsigned int n_subtrees = 0;
+  unsigned int n_updated = 0;
+  unsigned int end = 0;
+
+  if (h->n_dirty == 0)
+    return 0;
+
+  /* Visit the dirty nodes in depth-first order: each of them either
+   * starts a new subtree to update, or is inside the previous one
+   */
+  if (h->n_dirty > h->n_nodes / 16)
+    {
+      for (unsigned int i = 0; i < h->n_nodes; i++)
+        {
+          unsigned int node = h->pre_order[i];
+
+          if (!h->dirty[node])
+            continue;
+
+          h->dirty[node] = 0;
+
+          if (i >= end)
+            {
+              h->subtrees[n_subtrees++] = node;
+              end = i + h->subtree_size[node];
+              n_updated += h->subtree_size[node];
+            }
+        }
+    }
+  else
+    {
+      for (unsigned int i = 0; i < h->n_dirty; i++)
+        h->dirty_nodes[i] = h->pre_index[h->dirty_nodes[i]];
+
+      qsort (h->dirty_nodes, h->n_dirty, sizeof (unsigned int), compare_indices);
+
+      for (unsigned int i = 0; i < h->n_dirty; i++)
+        {
+          unsigned int index = h->dirty_nodes[i];
+          unsigned int node = h->pre_order[index];
+
+          h->dirty[node] = 0;
+
+          if (index >= end)
+            {
+              h->subtrees[n_subtrees++] = node;
+              end = index + h->subtree_size[node];
+              n_updated += h->subtree_size[node];
+            }
+        }
+    }
+
+  h->n_dirty = 0;
+
+  hierarchy_update_parallel (h, h->subtrees, n_subtrees, n_updated);
+
+  return n_updated;
+}
+
+/**
+ * graphene_transform_hierarchy_get_world:
+ * @h: a #graphene_transform_hierarchy_t
+ * @node: the index of a node
+ * @res: (out caller-allocates): return location for the world
+ *   transformation of the node
+ *
+ * Retrieves the world transformation of @node, as computed by the last
+ * call to graphene_transform_hierarchy_update().
+ *
+ * Since: 1.12
+ */
+void
+graphene_transform_hierarchy_get_world (const graphene_transform_hierarchy_t *h,
+                                        unsigned int                          node,
+                                        graphene_matrix_t                    *res)
+{
+  if (node >= h->n_nodes)
+    {
+      graphene_matrix_init_identity (res);
+      return;
+    }
+
+  graphene_matrix_init_from_matrix (res, &h->world[node]);
+}
+
+/**
+ * graphene_transform_hierarchy_get_world_matrices:
+ * @h: a #graphene_transform_hierarchy_t
+ *
+ * Retrieves the world transformations of all the nodes, as computed by
+ * the last call to graphene_transform_hierarchy_update().
+ *
+ * The matrices are stored contiguously, in node order, and the returned
+ * array is owned by the hierarchy: it is overwritten by the next update,
+ * and it must not be freed.
+ *
+ * Returns: (array) (transfer none): an array of
+ *   graphene_transform_hierarchy_get_n_nodes() matrices
+ *
+ * Since: 1.12
+ */
+const graphene_matrix_t *
+graphene_transform_hierarchy_get_world_matrices (const graphene_transform_hierarchy_t *h)
+{
+  return h->world;
+}
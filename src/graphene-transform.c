@@ -0,0 +1,806 @@
+/* graphene-transform.c: A matrix with a cached transformation category
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright 2026  Graphene contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * SECTION:graphene-transform
+ * @Title: Transform
+ * @Short_Description: A matrix with a cached transformation category
+ *
+ * #graphene_transform_t is a #graphene_matrix_t that keeps track of the
+ * kind of transformation it represents: the identity, a translation, a
+ * scale and translation, a 2D or 3D affine transformation, or a generic
+ * projective transformation. The category is computed when initializing
+ * the transform, and updated every time it is composed with another
+ * transformation, without looking at the values of the matrix.
+ *
+ * Transforming points, rectangles, and boxes, as well as inverting the
+ * transformation, use the category to select an implementation that does
+ * the least amount of work; for instance, transforming the bounds of a
+ * rectangle with a translation only needs to offset its origin.
+ *
+ * Renderers that keep a stack of transformations can use
+ * #graphene_transform_t instead of #graphene_matrix_t to avoid the
+ * generic 4x4 matrix operations for the common cases.
+ */
+
+#include "graphene-private.h"
+
+#include "graphene-transform.h"
+
+#include "graphene-alloc-private.h"
+#include "graphene-box.h"
+#include "graphene-point.h"
+#include "graphene-point3d.h"
+#include "graphene-rect.h"
+#include "graphene-simd4f.h"
+#include "graphene-simd4x4f.h"
+#include "graphene-vec3.h"
+
+/**
+ * graphene_transform_alloc: (constructor)
+ *
+ * Allocates a new #graphene_transform_t.
+ *
+ * Returns: (transfer full): the newly allocated transform
+ *
+ * Since: 1.12
+ */
+graphene_transform_t *
+graphene_transform_alloc (void)
+{
+  return graphene_aligned_alloc (sizeof (graphene_transform_t), 1, 16);
+}
+
+/**
+ * graphene_transform_free:
+ * @t: a #graphene_transform_t
+ *
+ * Frees the resources allocated by graphene_transform_alloc().
+ *
+ * Since: 1.12
+ */
+void
+graphene_transform_free (graphene_transform_t *t)
+{
+  graphene_aligned_free (t);
+}
+
+/* Computes the category of a matrix by looking at its elements; the
+ * comparisons are exact for the categories that have their own code
+ * paths, so that those return the same results as the generic ones
+ */
+static graphene_transform_category_t
+transform_classify (const graphene_simd4x4f_t *m)
+{
+  const graphene_simd4f_t zero = graphene_simd4f_init_zero ();
+  const graphene_simd4f_t x_axis = graphene_simd4f_init (1.f, 0.f, 0.f, 0.f);
+  const graphene_simd4f_t y_axis = graphene_simd4f_init (0.f, 1.f, 0.f, 0.f);
+  const graphene_simd4f_t z_axis = graphene_simd4f_init (0.f, 0.f, 1.f, 0.f);
+  const graphene_simd4f_t w_axis = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+  graphene_simd4f_t col;
+  float xw, yw, zw, ww;
+
+  /* The last column of an affine transformation is (0, 0, 0, 1) */
+  xw = graphene_simd4f_get_w (m->x);
+  yw = graphene_simd4f_get_w (m->y);
+  zw = graphene_simd4f_get_w (m->z);
+  ww = graphene_simd4f_get_w (m->w);
+  col = graphene_simd4f_init (xw, yw, zw, ww);
+  if (!graphene_simd4f_cmp_eq (col, w_axis))
+    return GRAPHENE_TRANSFORM_CATEGORY_PROJECTIVE;
+
+  /* Only the diagonal of the linear part is set */
+  if (graphene_simd4f_cmp_eq (graphene_simd4f_mul (m->x, graphene_simd4f_init (0.f, 1.f, 1.f, 0.f)), zero) &&
+      graphene_simd4f_cmp_eq (graphene_simd4f_mul (m->y, graphene_simd4f_init (1.f, 0.f, 1.f, 0.f)), zero) &&
+      graphene_simd4f_cmp_eq (graphene_simd4f_mul (m->z, graphene_simd4f_init (1.f, 1.f, 0.f, 0.f)), zero))
+    {
+      if (!(graphene_simd4f_cmp_eq (m->x, x_axis) &&
+            graphene_simd4f_cmp_eq (m->y, y_axis) &&
+            graphene_simd4f_cmp_eq (m->z, z_axis)))
+        return GRAPHENE_TRANSFORM_CATEGORY_SCALE;
+
+      if (graphene_simd4f_cmp_eq (m->w, w_axis))
+        return GRAPHENE_TRANSFORM_CATEGORY_IDENTITY;
+
+      return GRAPHENE_TRANSFORM_CATEGORY_TRANSLATE;
+    }
+
+  /* Use the same tolerance as graphene_matrix_is_2d(); the 2D and 3D
+   * affine transformations share the same code paths, so this does not
+   * affect the results
+   */
+  if (graphene_simd4x4f_is_2d (m))
+    return GRAPHENE_TRANSFORM_CATEGORY_AFFINE_2D;
+
+  return GRAPHENE_TRANSFORM_CATEGORY_AFFINE_3D;
+}
+
+/* Computes the category of the product of two transformations of
+ * category @a and @b, without looking at the resulting matrix @m unless
+ * necessary.
+ *
+ * The result may be more generic than the actual category of @m, for
+ * instance if a rotation is undone by the opposite rotation, but it is
+ * never less generic.
+ */
+static inline graphene_transform_category_t
+transform_category_compose (graphene_transform_category_t  a,
+                            graphene_transform_category_t  b,
+                            const graphene_simd4x4f_t     *m)
+{
+  graphene_transform_category_t lo = MIN (a, b);
+  graphene_transform_category_t hi = MAX (a, b);
+
+  if (lo == GRAPHENE_TRANSFORM_CATEGORY_IDENTITY)
+    return hi;
+
+  /* Translations and scales may move things along the Z axis, which
+   * would turn a 2D affine transformation into a 3D one
+   */
+  if (hi == GRAPHENE_TRANSFORM_CATEGORY_AFFINE_2D && lo != GRAPHENE_TRANSFORM_CATEGORY_AFFINE_2D)
+    return transform_classify (m);
+
+  return hi;
+}
+
+/**
+ * graphene_transform_init_identity:
+ * @t: a #graphene_transform_t
+ *
+ * Initializes a #graphene_transform_t with the identity transformation.
+ *
+ * Returns: (transfer none): the initialized transform
+ *
+ * Since: 1.12
+ */
+graphene_transform_t *
+graphene_transform_init_identity (graphene_transform_t *t)
+{
+  graphene_matrix_init_identity (&t->matrix);
+  t->category = GRAPHENE_TRANSFORM_CATEGORY_IDENTITY;
+
+  return t;
+}
+
+/**
+ * graphene_transform_init_from_matrix:
+ * @t: a #graphene_transform_t
+ * @m: a #graphene_matrix_t
+ *
+ * Initializes a #graphene_transform_t with the given matrix, and
+ * computes its category.
+ *
+ * Returns: (transfer none): the initialized transform
+ *
+ * Since: 1.12
+ */
+graphene_transform_t *
+graphene_transform_init_from_matrix (graphene_transform_t    *t,
+                                     const graphene_matrix_t *m)
+{
+  t->matrix.value = m->value;
+  t->category = transform_classify (&t->matrix.value);
+
+  return t;
+}
+
+/**
+ * graphene_transform_init_from_transform:
+ * @t: a #graphene_transform_t
+ * @src: a #graphene_transform_t
+ *
+ * Initializes a #graphene_transform_t using the values of another
+ * transform.
+ *
+ * Returns: (transfer none): the initialized transform
+ *
+ * Since: 1.12
+ */
+graphene_transform_t *
+graphene_transform_init_from_transform (graphene_transform_t       *t,
+                                        const graphene_transform_t *src)
+{
+  t->matrix.value = src->matrix.value;
+  t->category = src->category;
+
+  return t;
+}
+
+/**
+ * graphene_transform_init_translate:
+ * @t: a #graphene_transform_t
+ * @p: the translation coordinates
+ *
+ * Initializes a #graphene_transform_t with a translation.
+ *
+ * Returns: (transfer none): the initialized transform
+ *
+ * Since: 1.12
+ */
+graphene_transform_t *
+graphene_transform_init_translate (graphene_transform_t     *t,
+                                   const graphene_point3d_t *p)
+{
+  graphene_matrix_init_translate (&t->matrix, p);
+  t->category = transform_classify (&t->matrix.value);
+
+  return t;
+}
+
+/**
+ * graphene_transform_init_scale:
+ * @t: a #graphene_transform_t
+ * @x: the scale factor on the X axis
+ * @y: the scale factor on the Y axis
+ * @z: the scale factor on the Z axis
+ *
+ * Initializes a #graphene_transform_t with the given scaling factors.
+ *
+ * Returns: (transfer none): the initialized transform
+ *
+ * Since: 1.12
+ */
+graphene_transform_t *
+graphene_transform_init_scale (graphene_transform_t *t,
+                               float                 x,
+                               float                 y,
+                               float                 z)
+{
+  graphene_matrix_init_scale (&t->matrix, x, y, z);
+  t->category = transform_classify (&t->matrix.value);
+
+  return t;
+}
+
+/**
+ * graphene_transform_get_category:
+ * @t: a #graphene_transform_t
+ *
+ * Retrieves the category of the transformation.
+ *
+ * The category is never less generic than the transformation stored in
+ * @t, but it can be more generic; for instance, after composing a rotation
+ * with the opposite rotation.
+ *
+ * Returns: the category of the transformation
+ *
+ * Since: 1.12
+ */
+graphene_transform_category_t
+graphene_transform_get_category (const graphene_transform_t *t)
+{
+  return t->category;
+}
+
+/**
+ * graphene_transform_to_matrix:
+ * @t: a #graphene_transform_t
+ * @res: (out caller-allocates): return location for the matrix
+ *
+ * Retrieves the matrix of the transformation.
+ *
+ * Since: 1.12
+ */
+void
+graphene_transform_to_matrix (const graphene_transform_t *t,
+                              graphene_matrix_t          *res)
+{
+  res->value = t->matrix.value;
+}
+
+/**
+ * graphene_transform_multiply:
+ * @a: a #graphene_transform_t
+ * @b: a #graphene_transform_t
+ * @res: (out caller-allocates): return location for the result
+ *
+ * Multiplies two transformations, following the same convention as
+ * graphene_matrix_multiply(): the resulting transformation applies
+ * @a first, and then @b.
+ *
+ * Since: 1.12
+ */
+void
+graphene_transform_multiply (const graphene_transform_t *a,
+                             const graphene_transform_t *b,
+                             graphene_transform_t       *res)
+{
+  graphene_transform_category_t category_a = a->category;
+  graphene_transform_category_t category_b = b->category;
+  graphene_simd4x4f_t m;
+
+  if (category_a == GRAPHENE_TRANSFORM_CATEGORY_IDENTITY)
+    {
+      graphene_transform_init_from_transform (res, b);
+      return;
+    }
+
+  if (category_b == GRAPHENE_TRANSFORM_CATEGORY_IDENTITY)
+    {
+      graphene_transform_init_from_transform (res, a);
+      return;
+    }
+
+  if (category_a <= GRAPHENE_TRANSFORM_CATEGORY_SCALE &&
+      category_b <= GRAPHENE_TRANSFORM_CATEGORY_SCALE)
+    {
+      /* Scale the diagonals and the translation of @a by the diagonal
+       * of @b, then add the translation of @b
+       */
+      float bx = graphene_simd4f_get_x (b->matrix.value.x);
+      float by = graphene_simd4f_get_y (b->matrix.value.y);
+      float bz = graphene_simd4f_get_z (b->matrix.value.z);
+      graphene_simd4f_t scale = graphene_simd4f_init (bx, by, bz, 0.f);
+
+      m.x = graphene_simd4f_mul (a->matrix.value.x, b->matrix.value.x);
+      m.y = graphene_simd4f_mul (a->matrix.value.y, b->matrix.value.y);
+      m.z = graphene_simd4f_mul (a->matrix.value.z, b->matrix.value.z);
+      m.w = graphene_simd4f_madd (a->matrix.value.w, scale, b->matrix.value.w);
+
+      res->matrix.value = m;
+      res->category = MAX (category_a, category_b);
+      return;
+    }
+
+  graphene_simd4x4f_matrix_mul (&a->matrix.value, &b->matrix.value, &m);
+
+  res->matrix.value = m;
+  res->category = transform_category_compose (category_a, category_b, &m);
+}
+
+/**
+ * graphene_transform_translate:
+ * @t: a #graphene_transform_t
+ * @p: the translation coordinates
+ *
+ * Adds a translation transformation to @t, like graphene_matrix_translate().
+ *
+ * Since: 1.12
+ */
+void
+graphene_transform_translate (graphene_transform_t     *t,
+                              const graphene_point3d_t *p)
+{
+  graphene_simd4f_t offset;
+
+  if (t->category == GRAPHENE_TRANSFORM_CATEGORY_PROJECTIVE)
+    {
+      graphene_matrix_translate (&t->matrix, p);
+      return;
+    }
+
+  /* The last column of an affine transformation is (0, 0, 0, 1), so
+   * only the translation row changes
+   */
+  offset = graphene_simd4f_init (p->x, p->y, p->z, 0.f);
+  t->matrix.value.w = graphene_simd4f_add (t->matrix.value.w, offset);
+
+  if (t->category == GRAPHENE_TRANSFORM_CATEGORY_IDENTITY)
+    t->category = GRAPHENE_TRANSFORM_CATEGORY_TRANSLATE;
+  else if (t->category == GRAPHENE_TRANSFORM_CATEGORY_AFFINE_2D && fabsf (p->z) > 0.f)
+    t->category = GRAPHENE_TRANSFORM_CATEGORY_AFFINE_3D;
+}
+
+/**
+ * graphene_transform_scale:
+ * @t: a #graphene_transform_t
+ * @x: the scale factor on the X axis
+ * @y: the scale factor on the Y axis
+ * @z: the scale factor on the Z axis
+ *
+ * Adds a scaling transformation to @t, like graphene_matrix_scale().
+ *
+ * Since: 1.12
+ */
+void
+graphene_transform_scale (graphene_transform_t *t,
+                          float                 x,
+                          float                 y,
+                          float                 z)
+{
+  graphene_simd4f_t scale = graphene_simd4f_init (x, y, z, 1.f);
+
+  t->matrix.value.x = graphene_simd4f_mul (t->matrix.value.x, scale);
+  t->matrix.value.y = graphene_simd4f_mul (t->matrix.value.y, scale);
+  t->matrix.value.z = graphene_simd4f_mul (t->matrix.value.z, scale);
+  t->matrix.value.w = graphene_simd4f_mul (t->matrix.value.w, scale);
+
+  if (t->category < GRAPHENE_TRANSFORM_CATEGORY_SCALE)
+    t->category = GRAPHENE_TRANSFORM_CATEGORY_SCALE;
+  else if (t->category == GRAPHENE_TRANSFORM_CATEGORY_AFFINE_2D && fabsf (z - 1.f) > 0.f)
+    t->category = GRAPHENE_TRANSFORM_CATEGORY_AFFINE_3D;
+}
+
+/**
+ * graphene_transform_rotate:
+ * @t: a #graphene_transform_t
+ * @angle: the rotation angle, in degrees
+ * @axis: the rotation axis, as a #graphene_vec3_t
+ *
+ * Adds a rotation transformation to @t, like graphene_matrix_rotate().
+ *
+ * Since: 1.12
+ */
+void
+graphene_transform_rotate (graphene_transform_t  *t,
+                           float                  angle,
+                           const graphene_vec3_t *axis)
+{
+  graphene_transform_category_t category;
+  float ax = graphene_vec3_get_x (axis);
+  float ay = graphene_vec3_get_y (axis);
+
+  /* Rotations around the Z axis are 2D transformations */
+  if (fabsf (ax) > 0.f || fabsf (ay) > 0.f)
+    category = GRAPHENE_TRANSFORM_CATEGORY_AFFINE_3D;
+  else
+    category = GRAPHENE_TRANSFORM_CATEGORY_AFFINE_2D;
+
+  graphene_matrix_rotate (&t->matrix, angle, axis);
+  t->category = transform_category_compose (t->category, category, &t->matrix.value);
+}
+
+/**
+ * graphene_transform_inverse:
+ * @t: a #graphene_transform_t
+ * @res: (out caller-allocates): return location for the inverse
+ *   transformation
+ *
+ * Inverts the given transformation.
+ *
+ * The inverse has the same category as @t.
+ *
+ * Returns: `true` if the transformation is invertible
+ *
+ * Since: 1.12
+ */
+bool
+graphene_transform_inverse (const graphene_transform_t *t,
+                            graphene_transform_t       *res)
+{
+  const graphene_simd4f_t w_axis = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+  graphene_simd4x4f_t m = t->matrix.value;
+
+  switch (t->category)
+    {
+    case GRAPHENE_TRANSFORM_CATEGORY_IDENTITY:
+      break;
+
+    case GRAPHENE_TRANSFORM_CATEGORY_TRANSLATE:
+      /* (-x, -y, -z, 1) */
+      m.w = graphene_simd4f_sub (graphene_simd4f_add (w_axis, w_axis), m.w);
+      break;
+
+    case GRAPHENE_TRANSFORM_CATEGORY_SCALE:
+      {
+        float sx = graphene_simd4f_get_x (m.x);
+        float sy = graphene_simd4f_get_y (m.y);
+        float sz = graphene_simd4f_get_z (m.z);
+        graphene_simd4f_t inv_scale;
+        graphene_simd4f_t translate;
+
+        /* Same check as graphene_simd4x4f_inverse() */
+        if (fabsf (sx * sy * sz) < FLT_EPSILON)
+          return false;
+
+        inv_scale = graphene_simd4f_init (1.f / sx, 1.f / sy, 1.f / sz, 1.f);
+        translate = graphene_simd4f_sub (graphene_simd4f_add (w_axis, w_axis), m.w);
+
+        m.x = graphene_simd4f_init (1.f / sx, 0.f, 0.f, 0.f);
+        m.y = graphene_simd4f_init (0.f, 1.f / sy, 0.f, 0.f);
+        m.z = graphene_simd4f_init (0.f, 0.f, 1.f / sz, 0.f);
+        m.w = graphene_simd4f_mul (translate, inv_scale);
+      }
+      break;
+
+    case GRAPHENE_TRANSFORM_CATEGORY_AFFINE_2D:
+    case GRAPHENE_TRANSFORM_CATEGORY_AFFINE_3D:
+      {
+        graphene_matrix_t inverse;
+
+        if (!graphene_matrix_inverse_affine (&t->matrix, &inverse))
+          return false;
+
+        m = inverse.value;
+      }
+      break;
+
+    case GRAPHENE_TRANSFORM_CATEGORY_PROJECTIVE:
+    default:
+      {
+        graphene_matrix_t inverse;
+
+        if (!graphene_matrix_inverse (&t->matrix, &inverse))
+          return false;
+
+        m = inverse.value;
+      }
+      break;
+    }
+
+  res->matrix.value = m;
+  res->category = t->category;
+
+  return true;
+}
+
+/**
+ * graphene_transform_transform_point:
+ * @t: a #graphene_transform_t
+ * @p: a #graphene_point_t
+ * @res: (out caller-allocates): return location for the transformed
+ *   point
+ *
+ * Transforms the given #graphene_point_t, like
+ * graphene_matrix_transform_point().
+ *
+ * Since: 1.12
+ */
+void
+graphene_transform_transform_point (const graphene_transform_t *t,
+                                    const graphene_point_t     *p,
+                                    graphene_point_t           *res)
+{
+  const graphene_simd4x4f_t *m = &t->matrix.value;
+
+  switch (t->category)
+    {
+    case GRAPHENE_TRANSFORM_CATEGORY_IDENTITY:
+      *res = *p;
+      break;
+
+    case GRAPHENE_TRANSFORM_CATEGORY_TRANSLATE:
+      res->x = p->x + graphene_simd4f_get_x (m->w);
+      res->y = p->y + graphene_simd4f_get_y (m->w);
+      break;
+
+    case GRAPHENE_TRANSFORM_CATEGORY_SCALE:
+      res->x = p->x * graphene_simd4f_get_x (m->x) + graphene_simd4f_get_x (m->w);
+      res->y = p->y * graphene_simd4f_get_y (m->y) + graphene_simd4f_get_y (m->w);
+      break;
+
+    case GRAPHENE_TRANSFORM_CATEGORY_AFFINE_2D:
+    case GRAPHENE_TRANSFORM_CATEGORY_AFFINE_3D:
+    case GRAPHENE_TRANSFORM_CATEGORY_PROJECTIVE:
+    default:
+      graphene_matrix_transform_point (&t->matrix, p, res);
+      break;
+    }
+}
+
+/**
+ * graphene_transform_transform_point3d:
+ * @t: a #graphene_transform_t
+ * @p: a #graphene_point3d_t
+ * @res: (out caller-allocates): return location for the transformed
+ *   point
+ *
+ * Transforms the given #graphene_point3d_t, like
+ * graphene_matrix_transform_point3d().
+ *
+ * Since: 1.12
+ */
+void
+graphene_transform_transform_point3d (const graphene_transform_t *t,
+                                      const graphene_point3d_t   *p,
+                                      graphene_point3d_t         *res)
+{
+  const graphene_simd4x4f_t *m = &t->matrix.value;
+  graphene_simd4f_t v;
+
+  switch (t->category)
+    {
+    case GRAPHENE_TRANSFORM_CATEGORY_IDENTITY:
+      *res = *p;
+      return;
+
+    case GRAPHENE_TRANSFORM_CATEGORY_TRANSLATE:
+      v = graphene_simd4f_init (p->x, p->y, p->z, 0.f);
+      v = graphene_simd4f_add (v, m->w);
+      break;
+
+    case GRAPHENE_TRANSFORM_CATEGORY_SCALE:
+      {
+        float sx = graphene_simd4f_get_x (m->x);
+        float sy = graphene_simd4f_get_y (m->y);
+        float sz = graphene_simd4f_get_z (m->z);
+        graphene_simd4f_t scale = graphene_simd4f_init (sx, sy, sz, 0.f);
+
+        v = graphene_simd4f_init (p->x, p->y, p->z, 0.f);
+        v = graphene_simd4f_madd (v, scale, m->w);
+      }
+      break;
+
+    case GRAPHENE_TRANSFORM_CATEGORY_AFFINE_2D:
+    case GRAPHENE_TRANSFORM_CATEGORY_AFFINE_3D:
+    case GRAPHENE_TRANSFORM_CATEGORY_PROJECTIVE:
+    default:
+      v = graphene_simd4f_init (p->x, p->y, p->z, 1.f);
+      graphene_simd4x4f_point3_mul (m, &v, &v);
+      break;
+    }
+
+  res->x = graphene_simd4f_get_x (v);
+  res->y = graphene_simd4f_get_y (v);
+  res->z = graphene_simd4f_get_z (v);
+}
+
+/**
+ * graphene_transform_transform_bounds:
+ * @t: a #graphene_transform_t
+ * @r: a #graphene_rect_t
+ * @res: (out caller-allocates): return location for the bounds
+ *   of the transformed rectangle
+ *
+ * Transforms a #graphene_rect_t, and computes the axis aligned
+ * rectangle containing the result, like graphene_matrix_transform_bounds().
+ *
+ * Since: 1.12
+ */
+void
+graphene_transform_transform_bounds (const graphene_transform_t *t,
+                                     const graphene_rect_t      *r,
+                                     graphene_rect_t            *res)
+{
+  const graphene_simd4x4f_t *m = &t->matrix.value;
+  graphene_rect_t rr;
+
+  graphene_rect_normalize_r (r, &rr);
+
+  switch (t->category)
+    {
+    case GRAPHENE_TRANSFORM_CATEGORY_IDENTITY:
+      *res = rr;
+      break;
+
+    case GRAPHENE_TRANSFORM_CATEGORY_TRANSLATE:
+      graphene_rect_offset_r (&rr,
+                              graphene_simd4f_get_x (m->w),
+                              graphene_simd4f_get_y (m->w),
+                              res);
+      break;
+
+    case GRAPHENE_TRANSFORM_CATEGORY_SCALE:
+    case GRAPHENE_TRANSFORM_CATEGORY_AFFINE_2D:
+    case GRAPHENE_TRANSFORM_CATEGORY_AFFINE_3D:
+      {
+        /* Transform the center of the rectangle, and project the half
+         * extents on each axis; the rectangle has Z = 0 and W = 1, so
+         * only the first two rows and the translation contribute
+         */
+        const graphene_simd4f_t half = graphene_simd4f_splat (0.5f);
+        graphene_simd4f_t origin = graphene_simd4f_init (rr.origin.x, rr.origin.y, 0.f, 0.f);
+        graphene_simd4f_t size = graphene_simd4f_init (rr.size.width, rr.size.height, 0.f, 0.f);
+        graphene_simd4f_t extents = graphene_simd4f_mul (size, half);
+        graphene_simd4f_t center = graphene_simd4f_add (origin, extents);
+        graphene_simd4f_t cx = graphene_simd4f_splat_x (center);
+        graphene_simd4f_t cy = graphene_simd4f_splat_y (center);
+        graphene_simd4f_t ex = graphene_simd4f_splat_x (extents);
+        graphene_simd4f_t ey = graphene_simd4f_splat_y (extents);
+        graphene_simd4f_t abs_x = graphene_simd4f_max (m->x, graphene_simd4f_neg (m->x));
+        graphene_simd4f_t abs_y = graphene_simd4f_max (m->y, graphene_simd4f_neg (m->y));
+        graphene_simd4f_t c, e, min, max;
+
+        c = graphene_simd4f_madd (cx, m->x, m->w);
+        c = graphene_simd4f_madd (cy, m->y, c);
+        e = graphene_simd4f_mul (ex, abs_x);
+        e = graphene_simd4f_madd (ey, abs_y, e);
+
+        min = graphene_simd4f_sub (c, e);
+        max = graphene_simd4f_add (c, e);
+
+        graphene_rect_init (res,
+                            graphene_simd4f_get_x (min),
+                            graphene_simd4f_get_y (min),
+                            graphene_simd4f_get_x (max) - graphene_simd4f_get_x (min),
+                            graphene_simd4f_get_y (max) - graphene_simd4f_get_y (min));
+      }
+      break;
+
+    case GRAPHENE_TRANSFORM_CATEGORY_PROJECTIVE:
+    default:
+      graphene_matrix_transform_bounds (&t->matrix, &rr, res);
+      break;
+    }
+}
+
+/**
+ * graphene_transform_transform_box:
+ * @t: a #graphene_transform_t
+ * @b: a #graphene_box_t
+ * @res: (out caller-allocates): return location for the bounds
+ *   of the transformed box
+ *
+ * Transforms a #graphene_box_t, and computes the axis aligned
+ * box containing the result, like graphene_matrix_transform_box().
+ *
+ * Since: 1.12
+ */
+void
+graphene_transform_transform_box (const graphene_transform_t *t,
+                                  const graphene_box_t       *b,
+                                  graphene_box_t             *res)
+{
+  const graphene_simd4x4f_t *m = &t->matrix.value;
+
+  switch (t->category)
+    {
+    case GRAPHENE_TRANSFORM_CATEGORY_IDENTITY:
+      graphene_box_init_from_box (res, b);
+      break;
+
+    case GRAPHENE_TRANSFORM_CATEGORY_TRANSLATE:
+      {
+        const graphene_simd4f_t w_axis = graphene_simd4f_init (0.f, 0.f, 0.f, 1.f);
+        graphene_simd4f_t offset = graphene_simd4f_sub (m->w, w_axis);
+
+        res->min.value = graphene_simd4f_add (b->min.value, offset);
+        res->max.value = graphene_simd4f_add (b->max.value, offset);
+      }
+      break;
+
+    case GRAPHENE_TRANSFORM_CATEGORY_SCALE:
+      {
+        float scale[3], offset[3];
+        float vmin[3], vmax[3];
+        float rmin[3], rmax[3];
+
+        scale[0] = graphene_simd4f_get_x (m->x);
+        scale[1] = graphene_simd4f_get_y (m->y);
+        scale[2] = graphene_simd4f_get_z (m->z);
+        graphene_simd4f_dup_3f (m->w, offset);
+        graphene_simd4f_dup_3f (b->min.value, vmin);
+        graphene_simd4f_dup_3f (b->max.value, vmax);
+
+        /* Swapping the extremes on a negative scale keeps empty boxes
+         * empty, instead of turning them into infinite ones
+         */
+        for (int i = 0; i < 3; i++)
+          {
+            if (scale[i] < 0.f)
+              {
+                rmin[i] = vmax[i] * scale[i] + offset[i];
+                rmax[i] = vmin[i] * scale[i] + offset[i];
+              }
+            else
+              {
+                rmin[i] = vmin[i] * scale[i] + offset[i];
+                rmax[i] = vmax[i] * scale[i] + offset[i];
+              }
+          }
+
+        res->min.value = graphene_simd4f_init (rmin[0], rmin[1], rmin[2], 0.f);
+        res->max.value = graphene_simd4f_init (rmax[0], rmax[1], rmax[2], 0.f);
+      }
+      break;
+
+    case GRAPHENE_TRANSFORM_CATEGORY_AFFINE_2D:
+    case GRAPHENE_TRANSFORM_CATEGORY_AFFINE_3D:
+    case GRAPHENE_TRANSFORM_CATEGORY_PROJECTIVE:
+    default:
+      graphene_matrix_transform_box (&t->matrix, b, res);
+      break;
+    }
+}
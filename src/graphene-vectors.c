@@ -26,6 +26,7 @@
 #include "graphene-private.h"
 #include "graphene-vectors-private.h"
 #include "graphene-alloc-private.h"
+#include "graphene-kernels-private.h"
 
 #include <stdio.h>
 
@@ -937,10 +938,7 @@ void
 graphene_vec3_normalize (const graphene_vec3_t *v,
                          graphene_vec3_t       *res)
 {
-  if (fabsf (graphene_vec3_length (v)) > FLT_EPSILON)
-    res->value = graphene_simd4f_normalize3 (v->value);
-  else
-    res->value = graphene_simd4f_init_zero ();
+  graphene_get_kernels ()->vec3_normalize (&v->value, &res->value);
 }
 
 /**
@@ -1709,10 +1707,7 @@ void
 graphene_vec4_normalize (const graphene_vec4_t *v,
                          graphene_vec4_t       *res)
 {
-  if (fabsf (graphene_vec4_length (v)) > FLT_EPSILON)
-    res->value = graphene_simd4f_normalize4 (v->value);
-  else
-    res->value = graphene_simd4f_init_zero ();
+  graphene_get_kernels ()->vec4_normalize (&v->value, &res->value);
 }
 
 /**
@@ -0,0 +1,222 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include <math.h>
+#include <graphene.h>
+#include <mutest.h>
+
+static bool
+matrix_near_affine2d (const graphene_matrix_t   *m,
+                      const graphene_affine2d_t *a,
+                      float                      epsilon)
+{
+  graphene_matrix_t am;
+
+  graphene_affine2d_to_matrix (a, &am);
+
+  return graphene_matrix_near (m, &am, epsilon);
+}
+
+static void
+affine2d_init (mutest_spec_t *spec)
+{
+  graphene_affine2d_t a, b;
+  graphene_matrix_t m;
+  float v[6];
+
+  graphene_affine2d_init (&a, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f);
+  graphene_affine2d_to_float (&a, v);
+  for (int i = 0; i < 6; i++)
+    mutest_expect ("init() to store the values in order",
+                   mutest_float_value (v[i]),
+                   mutest_to_be_close_to, (double) i + 1.0, 0.00001,
+                   NULL);
+
+  graphene_affine2d_to_matrix (&a, &m);
+  mutest_expect ("to_matrix() to use the layout of graphene_matrix_init_from_2d()",
+                 mutest_float_value (graphene_matrix_get_value (&m, 1, 0)),
+                 mutest_to_be_close_to, 3.0, 0.00001,
+                 NULL);
+  mutest_expect ("to_matrix() to store the translation in the last row",
+                 mutest_float_value (graphene_matrix_get_value (&m, 3, 1)),
+                 mutest_to_be_close_to, 6.0, 0.00001,
+                 NULL);
+
+  mutest_expect ("init_from_matrix() to accept 2D matrices",
+                 mutest_bool_value (graphene_affine2d_init_from_matrix (&b, &m)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("init_from_matrix() to round trip",
+                 mutest_bool_value (graphene_affine2d_near (&a, &b, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_init_rotate (&m, 30.f, graphene_vec3_x_axis ());
+  mutest_expect ("init_from_matrix() to reject 3D matrices",
+                 mutest_bool_value (graphene_affine2d_init_from_matrix (&b, &m)),
+                 mutest_to_be_false,
+                 NULL);
+  mutest_expect ("init_from_matrix() to set the identity on failure",
+                 mutest_bool_value (graphene_affine2d_is_identity (&b)),
+                 mutest_to_be_true,
+                 NULL);
+}
+
+static void
+affine2d_operations (mutest_spec_t *spec)
+{
+  graphene_affine2d_t a, b, c;
+  graphene_matrix_t m, n;
+
+  graphene_affine2d_init_scale (&a, 2.f, 3.f);
+  graphene_affine2d_rotate (&a, 30.f);
+  graphene_affine2d_translate (&a, &GRAPHENE_POINT_INIT (10.f, -5.f));
+  graphene_affine2d_scale (&a, 0.5f, -1.f);
+
+  graphene_matrix_init_scale (&m, 2.f, 3.f, 1.f);
+  graphene_matrix_rotate (&m, 30.f, graphene_vec3_z_axis ());
+  graphene_matrix_translate (&m, &GRAPHENE_POINT3D_INIT (10.f, -5.f, 0.f));
+  graphene_matrix_scale (&m, 0.5f, -1.f, 1.f);
+
+  mutest_expect ("scale(), rotate(), and translate() to match the matrix operations",
+                 mutest_bool_value (matrix_near_affine2d (&m, &a, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_affine2d_init_rotate (&b, -45.f);
+  graphene_affine2d_translate (&b, &GRAPHENE_POINT_INIT (1.f, 2.f));
+  graphene_affine2d_multiply (&a, &b, &c);
+
+  graphene_affine2d_to_matrix (&b, &n);
+  graphene_matrix_multiply (&m, &n, &m);
+  mutest_expect ("multiply() to match graphene_matrix_multiply()",
+                 mutest_bool_value (matrix_near_affine2d (&m, &c, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  mutest_expect ("inverse() to succeed on invertible transformations",
+                 mutest_bool_value (graphene_affine2d_inverse (&c, &b)),
+                 mutest_to_be_true,
+                 NULL);
+  graphene_affine2d_multiply (&c, &b, &b);
+  graphene_affine2d_init_identity (&a);
+  mutest_expect ("inverse() to return the inverse transformation",
+                 mutest_bool_value (graphene_affine2d_near (&a, &b, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_affine2d_init_scale (&a, 0.f, 1.f);
+  mutest_expect ("inverse() to fail on degenerate transformations",
+                 mutest_bool_value (graphene_affine2d_inverse (&a, &b)),
+                 mutest_to_be_false,
+                 NULL);
+}
+
+static void
+affine2d_interpolate (mutest_spec_t *spec)
+{
+  graphene_affine2d_t a, b, res;
+  graphene_matrix_t ma, mb, mres;
+
+  graphene_affine2d_init_translate (&a, &GRAPHENE_POINT_INIT (10.f, 20.f));
+  graphene_affine2d_init_rotate (&b, 90.f);
+  graphene_affine2d_scale (&b, 2.f, 2.f);
+
+  graphene_affine2d_to_matrix (&a, &ma);
+  graphene_affine2d_to_matrix (&b, &mb);
+
+  graphene_affine2d_interpolate (&a, &b, 0.25, &res);
+  graphene_matrix_interpolate (&ma, &mb, 0.25, &mres);
+  mutest_expect ("interpolate() to match graphene_matrix_interpolate()",
+                 mutest_bool_value (matrix_near_affine2d (&mres, &res, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+}
+
+static void
+affine2d_transform (mutest_spec_t *spec)
+{
+  const graphene_rect_t r = GRAPHENE_RECT_INIT (10.f, 20.f, -30.f, 40.f);
+  graphene_point_t points[5], points_res[5];
+  graphene_rect_t rects[2], rects_res[2];
+  graphene_quad_t quad, matrix_quad;
+  graphene_rect_t bounds;
+  graphene_affine2d_t a;
+  graphene_matrix_t m;
+  bool all_near = true;
+
+  graphene_affine2d_init_rotate (&a, 30.f);
+  graphene_affine2d_scale (&a, 2.f, -0.5f);
+  graphene_affine2d_translate (&a, &GRAPHENE_POINT_INIT (10.f, 20.f));
+  graphene_affine2d_to_matrix (&a, &m);
+
+  for (int i = 0; i < 5; i++)
+    graphene_point_init (&points[i], (float) i * 3.f - 4.f, (float) i * -2.f + 1.f);
+
+  graphene_affine2d_transform_points (&a, 5, points, points_res);
+  for (int i = 0; i < 5; i++)
+    {
+      graphene_point_t p;
+
+      graphene_matrix_transform_point (&m, &points[i], &p);
+      all_near = all_near && graphene_point_near (&p, &points_res[i], 0.0001f);
+
+      graphene_affine2d_transform_point (&a, &points[i], &p);
+      all_near = all_near && graphene_point_near (&p, &points_res[i], 0.0001f);
+    }
+  mutest_expect ("transform_points() to match graphene_matrix_transform_point()",
+                 mutest_bool_value (all_near),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_affine2d_transform_rect (&a, &r, &quad);
+  graphene_matrix_transform_rect (&m, &r, &matrix_quad);
+  all_near = true;
+  for (unsigned int i = 0; i < 4; i++)
+    all_near = all_near && graphene_point_near (graphene_quad_get_point (&quad, i),
+                                                graphene_quad_get_point (&matrix_quad, i),
+                                                0.001f);
+  mutest_expect ("transform_rect() to match graphene_matrix_transform_rect()",
+                 mutest_bool_value (all_near),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_affine2d_transform_quads (&a, 1, &quad, &quad);
+  graphene_matrix_transform_point (&m, graphene_quad_get_point (&matrix_quad, 2), &points[0]);
+  mutest_expect ("transform_quads() to transform each point",
+                 mutest_bool_value (graphene_point_near (graphene_quad_get_point (&quad, 2), &points[0], 0.001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  rects[0] = r;
+  graphene_rect_init (&rects[1], 0.f, 0.f, 1.f, 1.f);
+  graphene_affine2d_transform_bounds_array (&a, 2, rects, rects_res);
+  all_near = true;
+  for (int i = 0; i < 2; i++)
+    {
+      graphene_matrix_transform_bounds (&m, &rects[i], &bounds);
+      all_near = all_near &&
+                 fabsf (bounds.origin.x - rects_res[i].origin.x) < 0.001f &&
+                 fabsf (bounds.origin.y - rects_res[i].origin.y) < 0.001f &&
+                 fabsf (bounds.size.width - rects_res[i].size.width) < 0.001f &&
+                 fabsf (bounds.size.height - rects_res[i].size.height) < 0.001f;
+    }
+  mutest_expect ("transform_bounds_array() to match graphene_matrix_transform_bounds()",
+                 mutest_bool_value (all_near),
+                 mutest_to_be_true,
+                 NULL);
+}
+
+static void
+affine2d_suite (mutest_suite_t *suite)
+{
+  mutest_it ("can be initialized and converted", affine2d_init);
+  mutest_it ("can be composed and inverted", affine2d_operations);
+  mutest_it ("can be interpolated", affine2d_interpolate);
+  mutest_it ("transforms points, rectangles, and quads", affine2d_transform);
+}
+
+MUTEST_MAIN (
+  mutest_describe ("graphene_affine2d_t", affine2d_suite);
+)
@@ -0,0 +1,226 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include <math.h>
+#include <graphene.h>
+#include <mutest.h>
+
+static void
+init_test_transform (graphene_matrix_t   *m,
+                     graphene_affine3d_t *a,
+                     float                angle)
+{
+  graphene_vec3_t axis;
+
+  graphene_vec3_init (&axis, 1.f, 2.f, -0.5f);
+  graphene_vec3_normalize (&axis, &axis);
+
+  graphene_matrix_init_scale (m, 2.f, 0.5f, -1.5f);
+  graphene_matrix_rotate (m, angle, &axis);
+  graphene_matrix_translate (m, &GRAPHENE_POINT3D_INIT (10.f, -20.f, 5.f));
+
+  graphene_affine3d_init_from_matrix (a, m);
+}
+
+static bool
+matrix_near_affine3d (const graphene_matrix_t   *m,
+                      const graphene_affine3d_t *a,
+                      float                      epsilon)
+{
+  graphene_matrix_t am;
+
+  graphene_affine3d_to_matrix (a, &am);
+
+  return graphene_matrix_near (m, &am, epsilon);
+}
+
+static bool
+box_near (const graphene_box_t *a,
+          const graphene_box_t *b,
+          float                 epsilon)
+{
+  graphene_point3d_t pa, pb;
+  bool res;
+
+  graphene_box_get_min (a, &pa);
+  graphene_box_get_min (b, &pb);
+  res = graphene_point3d_near (&pa, &pb, epsilon);
+
+  graphene_box_get_max (a, &pa);
+  graphene_box_get_max (b, &pb);
+
+  return res && graphene_point3d_near (&pa, &pb, epsilon);
+}
+
+static void
+affine3d_init (mutest_spec_t *spec)
+{
+  graphene_affine3d_t a, b;
+  graphene_matrix_t m, n;
+  float v[12];
+
+  init_test_transform (&m, &a, 30.f);
+  mutest_expect ("init_from_matrix() to accept affine matrices",
+                 mutest_bool_value (graphene_affine3d_init_from_matrix (&a, &m)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_affine3d_to_matrix (&a, &n);
+  mutest_expect ("to_matrix() to be lossless",
+                 mutest_bool_value (graphene_matrix_equal_fast (&m, &n)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_affine3d_to_float (&a, v);
+  mutest_expect ("to_float() to store the translation in the last column",
+                 mutest_float_value (v[7]),
+                 mutest_to_be_close_to, -20.0, 0.00001,
+                 NULL);
+
+  graphene_affine3d_init_from_float (&b, v);
+  mutest_expect ("init_from_float() to round trip",
+                 mutest_bool_value (graphene_affine3d_near (&a, &b, 0.00001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_init_perspective (&m, 60.f, 1.f, 1.f, 100.f);
+  mutest_expect ("init_from_matrix() to reject projective matrices",
+                 mutest_bool_value (graphene_affine3d_init_from_matrix (&b, &m)),
+                 mutest_to_be_false,
+                 NULL);
+  mutest_expect ("init_from_matrix() to set the identity on failure",
+                 mutest_bool_value (graphene_affine3d_is_identity (&b)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_init_rotate (&m, 45.f, graphene_vec3_y_axis ());
+  graphene_affine3d_init_rotate (&a, 45.f, graphene_vec3_y_axis ());
+  mutest_expect ("init_rotate() to match graphene_matrix_init_rotate()",
+                 mutest_bool_value (matrix_near_affine3d (&m, &a, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_init_translate (&m, &GRAPHENE_POINT3D_INIT (1.f, 2.f, 3.f));
+  graphene_affine3d_init_translate (&a, &GRAPHENE_POINT3D_INIT (1.f, 2.f, 3.f));
+  mutest_expect ("init_translate() to match graphene_matrix_init_translate()",
+                 mutest_bool_value (matrix_near_affine3d (&m, &a, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_init_scale (&m, 1.f, -2.f, 3.f);
+  graphene_affine3d_init_scale (&a, 1.f, -2.f, 3.f);
+  mutest_expect ("init_scale() to match graphene_matrix_init_scale()",
+                 mutest_bool_value (matrix_near_affine3d (&m, &a, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+}
+
+static void
+affine3d_operations (mutest_spec_t *spec)
+{
+  graphene_affine3d_t a, b, c;
+  graphene_matrix_t ma, mb, mc;
+
+  init_test_transform (&ma, &a, 30.f);
+  init_test_transform (&mb, &b, -75.f);
+
+  graphene_affine3d_multiply (&a, &b, &c);
+  graphene_matrix_multiply (&ma, &mb, &mc);
+  mutest_expect ("multiply() to match graphene_matrix_multiply()",
+                 mutest_bool_value (matrix_near_affine3d (&mc, &c, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  mutest_expect ("inverse() to succeed on invertible transformations",
+                 mutest_bool_value (graphene_affine3d_inverse (&c, &b)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_inverse (&mc, &mb);
+  mutest_expect ("inverse() to match graphene_matrix_inverse()",
+                 mutest_bool_value (matrix_near_affine3d (&mb, &b, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_affine3d_multiply (&c, &b, &b);
+  graphene_affine3d_init_identity (&a);
+  mutest_expect ("inverse() to return the inverse transformation",
+                 mutest_bool_value (graphene_affine3d_near (&a, &b, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_affine3d_init_scale (&a, 1.f, 0.f, 1.f);
+  mutest_expect ("inverse() to fail on degenerate transformations",
+                 mutest_bool_value (graphene_affine3d_inverse (&a, &b)),
+                 mutest_to_be_false,
+                 NULL);
+}
+
+static void
+affine3d_transform (mutest_spec_t *spec)
+{
+  graphene_point3d_t points[5], points_res[5];
+  graphene_vec3_t v, v_res, v_matrix;
+  graphene_box_t box, box_res, box_matrix;
+  graphene_affine3d_t a;
+  graphene_matrix_t m;
+  bool all_near = true;
+
+  init_test_transform (&m, &a, 60.f);
+
+  for (int i = 0; i < 5; i++)
+    graphene_point3d_init (&points[i], (float) i * 3.f - 4.f, (float) i * -2.f + 1.f, (float) i);
+
+  graphene_affine3d_transform_points (&a, 5, points, points_res);
+  for (int i = 0; i < 5; i++)
+    {
+      graphene_point3d_t p;
+
+      graphene_matrix_transform_point3d (&m, &points[i], &p);
+      all_near = all_near && graphene_point3d_near (&p, &points_res[i], 0.0001f);
+
+      graphene_affine3d_transform_point (&a, &points[i], &p);
+      all_near = all_near && graphene_point3d_near (&p, &points_res[i], 0.0001f);
+    }
+  mutest_expect ("transform_points() to match graphene_matrix_transform_point3d()",
+                 mutest_bool_value (all_near),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_vec3_init (&v, 1.f, -2.f, 3.f);
+  graphene_affine3d_transform_vec3 (&a, &v, &v_res);
+  graphene_matrix_transform_vec3 (&m, &v, &v_matrix);
+  mutest_expect ("transform_vec3() to match graphene_matrix_transform_vec3()",
+                 mutest_bool_value (graphene_vec3_near (&v_res, &v_matrix, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_box_init (&box,
+                     &GRAPHENE_POINT3D_INIT (-1.f, 2.f, -3.f),
+                     &GRAPHENE_POINT3D_INIT (4.f, 5.f, 6.f));
+  graphene_affine3d_transform_box (&a, &box, &box_res);
+  graphene_matrix_transform_box (&m, &box, &box_matrix);
+  mutest_expect ("transform_box() to match graphene_matrix_transform_box()",
+                 mutest_bool_value (box_near (&box_res, &box_matrix, 0.001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_affine3d_transform_box (&a, graphene_box_empty (), &box_res);
+  mutest_expect ("transform_box() to keep empty boxes empty",
+                 mutest_bool_value (graphene_box_equal (&box_res, graphene_box_empty ())),
+                 mutest_to_be_true,
+                 NULL);
+}
+
+static void
+affine3d_suite (mutest_suite_t *suite)
+{
+  mutest_it ("can be initialized and converted", affine3d_init);
+  mutest_it ("can be composed and inverted", affine3d_operations);
+  mutest_it ("transforms points, vectors, and boxes", affine3d_transform);
+}
+
+MUTEST_MAIN (
+  mutest_describe ("graphene_affine3d_t", affine3d_suite);
+)
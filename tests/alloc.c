@@ -0,0 +1,208 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <graphene.h>
+#include <mutest.h>
+
+#define N_OBJECTS       1000
+
+static bool
+is_aligned (const void *p)
+{
+  return ((uintptr_t) p % 16) == 0;
+}
+
+static void
+alloc_alignment (void)
+{
+  graphene_point_t *p = graphene_point_alloc ();
+  graphene_rect_t *r = graphene_rect_alloc ();
+  graphene_vec3_t *v = graphene_vec3_alloc ();
+  graphene_matrix_t *m = graphene_matrix_alloc ();
+  graphene_frustum_t *f = graphene_frustum_alloc ();
+
+  mutest_expect ("pooled allocations to be aligned",
+                 mutest_bool_value (is_aligned (p) && is_aligned (r) && is_aligned (v) && is_aligned (m)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("large allocations to be aligned",
+                 mutest_bool_value (is_aligned (f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_frustum_free (f);
+  graphene_matrix_free (m);
+  graphene_vec3_free (v);
+  graphene_rect_free (r);
+  graphene_point_free (p);
+}
+
+static void
+alloc_reuse (void)
+{
+  graphene_vec3_t *v[N_OBJECTS];
+  graphene_alloc_stats_t before, after;
+  graphene_box_t *b;
+
+  graphene_alloc_get_stats (&before);
+
+  for (unsigned int i = 0; i < N_OBJECTS; i++)
+    v[i] = graphene_vec3_alloc ();
+  for (unsigned int i = 0; i < N_OBJECTS; i++)
+    graphene_vec3_free (v[i]);
+
+  graphene_alloc_get_stats (&after);
+
+  mutest_expect ("every allocation to be counted",
+                 mutest_int_value (after.hits + after.misses - before.hits - before.misses),
+                 mutest_to_be, N_OBJECTS,
+                 NULL);
+  mutest_expect ("most allocations to be served by the thread cache",
+                 mutest_bool_value (after.hits - before.hits > after.misses - before.misses),
+                 mutest_to_be_true,
+                 NULL);
+
+  b = graphene_box_alloc ();
+  graphene_box_init (b, &GRAPHENE_POINT3D_INIT (1.f, 2.f, 3.f), &GRAPHENE_POINT3D_INIT (4.f, 5.f, 6.f));
+  graphene_box_free (b);
+
+  b = graphene_box_alloc ();
+  mutest_expect ("recycled blocks to be cleared by alloc0",
+                 mutest_bool_value (graphene_box_equal (b, &(graphene_box_t) { 0 })),
+                 mutest_to_be_true,
+                 NULL);
+  graphene_box_free (b);
+}
+
+static void *
+alloc_thread_func (void *data)
+{
+  graphene_matrix_t **m = data;
+
+  for (unsigned int i = 0; i < N_OBJECTS; i++)
+    {
+      m[i] = graphene_matrix_alloc ();
+      graphene_matrix_init_scale (m[i], (float) i, 1.f, 1.f);
+    }
+
+  return NULL;
+}
+
+static void
+alloc_threads (void)
+{
+  graphene_matrix_t **m = malloc (sizeof (graphene_matrix_t *) * N_OBJECTS);
+  pthread_t thread;
+  bool valid = true;
+
+  /* Allocate on a thread that exits, and free on this one */
+  pthread_create (&thread, NULL, alloc_thread_func, m);
+  pthread_join (thread, NULL);
+
+  for (unsigned int i = 0; i < N_OBJECTS; i++)
+    {
+      if (graphene_matrix_get_x_scale (m[i]) != (float) i)
+        valid = false;
+
+      graphene_matrix_free (m[i]);
+    }
+
+  mutest_expect ("objects allocated by other threads to stay valid",
+                 mutest_bool_value (valid),
+                 mutest_to_be_true,
+                 NULL);
+
+  /* The blocks freed above are recycled on this thread */
+  alloc_thread_func (m);
+  for (unsigned int i = 0; i < N_OBJECTS; i++)
+    graphene_matrix_free (m[i]);
+
+  free (m);
+}
+
+static void
+arena_alloc (void)
+{
+  graphene_arena_t *arena = graphene_arena_new (1024);
+  graphene_matrix_t *m = graphene_arena_new_matrix (arena);
+  graphene_box_t *b = graphene_arena_new_box (arena);
+  void *p16, *p32, *p64, *large;
+  size_t size;
+  bool aligned = true;
+
+  graphene_matrix_init_scale (m, 2.f, 3.f, 4.f);
+  graphene_box_init (b, &GRAPHENE_POINT3D_INIT (1.f, 2.f, 3.f), &GRAPHENE_POINT3D_INIT (4.f, 5.f, 6.f));
+
+  for (unsigned int i = 0; i < 100; i++)
+    {
+      p16 = graphene_arena_alloc (arena, 1 + i % 7, 16);
+      p32 = graphene_arena_alloc (arena, 3, 32);
+      p64 = graphene_arena_alloc (arena, 5, 64);
+
+      if ((uintptr_t) p16 % 16 != 0 || (uintptr_t) p32 % 32 != 0 || (uintptr_t) p64 % 64 != 0)
+        aligned = false;
+    }
+
+  mutest_expect ("arena allocations to honor the alignment",
+                 mutest_bool_value (aligned),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("arena objects to stay valid while allocating more blocks",
+                 mutest_bool_value (graphene_matrix_get_y_scale (m) == 3.f &&
+                                    graphene_box_get_width (b) == 3.f),
+                 mutest_to_be_true,
+                 NULL);
+
+  large = graphene_arena_alloc (arena, 4096, 0);
+  mutest_expect ("allocations larger than a block to succeed",
+                 mutest_bool_value (large != NULL && (uintptr_t) large % 16 == 0),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("invalid alignments to be rejected",
+                 mutest_pointer (graphene_arena_alloc (arena, 16, 24)),
+                 mutest_to_be_null,
+                 NULL);
+
+  graphene_arena_reset (arena);
+  size = graphene_arena_get_size (arena);
+
+  for (unsigned int i = 0; i < 100; i++)
+    {
+      graphene_arena_alloc (arena, 1 + i % 7, 16);
+      graphene_arena_alloc (arena, 3, 32);
+      graphene_arena_alloc (arena, 5, 64);
+    }
+  graphene_arena_alloc (arena, 4096, 0);
+  graphene_arena_reset (arena);
+
+  mutest_expect ("reset to keep enough memory for the same allocations",
+                 mutest_int_value (graphene_arena_get_size (arena)),
+                 mutest_to_be, size,
+                 NULL);
+
+  m = graphene_arena_new_matrix (arena);
+  graphene_arena_reset (arena);
+  mutest_expect ("reset to reuse the memory of the arena",
+                 mutest_bool_value (graphene_arena_new_matrix (arena) == m),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_arena_free (arena);
+}
+
+static void
+alloc_suite (void)
+{
+  mutest_it ("returns aligned memory", alloc_alignment);
+  mutest_it ("reuses freed memory", alloc_reuse);
+  mutest_it ("frees memory allocated by other threads", alloc_threads);
+  mutest_it ("allocates from arenas", arena_alloc);
+}
+
+MUTEST_MAIN (
+  mutest_describe ("graphene_alloc", alloc_suite);
+)
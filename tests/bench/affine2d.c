@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+
+#define N_POINTS        1024
+
+typedef struct {
+  graphene_affine2d_t a;
+  graphene_matrix_t m;
+
+  graphene_point_t points[N_POINTS];
+  graphene_point_t points_res[N_POINTS];
+
+  graphene_rect_t rects[N_POINTS];
+  graphene_rect_t rects_res[N_POINTS];
+} Affine2dBench;
+
+static Affine2dBench affine2d_bench;
+
+static void *
+affine2d_setup (void)
+{
+  Affine2dBench *res = &affine2d_bench;
+
+  graphene_affine2d_init_rotate (&res->a, 30.f);
+  graphene_affine2d_scale (&res->a, 2.f, 0.5f);
+  graphene_affine2d_translate (&res->a, &GRAPHENE_POINT_INIT (10.f, 20.f));
+  graphene_affine2d_to_matrix (&res->a, &res->m);
+
+  for (unsigned int i = 0; i < N_POINTS; i++)
+    {
+      float x = (float) (i % 32);
+      float y = (float) (i / 32);
+
+      graphene_point_init (&res->points[i], x, y);
+      graphene_rect_init (&res->rects[i], x * 10.f, y * 10.f, 8.f + x, 8.f);
+    }
+
+  return res;
+}
+
+static void
+affine2d_transform_point_matrix (void *data)
+{
+  Affine2dBench *bench = data;
+
+  for (unsigned int i = 0; i < N_POINTS; i++)
+    graphene_matrix_transform_point (&bench->m, &bench->points[i], &bench->points_res[i]);
+}
+
+static void
+affine2d_transform_point_loop (void *data)
+{
+  Affine2dBench *bench = data;
+
+  for (unsigned int i = 0; i < N_POINTS; i++)
+    graphene_affine2d_transform_point (&bench->a, &bench->points[i], &bench->points_res[i]);
+}
+
+static void
+affine2d_transform_points (void *data)
+{
+  Affine2dBench *bench = data;
+
+  graphene_affine2d_transform_points (&bench->a, N_POINTS, bench->points, bench->points_res);
+}
+
+static void
+affine2d_transform_bounds_matrix (void *data)
+{
+  Affine2dBench *bench = data;
+
+  graphene_matrix_transform_bounds_array (&bench->m, N_POINTS, bench->rects, bench->rects_res);
+}
+
+static void
+affine2d_transform_bounds_array (void *data)
+{
+  Affine2dBench *bench = data;
+
+  graphene_affine2d_transform_bounds_array (&bench->a, N_POINTS, bench->rects, bench->rects_res);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (affine2d_setup);
+
+  graphene_bench_add_func ("/affine2d/transform-point/matrix", affine2d_transform_point_matrix, N_POINTS);
+  graphene_bench_add_func ("/affine2d/transform-point/loop", affine2d_transform_point_loop, N_POINTS);
+  graphene_bench_add_func ("/affine2d/transform-point/batch", affine2d_transform_points, N_POINTS);
+  graphene_bench_add_func ("/affine2d/transform-bounds/matrix", affine2d_transform_bounds_matrix, N_POINTS);
+  graphene_bench_add_func ("/affine2d/transform-bounds/batch", affine2d_transform_bounds_array, N_POINTS);
+
+  return graphene_bench_run ();
+}
@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+
+#define N_POINTS        1024
+#define N_NODES         64
+
+typedef struct {
+  graphene_affine3d_t a;
+  graphene_matrix_t m;
+
+  graphene_point3d_t points[N_POINTS];
+  graphene_point3d_t points_res[N_POINTS];
+
+  graphene_box_t boxes[N_NODES];
+  graphene_box_t boxes_res[N_NODES];
+
+  graphene_affine3d_t nodes[N_NODES];
+  graphene_affine3d_t nodes_res[N_NODES];
+
+  graphene_matrix_t node_matrices[N_NODES];
+  graphene_matrix_t node_matrices_res[N_NODES];
+} Affine3dBench;
+
+static Affine3dBench affine3d_bench;
+
+static void *
+affine3d_setup (void)
+{
+  Affine3dBench *res = &affine3d_bench;
+
+  graphene_matrix_init_rotate (&res->m, 30.f, graphene_vec3_y_axis ());
+  graphene_matrix_translate (&res->m, &GRAPHENE_POINT3D_INIT (10.f, 20.f, 30.f));
+  graphene_affine3d_init_from_matrix (&res->a, &res->m);
+
+  for (unsigned int i = 0; i < N_POINTS; i++)
+    {
+      float x = (float) (i % 32);
+      float y = (float) (i / 32);
+      float z = (float) i * 0.25f;
+
+      graphene_point3d_init (&res->points[i], x, y, z);
+    }
+
+  for (unsigned int i = 0; i < N_NODES; i++)
+    {
+      float angle = (float) i * 5.f;
+      float f = (float) i;
+
+      graphene_matrix_init_rotate (&res->node_matrices[i], angle, graphene_vec3_z_axis ());
+      graphene_matrix_scale (&res->node_matrices[i], 1.f + f * 0.1f, 1.f, 2.f);
+      graphene_matrix_translate (&res->node_matrices[i], &GRAPHENE_POINT3D_INIT (f, 2.f, -3.f));
+      graphene_affine3d_init_from_matrix (&res->nodes[i], &res->node_matrices[i]);
+
+      graphene_box_init (&res->boxes[i],
+                         &GRAPHENE_POINT3D_INIT (f, -f, 0.f),
+                         &GRAPHENE_POINT3D_INIT (f + 2.f, 1.f, f * 0.5f));
+    }
+
+  return res;
+}
+
+static void
+affine3d_transform_point_matrix (void *data)
+{
+  Affine3dBench *bench = data;
+
+  graphene_matrix_transform_points3d (&bench->m, N_POINTS, bench->points, bench->points_res);
+}
+
+static void
+affine3d_transform_points (void *data)
+{
+  Affine3dBench *bench = data;
+
+  graphene_affine3d_transform_points (&bench->a, N_POINTS, bench->points, bench->points_res);
+}
+
+static void
+affine3d_multiply_matrix (void *data)
+{
+  Affine3dBench *bench = data;
+
+  for (unsigned int i = 0; i < N_NODES; i++)
+    graphene_matrix_multiply (&bench->node_matrices[i], &bench->m, &bench->node_matrices_res[i]);
+}
+
+static void
+affine3d_multiply (void *data)
+{
+  Affine3dBench *bench = data;
+
+  for (unsigned int i = 0; i < N_NODES; i++)
+    graphene_affine3d_multiply (&bench->nodes[i], &bench->a, &bench->nodes_res[i]);
+}
+
+static void
+affine3d_inverse_matrix (void *data)
+{
+  Affine3dBench *bench = data;
+
+  for (unsigned int i = 0; i < N_NODES; i++)
+    graphene_matrix_inverse (&bench->node_matrices[i], &bench->node_matrices_res[i]);
+}
+
+static void
+affine3d_inverse (void *data)
+{
+  Affine3dBench *bench = data;
+
+  for (unsigned int i = 0; i < N_NODES; i++)
+    graphene_affine3d_inverse (&bench->nodes[i], &bench->nodes_res[i]);
+}
+
+static void
+affine3d_transform_box_matrix (void *data)
+{
+  Affine3dBench *bench = data;
+
+  for (unsigned int i = 0; i < N_NODES; i++)
+    graphene_matrix_transform_box (&bench->node_matrices[i], &bench->boxes[i], &bench->boxes_res[i]);
+}
+
+static void
+affine3d_transform_box (void *data)
+{
+  Affine3dBench *bench = data;
+
+  for (unsigned int i = 0; i < N_NODES; i++)
+    graphene_affine3d_transform_box (&bench->nodes[i], &bench->boxes[i], &bench->boxes_res[i]);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (affine3d_setup);
+
+  graphene_bench_add_func ("/affine3d/transform-point/matrix", affine3d_transform_point_matrix, N_POINTS);
+  graphene_bench_add_func ("/affine3d/transform-point/batch", affine3d_transform_points, N_POINTS);
+  graphene_bench_add_func ("/affine3d/multiply/matrix", affine3d_multiply_matrix, N_NODES);
+  graphene_bench_add_func ("/affine3d/multiply", affine3d_multiply, N_NODES);
+  graphene_bench_add_func ("/affine3d/inverse/matrix", affine3d_inverse_matrix, N_NODES);
+  graphene_bench_add_func ("/affine3d/inverse", affine3d_inverse, N_NODES);
+  graphene_bench_add_func ("/affine3d/transform-box/matrix", affine3d_transform_box_matrix, N_NODES);
+  graphene_bench_add_func ("/affine3d/transform-box", affine3d_transform_box, N_NODES);
+
+  return graphene_bench_run ();
+}
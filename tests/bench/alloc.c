@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#define N_THREADS       4
+#define N_OBJECTS       256
+#define N_ROUNDS        64
+
+#define N_OPS           (N_OBJECTS * N_ROUNDS)
+
+typedef struct {
+  void *objects[N_THREADS][N_OBJECTS];
+
+  graphene_arena_t *arena;
+} AllocBench;
+
+static AllocBench alloc_bench;
+
+static void *
+alloc_setup (void)
+{
+  AllocBench *res = &alloc_bench;
+
+  if (res->arena == NULL)
+    res->arena = graphene_arena_new (0);
+
+  return res;
+}
+
+/* Allocates and frees a mix of types, in batches */
+static void
+churn (void **objects)
+{
+  for (unsigned int r = 0; r < N_ROUNDS; r++)
+    {
+      for (unsigned int i = 0; i < N_OBJECTS; i += 4)
+        {
+          objects[i + 0] = graphene_vec3_alloc ();
+          objects[i + 1] = graphene_matrix_alloc ();
+          objects[i + 2] = graphene_box_alloc ();
+          objects[i + 3] = graphene_quaternion_alloc ();
+        }
+
+      for (unsigned int i = 0; i < N_OBJECTS; i += 4)
+        {
+          graphene_vec3_free (objects[i + 0]);
+          graphene_matrix_free (objects[i + 1]);
+          graphene_box_free (objects[i + 2]);
+          graphene_quaternion_free (objects[i + 3]);
+        }
+    }
+}
+
+static void
+alloc_churn (void *data)
+{
+  AllocBench *bench = data;
+
+  churn (bench->objects[0]);
+}
+
+/* The same allocations as churn(), from an arena */
+static void
+alloc_arena (void *data)
+{
+  AllocBench *bench = data;
+  void **objects = bench->objects[0];
+
+  for (unsigned int r = 0; r < N_ROUNDS; r++)
+    {
+      for (unsigned int i = 0; i < N_OBJECTS; i += 4)
+        {
+          objects[i + 0] = graphene_arena_new_vec3 (bench->arena);
+          objects[i + 1] = graphene_arena_new_matrix (bench->arena);
+          objects[i + 2] = graphene_arena_new_box (bench->arena);
+          objects[i + 3] = graphene_arena_new_quaternion (bench->arena);
+        }
+
+      graphene_arena_reset (bench->arena);
+    }
+}
+
+static void *
+churn_thread (void *data)
+{
+  churn (data);
+
+  return NULL;
+}
+
+static void
+alloc_churn_threads (void *data)
+{
+  AllocBench *bench = data;
+  pthread_t threads[N_THREADS];
+
+  for (unsigned int i = 0; i < N_THREADS; i++)
+    pthread_create (&threads[i], NULL, churn_thread, bench->objects[i]);
+
+  for (unsigned int i = 0; i < N_THREADS; i++)
+    pthread_join (threads[i], NULL);
+}
+
+/* Allocates on one thread, and frees on another, like values passed
+ * between a producer and a consumer
+ */
+static void *
+produce_thread (void *data)
+{
+  void **objects = data;
+
+  for (unsigned int i = 0; i < N_OBJECTS; i++)
+    objects[i] = graphene_matrix_alloc ();
+
+  return NULL;
+}
+
+static void *
+consume_thread (void *data)
+{
+  void **objects = data;
+
+  for (unsigned int i = 0; i < N_OBJECTS; i++)
+    graphene_matrix_free (objects[i]);
+
+  return NULL;
+}
+
+static void
+alloc_cross_threads (void *data)
+{
+  AllocBench *bench = data;
+  pthread_t producer, consumer;
+
+  for (unsigned int r = 0; r < N_ROUNDS / 8; r++)
+    {
+      pthread_create (&producer, NULL, produce_thread, bench->objects[0]);
+      pthread_join (producer, NULL);
+
+      pthread_create (&consumer, NULL, consume_thread, bench->objects[0]);
+      pthread_join (consumer, NULL);
+    }
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (alloc_setup);
+
+  graphene_bench_add_func ("/alloc/churn", alloc_churn, N_OPS);
+  graphene_bench_add_func ("/alloc/arena", alloc_arena, N_OPS);
+  graphene_bench_add_func ("/alloc/churn-threads", alloc_churn_threads, N_OPS * N_THREADS);
+  graphene_bench_add_func ("/alloc/cross-threads", alloc_cross_threads, N_OBJECTS * (N_ROUNDS / 8));
+
+  return graphene_bench_run ();
+}
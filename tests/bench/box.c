@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+
+#include <stdlib.h>
+
+#define N_POINTS        (256 * 1024)
+
+typedef struct {
+  graphene_point3d_t *points;
+  graphene_vec3_t *vectors;
+  float *coords;
+} BoxBench;
+
+static BoxBench box_bench;
+
+static void *
+box_setup (void)
+{
+  BoxBench *res = &box_bench;
+
+  if (res->points != NULL)
+    return res;
+
+  res->points = malloc (sizeof (graphene_point3d_t) * N_POINTS);
+  res->vectors = malloc (sizeof (graphene_vec3_t) * N_POINTS);
+  res->coords = malloc (sizeof (float) * 3 * N_POINTS);
+
+  for (unsigned int i = 0; i < N_POINTS; i++)
+    {
+      float x = (float) (i % 512) - 256.f;
+      float y = (float) (i % 7);
+      float z = (float) (i / 512) - 256.f;
+
+      graphene_point3d_init (&res->points[i], x, y, z);
+      graphene_vec3_init (&res->vectors[i], x, y, z);
+      res->coords[i * 3 + 0] = x;
+      res->coords[i * 3 + 1] = y;
+      res->coords[i * 3 + 2] = z;
+    }
+
+  /* Measure the kernels, not the thread pool */
+  graphene_parallel_set_n_threads (1);
+
+  return res;
+}
+
+static void
+box_points_loop (void *data)
+{
+  BoxBench *bench = data;
+  graphene_box_t b;
+
+  graphene_box_init_from_box (&b, graphene_box_empty ());
+  for (unsigned int i = 0; i < N_POINTS; i++)
+    graphene_box_expand (&b, &bench->points[i], &b);
+}
+
+static void
+box_points (void *data)
+{
+  BoxBench *bench = data;
+  graphene_box_t b;
+
+  graphene_box_init_from_points (&b, N_POINTS, bench->points);
+}
+
+static void
+box_vectors (void *data)
+{
+  BoxBench *bench = data;
+  graphene_box_t b;
+
+  graphene_box_init_from_vectors (&b, N_POINTS, bench->vectors);
+}
+
+static void
+box_float_array (void *data)
+{
+  BoxBench *bench = data;
+  graphene_box_t b;
+
+  graphene_box_init_from_float_array (&b, N_POINTS, bench->coords);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (box_setup);
+
+  graphene_bench_add_func ("/box/init-from-points/loop", box_points_loop, N_POINTS);
+  graphene_bench_add_func ("/box/init-from-points", box_points, N_POINTS);
+  graphene_bench_add_func ("/box/init-from-vectors", box_vectors, N_POINTS);
+  graphene_bench_add_func ("/box/init-from-float-array", box_float_array, N_POINTS);
+
+  return graphene_bench_run ();
+}
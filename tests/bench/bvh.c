@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+#include "../graphene-test-utils.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/* A 708x708 height field has about a million triangles */
+#define GRID_SIZE       708
+#define N_VERTICES      ((GRID_SIZE + 1) * (GRID_SIZE + 1))
+#define N_INDICES       (GRID_SIZE * GRID_SIZE * 6)
+#define N_RAYS          1024
+
+typedef struct {
+  graphene_point3d_t *vertices;
+  unsigned int *indices;
+
+  graphene_bvh_t *bvh;
+
+  graphene_ray_t rays[N_RAYS];
+  unsigned int n_hits;
+} BvhBench;
+
+/* Static storage, so that the rays are suitably aligned */
+static BvhBench bvh_bench;
+
+static void *
+bvh_setup (void)
+{
+  BvhBench *res = &bvh_bench;
+  unsigned int n_indices = 0;
+
+  /* The mesh is shared by all benchmarks */
+  if (res->bvh != NULL)
+    return res;
+
+  res->vertices = malloc (sizeof (graphene_point3d_t) * N_VERTICES);
+  res->indices = malloc (sizeof (unsigned int) * N_INDICES);
+
+  for (unsigned int z = 0; z <= GRID_SIZE; z++)
+    {
+      for (unsigned int x = 0; x <= GRID_SIZE; x++)
+        {
+          float fx = (float) x - GRID_SIZE / 2.f;
+          float fz = (float) z - GRID_SIZE / 2.f;
+
+          graphene_point3d_init (&res->vertices[z * (GRID_SIZE + 1) + x],
+                                 fx,
+                                 sinf (fx * 0.05f) * cosf (fz * 0.07f) * 20.f,
+                                 fz);
+        }
+    }
+
+  for (unsigned int z = 0; z < GRID_SIZE; z++)
+    {
+      for (unsigned int x = 0; x < GRID_SIZE; x++)
+        {
+          unsigned int v = z * (GRID_SIZE + 1) + x;
+
+          res->indices[n_indices++] = v;
+          res->indices[n_indices++] = v + 1;
+          res->indices[n_indices++] = v + GRID_SIZE + 1;
+          res->indices[n_indices++] = v + 1;
+          res->indices[n_indices++] = v + GRID_SIZE + 2;
+          res->indices[n_indices++] = v + GRID_SIZE + 1;
+        }
+    }
+
+  res->bvh = graphene_bvh_new_from_triangles (N_VERTICES, res->vertices, N_INDICES, res->indices);
+
+  for (unsigned int i = 0; i < N_RAYS; i++)
+    {
+      graphene_vec3_t direction;
+
+      graphene_vec3_init (&direction, random_float (-0.5f, 0.5f), -1.f, random_float (-0.5f, 0.5f));
+      graphene_ray_init (&res->rays[i],
+                         &GRAPHENE_POINT3D_INIT (random_float (-300.f, 300.f),
+                                                 100.f,
+                                                 random_float (-300.f, 300.f)),
+                         &direction);
+    }
+
+  return res;
+}
+
+static void
+bvh_build_triangles (void *data)
+{
+  BvhBench *bench = data;
+
+  graphene_bvh_free (graphene_bvh_new_from_triangles (N_VERTICES, bench->vertices,
+                                                      N_INDICES, bench->indices));
+}
+
+static void
+bvh_intersect_ray (void *data)
+{
+  BvhBench *bench = data;
+
+  for (unsigned int i = 0; i < N_RAYS; i++)
+    {
+      if (graphene_bvh_intersect_ray (bench->bvh, &bench->rays[i], NULL, NULL))
+        bench->n_hits += 1;
+    }
+}
+
+static void
+bvh_intersects_ray (void *data)
+{
+  BvhBench *bench = data;
+
+  for (unsigned int i = 0; i < N_RAYS; i++)
+    {
+      if (graphene_bvh_intersects_ray (bench->bvh, &bench->rays[i], INFINITY))
+        bench->n_hits += 1;
+    }
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (bvh_setup);
+
+  graphene_bench_add_func ("/bvh/triangles/build", bvh_build_triangles, N_INDICES / 3);
+  graphene_bench_add_func ("/bvh/triangles/closest-hit", bvh_intersect_ray, N_RAYS);
+  graphene_bench_add_func ("/bvh/triangles/any-hit", bvh_intersects_ray, N_RAYS);
+
+  return graphene_bench_run ();
+}
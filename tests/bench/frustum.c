@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+
+#define N_OBJECTS       (100 * 1024)
+
+typedef struct {
+  graphene_frustum_t f;
+
+  graphene_point3d_t points[N_OBJECTS];
+  graphene_sphere_t spheres[N_OBJECTS];
+  graphene_box_t boxes[N_OBJECTS];
+
+  uint32_t visible[N_OBJECTS / 32];
+  bool visible_loop[N_OBJECTS];
+} FrustumBench;
+
+/* Static storage, so that the vectors are suitably aligned */
+static FrustumBench frustum_bench;
+
+static void *
+frustum_setup (void)
+{
+  FrustumBench *res = &frustum_bench;
+  graphene_matrix_t m;
+
+  graphene_matrix_init_perspective (&m, 60.f, 1.f, 1.f, 500.f);
+  graphene_frustum_init_from_matrix (&res->f, &m);
+
+  /* Objects on a 64x64 grid, at increasing depths */
+  for (unsigned int i = 0; i < N_OBJECTS; i++)
+    {
+      graphene_point3d_t min, max;
+      float x = ((float) (i % 64) - 32.f) * 10.f;
+      float y = ((float) ((i / 64) % 64) - 32.f) * 10.f;
+      float z = -((float) (i / 4096)) * 20.f;
+
+      graphene_point3d_init (&res->points[i], x, y, z);
+      graphene_sphere_init (&res->spheres[i], &res->points[i], 4.f);
+      graphene_point3d_init (&min, x - 4.f, y - 4.f, z - 4.f);
+      graphene_point3d_init (&max, x + 4.f, y + 4.f, z + 4.f);
+      graphene_box_init (&res->boxes[i], &min, &max);
+    }
+
+  return res;
+}
+
+static void
+frustum_contains_point_loop (void *data)
+{
+  FrustumBench *bench = data;
+
+  for (unsigned int i = 0; i < N_OBJECTS; i++)
+    bench->visible_loop[i] = graphene_frustum_contains_point (&bench->f, &bench->points[i]);
+}
+
+static void
+frustum_cull_points (void *data)
+{
+  FrustumBench *bench = data;
+
+  graphene_frustum_cull_points (&bench->f, N_OBJECTS, bench->points, bench->visible);
+}
+
+static void
+frustum_intersects_sphere_loop (void *data)
+{
+  FrustumBench *bench = data;
+
+  for (unsigned int i = 0; i < N_OBJECTS; i++)
+    bench->visible_loop[i] = graphene_frustum_intersects_sphere (&bench->f, &bench->spheres[i]);
+}
+
+static void
+frustum_cull_spheres (void *data)
+{
+  FrustumBench *bench = data;
+
+  graphene_frustum_cull_spheres (&bench->f, N_OBJECTS, bench->spheres, bench->visible);
+}
+
+static void
+frustum_intersects_box_loop (void *data)
+{
+  FrustumBench *bench = data;
+
+  for (unsigned int i = 0; i < N_OBJECTS; i++)
+    bench->visible_loop[i] = graphene_frustum_intersects_box (&bench->f, &bench->boxes[i]);
+}
+
+static void
+frustum_cull_boxes (void *data)
+{
+  FrustumBench *bench = data;
+
+  graphene_frustum_cull_boxes (&bench->f, N_OBJECTS, bench->boxes, bench->visible);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (frustum_setup);
+
+  graphene_bench_add_func ("/frustum/points/loop", frustum_contains_point_loop, N_OBJECTS);
+  graphene_bench_add_func ("/frustum/points/cull", frustum_cull_points, N_OBJECTS);
+  graphene_bench_add_func ("/frustum/spheres/loop", frustum_intersects_sphere_loop, N_OBJECTS);
+  graphene_bench_add_func ("/frustum/spheres/cull", frustum_cull_spheres, N_OBJECTS);
+  graphene_bench_add_func ("/frustum/boxes/loop", frustum_intersects_box_loop, N_OBJECTS);
+  graphene_bench_add_func ("/frustum/boxes/cull", frustum_cull_boxes, N_OBJECTS);
+
+  return graphene_bench_run ();
+}
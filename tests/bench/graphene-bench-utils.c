@@ -0,0 +1,290 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+# define WIN32_LEAN_AND_MEAN
+# include <windows.h>
+#endif
+
+#define MAX_BENCHMARKS  64
+
+/* Minimum wall clock time spent inside each benchmark, in seconds */
+#define DEFAULT_DURATION        0.25
+
+/* Number of timed rounds; we keep the fastest one */
+#define N_ROUNDS        5
+
+typedef enum {
+  BENCH_FORMAT_TEXT,
+  BENCH_FORMAT_JSON
+} bench_format_t;
+
+typedef struct {
+  const char *path;
+  graphene_bench_func_t func;
+  unsigned int n_ops;
+
+  /* Result of the run, or a negative value if skipped */
+  double ns_per_op;
+} bench_entry_t;
+
+static bench_entry_t benchmarks[MAX_BENCHMARKS];
+static unsigned int n_benchmarks;
+
+static graphene_bench_setup_func_t fixture_setup;
+static graphene_bench_teardown_func_t fixture_teardown;
+
+static const char *bench_filter;
+static double bench_duration = DEFAULT_DURATION;
+static bench_format_t bench_format = BENCH_FORMAT_TEXT;
+static const char *bench_output;
+
+static const char *
+bench_get_simd_backend (void)
+{
+#if defined(GRAPHENE_USE_SSE)
+  return "sse";
+#elif defined(GRAPHENE_USE_ARM_NEON)
+  return "neon";
+#elif defined(GRAPHENE_USE_GCC)
+  return "gcc";
+#else
+  return "scalar";
+#endif
+}
+
+static double
+bench_get_time (void)
+{
+#ifdef _WIN32
+  static LARGE_INTEGER freq;
+  LARGE_INTEGER now;
+
+  if (freq.QuadPart == 0)
+    QueryPerformanceFrequency (&freq);
+
+  QueryPerformanceCounter (&now);
+
+  return (double) now.QuadPart / (double) freq.QuadPart;
+#else
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+
+  return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+#endif
+}
+
+void
+graphene_bench_init (int    *argc_p,
+                     char ***argv_p)
+{
+  int argc = *argc_p;
+  char **argv = *argv_p;
+
+  for (int i = 1; i < argc; i++)
+    {
+      const char *arg = argv[i];
+
+      if (strncmp (arg, "--duration=", 11) == 0)
+        {
+          bench_duration = strtod (arg + 11, NULL);
+          if (bench_duration <= 0.0)
+            bench_duration = DEFAULT_DURATION;
+        }
+      else if (strcmp (arg, "--format=json") == 0)
+        bench_format = BENCH_FORMAT_JSON;
+      else if (strcmp (arg, "--format=text") == 0)
+        bench_format = BENCH_FORMAT_TEXT;
+      else if (strncmp (arg, "--output=", 9) == 0)
+        bench_output = arg + 9;
+      else if (strcmp (arg, "--help") == 0 || strcmp (arg, "-h") == 0)
+        {
+          printf ("Usage: %s [--duration=SECONDS] [--format=text|json] [--output=FILE] [PATH-PREFIX]\n",
+                  argv[0]);
+          exit (EXIT_SUCCESS);
+        }
+      else if (arg[0] != '-')
+        bench_filter = arg;
+    }
+}
+
+void
+graphene_bench_set_fixture_setup (graphene_bench_setup_func_t func)
+{
+  fixture_setup = func;
+}
+
+void
+graphene_bench_set_fixture_teardown (graphene_bench_teardown_func_t func)
+{
+  fixture_teardown = func;
+}
+
+void
+graphene_bench_add_func (const char            *path,
+                         graphene_bench_func_t  func,
+                         unsigned int           n_ops)
+{
+  if (n_benchmarks == MAX_BENCHMARKS)
+    {
+      fprintf (stderr, "Too many benchmarks; ignoring '%s'\n", path);
+      return;
+    }
+
+  benchmarks[n_benchmarks].path = path;
+  benchmarks[n_benchmarks].func = func;
+  benchmarks[n_benchmarks].n_ops = n_ops > 0 ? n_ops : 1;
+  benchmarks[n_benchmarks].ns_per_op = -1.0;
+  n_benchmarks += 1;
+}
+
+static double
+bench_run_one (const bench_entry_t *entry,
+               void                *fixture)
+{
+  unsigned long n_iterations = 1;
+  double best = -1.0;
+
+  /* Warm up, and find how many iterations fill a round */
+  for (;;)
+    {
+      double start = bench_get_time ();
+
+      for (unsigned long i = 0; i < n_iterations; i++)
+        entry->func (fixture);
+
+      double elapsed = bench_get_time () - start;
+
+      if (elapsed >= bench_duration / N_ROUNDS)
+        break;
+
+      n_iterations *= 2;
+    }
+
+  for (int round = 0; round < N_ROUNDS; round++)
+    {
+      double start = bench_get_time ();
+
+      for (unsigned long i = 0; i < n_iterations; i++)
+        entry->func (fixture);
+
+      double elapsed = bench_get_time () - start;
+      double ns_per_op = elapsed * 1e9 / ((double) n_iterations * entry->n_ops);
+
+      if (best < 0.0 || ns_per_op < best)
+        best = ns_per_op;
+    }
+
+  return best;
+}
+
+static void
+bench_print_text (FILE *out)
+{
+  fprintf (out, "# graphene %d.%d.%d, SIMD backend: %s, kernels: %s\n",
+           GRAPHENE_MAJOR_VERSION,
+           GRAPHENE_MINOR_VERSION,
+           GRAPHENE_MICRO_VERSION,
+           bench_get_simd_backend (),
+           graphene_simd_get_active_backend ());
+
+  for (unsigned int i = 0; i < n_benchmarks; i++)
+    {
+      const bench_entry_t *entry = &benchmarks[i];
+
+      if (entry->ns_per_op < 0.0)
+        continue;
+
+      fprintf (out, "%-48s %12.3f ns/op %16.0f ops/s\n",
+               entry->path,
+               entry->ns_per_op,
+               entry->ns_per_op > 0.0 ? 1e9 / entry->ns_per_op : 0.0);
+    }
+}
+
+/* The paths are plain ASCII, so there is nothing to escape */
+static void
+bench_print_json (FILE *out)
+{
+  bool first = true;
+
+  fprintf (out, "{\n");
+  fprintf (out, "  \"version\": \"%d.%d.%d\",\n",
+           GRAPHENE_MAJOR_VERSION,
+           GRAPHENE_MINOR_VERSION,
+           GRAPHENE_MICRO_VERSION);
+  fprintf (out, "  \"simd_backend\": \"%s\",\n", bench_get_simd_backend ());
+  fprintf (out, "  \"kernels\": \"%s\",\n", graphene_simd_get_active_backend ());
+  fprintf (out, "  \"benchmarks\": [");
+
+  for (unsigned int i = 0; i < n_benchmarks; i++)
+    {
+      const bench_entry_t *entry = &benchmarks[i];
+
+      if (entry->ns_per_op < 0.0)
+        continue;
+
+      fprintf (out, "%s\n    { \"path\": \"%s\", \"ns_per_op\": %.3f, \"ops_per_sec\": %.0f }",
+               first ? "" : ",",
+               entry->path,
+               entry->ns_per_op,
+               entry->ns_per_op > 0.0 ? 1e9 / entry->ns_per_op : 0.0);
+
+      first = false;
+    }
+
+  fprintf (out, "\n  ]\n}\n");
+}
+
+int
+graphene_bench_run (void)
+{
+  FILE *out = stdout;
+
+  for (unsigned int i = 0; i < n_benchmarks; i++)
+    {
+      bench_entry_t *entry = &benchmarks[i];
+      void *fixture = NULL;
+
+      if (bench_filter != NULL &&
+          strncmp (entry->path, bench_filter, strlen (bench_filter)) != 0)
+        continue;
+
+      if (fixture_setup != NULL)
+        fixture = fixture_setup ();
+
+      entry->ns_per_op = bench_run_one (entry, fixture);
+
+      if (fixture_teardown != NULL)
+        fixture_teardown (fixture);
+    }
+
+  if (bench_output != NULL)
+    {
+      out = fopen (bench_output, "w");
+      if (out == NULL)
+        {
+          fprintf (stderr, "Unable to open '%s' for writing\n", bench_output);
+          return EXIT_FAILURE;
+        }
+    }
+
+  if (bench_format == BENCH_FORMAT_JSON)
+    bench_print_json (out);
+  else
+    bench_print_text (out);
+
+  if (out != stdout)
+    fclose (out);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <graphene.h>
+
+GRAPHENE_BEGIN_DECLS
+
+typedef void *(* graphene_bench_setup_func_t) (void);
+typedef void (* graphene_bench_teardown_func_t) (void *fixture);
+typedef void (* graphene_bench_func_t) (void *fixture);
+
+void    graphene_bench_init                     (int                             *argc_p,
+                                                 char                          ***argv_p);
+
+void    graphene_bench_set_fixture_setup        (graphene_bench_setup_func_t      func);
+void    graphene_bench_set_fixture_teardown     (graphene_bench_teardown_func_t   func);
+
+void    graphene_bench_add_func                 (const char                      *path,
+                                                 graphene_bench_func_t            func,
+                                                 unsigned int                     n_ops);
+
+int     graphene_bench_run                      (void);
+
+GRAPHENE_END_DECLS
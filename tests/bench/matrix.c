@@ -0,0 +1,329 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+
+#define N_POINTS        1024
+#define N_MATRICES      64
+
+typedef struct {
+  graphene_matrix_t m;
+  graphene_matrix_t m2d;
+
+  graphene_point3d_t points[N_POINTS];
+  graphene_point3d_t points_res[N_POINTS];
+
+  graphene_vec3_t vec3s[N_POINTS];
+  graphene_vec3_t vec3s_res[N_POINTS];
+
+  graphene_vec4_t vec4s[N_POINTS];
+  graphene_vec4_t vec4s_res[N_POINTS];
+
+  graphene_rect_t rects[N_POINTS];
+  graphene_rect_t rects_res[N_POINTS];
+
+  graphene_box_t boxes[N_POINTS];
+  graphene_box_t boxes_res[N_POINTS];
+
+  graphene_matrix_t matrices[N_MATRICES];
+  graphene_matrix_t matrices_res[N_MATRICES];
+
+  graphene_matrix_t rigid[N_MATRICES];
+  graphene_matrix_t projective[N_MATRICES];
+
+  graphene_vec3_t translations[N_MATRICES];
+  graphene_quaternion_t rotations[N_MATRICES];
+  graphene_vec3_t scales[N_MATRICES];
+} MatrixBench;
+
+/* Static storage, so that the vectors are suitably aligned */
+static MatrixBench matrix_bench;
+
+static void *
+matrix_setup (void)
+{
+  MatrixBench *res = &matrix_bench;
+
+  graphene_matrix_init_rotate (&res->m, 30.f, graphene_vec3_y_axis ());
+  graphene_matrix_translate (&res->m, &GRAPHENE_POINT3D_INIT (10.f, 20.f, 30.f));
+
+  graphene_matrix_init_scale (&res->m2d, 2.f, 2.f, 1.f);
+  graphene_matrix_translate (&res->m2d, &GRAPHENE_POINT3D_INIT (10.f, 20.f, 0.f));
+
+  for (unsigned int i = 0; i < N_POINTS; i++)
+    {
+      float x = (float) (i % 32);
+      float y = (float) (i / 32);
+      float z = (float) i * 0.25f;
+
+      graphene_point3d_init (&res->points[i], x, y, z);
+      graphene_vec3_init (&res->vec3s[i], x, y, z);
+      graphene_vec4_init (&res->vec4s[i], x, y, z, 1.f);
+      graphene_rect_init (&res->rects[i], x * 10.f, y * 10.f, 8.f + z, 8.f);
+      graphene_box_init (&res->boxes[i],
+                         &res->points[i],
+                         &GRAPHENE_POINT3D_INIT (x + 8.f, y + 4.f, z + 2.f));
+    }
+
+  for (unsigned int i = 0; i < N_MATRICES; i++)
+    {
+      float angle = (float) i * 5.f;
+      float scale = 1.f + (float) (i % 4) * 0.5f;
+
+      graphene_matrix_init_scale (&res->matrices[i], scale, scale, 1.f);
+      graphene_matrix_rotate (&res->matrices[i], angle, graphene_vec3_z_axis ());
+      graphene_matrix_rotate (&res->matrices[i], angle * 0.5f, graphene_vec3_x_axis ());
+      graphene_matrix_translate (&res->matrices[i], &GRAPHENE_POINT3D_INIT ((float) i, 2.f, -3.f));
+
+      graphene_matrix_init_rotate (&res->rigid[i], angle, graphene_vec3_y_axis ());
+      graphene_matrix_translate (&res->rigid[i], &GRAPHENE_POINT3D_INIT ((float) i, 2.f, -3.f));
+
+      /* The last column is not (0, 0, 0, 1), so the generic path is used */
+      graphene_matrix_perspective (&res->matrices[i], 100.f + (float) i, &res->projective[i]);
+
+      graphene_vec3_init (&res->translations[i], (float) i, 2.f, -3.f);
+      graphene_quaternion_init_from_angles (&res->rotations[i], angle * 0.5f, 0.f, angle);
+      graphene_vec3_init (&res->scales[i], scale, scale, 1.f);
+    }
+
+  return res;
+}
+
+static void
+matrix_transform_point3d_loop (void *data)
+{
+  MatrixBench *bench = data;
+
+  for (unsigned int i = 0; i < N_POINTS; i++)
+    graphene_matrix_transform_point3d (&bench->m, &bench->points[i], &bench->points_res[i]);
+}
+
+static void
+matrix_transform_points3d (void *data)
+{
+  MatrixBench *bench = data;
+
+  graphene_matrix_transform_points3d (&bench->m, N_POINTS, bench->points, bench->points_res);
+}
+
+static void
+matrix_transform_vec3_loop (void *data)
+{
+  MatrixBench *bench = data;
+
+  for (unsigned int i = 0; i < N_POINTS; i++)
+    graphene_matrix_transform_vec3 (&bench->m, &bench->vec3s[i], &bench->vec3s_res[i]);
+}
+
+static void
+matrix_transform_vec3_array (void *data)
+{
+  MatrixBench *bench = data;
+
+  graphene_matrix_transform_vec3_array (&bench->m, N_POINTS, bench->vec3s, bench->vec3s_res);
+}
+
+static void
+matrix_transform_vec4_loop (void *data)
+{
+  MatrixBench *bench = data;
+
+  for (unsigned int i = 0; i < N_POINTS; i++)
+    graphene_matrix_transform_vec4 (&bench->m, &bench->vec4s[i], &bench->vec4s_res[i]);
+}
+
+static void
+matrix_transform_vec4_array (void *data)
+{
+  MatrixBench *bench = data;
+
+  graphene_matrix_transform_vec4_array (&bench->m, N_POINTS, bench->vec4s, bench->vec4s_res);
+}
+
+static void
+matrix_transform_bounds_loop (void *data)
+{
+  MatrixBench *bench = data;
+
+  for (unsigned int i = 0; i < N_POINTS; i++)
+    graphene_matrix_transform_bounds (&bench->m, &bench->rects[i], &bench->rects_res[i]);
+}
+
+static void
+matrix_transform_bounds_array (void *data)
+{
+  MatrixBench *bench = data;
+
+  graphene_matrix_transform_bounds_array (&bench->m, N_POINTS, bench->rects, bench->rects_res);
+}
+
+static void
+matrix_transform_bounds_2d_loop (void *data)
+{
+  MatrixBench *bench = data;
+
+  for (unsigned int i = 0; i < N_POINTS; i++)
+    graphene_matrix_transform_bounds (&bench->m2d, &bench->rects[i], &bench->rects_res[i]);
+}
+
+static void
+matrix_transform_bounds_2d_array (void *data)
+{
+  MatrixBench *bench = data;
+
+  graphene_matrix_transform_bounds_array (&bench->m2d, N_POINTS, bench->rects, bench->rects_res);
+}
+
+static void
+matrix_transform_box_loop (void *data)
+{
+  MatrixBench *bench = data;
+
+  for (unsigned int i = 0; i < N_POINTS; i++)
+    graphene_matrix_transform_box (&bench->m, &bench->boxes[i], &bench->boxes_res[i]);
+}
+
+static void
+matrix_transform_boxes (void *data)
+{
+  MatrixBench *bench = data;
+
+  graphene_matrix_transform_boxes (&bench->m, N_POINTS, bench->boxes, bench->boxes_res);
+}
+
+static void
+matrix_multiply (void *data)
+{
+  MatrixBench *bench = data;
+
+  for (unsigned int i = 0; i < N_MATRICES; i++)
+    graphene_matrix_multiply (&bench->matrices[i], &bench->m, &bench->matrices_res[i]);
+}
+
+static void
+matrix_inverse (void *data)
+{
+  MatrixBench *bench = data;
+
+  for (unsigned int i = 0; i < N_MATRICES; i++)
+    graphene_matrix_inverse (&bench->matrices[i], &bench->matrices_res[i]);
+}
+
+static void
+matrix_inverse_generic (void *data)
+{
+  MatrixBench *bench = data;
+
+  for (unsigned int i = 0; i < N_MATRICES; i++)
+    graphene_matrix_inverse (&bench->projective[i], &bench->matrices_res[i]);
+}
+
+static void
+matrix_inverse_affine (void *data)
+{
+  MatrixBench *bench = data;
+
+  for (unsigned int i = 0; i < N_MATRICES; i++)
+    graphene_matrix_inverse_affine (&bench->matrices[i], &bench->matrices_res[i]);
+}
+
+static void
+matrix_inverse_rigid (void *data)
+{
+  MatrixBench *bench = data;
+
+  for (unsigned int i = 0; i < N_MATRICES; i++)
+    graphene_matrix_inverse_rigid (&bench->rigid[i], &bench->matrices_res[i]);
+}
+
+static void
+matrix_decompose (void *data)
+{
+  MatrixBench *bench = data;
+  graphene_vec3_t translate, scale, shear;
+  graphene_quaternion_t rotate;
+  graphene_vec4_t perspective;
+
+  for (unsigned int i = 0; i < N_MATRICES; i++)
+    graphene_matrix_decompose (&bench->matrices[i], &translate, &scale, &rotate, &shear, &perspective);
+}
+
+static void
+matrix_init_trs_compose (void *data)
+{
+  MatrixBench *bench = data;
+
+  for (unsigned int i = 0; i < N_MATRICES; i++)
+    {
+      graphene_matrix_t *m = &bench->matrices_res[i];
+      const graphene_vec3_t *t = &bench->translations[i];
+      const graphene_vec3_t *s = &bench->scales[i];
+
+      graphene_matrix_init_scale (m, graphene_vec3_get_x (s), graphene_vec3_get_y (s), graphene_vec3_get_z (s));
+      graphene_matrix_rotate_quaternion (m, &bench->rotations[i]);
+      graphene_matrix_translate (m, &GRAPHENE_POINT3D_INIT (graphene_vec3_get_x (t),
+                                                            graphene_vec3_get_y (t),
+                                                            graphene_vec3_get_z (t)));
+    }
+}
+
+static void
+matrix_init_trs_loop (void *data)
+{
+  MatrixBench *bench = data;
+
+  for (unsigned int i = 0; i < N_MATRICES; i++)
+    graphene_matrix_init_trs (&bench->matrices_res[i], &bench->translations[i], &bench->rotations[i], &bench->scales[i]);
+}
+
+static void
+matrix_init_trs_batch (void *data)
+{
+  MatrixBench *bench = data;
+
+  graphene_matrix_init_trs_array (N_MATRICES, bench->translations, bench->rotations, bench->scales, bench->matrices_res);
+}
+
+static void
+matrix_interpolate (void *data)
+{
+  MatrixBench *bench = data;
+
+  for (unsigned int i = 0; i < N_MATRICES; i++)
+    graphene_matrix_interpolate (&bench->m, &bench->matrices[i], 0.25, &bench->matrices_res[i]);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (matrix_setup);
+
+  graphene_bench_add_func ("/matrix/multiply", matrix_multiply, N_MATRICES);
+  graphene_bench_add_func ("/matrix/inverse", matrix_inverse, N_MATRICES);
+  graphene_bench_add_func ("/matrix/inverse/generic", matrix_inverse_generic, N_MATRICES);
+  graphene_bench_add_func ("/matrix/inverse/affine", matrix_inverse_affine, N_MATRICES);
+  graphene_bench_add_func ("/matrix/inverse/rigid", matrix_inverse_rigid, N_MATRICES);
+  graphene_bench_add_func ("/matrix/decompose", matrix_decompose, N_MATRICES);
+  graphene_bench_add_func ("/matrix/interpolate", matrix_interpolate, N_MATRICES);
+  graphene_bench_add_func ("/matrix/init-trs/compose", matrix_init_trs_compose, N_MATRICES);
+  graphene_bench_add_func ("/matrix/init-trs/loop", matrix_init_trs_loop, N_MATRICES);
+  graphene_bench_add_func ("/matrix/init-trs/batch", matrix_init_trs_batch, N_MATRICES);
+  graphene_bench_add_func ("/matrix/transform-point3d/loop", matrix_transform_point3d_loop, N_POINTS);
+  graphene_bench_add_func ("/matrix/transform-point3d/batch", matrix_transform_points3d, N_POINTS);
+  graphene_bench_add_func ("/matrix/transform-vec3/loop", matrix_transform_vec3_loop, N_POINTS);
+  graphene_bench_add_func ("/matrix/transform-vec3/batch", matrix_transform_vec3_array, N_POINTS);
+  graphene_bench_add_func ("/matrix/transform-vec4/loop", matrix_transform_vec4_loop, N_POINTS);
+  graphene_bench_add_func ("/matrix/transform-vec4/batch", matrix_transform_vec4_array, N_POINTS);
+  graphene_bench_add_func ("/matrix/transform-bounds/loop", matrix_transform_bounds_loop, N_POINTS);
+  graphene_bench_add_func ("/matrix/transform-bounds/batch", matrix_transform_bounds_array, N_POINTS);
+  graphene_bench_add_func ("/matrix/transform-bounds-2d/loop", matrix_transform_bounds_2d_loop, N_POINTS);
+  graphene_bench_add_func ("/matrix/transform-bounds-2d/batch", matrix_transform_bounds_2d_array, N_POINTS);
+  graphene_bench_add_func ("/matrix/transform-box/loop", matrix_transform_box_loop, N_POINTS);
+  graphene_bench_add_func ("/matrix/transform-box/batch", matrix_transform_boxes, N_POINTS);
+
+  return graphene_bench_run ();
+}
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+#include "../graphene-test-utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define N_BOXES         (16 * 1024)
+
+typedef struct {
+  graphene_frustum_t f;
+
+  graphene_point3d_t *points;
+  graphene_obb_t *obbs;
+  graphene_box_t *boxes;
+} ObbBench;
+
+static ObbBench obb_bench;
+
+static void *
+obb_setup (void)
+{
+  ObbBench *res = &obb_bench;
+  unsigned int n_obbs = 0, n_boxes = 0;
+  graphene_matrix_t p;
+
+  if (res->obbs != NULL)
+    return res;
+
+  graphene_matrix_init_perspective (&p, 60.f, 1.f, 1.f, 100.f);
+  graphene_frustum_init_from_matrix (&res->f, &p);
+
+  /* Long, thin boxes with random orientations, like the bounds of
+   * rotated objects, spread around the frustum
+   */
+  res->points = malloc (sizeof (graphene_point3d_t) * N_BOXES);
+  res->obbs = malloc (sizeof (graphene_obb_t) * N_BOXES);
+  res->boxes = malloc (sizeof (graphene_box_t) * N_BOXES);
+  for (unsigned int i = 0; i < N_BOXES; i++)
+    {
+      graphene_matrix_t m;
+      graphene_vec3_t axis, half_extents;
+      graphene_obb_t local;
+
+      graphene_vec3_init (&axis, random_float (-1.f, 1.f), random_float (-1.f, 1.f), random_float (-1.f, 1.f));
+      graphene_matrix_init_rotate (&m, random_float (0.f, 360.f), &axis);
+      graphene_matrix_translate (&m, &GRAPHENE_POINT3D_INIT (random_float (-80.f, 80.f),
+                                                             random_float (-80.f, 80.f),
+                                                             random_float (-120.f, 20.f)));
+
+      graphene_vec3_init (&half_extents, 10.f, 1.f, 1.f);
+      graphene_obb_init (&local, NULL, &half_extents, NULL, NULL, NULL);
+      graphene_matrix_transform_obb (&m, &local, &res->obbs[i]);
+      graphene_obb_get_bounding_box (&res->obbs[i], &res->boxes[i]);
+
+      graphene_point3d_init (&res->points[i], random_float (-10.f, 10.f), random_float (-1.f, 1.f), random_float (-1.f, 1.f));
+      graphene_matrix_transform_point3d (&m, &res->points[i], &res->points[i]);
+    }
+
+  /* The number of false positives matters as much as the time it takes
+   * to compute them
+   */
+  for (unsigned int i = 0; i < N_BOXES; i++)
+    {
+      n_obbs += graphene_frustum_intersects_obb (&res->f, &res->obbs[i]);
+      n_boxes += graphene_frustum_intersects_box (&res->f, &res->boxes[i]);
+    }
+
+  fprintf (stderr, "# visible: %u oriented boxes, %u axis aligned bounds\n", n_obbs, n_boxes);
+
+  return res;
+}
+
+static void
+obb_frustum_obb (void *data)
+{
+  ObbBench *bench = data;
+
+  for (unsigned int i = 0; i < N_BOXES; i++)
+    graphene_frustum_intersects_obb (&bench->f, &bench->obbs[i]);
+}
+
+static void
+obb_frustum_box (void *data)
+{
+  ObbBench *bench = data;
+
+  for (unsigned int i = 0; i < N_BOXES; i++)
+    graphene_frustum_intersects_box (&bench->f, &bench->boxes[i]);
+}
+
+static void
+obb_intersects_obb (void *data)
+{
+  ObbBench *bench = data;
+
+  for (unsigned int i = 0; i < N_BOXES; i++)
+    graphene_obb_intersects_obb (&bench->obbs[i], &bench->obbs[(i + 1) % N_BOXES]);
+}
+
+static void
+obb_from_points (void *data)
+{
+  ObbBench *bench = data;
+  graphene_obb_t obb;
+
+  graphene_obb_init_from_points (&obb, N_BOXES, bench->points);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (obb_setup);
+
+  graphene_bench_add_func ("/obb/frustum/oriented", obb_frustum_obb, N_BOXES);
+  graphene_bench_add_func ("/obb/frustum/axis-aligned", obb_frustum_box, N_BOXES);
+  graphene_bench_add_func ("/obb/intersects-obb", obb_intersects_obb, N_BOXES);
+  graphene_bench_add_func ("/obb/from-points", obb_from_points, N_BOXES);
+
+  return graphene_bench_run ();
+}
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+
+#include <stdlib.h>
+
+#define N_ITEMS         (1024 * 1024)
+
+typedef struct {
+  graphene_matrix_t m;
+  graphene_frustum_t f;
+
+  graphene_point3d_t *points;
+  graphene_point3d_t *points_res;
+  graphene_box_t *boxes;
+  uint32_t *visible;
+
+  unsigned int n_threads;
+} ParallelBench;
+
+static ParallelBench parallel_bench;
+
+static void *
+parallel_setup (void)
+{
+  ParallelBench *res = &parallel_bench;
+  graphene_matrix_t p;
+
+  if (res->points != NULL)
+    return res;
+
+  graphene_matrix_init_rotate (&res->m, 30.f, graphene_vec3_y_axis ());
+  graphene_matrix_translate (&res->m, &GRAPHENE_POINT3D_INIT (1.f, 2.f, 3.f));
+  graphene_matrix_init_perspective (&p, 60.f, 1.f, 1.f, 500.f);
+  graphene_frustum_init_from_matrix (&res->f, &p);
+
+  res->points = malloc (sizeof (graphene_point3d_t) * N_ITEMS);
+  res->points_res = malloc (sizeof (graphene_point3d_t) * N_ITEMS);
+  res->boxes = malloc (sizeof (graphene_box_t) * N_ITEMS);
+  res->visible = malloc (sizeof (uint32_t) * N_ITEMS / 32);
+
+  for (unsigned int i = 0; i < N_ITEMS; i++)
+    {
+      float x = (float) (i % 1024) - 512.f;
+      float z = (float) (i / 1024) - 512.f;
+
+      graphene_point3d_init (&res->points[i], x, (float) (i % 7), z);
+      graphene_box_init (&res->boxes[i],
+                         &res->points[i],
+                         &GRAPHENE_POINT3D_INIT (x + 0.5f, (float) (i % 7) + 0.5f, z + 0.5f));
+    }
+
+  /* Use all the CPUs for the parallel variants */
+  graphene_parallel_set_n_threads (0);
+  res->n_threads = graphene_parallel_get_n_threads ();
+  graphene_parallel_set_n_threads (1);
+
+  return res;
+}
+
+/* Changing the number of threads restarts the pool, so only do it when
+ * switching between the serial and the parallel variants
+ */
+static void
+parallel_use_threads (ParallelBench *bench,
+                      bool           parallel)
+{
+  unsigned int n_threads = parallel ? bench->n_threads : 1;
+
+  if (graphene_parallel_get_n_threads () != n_threads)
+    graphene_parallel_set_n_threads (n_threads);
+}
+
+static void
+parallel_transform_points_serial (void *data)
+{
+  ParallelBench *bench = data;
+
+  parallel_use_threads (bench, false);
+  graphene_matrix_transform_points3d (&bench->m, N_ITEMS, bench->points, bench->points_res);
+}
+
+static void
+parallel_transform_points_threads (void *data)
+{
+  ParallelBench *bench = data;
+
+  parallel_use_threads (bench, true);
+  graphene_matrix_transform_points3d (&bench->m, N_ITEMS, bench->points, bench->points_res);
+}
+
+static void
+parallel_cull_boxes_serial (void *data)
+{
+  ParallelBench *bench = data;
+
+  parallel_use_threads (bench, false);
+  graphene_frustum_cull_boxes (&bench->f, N_ITEMS, bench->boxes, bench->visible);
+}
+
+static void
+parallel_cull_boxes_threads (void *data)
+{
+  ParallelBench *bench = data;
+
+  parallel_use_threads (bench, true);
+  graphene_frustum_cull_boxes (&bench->f, N_ITEMS, bench->boxes, bench->visible);
+}
+
+static void
+parallel_box_from_points_serial (void *data)
+{
+  ParallelBench *bench = data;
+  graphene_box_t b;
+
+  parallel_use_threads (bench, false);
+  graphene_box_init_from_points (&b, N_ITEMS, bench->points);
+}
+
+static void
+parallel_box_from_points_threads (void *data)
+{
+  ParallelBench *bench = data;
+  graphene_box_t b;
+
+  parallel_use_threads (bench, true);
+  graphene_box_init_from_points (&b, N_ITEMS, bench->points);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (parallel_setup);
+
+  graphene_bench_add_func ("/parallel/transform-points/serial", parallel_transform_points_serial, N_ITEMS);
+  graphene_bench_add_func ("/parallel/transform-points/threads", parallel_transform_points_threads, N_ITEMS);
+  graphene_bench_add_func ("/parallel/cull-boxes/serial", parallel_cull_boxes_serial, N_ITEMS);
+  graphene_bench_add_func ("/parallel/cull-boxes/threads", parallel_cull_boxes_threads, N_ITEMS);
+  graphene_bench_add_func ("/parallel/box-from-points/serial", parallel_box_from_points_serial, N_ITEMS);
+  graphene_bench_add_func ("/parallel/box-from-points/threads", parallel_box_from_points_threads, N_ITEMS);
+
+  return graphene_bench_run ();
+}
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+
+#define N_QUATERNIONS   256
+
+typedef struct {
+  graphene_quaternion_t quaternions[N_QUATERNIONS];
+  graphene_quaternion_t quaternions_res[N_QUATERNIONS];
+
+  graphene_matrix_t matrices[N_QUATERNIONS];
+} QuaternionBench;
+
+static QuaternionBench quaternion_bench;
+
+static void *
+quaternion_setup (void)
+{
+  QuaternionBench *res = &quaternion_bench;
+
+  for (unsigned int i = 0; i < N_QUATERNIONS; i++)
+    {
+      float angle = (float) i * 1.5f;
+
+      graphene_quaternion_init_from_angles (&res->quaternions[i], angle, angle * 0.5f, 30.f);
+      graphene_quaternion_to_matrix (&res->quaternions[i], &res->matrices[i]);
+    }
+
+  return res;
+}
+
+static void
+quaternion_slerp (void *data)
+{
+  QuaternionBench *bench = data;
+
+  for (unsigned int i = 0; i < N_QUATERNIONS - 1; i++)
+    graphene_quaternion_slerp (&bench->quaternions[i], &bench->quaternions[i + 1], 0.3f,
+                               &bench->quaternions_res[i]);
+}
+
+static void
+quaternion_to_matrix (void *data)
+{
+  QuaternionBench *bench = data;
+
+  for (unsigned int i = 0; i < N_QUATERNIONS; i++)
+    graphene_quaternion_to_matrix (&bench->quaternions[i], &bench->matrices[i]);
+}
+
+static void
+quaternion_init_from_matrix (void *data)
+{
+  QuaternionBench *bench = data;
+
+  for (unsigned int i = 0; i < N_QUATERNIONS; i++)
+    graphene_quaternion_init_from_matrix (&bench->quaternions_res[i], &bench->matrices[i]);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (quaternion_setup);
+
+  graphene_bench_add_func ("/quaternion/slerp", quaternion_slerp, N_QUATERNIONS - 1);
+  graphene_bench_add_func ("/quaternion/to-matrix", quaternion_to_matrix, N_QUATERNIONS);
+  graphene_bench_add_func ("/quaternion/init-from-matrix", quaternion_init_from_matrix, N_QUATERNIONS);
+
+  return graphene_bench_run ();
+}
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+
+#define N_BOXES         4096
+
+typedef struct {
+  graphene_ray_t ray;
+
+  graphene_box_t boxes[N_BOXES];
+  graphene_sphere_t spheres[N_BOXES];
+  graphene_triangle_t triangles[N_BOXES];
+
+  float t[N_BOXES];
+  uint32_t hits[N_BOXES / 32];
+} RayBench;
+
+static RayBench ray_bench;
+
+static void *
+ray_setup (void)
+{
+  RayBench *res = &ray_bench;
+  graphene_vec3_t direction;
+
+  graphene_vec3_init (&direction, 0.1f, 0.05f, 1.f);
+  graphene_ray_init (&res->ray, &GRAPHENE_POINT3D_INIT (-1.f, 0.5f, -100.f), &direction);
+
+  for (unsigned int i = 0; i < N_BOXES; i++)
+    {
+      float x = (float) (i % 64) - 32.f;
+      float y = (float) (i / 64) - 32.f;
+      float z = -1.f - (float) (i % 97);
+      float size = 0.5f + (float) (i % 3);
+
+      graphene_box_init (&res->boxes[i],
+                         &GRAPHENE_POINT3D_INIT (x, y, z),
+                         &GRAPHENE_POINT3D_INIT (x + size, y + size, z + size));
+      graphene_sphere_init (&res->spheres[i],
+                            &GRAPHENE_POINT3D_INIT (x, y, z),
+                            size);
+      graphene_triangle_init_from_point3d (&res->triangles[i],
+                                           &GRAPHENE_POINT3D_INIT (x, y, z),
+                                           &GRAPHENE_POINT3D_INIT (x + size, y, z),
+                                           &GRAPHENE_POINT3D_INIT (x, y + size, z));
+    }
+
+  return res;
+}
+
+static void
+ray_intersect_box_loop (void *data)
+{
+  RayBench *bench = data;
+
+  for (unsigned int i = 0; i < N_BOXES; i++)
+    graphene_ray_intersect_box (&bench->ray, &bench->boxes[i], &bench->t[i]);
+}
+
+static void
+ray_intersect_boxes (void *data)
+{
+  RayBench *bench = data;
+
+  graphene_ray_intersect_boxes (&bench->ray, N_BOXES, bench->boxes, bench->t, bench->hits);
+}
+
+static void
+ray_intersect_sphere_loop (void *data)
+{
+  RayBench *bench = data;
+
+  for (unsigned int i = 0; i < N_BOXES; i++)
+    graphene_ray_intersect_sphere (&bench->ray, &bench->spheres[i], &bench->t[i]);
+}
+
+static void
+ray_intersect_triangle_loop (void *data)
+{
+  RayBench *bench = data;
+
+  for (unsigned int i = 0; i < N_BOXES; i++)
+    graphene_ray_intersect_triangle (&bench->ray, &bench->triangles[i], &bench->t[i]);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (ray_setup);
+
+  graphene_bench_add_func ("/ray/intersect-box/loop", ray_intersect_box_loop, N_BOXES);
+  graphene_bench_add_func ("/ray/intersect-box/batch", ray_intersect_boxes, N_BOXES);
+  graphene_bench_add_func ("/ray/intersect-sphere/loop", ray_intersect_sphere_loop, N_BOXES);
+  graphene_bench_add_func ("/ray/intersect-triangle/loop", ray_intersect_triangle_loop, N_BOXES);
+
+  return graphene_bench_run ();
+}
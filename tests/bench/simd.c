@@ -0,0 +1,331 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+
+#include <math.h>
+
+/* Compares the throughput of the same kernels written with 4-wide and
+ * 8-wide vectors; all the data is in a "structure of arrays" layout,
+ * so that loads and stores are contiguous for both widths.
+ */
+
+#define N_ELEMENTS      4096
+#define N_PLANES        6
+
+typedef struct {
+  /* Row-major 4x4 matrix, without the projection column */
+  float matrix[12];
+
+  float planes[N_PLANES][4];
+
+  float ray_origin[3];
+  float ray_inv_direction[3];
+
+  float x[N_ELEMENTS];
+  float y[N_ELEMENTS];
+  float z[N_ELEMENTS];
+  float radius[N_ELEMENTS];
+
+  float max_x[N_ELEMENTS];
+  float max_y[N_ELEMENTS];
+  float max_z[N_ELEMENTS];
+
+  float res_x[N_ELEMENTS];
+  float res_y[N_ELEMENTS];
+  float res_z[N_ELEMENTS];
+} SimdBench;
+
+static SimdBench simd_bench;
+
+static void *
+simd_setup (void)
+{
+  SimdBench *res = &simd_bench;
+  graphene_frustum_t frustum;
+  graphene_matrix_t m;
+  graphene_plane_t planes[N_PLANES];
+  float f[16];
+
+  graphene_matrix_init_rotate (&m, 30.f, graphene_vec3_y_axis ());
+  graphene_matrix_translate (&m, &GRAPHENE_POINT3D_INIT (10.f, 20.f, 30.f));
+  graphene_matrix_to_float (&m, f);
+
+  for (unsigned int i = 0; i < 4; i++)
+    {
+      res->matrix[i * 3 + 0] = f[i * 4 + 0];
+      res->matrix[i * 3 + 1] = f[i * 4 + 1];
+      res->matrix[i * 3 + 2] = f[i * 4 + 2];
+    }
+
+  graphene_matrix_init_perspective (&m, 60.f, 1.f, 1.f, 100.f);
+  graphene_frustum_init_from_matrix (&frustum, &m);
+  graphene_frustum_get_planes (&frustum, planes);
+
+  for (unsigned int i = 0; i < N_PLANES; i++)
+    {
+      graphene_vec3_t normal;
+
+      graphene_plane_get_normal (&planes[i], &normal);
+      res->planes[i][0] = graphene_vec3_get_x (&normal);
+      res->planes[i][1] = graphene_vec3_get_y (&normal);
+      res->planes[i][2] = graphene_vec3_get_z (&normal);
+      res->planes[i][3] = graphene_plane_get_constant (&planes[i]);
+    }
+
+  res->ray_origin[0] = -1.f;
+  res->ray_origin[1] = 0.5f;
+  res->ray_origin[2] = -100.f;
+  res->ray_inv_direction[0] = 10.f;
+  res->ray_inv_direction[1] = 20.f;
+  res->ray_inv_direction[2] = 1.f;
+
+  for (unsigned int i = 0; i < N_ELEMENTS; i++)
+    {
+      res->x[i] = (float) (i % 64) - 32.f;
+      res->y[i] = (float) (i / 64) - 32.f;
+      res->z[i] = -1.f - (float) (i % 97);
+      res->radius[i] = 0.5f + (float) (i % 3);
+
+      res->max_x[i] = res->x[i] + res->radius[i];
+      res->max_y[i] = res->y[i] + res->radius[i];
+      res->max_z[i] = res->z[i] + res->radius[i];
+    }
+
+  return res;
+}
+
+static void
+simd4f_transform (void *data)
+{
+  SimdBench *bench = data;
+  graphene_simd4f_t m[12];
+
+  for (unsigned int j = 0; j < 12; j++)
+    m[j] = graphene_simd4f_splat (bench->matrix[j]);
+
+  for (unsigned int i = 0; i < N_ELEMENTS; i += 4)
+    {
+      graphene_simd4f_t x = graphene_simd4f_init_4f (&bench->x[i]);
+      graphene_simd4f_t y = graphene_simd4f_init_4f (&bench->y[i]);
+      graphene_simd4f_t z = graphene_simd4f_init_4f (&bench->z[i]);
+      graphene_simd4f_t rx, ry, rz;
+
+      rx = graphene_simd4f_madd (x, m[0], m[9]);
+      ry = graphene_simd4f_madd (x, m[1], m[10]);
+      rz = graphene_simd4f_madd (x, m[2], m[11]);
+      rx = graphene_simd4f_madd (y, m[3], rx);
+      ry = graphene_simd4f_madd (y, m[4], ry);
+      rz = graphene_simd4f_madd (y, m[5], rz);
+      rx = graphene_simd4f_madd (z, m[6], rx);
+      ry = graphene_simd4f_madd (z, m[7], ry);
+      rz = graphene_simd4f_madd (z, m[8], rz);
+
+      graphene_simd4f_dup_4f (rx, &bench->res_x[i]);
+      graphene_simd4f_dup_4f (ry, &bench->res_y[i]);
+      graphene_simd4f_dup_4f (rz, &bench->res_z[i]);
+    }
+}
+
+static void
+simd8f_transform (void *data)
+{
+  SimdBench *bench = data;
+  graphene_simd8f_t m[12];
+
+  for (unsigned int j = 0; j < 12; j++)
+    m[j] = graphene_simd8f_splat (bench->matrix[j]);
+
+  for (unsigned int i = 0; i < N_ELEMENTS; i += 8)
+    {
+      graphene_simd8f_t x = graphene_simd8f_init_8f (&bench->x[i]);
+      graphene_simd8f_t y = graphene_simd8f_init_8f (&bench->y[i]);
+      graphene_simd8f_t z = graphene_simd8f_init_8f (&bench->z[i]);
+      graphene_simd8f_t rx, ry, rz;
+
+      rx = graphene_simd8f_madd (x, m[0], m[9]);
+      ry = graphene_simd8f_madd (x, m[1], m[10]);
+      rz = graphene_simd8f_madd (x, m[2], m[11]);
+      rx = graphene_simd8f_madd (y, m[3], rx);
+      ry = graphene_simd8f_madd (y, m[4], ry);
+      rz = graphene_simd8f_madd (y, m[5], rz);
+      rx = graphene_simd8f_madd (z, m[6], rx);
+      ry = graphene_simd8f_madd (z, m[7], ry);
+      rz = graphene_simd8f_madd (z, m[8], rz);
+
+      graphene_simd8f_dup_8f (rx, &bench->res_x[i]);
+      graphene_simd8f_dup_8f (ry, &bench->res_y[i]);
+      graphene_simd8f_dup_8f (rz, &bench->res_z[i]);
+    }
+}
+
+/* Signed distance of each sphere from the closest clip plane */
+static void
+simd4f_cull_spheres (void *data)
+{
+  SimdBench *bench = data;
+  graphene_simd4f_t nx[N_PLANES], ny[N_PLANES], nz[N_PLANES], d[N_PLANES];
+
+  for (unsigned int k = 0; k < N_PLANES; k++)
+    {
+      nx[k] = graphene_simd4f_splat (bench->planes[k][0]);
+      ny[k] = graphene_simd4f_splat (bench->planes[k][1]);
+      nz[k] = graphene_simd4f_splat (bench->planes[k][2]);
+      d[k] = graphene_simd4f_splat (bench->planes[k][3]);
+    }
+
+  for (unsigned int i = 0; i < N_ELEMENTS; i += 4)
+    {
+      graphene_simd4f_t x = graphene_simd4f_init_4f (&bench->x[i]);
+      graphene_simd4f_t y = graphene_simd4f_init_4f (&bench->y[i]);
+      graphene_simd4f_t z = graphene_simd4f_init_4f (&bench->z[i]);
+      graphene_simd4f_t min_d = graphene_simd4f_splat (INFINITY);
+
+      for (unsigned int k = 0; k < N_PLANES; k++)
+        {
+          graphene_simd4f_t dist;
+
+          dist = graphene_simd4f_madd (nx[k], x, d[k]);
+          dist = graphene_simd4f_madd (ny[k], y, dist);
+          dist = graphene_simd4f_madd (nz[k], z, dist);
+          min_d = graphene_simd4f_min (min_d, dist);
+        }
+
+      min_d = graphene_simd4f_add (min_d, graphene_simd4f_init_4f (&bench->radius[i]));
+      graphene_simd4f_dup_4f (min_d, &bench->res_x[i]);
+    }
+}
+
+static void
+simd8f_cull_spheres (void *data)
+{
+  SimdBench *bench = data;
+  graphene_simd8f_t nx[N_PLANES], ny[N_PLANES], nz[N_PLANES], d[N_PLANES];
+
+  for (unsigned int k = 0; k < N_PLANES; k++)
+    {
+      nx[k] = graphene_simd8f_splat (bench->planes[k][0]);
+      ny[k] = graphene_simd8f_splat (bench->planes[k][1]);
+      nz[k] = graphene_simd8f_splat (bench->planes[k][2]);
+      d[k] = graphene_simd8f_splat (bench->planes[k][3]);
+    }
+
+  for (unsigned int i = 0; i < N_ELEMENTS; i += 8)
+    {
+      graphene_simd8f_t x = graphene_simd8f_init_8f (&bench->x[i]);
+      graphene_simd8f_t y = graphene_simd8f_init_8f (&bench->y[i]);
+      graphene_simd8f_t z = graphene_simd8f_init_8f (&bench->z[i]);
+      graphene_simd8f_t min_d = graphene_simd8f_splat (INFINITY);
+
+      for (unsigned int k = 0; k < N_PLANES; k++)
+        {
+          graphene_simd8f_t dist;
+
+          dist = graphene_simd8f_madd (nx[k], x, d[k]);
+          dist = graphene_simd8f_madd (ny[k], y, dist);
+          dist = graphene_simd8f_madd (nz[k], z, dist);
+          min_d = graphene_simd8f_min (min_d, dist);
+        }
+
+      min_d = graphene_simd8f_add (min_d, graphene_simd8f_init_8f (&bench->radius[i]));
+      graphene_simd8f_dup_8f (min_d, &bench->res_x[i]);
+    }
+}
+
+/* Entry and exit distances of a ray through each box */
+static void
+simd4f_ray_boxes (void *data)
+{
+  SimdBench *bench = data;
+  graphene_simd4f_t ox = graphene_simd4f_splat (bench->ray_origin[0]);
+  graphene_simd4f_t oy = graphene_simd4f_splat (bench->ray_origin[1]);
+  graphene_simd4f_t oz = graphene_simd4f_splat (bench->ray_origin[2]);
+  graphene_simd4f_t ix = graphene_simd4f_splat (bench->ray_inv_direction[0]);
+  graphene_simd4f_t iy = graphene_simd4f_splat (bench->ray_inv_direction[1]);
+  graphene_simd4f_t iz = graphene_simd4f_splat (bench->ray_inv_direction[2]);
+
+  for (unsigned int i = 0; i < N_ELEMENTS; i += 4)
+    {
+      graphene_simd4f_t t0, t1, t_near, t_far, t_min, t_max;
+
+      t0 = graphene_simd4f_mul (graphene_simd4f_sub (graphene_simd4f_init_4f (&bench->x[i]), ox), ix);
+      t1 = graphene_simd4f_mul (graphene_simd4f_sub (graphene_simd4f_init_4f (&bench->max_x[i]), ox), ix);
+      t_min = graphene_simd4f_min (t0, t1);
+      t_max = graphene_simd4f_max (t0, t1);
+
+      t0 = graphene_simd4f_mul (graphene_simd4f_sub (graphene_simd4f_init_4f (&bench->y[i]), oy), iy);
+      t1 = graphene_simd4f_mul (graphene_simd4f_sub (graphene_simd4f_init_4f (&bench->max_y[i]), oy), iy);
+      t_near = graphene_simd4f_min (t0, t1);
+      t_far = graphene_simd4f_max (t0, t1);
+      t_min = graphene_simd4f_max (t_min, t_near);
+      t_max = graphene_simd4f_min (t_max, t_far);
+
+      t0 = graphene_simd4f_mul (graphene_simd4f_sub (graphene_simd4f_init_4f (&bench->z[i]), oz), iz);
+      t1 = graphene_simd4f_mul (graphene_simd4f_sub (graphene_simd4f_init_4f (&bench->max_z[i]), oz), iz);
+      t_near = graphene_simd4f_min (t0, t1);
+      t_far = graphene_simd4f_max (t0, t1);
+      t_min = graphene_simd4f_max (t_min, t_near);
+      t_max = graphene_simd4f_min (t_max, t_far);
+
+      graphene_simd4f_dup_4f (t_min, &bench->res_x[i]);
+      graphene_simd4f_dup_4f (t_max, &bench->res_y[i]);
+    }
+}
+
+static void
+simd8f_ray_boxes (void *data)
+{
+  SimdBench *bench = data;
+  graphene_simd8f_t ox = graphene_simd8f_splat (bench->ray_origin[0]);
+  graphene_simd8f_t oy = graphene_simd8f_splat (bench->ray_origin[1]);
+  graphene_simd8f_t oz = graphene_simd8f_splat (bench->ray_origin[2]);
+  graphene_simd8f_t ix = graphene_simd8f_splat (bench->ray_inv_direction[0]);
+  graphene_simd8f_t iy = graphene_simd8f_splat (bench->ray_inv_direction[1]);
+  graphene_simd8f_t iz = graphene_simd8f_splat (bench->ray_inv_direction[2]);
+
+  for (unsigned int i = 0; i < N_ELEMENTS; i += 8)
+    {
+      graphene_simd8f_t t0, t1, t_near, t_far, t_min, t_max;
+
+      t0 = graphene_simd8f_mul (graphene_simd8f_sub (graphene_simd8f_init_8f (&bench->x[i]), ox), ix);
+      t1 = graphene_simd8f_mul (graphene_simd8f_sub (graphene_simd8f_init_8f (&bench->max_x[i]), ox), ix);
+      t_min = graphene_simd8f_min (t0, t1);
+      t_max = graphene_simd8f_max (t0, t1);
+
+      t0 = graphene_simd8f_mul (graphene_simd8f_sub (graphene_simd8f_init_8f (&bench->y[i]), oy), iy);
+      t1 = graphene_simd8f_mul (graphene_simd8f_sub (graphene_simd8f_init_8f (&bench->max_y[i]), oy), iy);
+      t_near = graphene_simd8f_min (t0, t1);
+      t_far = graphene_simd8f_max (t0, t1);
+      t_min = graphene_simd8f_max (t_min, t_near);
+      t_max = graphene_simd8f_min (t_max, t_far);
+
+      t0 = graphene_simd8f_mul (graphene_simd8f_sub (graphene_simd8f_init_8f (&bench->z[i]), oz), iz);
+      t1 = graphene_simd8f_mul (graphene_simd8f_sub (graphene_simd8f_init_8f (&bench->max_z[i]), oz), iz);
+      t_near = graphene_simd8f_min (t0, t1);
+      t_far = graphene_simd8f_max (t0, t1);
+      t_min = graphene_simd8f_max (t_min, t_near);
+      t_max = graphene_simd8f_min (t_max, t_far);
+
+      graphene_simd8f_dup_8f (t_min, &bench->res_x[i]);
+      graphene_simd8f_dup_8f (t_max, &bench->res_y[i]);
+    }
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (simd_setup);
+
+  graphene_bench_add_func ("/simd/transform/simd4f", simd4f_transform, N_ELEMENTS);
+  graphene_bench_add_func ("/simd/transform/simd8f", simd8f_transform, N_ELEMENTS);
+  graphene_bench_add_func ("/simd/cull-spheres/simd4f", simd4f_cull_spheres, N_ELEMENTS);
+  graphene_bench_add_func ("/simd/cull-spheres/simd8f", simd8f_cull_spheres, N_ELEMENTS);
+  graphene_bench_add_func ("/simd/ray-boxes/simd4f", simd4f_ray_boxes, N_ELEMENTS);
+  graphene_bench_add_func ("/simd/ray-boxes/simd8f", simd8f_ray_boxes, N_ELEMENTS);
+
+  return graphene_bench_run ();
+}
@@ -0,0 +1,208 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+
+#include <stdlib.h>
+
+#define N_VECTORS       (64 * 1024)
+
+typedef struct {
+  graphene_matrix_t m;
+
+  graphene_vec3_t *a;
+  graphene_vec3_t *b;
+  graphene_vec3_t *res;
+
+  graphene_vec3_soa_t *soa_a;
+  graphene_vec3_soa_t *soa_b;
+  graphene_vec3_soa_t *soa_res;
+
+  graphene_matrix_t *matrices;
+  graphene_matrix_t *matrices_res;
+
+  graphene_matrix_soa_t *soa_matrices;
+  graphene_matrix_soa_t *soa_matrices_res;
+} SoaBench;
+
+static SoaBench soa_bench;
+
+static void *
+soa_setup (void)
+{
+  SoaBench *res = &soa_bench;
+
+  if (res->a != NULL)
+    return res;
+
+  graphene_matrix_init_rotate (&res->m, 30.f, graphene_vec3_y_axis ());
+  graphene_matrix_translate (&res->m, &GRAPHENE_POINT3D_INIT (1.f, 2.f, 3.f));
+
+  res->a = malloc (sizeof (graphene_vec3_t) * N_VECTORS);
+  res->b = malloc (sizeof (graphene_vec3_t) * N_VECTORS);
+  res->res = malloc (sizeof (graphene_vec3_t) * N_VECTORS);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    {
+      graphene_vec3_init (&res->a[i], (float) (i % 17), (float) (i % 5) + 1.f, (float) (i % 11));
+      graphene_vec3_init (&res->b[i], (float) (i % 7), (float) (i % 13), (float) (i % 3) + 1.f);
+    }
+
+  res->soa_a = graphene_vec3_soa_new (N_VECTORS);
+  res->soa_b = graphene_vec3_soa_new (N_VECTORS);
+  res->soa_res = graphene_vec3_soa_new (N_VECTORS);
+
+  graphene_vec3_soa_init_from_vec3 (res->soa_a, res->a);
+  graphene_vec3_soa_init_from_vec3 (res->soa_b, res->b);
+
+  res->matrices = malloc (sizeof (graphene_matrix_t) * N_VECTORS);
+  res->matrices_res = malloc (sizeof (graphene_matrix_t) * N_VECTORS);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    {
+      graphene_matrix_init_rotate (&res->matrices[i], (float) (i % 360), graphene_vec3_z_axis ());
+      graphene_matrix_translate (&res->matrices[i], &GRAPHENE_POINT3D_INIT ((float) (i % 17), 1.f, 2.f));
+    }
+
+  res->soa_matrices = graphene_matrix_soa_new (N_VECTORS);
+  res->soa_matrices_res = graphene_matrix_soa_new (N_VECTORS);
+
+  graphene_matrix_soa_init_from_matrices (res->soa_matrices, res->matrices);
+
+  return res;
+}
+
+static void
+soa_add_aos (void *data)
+{
+  SoaBench *bench = data;
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_vec3_add (&bench->a[i], &bench->b[i], &bench->res[i]);
+}
+
+static void
+soa_add_soa (void *data)
+{
+  SoaBench *bench = data;
+
+  graphene_vec3_soa_add (bench->soa_a, bench->soa_b, bench->soa_res);
+}
+
+static void
+soa_cross_aos (void *data)
+{
+  SoaBench *bench = data;
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_vec3_cross (&bench->a[i], &bench->b[i], &bench->res[i]);
+}
+
+static void
+soa_cross_soa (void *data)
+{
+  SoaBench *bench = data;
+
+  graphene_vec3_soa_cross (bench->soa_a, bench->soa_b, bench->soa_res);
+}
+
+static void
+soa_normalize_aos (void *data)
+{
+  SoaBench *bench = data;
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_vec3_normalize (&bench->a[i], &bench->res[i]);
+}
+
+static void
+soa_normalize_soa (void *data)
+{
+  SoaBench *bench = data;
+
+  graphene_vec3_soa_normalize (bench->soa_a, bench->soa_res);
+}
+
+static void
+soa_transform_aos (void *data)
+{
+  SoaBench *bench = data;
+
+  graphene_matrix_transform_vec3_array (&bench->m, N_VECTORS, bench->a, bench->res);
+}
+
+static void
+soa_transform_soa (void *data)
+{
+  SoaBench *bench = data;
+
+  graphene_vec3_soa_transform (bench->soa_a, &bench->m, bench->soa_res);
+}
+
+static void
+soa_matrix_multiply_aos (void *data)
+{
+  SoaBench *bench = data;
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_matrix_multiply (&bench->matrices[i], &bench->m, &bench->matrices_res[i]);
+}
+
+static void
+soa_matrix_multiply_soa (void *data)
+{
+  SoaBench *bench = data;
+
+  graphene_matrix_soa_multiply (bench->soa_matrices, bench->soa_matrices, bench->soa_matrices_res);
+}
+
+static void
+soa_matrix_inverse_aos (void *data)
+{
+  SoaBench *bench = data;
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_matrix_inverse (&bench->matrices[i], &bench->matrices_res[i]);
+}
+
+static void
+soa_matrix_inverse_soa (void *data)
+{
+  SoaBench *bench = data;
+
+  graphene_matrix_soa_inverse (bench->soa_matrices, bench->soa_matrices_res);
+}
+
+static void
+soa_convert (void *data)
+{
+  SoaBench *bench = data;
+
+  graphene_vec3_soa_init_from_vec3 (bench->soa_res, bench->a);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (soa_setup);
+
+  graphene_bench_add_func ("/soa/add/aos", soa_add_aos, N_VECTORS);
+  graphene_bench_add_func ("/soa/add/soa", soa_add_soa, N_VECTORS);
+  graphene_bench_add_func ("/soa/cross/aos", soa_cross_aos, N_VECTORS);
+  graphene_bench_add_func ("/soa/cross/soa", soa_cross_soa, N_VECTORS);
+  graphene_bench_add_func ("/soa/normalize/aos", soa_normalize_aos, N_VECTORS);
+  graphene_bench_add_func ("/soa/normalize/soa", soa_normalize_soa, N_VECTORS);
+  graphene_bench_add_func ("/soa/transform/aos", soa_transform_aos, N_VECTORS);
+  graphene_bench_add_func ("/soa/transform/soa", soa_transform_soa, N_VECTORS);
+  graphene_bench_add_func ("/soa/matrix-multiply/aos", soa_matrix_multiply_aos, N_VECTORS);
+  graphene_bench_add_func ("/soa/matrix-multiply/soa", soa_matrix_multiply_soa, N_VECTORS);
+  graphene_bench_add_func ("/soa/matrix-inverse/aos", soa_matrix_inverse_aos, N_VECTORS);
+  graphene_bench_add_func ("/soa/matrix-inverse/soa", soa_matrix_inverse_soa, N_VECTORS);
+  graphene_bench_add_func ("/soa/convert", soa_convert, N_VECTORS);
+
+  return graphene_bench_run ();
+}
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+#include "../graphene-test-utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define N_POINTS        (64 * 1024)
+
+typedef struct {
+  graphene_point3d_t *points;
+} SphereBench;
+
+static SphereBench sphere_bench;
+
+static void *
+sphere_setup (void)
+{
+  SphereBench *res = &sphere_bench;
+  graphene_sphere_t loose, fast, exact;
+
+  if (res->points != NULL)
+    return res;
+
+  /* An elongated cloud along a diagonal, like a rotated mesh */
+  res->points = malloc (sizeof (graphene_point3d_t) * N_POINTS);
+  for (unsigned int i = 0; i < N_POINTS; i++)
+    {
+      float t = random_float (0.f, 100.f);
+
+      graphene_point3d_init (&res->points[i],
+                             t + random_float (-5.f, 5.f),
+                             t + random_float (-5.f, 5.f),
+                             random_float (-5.f, 5.f));
+    }
+
+  graphene_parallel_set_n_threads (1);
+
+  /* The radius matters as much as the time it takes to compute it */
+  graphene_sphere_init_from_points (&loose, N_POINTS, res->points, NULL);
+  graphene_sphere_init_from_points_tight (&fast, N_POINTS, res->points, GRAPHENE_SPHERE_FIT_FAST);
+  graphene_sphere_init_from_points_tight (&exact, N_POINTS, res->points, GRAPHENE_SPHERE_FIT_EXACT);
+
+  fprintf (stderr, "# radius: bounding box %.3f, fast %.3f, exact %.3f\n",
+           graphene_sphere_get_radius (&loose),
+           graphene_sphere_get_radius (&fast),
+           graphene_sphere_get_radius (&exact));
+
+  return res;
+}
+
+static void
+sphere_bounding_box (void *data)
+{
+  SphereBench *bench = data;
+  graphene_sphere_t s;
+
+  graphene_sphere_init_from_points (&s, N_POINTS, bench->points, NULL);
+}
+
+static void
+sphere_fast (void *data)
+{
+  SphereBench *bench = data;
+  graphene_sphere_t s;
+
+  graphene_sphere_init_from_points_tight (&s, N_POINTS, bench->points, GRAPHENE_SPHERE_FIT_FAST);
+}
+
+static void
+sphere_exact (void *data)
+{
+  SphereBench *bench = data;
+  graphene_sphere_t s;
+
+  graphene_sphere_init_from_points_tight (&s, N_POINTS, bench->points, GRAPHENE_SPHERE_FIT_EXACT);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (sphere_setup);
+
+  graphene_bench_add_func ("/sphere/init-from-points/bounding-box", sphere_bounding_box, N_POINTS);
+  graphene_bench_add_func ("/sphere/init-from-points/fast", sphere_fast, N_POINTS);
+  graphene_bench_add_func ("/sphere/init-from-points/exact", sphere_exact, N_POINTS);
+
+  return graphene_bench_run ();
+}
@@ -0,0 +1,160 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+
+#include <stdlib.h>
+
+#define N_VERTICES      (64 * 1024)
+
+typedef struct {
+  float position[3];
+  float normal[3];
+  float uv[2];
+} vertex_t;
+
+typedef struct {
+  graphene_matrix_t m;
+  graphene_frustum_t f;
+
+  vertex_t *vertices;
+  graphene_point3d_t *staging;
+  uint32_t *visible;
+
+  graphene_strided_view_t positions;
+} StridedBench;
+
+static StridedBench strided_bench;
+
+static void *
+strided_setup (void)
+{
+  StridedBench *res = &strided_bench;
+  graphene_matrix_t p;
+
+  if (res->vertices != NULL)
+    return res;
+
+  graphene_matrix_init_rotate (&res->m, 30.f, graphene_vec3_y_axis ());
+  graphene_matrix_init_perspective (&p, 60.f, 1.f, 1.f, 500.f);
+  graphene_frustum_init_from_matrix (&res->f, &p);
+
+  res->vertices = malloc (sizeof (vertex_t) * N_VERTICES);
+  res->staging = malloc (sizeof (graphene_point3d_t) * N_VERTICES);
+  res->visible = malloc (sizeof (uint32_t) * N_VERTICES / 32);
+
+  for (unsigned int i = 0; i < N_VERTICES; i++)
+    {
+      vertex_t *v = &res->vertices[i];
+
+      v->position[0] = (float) (i % 256) - 128.f;
+      v->position[1] = (float) (i % 7);
+      v->position[2] = (float) (i / 256) - 128.f;
+      v->normal[0] = v->normal[2] = 0.f;
+      v->normal[1] = 1.f;
+      v->uv[0] = v->uv[1] = 0.f;
+    }
+
+  graphene_strided_view_init (&res->positions,
+                              res->vertices[0].position, sizeof (vertex_t),
+                              3, N_VERTICES);
+
+  return res;
+}
+
+/* What callers had to do before strided views: copy the positions out of
+ * the vertex buffer, process them, and copy them back
+ */
+static void
+strided_copy_in (StridedBench *bench)
+{
+  for (unsigned int i = 0; i < N_VERTICES; i++)
+    graphene_point3d_init (&bench->staging[i],
+                           bench->vertices[i].position[0],
+                           bench->vertices[i].position[1],
+                           bench->vertices[i].position[2]);
+}
+
+static void
+strided_copy_out (StridedBench *bench)
+{
+  for (unsigned int i = 0; i < N_VERTICES; i++)
+    {
+      bench->vertices[i].position[0] = bench->staging[i].x;
+      bench->vertices[i].position[1] = bench->staging[i].y;
+      bench->vertices[i].position[2] = bench->staging[i].z;
+    }
+}
+
+static void
+strided_box_staging (void *data)
+{
+  StridedBench *bench = data;
+  graphene_box_t b;
+
+  strided_copy_in (bench);
+  graphene_box_init_from_points (&b, N_VERTICES, bench->staging);
+}
+
+static void
+strided_box_direct (void *data)
+{
+  StridedBench *bench = data;
+  graphene_box_t b;
+
+  graphene_box_init_from_strided (&b, &bench->positions);
+}
+
+static void
+strided_transform_staging (void *data)
+{
+  StridedBench *bench = data;
+
+  strided_copy_in (bench);
+  graphene_matrix_transform_points3d (&bench->m, N_VERTICES, bench->staging, bench->staging);
+  strided_copy_out (bench);
+}
+
+static void
+strided_transform_direct (void *data)
+{
+  StridedBench *bench = data;
+
+  graphene_matrix_transform_strided (&bench->m, &bench->positions);
+}
+
+static void
+strided_cull_staging (void *data)
+{
+  StridedBench *bench = data;
+
+  strided_copy_in (bench);
+  graphene_frustum_cull_points (&bench->f, N_VERTICES, bench->staging, bench->visible);
+}
+
+static void
+strided_cull_direct (void *data)
+{
+  StridedBench *bench = data;
+
+  graphene_frustum_cull_strided (&bench->f, &bench->positions, bench->visible);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (strided_setup);
+
+  graphene_bench_add_func ("/strided/box/staging", strided_box_staging, N_VERTICES);
+  graphene_bench_add_func ("/strided/box/direct", strided_box_direct, N_VERTICES);
+  graphene_bench_add_func ("/strided/transform/staging", strided_transform_staging, N_VERTICES);
+  graphene_bench_add_func ("/strided/transform/direct", strided_transform_direct, N_VERTICES);
+  graphene_bench_add_func ("/strided/cull/staging", strided_cull_staging, N_VERTICES);
+  graphene_bench_add_func ("/strided/cull/direct", strided_cull_direct, N_VERTICES);
+
+  return graphene_bench_run ();
+}
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+
+#include <stdlib.h>
+
+/* A scene graph with a few wide levels, like a crowd of skinned meshes */
+#define N_NODES         65536
+#define N_CHILDREN      8
+#define N_DIRTY         64
+
+typedef struct {
+  unsigned int *parents;
+  graphene_matrix_t *local;
+  graphene_matrix_t *world;
+
+  graphene_transform_hierarchy_t *h;
+} HierarchyBench;
+
+static HierarchyBench hierarchy_bench;
+
+static void *
+hierarchy_setup (void)
+{
+  HierarchyBench *res = &hierarchy_bench;
+
+  if (res->h != NULL)
+    return res;
+
+  res->parents = malloc (sizeof (unsigned int) * N_NODES);
+  res->local = malloc (sizeof (graphene_matrix_t) * N_NODES);
+  res->world = malloc (sizeof (graphene_matrix_t) * N_NODES);
+
+  for (unsigned int i = 0; i < N_NODES; i++)
+    {
+      float f = (float) (i % 360);
+
+      res->parents[i] = i == 0 ? GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT : (i - 1) / N_CHILDREN;
+
+      graphene_matrix_init_rotate (&res->local[i], f, graphene_vec3_y_axis ());
+      graphene_matrix_translate (&res->local[i], &GRAPHENE_POINT3D_INIT (1.f, 0.f, f * 0.01f));
+    }
+
+  res->h = graphene_transform_hierarchy_new (N_NODES, res->parents);
+
+  for (unsigned int i = 0; i < N_NODES; i++)
+    graphene_transform_hierarchy_set_local (res->h, i, &res->local[i]);
+
+  return res;
+}
+
+/* The baseline: one matrix multiplication per node, in node order */
+static void
+hierarchy_update_per_node (void *data)
+{
+  HierarchyBench *bench = data;
+
+  for (unsigned int i = 0; i < N_NODES; i++)
+    {
+      unsigned int parent = bench->parents[i];
+
+      if (parent == GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT)
+        bench->world[i] = bench->local[i];
+      else
+        graphene_matrix_multiply (&bench->local[i], &bench->world[parent], &bench->world[i]);
+    }
+}
+
+static void
+hierarchy_update_all (void *data)
+{
+  HierarchyBench *bench = data;
+
+  graphene_transform_hierarchy_set_local (bench->h, 0, &bench->local[0]);
+  graphene_transform_hierarchy_update (bench->h);
+}
+
+static void
+hierarchy_update_leaves (void *data)
+{
+  HierarchyBench *bench = data;
+
+  for (unsigned int i = 0; i < N_DIRTY; i++)
+    {
+      unsigned int node = N_NODES - 1 - i * 97;
+
+      graphene_transform_hierarchy_set_local (bench->h, node, &bench->local[node]);
+    }
+
+  graphene_transform_hierarchy_update (bench->h);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (hierarchy_setup);
+
+  graphene_bench_add_func ("/transform-hierarchy/update/per-node", hierarchy_update_per_node, N_NODES);
+  graphene_bench_add_func ("/transform-hierarchy/update/all", hierarchy_update_all, N_NODES);
+  graphene_bench_add_func ("/transform-hierarchy/update/leaves", hierarchy_update_leaves, N_DIRTY);
+
+  return graphene_bench_run ();
+}
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+
+#define N_RECTS         1024
+
+typedef struct {
+  graphene_matrix_t translate_m;
+  graphene_matrix_t scale_m;
+  graphene_matrix_t affine_m;
+
+  graphene_transform_t translate_t;
+  graphene_transform_t scale_t;
+  graphene_transform_t affine_t;
+
+  graphene_rect_t rects[N_RECTS];
+  graphene_rect_t rects_res[N_RECTS];
+} TransformBench;
+
+static TransformBench transform_bench;
+
+static void *
+transform_setup (void)
+{
+  TransformBench *res = &transform_bench;
+
+  graphene_matrix_init_translate (&res->translate_m, &GRAPHENE_POINT3D_INIT (10.f, 20.f, 0.f));
+
+  graphene_matrix_init_scale (&res->scale_m, 2.f, 2.f, 1.f);
+  graphene_matrix_translate (&res->scale_m, &GRAPHENE_POINT3D_INIT (10.f, 20.f, 0.f));
+
+  graphene_matrix_init_rotate (&res->affine_m, 30.f, graphene_vec3_z_axis ());
+  graphene_matrix_translate (&res->affine_m, &GRAPHENE_POINT3D_INIT (10.f, 20.f, 0.f));
+
+  graphene_transform_init_from_matrix (&res->translate_t, &res->translate_m);
+  graphene_transform_init_from_matrix (&res->scale_t, &res->scale_m);
+  graphene_transform_init_from_matrix (&res->affine_t, &res->affine_m);
+
+  for (unsigned int i = 0; i < N_RECTS; i++)
+    {
+      float x = (float) (i % 32);
+      float y = (float) (i / 32);
+
+      graphene_rect_init (&res->rects[i], x * 10.f, y * 10.f, 8.f + x, 8.f);
+    }
+
+  return res;
+}
+
+#define BOUNDS_BENCH(name, field) \
+static void \
+matrix_bounds_ ## name (void *data) \
+{ \
+  TransformBench *bench = data; \
+\
+  for (unsigned int i = 0; i < N_RECTS; i++) \
+    graphene_matrix_transform_bounds (&bench->field ## _m, &bench->rects[i], &bench->rects_res[i]); \
+} \
+\
+static void \
+transform_bounds_ ## name (void *data) \
+{ \
+  TransformBench *bench = data; \
+\
+  for (unsigned int i = 0; i < N_RECTS; i++) \
+    graphene_transform_transform_bounds (&bench->field ## _t, &bench->rects[i], &bench->rects_res[i]); \
+}
+
+BOUNDS_BENCH (translate, translate)
+BOUNDS_BENCH (scale, scale)
+BOUNDS_BENCH (affine, affine)
+
+#undef BOUNDS_BENCH
+
+static void
+matrix_inverse_scale (void *data)
+{
+  TransformBench *bench = data;
+  graphene_matrix_t res;
+
+  for (unsigned int i = 0; i < N_RECTS; i++)
+    graphene_matrix_inverse (&bench->scale_m, &res);
+}
+
+static void
+transform_inverse_scale (void *data)
+{
+  TransformBench *bench = data;
+  graphene_transform_t res;
+
+  for (unsigned int i = 0; i < N_RECTS; i++)
+    graphene_transform_inverse (&bench->scale_t, &res);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (transform_setup);
+
+  graphene_bench_add_func ("/transform/bounds-translate/matrix", matrix_bounds_translate, N_RECTS);
+  graphene_bench_add_func ("/transform/bounds-translate/transform", transform_bounds_translate, N_RECTS);
+  graphene_bench_add_func ("/transform/bounds-scale/matrix", matrix_bounds_scale, N_RECTS);
+  graphene_bench_add_func ("/transform/bounds-scale/transform", transform_bounds_scale, N_RECTS);
+  graphene_bench_add_func ("/transform/bounds-affine/matrix", matrix_bounds_affine, N_RECTS);
+  graphene_bench_add_func ("/transform/bounds-affine/transform", transform_bounds_affine, N_RECTS);
+  graphene_bench_add_func ("/transform/inverse-scale/matrix", matrix_inverse_scale, N_RECTS);
+  graphene_bench_add_func ("/transform/inverse-scale/transform", transform_inverse_scale, N_RECTS);
+
+  return graphene_bench_run ();
+}
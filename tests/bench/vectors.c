@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include "graphene-bench-utils.h"
+
+#define N_VECTORS       1024
+
+typedef struct {
+  graphene_vec3_t vec3s[N_VECTORS];
+  graphene_vec3_t vec3s_res[N_VECTORS];
+
+  graphene_vec4_t vec4s[N_VECTORS];
+  graphene_vec4_t vec4s_res[N_VECTORS];
+
+  float dots[N_VECTORS];
+} VectorsBench;
+
+static VectorsBench vectors_bench;
+
+static void *
+vectors_setup (void)
+{
+  VectorsBench *res = &vectors_bench;
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    {
+      float x = (float) (i % 32) + 1.f;
+      float y = (float) (i / 32) - 16.f;
+      float z = (float) i * 0.25f;
+
+      graphene_vec3_init (&res->vec3s[i], x, y, z);
+      graphene_vec4_init (&res->vec4s[i], x, y, z, 1.f);
+    }
+
+  return res;
+}
+
+static void
+vec3_normalize (void *data)
+{
+  VectorsBench *bench = data;
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_vec3_normalize (&bench->vec3s[i], &bench->vec3s_res[i]);
+}
+
+static void
+vec4_normalize (void *data)
+{
+  VectorsBench *bench = data;
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_vec4_normalize (&bench->vec4s[i], &bench->vec4s_res[i]);
+}
+
+static void
+vec3_cross (void *data)
+{
+  VectorsBench *bench = data;
+
+  for (unsigned int i = 0; i < N_VECTORS - 1; i++)
+    graphene_vec3_cross (&bench->vec3s[i], &bench->vec3s[i + 1], &bench->vec3s_res[i]);
+}
+
+static void
+vec3_dot (void *data)
+{
+  VectorsBench *bench = data;
+
+  for (unsigned int i = 0; i < N_VECTORS - 1; i++)
+    bench->dots[i] = graphene_vec3_dot (&bench->vec3s[i], &bench->vec3s[i + 1]);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  graphene_bench_init (&argc, &argv);
+
+  graphene_bench_set_fixture_setup (vectors_setup);
+
+  graphene_bench_add_func ("/vec3/normalize", vec3_normalize, N_VECTORS);
+  graphene_bench_add_func ("/vec4/normalize", vec4_normalize, N_VECTORS);
+  graphene_bench_add_func ("/vec3/cross", vec3_cross, N_VECTORS - 1);
+  graphene_bench_add_func ("/vec3/dot", vec3_dot, N_VECTORS - 1);
+
+  return graphene_bench_run ();
+}
@@ -164,6 +164,59 @@ box_init_from_vectors (mutest_spec_t *spec)
   free (vectors);
 }
 
+/* Checks every length around the sizes of the unrolled blocks against
+ * expanding an empty box one point at a time
+ */
+static void
+box_init_from_float_array (mutest_spec_t *spec)
+{
+  float coords[70 * 3];
+  graphene_point3d_t points[70];
+  graphene_vec3_t vectors[70];
+  bool same_points = true, same_vectors = true, same_floats = true;
+
+  for (unsigned int i = 0; i < 70; i++)
+    {
+      coords[i * 3 + 0] = (float) ((i * 37) % 101) - 50.f;
+      coords[i * 3 + 1] = (float) ((i * 53) % 89) - 40.f;
+      coords[i * 3 + 2] = (float) ((i * 71) % 97) - 60.f;
+
+      graphene_point3d_init (&points[i], coords[i * 3 + 0], coords[i * 3 + 1], coords[i * 3 + 2]);
+      graphene_point3d_to_vec3 (&points[i], &vectors[i]);
+    }
+
+  for (unsigned int n = 0; n <= 70; n++)
+    {
+      graphene_box_t check, b;
+
+      graphene_box_init_from_box (&check, graphene_box_empty ());
+      for (unsigned int i = 0; i < n; i++)
+        graphene_box_expand (&check, &points[i], &check);
+
+      graphene_box_init_from_points (&b, n, points);
+      same_points &= graphene_box_equal (&b, &check);
+
+      graphene_box_init_from_vectors (&b, n, vectors);
+      same_vectors &= graphene_box_equal (&b, &check);
+
+      graphene_box_init_from_float_array (&b, n, coords);
+      same_floats &= graphene_box_equal (&b, &check);
+    }
+
+  mutest_expect ("init_from_points() to match expanding the box point by point",
+                 mutest_bool_value (same_points),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("init_from_vectors() to match expanding the box point by point",
+                 mutest_bool_value (same_vectors),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("init_from_float_array() to match expanding the box point by point",
+                 mutest_bool_value (same_floats),
+                 mutest_to_be_true,
+                 NULL);
+}
+
 static void
 box_size (mutest_spec_t *spec)
 {
@@ -519,6 +572,7 @@ box_suite (mutest_suite_t *suite)
   mutest_it ("initializes min/max points", box_init_min_max);
   mutest_it ("initializes from points", box_init_from_points);
   mutest_it ("initializes from vectors", box_init_from_vectors);
+  mutest_it ("initializes from float arrays", box_init_from_float_array);
   mutest_it ("has the correct sizes", box_size);
   mutest_it ("has the correct center point", box_center);
   mutest_it ("has equality", box_equal);
@@ -0,0 +1,336 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include <math.h>
+#include <string.h>
+#include <graphene.h>
+#include <mutest.h>
+
+#include "graphene-test-utils.h"
+
+#define N_BOXES         200
+#define GRID_SIZE       10
+
+static void
+init_boxes (graphene_box_t *boxes)
+{
+  random_seed (1);
+
+  for (unsigned int i = 0; i < N_BOXES; i++)
+    {
+      graphene_point3d_t min, max;
+
+      graphene_point3d_init (&min,
+                             random_float (-50.f, 50.f),
+                             random_float (-50.f, 50.f),
+                             random_float (-50.f, 50.f));
+      graphene_point3d_init (&max,
+                             min.x + random_float (0.5f, 5.f),
+                             min.y + random_float (0.5f, 5.f),
+                             min.z + random_float (0.5f, 5.f));
+      graphene_box_init (&boxes[i], &min, &max);
+    }
+}
+
+static void
+init_ray (graphene_ray_t *r)
+{
+  graphene_point3d_t origin;
+  graphene_vec3_t direction;
+
+  graphene_point3d_init (&origin,
+                         random_float (-60.f, 60.f),
+                         random_float (-60.f, 60.f),
+                         random_float (-60.f, 60.f));
+  graphene_vec3_init (&direction,
+                      random_float (-1.f, 1.f) - origin.x / 60.f,
+                      random_float (-1.f, 1.f) - origin.y / 60.f,
+                      random_float (-1.f, 1.f) - origin.z / 60.f);
+  graphene_ray_init (r, &origin, &direction);
+}
+
+static void
+bvh_boxes_intersect_ray (void)
+{
+  graphene_box_t boxes[N_BOXES];
+  graphene_bvh_t *bvh;
+  bool all_match = true;
+  unsigned int n_hits = 0;
+
+  init_boxes (boxes);
+  bvh = graphene_bvh_new_from_boxes (N_BOXES, boxes);
+
+  mutest_expect ("new_from_boxes() to contain all the boxes",
+                 mutest_int_value (graphene_bvh_get_n_primitives (bvh)),
+                 mutest_to_be, N_BOXES,
+                 NULL);
+
+  for (unsigned int i = 0; i < 500; i++)
+    {
+      graphene_ray_t r;
+      float best_t = INFINITY;
+      float t;
+      unsigned int primitive;
+      bool hit;
+
+      init_ray (&r);
+
+      for (unsigned int j = 0; j < N_BOXES; j++)
+        {
+          if (graphene_ray_intersect_box (&r, &boxes[j], &t) != GRAPHENE_RAY_INTERSECTION_KIND_NONE)
+            best_t = fminf (best_t, t);
+        }
+
+      hit = graphene_bvh_intersect_ray (bvh, &r, &primitive, &t);
+      if (hit)
+        {
+          float check;
+
+          n_hits += 1;
+          graphene_ray_intersect_box (&r, &boxes[primitive], &check);
+          all_match = all_match && fabsf (t - best_t) < 0.001f && fabsf (t - check) < 0.001f;
+        }
+      else
+        all_match = all_match && isinf (best_t);
+
+      all_match = all_match && graphene_bvh_intersects_ray (bvh, &r, INFINITY) == hit;
+    }
+
+  mutest_expect ("intersect_ray() to find the closest box",
+                 mutest_bool_value (all_match),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("some rays to hit a box",
+                 mutest_bool_value (n_hits > 0),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_bvh_free (bvh);
+}
+
+static void
+bvh_boxes_query (void)
+{
+  graphene_box_t boxes[N_BOXES];
+  unsigned int results[N_BOXES];
+  bool found[N_BOXES];
+  graphene_box_t query;
+  graphene_matrix_t m;
+  graphene_frustum_t frustum;
+  graphene_bvh_t *bvh;
+  unsigned int n_results, n_expected;
+  bool all_match;
+
+  init_boxes (boxes);
+  bvh = graphene_bvh_new_from_boxes (N_BOXES, boxes);
+
+  graphene_box_init (&query,
+                     &GRAPHENE_POINT3D_INIT (-20.f, -20.f, -20.f),
+                     &GRAPHENE_POINT3D_INIT (10.f, 15.f, 20.f));
+
+  n_results = graphene_bvh_query_box (bvh, &query, N_BOXES, results);
+  memset (found, 0, sizeof (found));
+  for (unsigned int i = 0; i < n_results && i < N_BOXES; i++)
+    found[results[i]] = true;
+
+  n_expected = 0;
+  all_match = true;
+  for (unsigned int i = 0; i < N_BOXES; i++)
+    {
+      bool expected = graphene_box_intersection (&boxes[i], &query, NULL);
+
+      n_expected += expected ? 1 : 0;
+      all_match = all_match && expected == found[i];
+    }
+
+  mutest_expect ("query_box() to find the overlapping boxes",
+                 mutest_bool_value (all_match && n_results == n_expected && n_results > 0),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("query_box() to return the total number of results",
+                 mutest_int_value (graphene_bvh_query_box (bvh, &query, 0, NULL)),
+                 mutest_to_be, n_expected,
+                 NULL);
+
+  graphene_matrix_init_perspective (&m, 45.f, 1.f, 1.f, 60.f);
+  graphene_frustum_init_from_matrix (&frustum, &m);
+
+  n_results = graphene_bvh_query_frustum (bvh, &frustum, N_BOXES, results);
+  memset (found, 0, sizeof (found));
+  for (unsigned int i = 0; i < n_results && i < N_BOXES; i++)
+    found[results[i]] = true;
+
+  n_expected = 0;
+  all_match = true;
+  for (unsigned int i = 0; i < N_BOXES; i++)
+    {
+      bool expected = graphene_frustum_intersects_box (&frustum, &boxes[i]);
+
+      n_expected += expected ? 1 : 0;
+      all_match = all_match && expected == found[i];
+    }
+
+  mutest_expect ("query_frustum() to find the boxes intersecting the frustum",
+                 mutest_bool_value (all_match && n_results == n_expected && n_results > 0),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_bvh_free (bvh);
+}
+
+static void
+bvh_triangles_intersect_ray (void)
+{
+  graphene_point3d_t vertices[(GRID_SIZE + 1) * (GRID_SIZE + 1)];
+  unsigned int indices[GRID_SIZE * GRID_SIZE * 6];
+  graphene_bvh_t *bvh;
+  unsigned int n_indices = 0;
+  bool all_match = true;
+  unsigned int n_hits = 0;
+
+  random_seed (42);
+
+  /* A bumpy height field on the xz plane */
+  for (unsigned int z = 0; z <= GRID_SIZE; z++)
+    for (unsigned int x = 0; x <= GRID_SIZE; x++)
+      graphene_point3d_init (&vertices[z * (GRID_SIZE + 1) + x],
+                             (float) x * 4.f - 20.f,
+                             random_float (-2.f, 2.f),
+                             (float) z * 4.f - 20.f);
+
+  for (unsigned int z = 0; z < GRID_SIZE; z++)
+    {
+      for (unsigned int x = 0; x < GRID_SIZE; x++)
+        {
+          unsigned int v = z * (GRID_SIZE + 1) + x;
+
+          indices[n_indices++] = v;
+          indices[n_indices++] = v + 1;
+          indices[n_indices++] = v + GRID_SIZE + 1;
+          indices[n_indices++] = v + 1;
+          indices[n_indices++] = v + GRID_SIZE + 2;
+          indices[n_indices++] = v + GRID_SIZE + 1;
+        }
+    }
+
+  bvh = graphene_bvh_new_from_triangles ((GRID_SIZE + 1) * (GRID_SIZE + 1), vertices, n_indices, indices);
+
+  mutest_expect ("new_from_triangles() to contain all the triangles",
+                 mutest_int_value (graphene_bvh_get_n_primitives (bvh)),
+                 mutest_to_be, n_indices / 3,
+                 NULL);
+
+  for (unsigned int i = 0; i < 200; i++)
+    {
+      graphene_ray_t r;
+      graphene_vec3_t direction;
+      float best_t = INFINITY;
+      unsigned int primitive;
+      float t;
+
+      graphene_vec3_init (&direction, random_float (-0.5f, 0.5f), -1.f, random_float (-0.5f, 0.5f));
+      graphene_ray_init (&r,
+                         &GRAPHENE_POINT3D_INIT (random_float (-25.f, 25.f), 10.f, random_float (-25.f, 25.f)),
+                         &direction);
+
+      for (unsigned int j = 0; j < n_indices / 3; j++)
+        {
+          graphene_triangle_t tri;
+
+          graphene_triangle_init_from_point3d (&tri,
+                                               &vertices[indices[j * 3 + 0]],
+                                               &vertices[indices[j * 3 + 1]],
+                                               &vertices[indices[j * 3 + 2]]);
+
+          if (graphene_ray_intersect_triangle (&r, &tri, &t) != GRAPHENE_RAY_INTERSECTION_KIND_NONE &&
+              t < best_t)
+            best_t = t;
+        }
+
+      if (graphene_bvh_intersect_ray (bvh, &r, &primitive, &t))
+        {
+          n_hits += 1;
+          all_match = all_match && fabsf (t - best_t) < 0.001f && primitive < n_indices / 3;
+        }
+      else
+        all_match = all_match && isinf (best_t);
+    }
+
+  mutest_expect ("intersect_ray() to find the closest triangle",
+                 mutest_bool_value (all_match),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("some rays to hit a triangle",
+                 mutest_bool_value (n_hits > 0),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_bvh_free (bvh);
+}
+
+static void
+bvh_empty (void)
+{
+  const unsigned int indices[] = { 0, 1, 2 };
+  graphene_bvh_t *bvh = graphene_bvh_new_from_boxes (0, NULL);
+  graphene_ray_t r;
+  graphene_box_t bounds;
+
+  graphene_ray_init (&r, NULL, graphene_vec3_x_axis ());
+  graphene_bvh_get_bounds (bvh, &bounds);
+
+  mutest_expect ("an empty hierarchy to have empty bounds",
+                 mutest_bool_value (graphene_box_equal (&bounds, graphene_box_empty ())),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("an empty hierarchy to not intersect rays",
+                 mutest_bool_value (graphene_bvh_intersect_ray (bvh, &r, NULL, NULL)),
+                 mutest_to_be_false,
+                 NULL);
+  mutest_expect ("an empty hierarchy to not overlap boxes",
+                 mutest_int_value (graphene_bvh_query_box (bvh, graphene_box_infinite (), 0, NULL)),
+                 mutest_to_be, 0,
+                 NULL);
+
+  graphene_bvh_free (bvh);
+
+  /* Indices without any vertex to refer to */
+  bvh = graphene_bvh_new_from_triangles (0, NULL, 3, indices);
+  mutest_expect ("a mesh without vertices to have no triangles",
+                 mutest_int_value (graphene_bvh_query_box (bvh, graphene_box_infinite (), 0, NULL)),
+                 mutest_to_be, 0,
+                 NULL);
+
+  graphene_bvh_free (bvh);
+}
+
+static void
+bvh_invalid_indices (void)
+{
+  const graphene_point3d_t vertices[] = {
+    GRAPHENE_POINT3D_INIT (0.f, 0.f, 0.f),
+    GRAPHENE_POINT3D_INIT (1.f, 0.f, 0.f),
+    GRAPHENE_POINT3D_INIT (0.f, 1.f, 0.f),
+  };
+  const unsigned int indices[] = { 0, 1, 2, 2, 1, 3 };
+
+  mutest_expect ("out of range indices to be rejected",
+                 mutest_pointer (graphene_bvh_new_from_triangles (3, vertices, 6, indices)),
+                 mutest_to_be_null,
+                 NULL);
+}
+
+static void
+bvh_suite (void)
+{
+  mutest_it ("can intersect rays with boxes", bvh_boxes_intersect_ray);
+  mutest_it ("can query boxes and frustums", bvh_boxes_query);
+  mutest_it ("can intersect rays with triangles", bvh_triangles_intersect_ray);
+  mutest_it ("can be empty", bvh_empty);
+  mutest_it ("rejects out of range indices", bvh_invalid_indices);
+}
+
+MUTEST_MAIN (
+  mutest_describe ("graphene_bvh_t", bvh_suite);
+)
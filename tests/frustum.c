@@ -145,12 +145,184 @@ frustum_matrix_contains_point (mutest_spec_t *spec)
 #endif
 }
 
+static void
+frustum_cull (mutest_spec_t *spec)
+{
+  graphene_point3d_t points[37];
+  graphene_sphere_t spheres[37];
+  graphene_box_t boxes[37];
+  uint32_t visible[2];
+  graphene_matrix_t m;
+  graphene_frustum_t f;
+  unsigned int n_visible, n_expected;
+  bool all_match;
+
+  graphene_matrix_init_perspective (&m, 60.f, 1.f, 1.f, 100.f);
+  graphene_frustum_init_from_matrix (&f, &m);
+
+  for (unsigned int i = 0; i < 37; i++)
+    {
+      graphene_point3d_t min, max;
+      float x = ((float) (i % 7) - 3.f) * 12.f;
+      float z = -((float) (i / 7) * 25.f);
+
+      graphene_point3d_init (&points[i], x, x * 0.5f, z);
+      graphene_sphere_init (&spheres[i], &points[i], 3.f);
+      graphene_point3d_init (&min, x - 4.f, x * 0.5f - 2.f, z - 4.f);
+      graphene_point3d_init (&max, x + 4.f, x * 0.5f + 2.f, z + 4.f);
+      graphene_box_init (&boxes[i], &min, &max);
+    }
+
+  n_visible = graphene_frustum_cull_points (&f, 37, points, visible);
+  n_expected = 0;
+  all_match = true;
+  for (unsigned int i = 0; i < 37; i++)
+    {
+      bool expected = graphene_frustum_contains_point (&f, &points[i]);
+      bool is_visible = (visible[i / 32] & (1u << (i % 32))) != 0;
+
+      n_expected += expected ? 1 : 0;
+      all_match = all_match && expected == is_visible;
+    }
+
+  mutest_expect ("cull_points() to match contains_point()",
+                 mutest_bool_value (all_match && n_visible == n_expected),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("cull_points() to not set bits past the last point",
+                 mutest_bool_value ((visible[1] >> 5) == 0),
+                 mutest_to_be_true,
+                 NULL);
+
+  n_visible = graphene_frustum_cull_spheres (&f, 37, spheres, visible);
+  n_expected = 0;
+  all_match = true;
+  for (unsigned int i = 0; i < 37; i++)
+    {
+      bool expected = graphene_frustum_intersects_sphere (&f, &spheres[i]);
+      bool is_visible = (visible[i / 32] & (1u << (i % 32))) != 0;
+
+      n_expected += expected ? 1 : 0;
+      all_match = all_match && expected == is_visible;
+    }
+
+  mutest_expect ("cull_spheres() to match intersects_sphere()",
+                 mutest_bool_value (all_match && n_visible == n_expected),
+                 mutest_to_be_true,
+                 NULL);
+
+  n_visible = graphene_frustum_cull_boxes (&f, 37, boxes, visible);
+  n_expected = 0;
+  all_match = true;
+  for (unsigned int i = 0; i < 37; i++)
+    {
+      bool expected = graphene_frustum_intersects_box (&f, &boxes[i]);
+      bool is_visible = (visible[i / 32] & (1u << (i % 32))) != 0;
+
+      n_expected += expected ? 1 : 0;
+      all_match = all_match && expected == is_visible;
+    }
+
+  mutest_expect ("cull_boxes() to match intersects_box()",
+                 mutest_bool_value (all_match && n_visible == n_expected),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("cull_boxes() to cull some boxes",
+                 mutest_bool_value (n_visible > 0 && n_visible < 37),
+                 mutest_to_be_true,
+                 NULL);
+}
+
+static void
+frustum_classify (mutest_spec_t *spec)
+{
+  graphene_matrix_t m;
+  graphene_frustum_t f;
+  graphene_box_t box;
+  graphene_sphere_t sphere;
+  unsigned int mask, child_mask;
+
+  graphene_matrix_init_ortho (&m, -1.f, 1.f, -1.f, 1.f, 1.f, 100.f);
+  graphene_frustum_init_from_matrix (&f, &m);
+
+  graphene_box_init (&box,
+                     &GRAPHENE_POINT3D_INIT (-0.5f, -0.5f, -50.f),
+                     &GRAPHENE_POINT3D_INIT (0.5f, 0.5f, -40.f));
+  mutest_expect ("a box inside the frustum to be classified as inside",
+                 mutest_bool_value (graphene_frustum_classify_box (&f, &box, GRAPHENE_FRUSTUM_ALL_PLANES, &mask) == GRAPHENE_FRUSTUM_CONTAINMENT_INSIDE),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("a box inside the frustum to not intersect any plane",
+                 mutest_bool_value (mask == 0),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_box_init (&box,
+                     &GRAPHENE_POINT3D_INIT (2.f, 2.f, -50.f),
+                     &GRAPHENE_POINT3D_INIT (3.f, 3.f, -40.f));
+  mutest_expect ("a box outside the frustum to be classified as outside",
+                 mutest_bool_value (graphene_frustum_classify_box (&f, &box, GRAPHENE_FRUSTUM_ALL_PLANES, NULL) == GRAPHENE_FRUSTUM_CONTAINMENT_OUTSIDE),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_box_init (&box,
+                     &GRAPHENE_POINT3D_INIT (0.5f, -0.5f, -50.f),
+                     &GRAPHENE_POINT3D_INIT (1.5f, 0.5f, -40.f));
+  mutest_expect ("a box crossing a side of the frustum to be classified as intersecting",
+                 mutest_bool_value (graphene_frustum_classify_box (&f, &box, GRAPHENE_FRUSTUM_ALL_PLANES, &mask) == GRAPHENE_FRUSTUM_CONTAINMENT_INTERSECTING),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("a box crossing a side of the frustum to intersect a single plane",
+                 mutest_bool_value (mask != 0 && (mask & (mask - 1)) == 0),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_box_init (&box,
+                     &GRAPHENE_POINT3D_INIT (0.6f, -0.4f, -48.f),
+                     &GRAPHENE_POINT3D_INIT (0.9f, 0.4f, -42.f));
+  mutest_expect ("a child box only tested against the planes of its parent to be inside",
+                 mutest_bool_value (graphene_frustum_classify_box (&f, &box, mask, &child_mask) == GRAPHENE_FRUSTUM_CONTAINMENT_INSIDE &&
+                                    child_mask == 0),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_box_init (&box,
+                     &GRAPHENE_POINT3D_INIT (1.2f, -0.4f, -48.f),
+                     &GRAPHENE_POINT3D_INIT (1.4f, 0.4f, -42.f));
+  mutest_expect ("a child box only tested against the planes of its parent to be outside",
+                 mutest_bool_value (graphene_frustum_classify_box (&f, &box, mask, NULL) == GRAPHENE_FRUSTUM_CONTAINMENT_OUTSIDE),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_sphere_init (&sphere, &GRAPHENE_POINT3D_INIT (0.f, 0.f, -50.f), 0.5f);
+  mutest_expect ("a sphere inside the frustum to be classified as inside",
+                 mutest_bool_value (graphene_frustum_classify_sphere (&f, &sphere, GRAPHENE_FRUSTUM_ALL_PLANES, &mask) == GRAPHENE_FRUSTUM_CONTAINMENT_INSIDE &&
+                                    mask == 0),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_sphere_init (&sphere, &GRAPHENE_POINT3D_INIT (-1.f, 0.f, -50.f), 0.5f);
+  mutest_expect ("a sphere crossing a side of the frustum to be classified as intersecting",
+                 mutest_bool_value (graphene_frustum_classify_sphere (&f, &sphere, GRAPHENE_FRUSTUM_ALL_PLANES, &mask) == GRAPHENE_FRUSTUM_CONTAINMENT_INTERSECTING &&
+                                    mask != 0 && (mask & (mask - 1)) == 0),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_sphere_init (&sphere, &GRAPHENE_POINT3D_INIT (0.f, 0.f, -150.f), 10.f);
+  mutest_expect ("a sphere beyond the far plane to be classified as outside",
+                 mutest_bool_value (graphene_frustum_classify_sphere (&f, &sphere, GRAPHENE_FRUSTUM_ALL_PLANES, NULL) == GRAPHENE_FRUSTUM_CONTAINMENT_OUTSIDE),
+                 mutest_to_be_true,
+                 NULL);
+}
+
 static void
 frustum_suite (mutest_suite_t *suite)
 {
   mutest_it ("initializes frustums from planes", frustum_init);
   mutest_it ("contains points in an orthographic frustum", frustum_ortho_contains_point);
   mutest_it ("contains points in a frustum matrix", frustum_matrix_contains_point);
+  mutest_it ("culls arrays of points, spheres, and boxes", frustum_cull);
+  mutest_it ("classifies boxes and spheres", frustum_classify);
 }
 
 MUTEST_MAIN (
@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+/* A small linear congruential generator, so that the random inputs of
+ * the tests are the same on every platform
+ */
+static unsigned int test_rand_state = 1;
+
+static inline void
+random_seed (unsigned int seed)
+{
+  test_rand_state = seed;
+}
+
+static inline float
+random_float (float min,
+              float max)
+{
+  test_rand_state = test_rand_state * 1103515245u + 12345u;
+
+  return min + (max - min) * (float) ((test_rand_state >> 8) & 0xffff) / 65535.f;
+}
@@ -282,6 +282,54 @@ matrix_invert (void)
                  NULL);
 }
 
+static void
+matrix_invert_affine (void)
+{
+  graphene_matrix_t m;
+  graphene_matrix_t identity;
+  graphene_matrix_t inv;
+  graphene_matrix_t res;
+
+  graphene_matrix_init_identity (&identity);
+
+  graphene_matrix_init_scale (&m, 2.0f, -1.0f, 0.5f);
+  graphene_matrix_rotate (&m, 30, graphene_vec3_y_axis ());
+  graphene_matrix_translate (&m, &GRAPHENE_POINT3D_INIT (1.f, 2.f, 3.f));
+
+  mutest_expect ("inverting an affine matrix to succeed",
+                 mutest_bool_value (graphene_matrix_inverse_affine (&m, &inv)),
+                 mutest_to_be_true,
+                 NULL);
+  graphene_matrix_multiply (&m, &inv, &res);
+  mutest_expect ("inverting an affine matrix to return an identity",
+                 mutest_pointer (&res),
+                 graphene_test_matrix_near, mutest_pointer (&identity),
+                 NULL);
+
+  graphene_matrix_init_scale (&m, 2.0f, 0.0f, 0.5f);
+  mutest_expect ("inverting a degenerate affine matrix to fail",
+                 mutest_bool_value (graphene_matrix_inverse_affine (&m, &inv)),
+                 mutest_to_be_false,
+                 NULL);
+
+  graphene_matrix_init_rotate (&m, 60, graphene_vec3_z_axis ());
+  graphene_matrix_rotate (&m, 45, graphene_vec3_x_axis ());
+  graphene_matrix_translate (&m, &GRAPHENE_POINT3D_INIT (-4.f, 5.f, 6.f));
+
+  graphene_matrix_inverse_rigid (&m, &inv);
+  graphene_matrix_multiply (&m, &inv, &res);
+  mutest_expect ("inverting a rigid matrix to return an identity",
+                 mutest_pointer (&res),
+                 graphene_test_matrix_near, mutest_pointer (&identity),
+                 NULL);
+
+  graphene_matrix_inverse (&m, &res);
+  mutest_expect ("inverting a rigid matrix to match the generic inverse",
+                 mutest_pointer (&inv),
+                 graphene_test_matrix_near, mutest_pointer (&res),
+                 NULL);
+}
+
 static void
 matrix_neutral_element (void)
 {
@@ -722,6 +770,80 @@ matrix_2d_transform_bound (void)
                  NULL);
 }
 
+static bool
+rect_near (const graphene_rect_t *a,
+           const graphene_rect_t *b,
+           float                  epsilon)
+{
+  return fabsf (a->origin.x - b->origin.x) < epsilon &&
+         fabsf (a->origin.y - b->origin.y) < epsilon &&
+         fabsf (a->size.width - b->size.width) < epsilon &&
+         fabsf (a->size.height - b->size.height) < epsilon;
+}
+
+static void
+matrix_2d_transform_bounds_array (void)
+{
+  graphene_rect_t rects[7], res[7];
+  graphene_matrix_t m;
+  bool all_near;
+
+  for (unsigned int i = 0; i < 7; i++)
+    {
+      float size = i % 2 == 0 ? 10.f : -10.f;
+
+      graphene_rect_init (&rects[i], (float) i * 20.f, (float) i * -5.f, size, size * 0.5f);
+    }
+
+  graphene_matrix_init_scale (&m, 2.f, -3.f, 1.f);
+  graphene_matrix_translate (&m, &GRAPHENE_POINT3D_INIT (100.f, 50.f, 0.f));
+  graphene_matrix_transform_bounds_array (&m, 7, rects, res);
+
+  all_near = true;
+  for (unsigned int i = 0; i < 7; i++)
+    {
+      graphene_rect_t check;
+
+      graphene_matrix_transform_bounds (&m, &rects[i], &check);
+      all_near = all_near && rect_near (&res[i], &check, 0.001f);
+    }
+
+  mutest_expect ("transform_bounds_array() matches transform_bounds() for scale and translate",
+                 mutest_bool_value (all_near),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_init_rotate (&m, 30.f, graphene_vec3_z_axis ());
+  graphene_matrix_scale (&m, 1.5f, 0.5f, 1.f);
+  graphene_matrix_translate (&m, &GRAPHENE_POINT3D_INIT (100.f, 50.f, 0.f));
+  graphene_matrix_transform_bounds_array (&m, 7, rects, res);
+
+  all_near = true;
+  for (unsigned int i = 0; i < 7; i++)
+    {
+      graphene_rect_t check;
+
+      graphene_matrix_transform_bounds (&m, &rects[i], &check);
+      all_near = all_near && rect_near (&res[i], &check, 0.001f);
+    }
+
+  mutest_expect ("transform_bounds_array() matches transform_bounds() for rotations",
+                 mutest_bool_value (all_near),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_transform_bounds_array (&m, 7, rects, rects);
+
+  all_near = true;
+  for (unsigned int i = 0; i < 7; i++)
+    all_near = all_near && rect_near (&rects[i], &res[i], 0.001f);
+
+  mutest_expect ("transform_bounds_array() can transform in place",
+                 mutest_bool_value (all_near),
+                 mutest_to_be_true,
+                 NULL);
+}
+
 static void
 matrix_3d_transform_point (void)
 {
@@ -754,6 +876,164 @@ matrix_3d_transform_point (void)
                  NULL);
 }
 
+static void
+matrix_3d_transform_points_array (void)
+{
+  graphene_point3d_t points[7], res[7];
+  graphene_vec3_t vectors[7], vec3_res[7];
+  graphene_vec4_t vec4s[7], vec4_res[7];
+  graphene_matrix_t m;
+  bool all_near;
+
+  graphene_matrix_init_rotate (&m, 30.f, graphene_vec3_y_axis ());
+  graphene_matrix_translate (&m, &GRAPHENE_POINT3D_INIT (50.f, 70.f, -10.f));
+
+  for (unsigned int i = 0; i < 7; i++)
+    {
+      graphene_point3d_init (&points[i], (float) i, (float) i * -2.f, 1.f + (float) i * 0.5f);
+      graphene_point3d_to_vec3 (&points[i], &vectors[i]);
+      graphene_vec4_init_from_vec3 (&vec4s[i], &vectors[i], 1.f);
+    }
+
+  graphene_matrix_transform_points3d (&m, 7, points, res);
+  graphene_matrix_transform_vec3_array (&m, 7, vectors, vec3_res);
+  graphene_matrix_transform_vec4_array (&m, 7, vec4s, vec4_res);
+
+  all_near = true;
+  for (unsigned int i = 0; i < 7; i++)
+    {
+      graphene_point3d_t check;
+
+      graphene_matrix_transform_point3d (&m, &points[i], &check);
+      all_near = all_near && graphene_point3d_near (&res[i], &check, 0.0001f);
+    }
+
+  mutest_expect ("transform_points3d() matches transform_point3d() for each point",
+                 mutest_bool_value (all_near),
+                 mutest_to_be_true,
+                 NULL);
+
+  all_near = true;
+  for (unsigned int i = 0; i < 7; i++)
+    {
+      graphene_vec3_t check3;
+      graphene_vec4_t check4;
+
+      graphene_matrix_transform_vec3 (&m, &vectors[i], &check3);
+      graphene_matrix_transform_vec4 (&m, &vec4s[i], &check4);
+      all_near = all_near &&
+                 graphene_vec3_near (&vec3_res[i], &check3, 0.0001f) &&
+                 graphene_vec4_near (&vec4_res[i], &check4, 0.0001f);
+    }
+
+  mutest_expect ("transform_vec3_array() and transform_vec4_array() match the single vector variants",
+                 mutest_bool_value (all_near),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_transform_points3d (&m, 7, points, points);
+
+  all_near = true;
+  for (unsigned int i = 0; i < 7; i++)
+    all_near = all_near && graphene_point3d_near (&points[i], &res[i], 0.0001f);
+
+  mutest_expect ("transform_points3d() can transform in place",
+                 mutest_bool_value (all_near),
+                 mutest_to_be_true,
+                 NULL);
+}
+
+/* Transforms the eight vertices of @b, and checks that @res contains
+ * exactly the transformed vertices
+ */
+static bool
+box_near_transformed_vertices (const graphene_matrix_t *m,
+                               const graphene_box_t    *b,
+                               const graphene_box_t    *res)
+{
+  graphene_point3d_t min, max, check_min, check_max, vertices[8];
+  graphene_vec3_t v[8];
+  graphene_box_t check;
+
+  graphene_box_get_vertices (b, v);
+  for (unsigned int i = 0; i < 8; i++)
+    {
+      graphene_point3d_init_from_vec3 (&vertices[i], &v[i]);
+      graphene_matrix_transform_point3d (m, &vertices[i], &vertices[i]);
+    }
+
+  graphene_box_init_from_points (&check, 8, vertices);
+  graphene_box_get_minmax (res, &min, &max);
+  graphene_box_get_minmax (&check, &check_min, &check_max);
+
+  return graphene_point3d_near (&min, &check_min, 0.001f) &&
+         graphene_point3d_near (&max, &check_max, 0.001f);
+}
+
+static void
+matrix_3d_transform_boxes (void)
+{
+  graphene_box_t boxes[9], res[9];
+  graphene_matrix_t m, projection;
+  bool all_near;
+
+  graphene_matrix_init_rotate (&m, 30.f, graphene_vec3_y_axis ());
+  graphene_matrix_rotate (&m, 20.f, graphene_vec3_x_axis ());
+  graphene_matrix_scale (&m, 2.f, 0.5f, -1.f);
+  graphene_matrix_translate (&m, &GRAPHENE_POINT3D_INIT (50.f, 70.f, -10.f));
+
+  for (unsigned int i = 0; i < 9; i++)
+    graphene_box_init (&boxes[i],
+                       &GRAPHENE_POINT3D_INIT ((float) i, (float) i * -2.f, 1.f),
+                       &GRAPHENE_POINT3D_INIT ((float) i * 2.f + 1.f, (float) i, 2.f + (float) i * 0.5f));
+
+  all_near = true;
+  for (unsigned int i = 0; i < 9; i++)
+    {
+      graphene_matrix_transform_box (&m, &boxes[i], &res[i]);
+      all_near = all_near && box_near_transformed_vertices (&m, &boxes[i], &res[i]);
+    }
+
+  mutest_expect ("transform_box() returns the bounds of the transformed vertices",
+                 mutest_bool_value (all_near),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_transform_boxes (&m, 9, boxes, boxes);
+
+  all_near = true;
+  for (unsigned int i = 0; i < 9; i++)
+    all_near = all_near && graphene_box_equal (&boxes[i], &res[i]);
+
+  mutest_expect ("transform_boxes() matches transform_box() in place",
+                 mutest_bool_value (all_near),
+                 mutest_to_be_true,
+                 NULL);
+
+  /* Points are not divided by w, so the bounds are the same */
+  graphene_matrix_init_perspective (&projection, 60.f, 1.f, 1.f, 100.f);
+  graphene_box_init (&boxes[0],
+                     &GRAPHENE_POINT3D_INIT (-1.f, -2.f, -10.f),
+                     &GRAPHENE_POINT3D_INIT (3.f, 2.f, -5.f));
+  graphene_matrix_transform_box (&projection, &boxes[0], &res[0]);
+  mutest_expect ("transform_box() with a projection returns the bounds of the transformed vertices",
+                 mutest_bool_value (box_near_transformed_vertices (&projection, &boxes[0], &res[0])),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_transform_box (&m, graphene_box_empty (), &res[0]);
+  mutest_expect ("transform_box() keeps empty boxes empty",
+                 mutest_bool_value (graphene_box_equal (&res[0], graphene_box_empty ())),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_transform_box (&m, graphene_box_infinite (), &res[0]);
+  mutest_expect ("transform_box() keeps infinite boxes infinite",
+                 mutest_bool_value (graphene_box_equal (&res[0], graphene_box_infinite ())),
+                 mutest_to_be_true,
+                 NULL);
+}
+
 static void
 matrix_decompose_3d (void)
 {
@@ -784,6 +1064,84 @@ matrix_decompose_3d (void)
                  NULL);
 }
 
+static void
+matrix_trs (void)
+{
+  graphene_vec3_t t[4], s[4], dt, ds, sh;
+  graphene_quaternion_t r[4], dr;
+  graphene_matrix_t m[4], expected, res;
+  graphene_vec4_t p;
+  bool near = true;
+
+  for (unsigned int i = 0; i < 4; i++)
+    {
+      graphene_vec3_init (&t[i], 1.f + i, -2.f * i, 3.f);
+      graphene_quaternion_init_from_angles (&r[i], 30.f * i, 45.f, 20.f + 10.f * i);
+      graphene_vec3_init (&s[i], 2.f, 0.5f + i, i == 3 ? -1.5f : 3.f);
+    }
+
+  graphene_matrix_init_trs_array (4, t, r, s, m);
+
+  for (unsigned int i = 0; i < 4; i++)
+    {
+      graphene_matrix_init_scale (&expected,
+                                  graphene_vec3_get_x (&s[i]),
+                                  graphene_vec3_get_y (&s[i]),
+                                  graphene_vec3_get_z (&s[i]));
+      graphene_matrix_rotate_quaternion (&expected, &r[i]);
+      graphene_matrix_translate (&expected,
+                                 &GRAPHENE_POINT3D_INIT (graphene_vec3_get_x (&t[i]),
+                                                         graphene_vec3_get_y (&t[i]),
+                                                         graphene_vec3_get_z (&t[i])));
+
+      graphene_matrix_init_trs (&res, &t[i], &r[i], &s[i]);
+      if (!graphene_matrix_near (&res, &expected, 0.0001f) || !graphene_matrix_equal_fast (&res, &m[i]))
+        near = false;
+    }
+
+  mutest_expect ("init_trs() to match scaling, rotating, and translating",
+                 mutest_bool_value (near),
+                 mutest_to_be_true,
+                 NULL);
+
+  mutest_expect ("a TRS matrix to be decomposed",
+                 mutest_bool_value (graphene_matrix_decompose (&m[1], &dt, &ds, &dr, &sh, &p)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("decompose() to return the translation of a TRS matrix",
+                 mutest_bool_value (graphene_vec3_near (&dt, &t[1], 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("decompose() to return the scale of a TRS matrix",
+                 mutest_bool_value (graphene_vec3_near (&ds, &s[1], 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("decompose() to return the rotation of a TRS matrix",
+                 mutest_bool_value (fabsf (graphene_quaternion_dot (&dr, &r[1])) > 0.9999f),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("decompose() to return no shear and no perspective for a TRS matrix",
+                 mutest_bool_value (graphene_vec3_near (&sh, graphene_vec3_zero (), 0.0001f) &&
+                                    graphene_vec4_equal (&p, graphene_vec4_w_axis ())),
+                 mutest_to_be_true,
+                 NULL);
+
+  /* A negative scale is decomposed as a flip of all the axes */
+  graphene_matrix_decompose (&m[3], &dt, &ds, &dr, &sh, &p);
+  graphene_matrix_init_trs (&res, &dt, &dr, &ds);
+  mutest_expect ("init_trs() to invert decompose() for a flipped TRS matrix",
+                 mutest_bool_value (graphene_matrix_near (&res, &m[3], 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_vec3_init (&s[0], 1.f, 1.f, 0.f);
+  graphene_matrix_init_trs (&res, &t[0], &r[0], &s[0]);
+  mutest_expect ("a singular affine matrix to not be decomposed",
+                 mutest_bool_value (graphene_matrix_decompose (&res, &dt, &ds, &dr, &sh, &p)),
+                 mutest_to_be_false,
+                 NULL);
+}
+
 static void
 matrix_suite (void)
 {
@@ -805,8 +1163,13 @@ matrix_suite (void)
   mutest_it ("supports round-trips with affine matrices", matrix_2d_round_trip);
   mutest_it ("can interpolate 2D transformations", matrix_2d_interpolate);
   mutest_it ("can transform 2D bounds", matrix_2d_transform_bound);
+  mutest_it ("can transform arrays of 2D bounds", matrix_2d_transform_bounds_array);
   mutest_it ("can transform 3D points", matrix_3d_transform_point);
+  mutest_it ("can transform arrays of 3D points and vectors", matrix_3d_transform_points_array);
+  mutest_it ("can transform 3D boxes", matrix_3d_transform_boxes);
   mutest_it ("can decompose a 3D matrix", matrix_decompose_3d);
+  mutest_it ("can compose and decompose TRS matrices", matrix_trs);
+  mutest_it ("can invert affine and rigid matrices", matrix_invert_affine);
 }
 
 MUTEST_MAIN (
@@ -0,0 +1,350 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include <graphene.h>
+#include <mutest.h>
+
+#define N_POINTS        (5 * 5 * 5)
+
+/* An oriented box with half extents (4, 2, 1), rotated around an
+ * arbitrary axis
+ */
+static void
+rotated_obb (graphene_obb_t    *obb,
+             graphene_matrix_t *rotation)
+{
+  graphene_obb_t local;
+  graphene_vec3_t axis;
+
+  graphene_vec3_init (&axis, 1.f, 2.f, 3.f);
+  graphene_matrix_init_rotate (rotation, 35.f, &axis);
+  graphene_matrix_translate (rotation, &GRAPHENE_POINT3D_INIT (10.f, -5.f, 2.f));
+
+  graphene_obb_init (&local, NULL, graphene_vec3_init (&axis, 4.f, 2.f, 1.f), NULL, NULL, NULL);
+  graphene_matrix_transform_obb (rotation, &local, obb);
+}
+
+static void
+obb_init_from_box (void)
+{
+  graphene_box_t box, bounds;
+  graphene_point3d_t center;
+  graphene_vec3_t half_extents, x_axis;
+  graphene_obb_t obb;
+
+  graphene_box_init (&box,
+                     &GRAPHENE_POINT3D_INIT (-1.f, 0.f, 2.f),
+                     &GRAPHENE_POINT3D_INIT (3.f, 2.f, 3.f));
+  graphene_obb_init_from_box (&obb, &box);
+
+  graphene_obb_get_center (&obb, &center);
+  graphene_obb_get_half_extents (&obb, &half_extents);
+  graphene_obb_get_axes (&obb, &x_axis, NULL, NULL);
+  graphene_obb_get_bounding_box (&obb, &bounds);
+
+  mutest_expect ("the center to be the center of the box",
+                 mutest_bool_value (graphene_point3d_equal (&center, &GRAPHENE_POINT3D_INIT (1.f, 1.f, 2.5f))),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("the half extents to be half the size of the box",
+                 mutest_bool_value (graphene_vec3_equal (&half_extents, graphene_vec3_init (&x_axis, 2.f, 1.f, 0.5f))),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("the volume to be the volume of the box",
+                 mutest_float_value (graphene_obb_get_volume (&obb)),
+                 mutest_to_be_close_to, 8.0, 0.0001,
+                 NULL);
+  mutest_expect ("the bounding box to be the original box",
+                 mutest_bool_value (graphene_box_equal (&bounds, &box)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_obb_init_from_box (&obb, graphene_box_empty ());
+  mutest_expect ("an empty box to have no volume",
+                 mutest_float_value (graphene_obb_get_volume (&obb)),
+                 mutest_to_be_close_to, 0.0, 0.0001,
+                 NULL);
+}
+
+static void
+obb_init_from_points (void)
+{
+  graphene_point3d_t points[N_POINTS], center;
+  graphene_vec3_t half_extents, axes[3], expected_axes[3], v;
+  graphene_matrix_t rotation;
+  graphene_obb_t obb, expected, grown;
+  bool aligned = true, contained = true;
+
+  rotated_obb (&expected, &rotation);
+
+  /* A grid of points filling the box */
+  for (unsigned int i = 0; i < N_POINTS; i++)
+    {
+      graphene_point3d_init (&points[i],
+                             (float) ((int) (i % 5) - 2) * 2.f,
+                             (float) ((int) (i / 5 % 5) - 2),
+                             (float) ((int) (i / 25) - 2) * 0.5f);
+      graphene_matrix_transform_point3d (&rotation, &points[i], &points[i]);
+    }
+
+  graphene_obb_init_from_points (&obb, N_POINTS, points);
+  graphene_obb_get_center (&obb, &center);
+  graphene_obb_get_half_extents (&obb, &half_extents);
+  graphene_obb_get_axes (&obb, &axes[0], &axes[1], &axes[2]);
+  graphene_obb_get_axes (&expected, &expected_axes[0], &expected_axes[1], &expected_axes[2]);
+
+  for (int i = 0; i < 3; i++)
+    {
+      if (fabsf (graphene_vec3_dot (&axes[i], &expected_axes[i])) < 0.9999f)
+        aligned = false;
+    }
+
+  mutest_expect ("the axes to follow the principal directions of the points",
+                 mutest_bool_value (aligned),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("the half extents to fit the points",
+                 mutest_bool_value (graphene_vec3_near (&half_extents, graphene_vec3_init (&v, 4.f, 2.f, 1.f), 0.001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  /* Allow for rounding errors on the surface of the box */
+  graphene_vec3_add (&half_extents, graphene_vec3_init (&v, 1e-4f, 1e-4f, 1e-4f), &half_extents);
+  graphene_obb_init (&grown, &center, &half_extents, &axes[0], &axes[1], &axes[2]);
+
+  for (unsigned int i = 0; i < N_POINTS; i++)
+    {
+      if (!graphene_obb_contains_point (&grown, &points[i]))
+        contained = false;
+    }
+
+  mutest_expect ("the box to contain all the points",
+                 mutest_bool_value (contained),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_obb_init_from_points (&obb, 0, NULL);
+  mutest_expect ("an empty set of points to have no volume",
+                 mutest_float_value (graphene_obb_get_volume (&obb)),
+                 mutest_to_be_close_to, 0.0, 0.0001,
+                 NULL);
+}
+
+static void
+obb_transform (void)
+{
+  graphene_vec3_t half_extents, v;
+  graphene_matrix_t rotation;
+  graphene_box_t box, aabb;
+  graphene_obb_t obb;
+
+  rotated_obb (&obb, &rotation);
+  graphene_obb_get_half_extents (&obb, &half_extents);
+
+  mutest_expect ("a rotation to keep the half extents",
+                 mutest_bool_value (graphene_vec3_near (&half_extents, graphene_vec3_init (&v, 4.f, 2.f, 1.f), 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("a rotation to keep the volume",
+                 mutest_float_value (graphene_obb_get_volume (&obb)),
+                 mutest_to_be_close_to, 64.0, 0.001,
+                 NULL);
+
+  /* The same rotation applied to an axis aligned box grows it */
+  graphene_box_init (&box,
+                     &GRAPHENE_POINT3D_INIT (-4.f, -2.f, -1.f),
+                     &GRAPHENE_POINT3D_INIT (4.f, 2.f, 1.f));
+  graphene_matrix_transform_box (&rotation, &box, &aabb);
+
+  mutest_expect ("the transformed axis aligned box to be larger",
+                 mutest_float_value (graphene_box_get_width (&aabb) *
+                                     graphene_box_get_height (&aabb) *
+                                     graphene_box_get_depth (&aabb)),
+                 mutest_to_be_greater_than, 64.0 * 1.5,
+                 NULL);
+
+  graphene_matrix_init_scale (&rotation, 2.f, 1.f, 3.f);
+  graphene_obb_init (&obb, NULL, graphene_vec3_init (&v, 1.f, 1.f, 1.f), NULL, NULL, NULL);
+  graphene_matrix_transform_obb (&rotation, &obb, &obb);
+  graphene_obb_get_half_extents (&obb, &half_extents);
+
+  mutest_expect ("a scale to scale the half extents",
+                 mutest_bool_value (graphene_vec3_near (&half_extents, graphene_vec3_init (&v, 2.f, 1.f, 3.f), 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+}
+
+static void
+obb_intersects_obb (void)
+{
+  graphene_vec3_t half_extents, x_axis, y_axis, z_axis;
+  graphene_matrix_t rotation;
+  graphene_obb_t a, b;
+
+  graphene_obb_init (&a, NULL, graphene_vec3_init (&half_extents, 1.f, 1.f, 1.f), NULL, NULL, NULL);
+
+  graphene_obb_init (&b, &GRAPHENE_POINT3D_INIT (1.5f, 0.f, 0.f), &half_extents, NULL, NULL, NULL);
+  mutest_expect ("overlapping boxes to intersect",
+                 mutest_bool_value (graphene_obb_intersects_obb (&a, &b)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_obb_init (&b, &GRAPHENE_POINT3D_INIT (2.5f, 0.f, 0.f), &half_extents, NULL, NULL, NULL);
+  mutest_expect ("boxes separated along a face axis to not intersect",
+                 mutest_bool_value (graphene_obb_intersects_obb (&a, &b)),
+                 mutest_to_be_false,
+                 NULL);
+
+  /* A box rotated by 45 degrees around Z, with a corner pointing at @a */
+  graphene_matrix_init_rotate (&rotation, 45.f, graphene_vec3_z_axis ());
+  graphene_matrix_transform_vec3 (&rotation, graphene_vec3_x_axis (), &x_axis);
+  graphene_matrix_transform_vec3 (&rotation, graphene_vec3_y_axis (), &y_axis);
+  graphene_vec3_init_from_vec3 (&z_axis, graphene_vec3_z_axis ());
+
+  graphene_obb_init (&b, &GRAPHENE_POINT3D_INIT (2.3f, 0.f, 0.f), &half_extents, &x_axis, &y_axis, &z_axis);
+  mutest_expect ("a rotated box whose corner is inside to intersect",
+                 mutest_bool_value (graphene_obb_intersects_obb (&a, &b)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_obb_init (&b, &GRAPHENE_POINT3D_INIT (2.5f, 0.f, 0.f), &half_extents, &x_axis, &y_axis, &z_axis);
+  mutest_expect ("a rotated box separated along its own axes to not intersect",
+                 mutest_bool_value (graphene_obb_intersects_obb (&a, &b)),
+                 mutest_to_be_false,
+                 NULL);
+
+  /* A box rotated by 45 degrees around X, under a box rotated by 45
+   * degrees around Y: the edges facing each other cross, and the boxes
+   * are only separated along Z, the cross product of these edges
+   */
+  graphene_matrix_init_rotate (&rotation, 45.f, graphene_vec3_x_axis ());
+  graphene_matrix_transform_vec3 (&rotation, graphene_vec3_y_axis (), &y_axis);
+  graphene_matrix_transform_vec3 (&rotation, graphene_vec3_z_axis (), &z_axis);
+  graphene_obb_init (&a, NULL, &half_extents, NULL, &y_axis, &z_axis);
+
+  graphene_matrix_init_rotate (&rotation, 45.f, graphene_vec3_y_axis ());
+  graphene_matrix_transform_vec3 (&rotation, graphene_vec3_x_axis (), &x_axis);
+  graphene_matrix_transform_vec3 (&rotation, graphene_vec3_z_axis (), &z_axis);
+
+  graphene_obb_init (&b, &GRAPHENE_POINT3D_INIT (0.f, 0.f, 2.7f), &half_extents, &x_axis, NULL, &z_axis);
+  mutest_expect ("boxes with crossing edges to intersect",
+                 mutest_bool_value (graphene_obb_intersects_obb (&a, &b)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_obb_init (&b, &GRAPHENE_POINT3D_INIT (0.f, 0.f, 2.9f), &half_extents, &x_axis, NULL, &z_axis);
+  mutest_expect ("boxes separated along an edge axis to not intersect",
+                 mutest_bool_value (graphene_obb_intersects_obb (&a, &b)),
+                 mutest_to_be_false,
+                 NULL);
+}
+
+static void
+obb_intersects_frustum (void)
+{
+  graphene_vec3_t half_extents;
+  graphene_matrix_t projection;
+  graphene_frustum_t f;
+  graphene_obb_t obb;
+
+  /* Looking down -Z, with the near plane at 1 and the far plane at 100 */
+  graphene_matrix_init_perspective (&projection, 90.f, 1.f, 1.f, 100.f);
+  graphene_frustum_init_from_matrix (&f, &projection);
+
+  graphene_vec3_init (&half_extents, 1.f, 1.f, 1.f);
+
+  graphene_obb_init (&obb, &GRAPHENE_POINT3D_INIT (0.f, 0.f, -10.f), &half_extents, NULL, NULL, NULL);
+  mutest_expect ("a box inside the frustum to intersect",
+                 mutest_bool_value (graphene_frustum_intersects_obb (&f, &obb)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_obb_init (&obb, &GRAPHENE_POINT3D_INIT (0.f, 0.f, 10.f), &half_extents, NULL, NULL, NULL);
+  mutest_expect ("a box behind the camera to not intersect",
+                 mutest_bool_value (graphene_frustum_intersects_obb (&f, &obb)),
+                 mutest_to_be_false,
+                 NULL);
+
+  graphene_obb_init (&obb, &GRAPHENE_POINT3D_INIT (10.5f, 0.f, -10.f), &half_extents, NULL, NULL, NULL);
+  mutest_expect ("a box crossing a plane to intersect",
+                 mutest_bool_value (graphene_frustum_intersects_obb (&f, &obb)),
+                 mutest_to_be_true,
+                 NULL);
+
+  /* A box outside the far right edge of the frustum, crossing both the
+   * far plane and the right plane, and rejected by neither of them
+   */
+  graphene_obb_init (&obb, &GRAPHENE_POINT3D_INIT (110.f, 0.f, -104.5f),
+                     graphene_vec3_init (&half_extents, 5.f, 5.f, 5.5f),
+                     NULL, NULL, NULL);
+  mutest_expect ("a box near a corner of the frustum to not intersect",
+                 mutest_bool_value (graphene_frustum_intersects_obb (&f, &obb)),
+                 mutest_to_be_false,
+                 NULL);
+}
+
+static void
+obb_intersect_ray (void)
+{
+  graphene_vec3_t half_extents, x_axis, y_axis, origin, direction;
+  graphene_matrix_t rotation;
+  graphene_ray_t r;
+  graphene_obb_t obb;
+  float t = 0.f;
+
+  /* A box rotated by 45 degrees around Z, with a corner at (-√2, 0, 0) */
+  graphene_matrix_init_rotate (&rotation, 45.f, graphene_vec3_z_axis ());
+  graphene_matrix_transform_vec3 (&rotation, graphene_vec3_x_axis (), &x_axis);
+  graphene_matrix_transform_vec3 (&rotation, graphene_vec3_y_axis (), &y_axis);
+  graphene_obb_init (&obb, NULL, graphene_vec3_init (&half_extents, 1.f, 1.f, 1.f),
+                     &x_axis, &y_axis, NULL);
+
+  graphene_ray_init_from_vec3 (&r,
+                               graphene_vec3_init (&origin, -5.f, 0.f, 0.f),
+                               graphene_vec3_init (&direction, 1.f, 0.f, 0.f));
+  mutest_expect ("a ray towards the box to enter it",
+                 mutest_int_value (graphene_ray_intersect_obb (&r, &obb, &t)),
+                 mutest_to_be, GRAPHENE_RAY_INTERSECTION_KIND_ENTER,
+                 NULL);
+  mutest_expect ("the distance to be the distance of the corner",
+                 mutest_float_value (t),
+                 mutest_to_be_close_to, 5.0 - 1.41421356, 0.0001,
+                 NULL);
+
+  /* Would hit the axis aligned bounds of the box, but not the box */
+  graphene_ray_init_from_vec3 (&r,
+                               graphene_vec3_init (&origin, -1.3f, 1.3f, 5.f),
+                               graphene_vec3_init (&direction, 0.f, 0.f, -1.f));
+  mutest_expect ("a ray that misses the box to not intersect it",
+                 mutest_bool_value (graphene_ray_intersects_obb (&r, &obb)),
+                 mutest_to_be_false,
+                 NULL);
+
+  graphene_ray_init_from_vec3 (&r,
+                               graphene_vec3_init (&origin, 0.f, 0.f, 0.f),
+                               graphene_vec3_init (&direction, 0.f, 1.f, 0.f));
+  mutest_expect ("a ray from inside the box to leave it",
+                 mutest_int_value (graphene_ray_intersect_obb (&r, &obb, &t)),
+                 mutest_to_be, GRAPHENE_RAY_INTERSECTION_KIND_LEAVE,
+                 NULL);
+  mutest_expect ("the distance to be the distance of the corner",
+                 mutest_float_value (t),
+                 mutest_to_be_close_to, 1.41421356, 0.0001,
+                 NULL);
+}
+
+static void
+obb_suite (void)
+{
+  mutest_it ("initializes from axis aligned boxes", obb_init_from_box);
+  mutest_it ("initializes from points", obb_init_from_points);
+  mutest_it ("keeps its shape under rotations", obb_transform);
+  mutest_it ("intersects oriented boxes", obb_intersects_obb);
+  mutest_it ("intersects frustums", obb_intersects_frustum);
+  mutest_it ("intersects rays", obb_intersect_ray);
+}
+
+MUTEST_MAIN (
+  mutest_describe ("graphene_obb_t", obb_suite);
+)
@@ -0,0 +1,221 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdlib.h>
+#include <string.h>
+#include <graphene.h>
+#include <mutest.h>
+
+#include "graphene-test-utils.h"
+
+/* Large enough to be split into many chunks */
+#define N_ITEMS         200003
+
+static graphene_point3d_t *
+random_points (void)
+{
+  graphene_point3d_t *res = malloc (sizeof (graphene_point3d_t) * N_ITEMS);
+
+  random_seed (1);
+
+  for (unsigned int i = 0; i < N_ITEMS; i++)
+    graphene_point3d_init (&res[i],
+                           random_float (-100.f, 100.f),
+                           random_float (-100.f, 100.f),
+                           random_float (-100.f, 100.f));
+
+  return res;
+}
+
+static unsigned int n_executor_calls;
+
+/* Runs the tasks backwards, to check that the order does not matter */
+static void
+reverse_executor (unsigned int                   n_tasks,
+                  graphene_parallel_task_func_t  func,
+                  void                          *data,
+                  void                          *user_data)
+{
+  unsigned int *n_tasks_run = user_data;
+
+  n_executor_calls += 1;
+
+  for (unsigned int i = n_tasks; i-- > 0;)
+    {
+      func (i, data);
+      *n_tasks_run += 1;
+    }
+}
+
+static void
+parallel_n_threads (void)
+{
+  graphene_parallel_set_n_threads (3);
+  mutest_expect ("get_n_threads() to return the number of threads",
+                 mutest_int_value (graphene_parallel_get_n_threads ()),
+                 mutest_to_be, 3,
+                 NULL);
+
+  graphene_parallel_set_n_threads (0);
+  mutest_expect ("set_n_threads(0) to use at least one thread",
+                 mutest_int_value (graphene_parallel_get_n_threads ()),
+                 mutest_to_be_greater_than_or_equal, 1.0,
+                 NULL);
+
+  graphene_parallel_set_n_threads (1);
+  mutest_expect ("set_n_threads(1) to disable parallel execution",
+                 mutest_int_value (graphene_parallel_get_n_threads ()),
+                 mutest_to_be, 1,
+                 NULL);
+}
+
+/* Runs the same batch operations serially, with a thread pool, and with
+ * an executor, and checks that the results are the same
+ */
+static void
+parallel_batch_results (void)
+{
+  graphene_point3d_t *points = random_points ();
+  graphene_point3d_t *serial_res = malloc (sizeof (graphene_point3d_t) * N_ITEMS);
+  graphene_point3d_t *res = malloc (sizeof (graphene_point3d_t) * N_ITEMS);
+  graphene_box_t *boxes = malloc (sizeof (graphene_box_t) * N_ITEMS);
+  uint32_t *serial_visible = malloc (sizeof (uint32_t) * (N_ITEMS + 31) / 32);
+  uint32_t *visible = malloc (sizeof (uint32_t) * (N_ITEMS + 31) / 32);
+  unsigned int serial_n_visible, n_visible;
+  unsigned int n_tasks_run = 0;
+  graphene_box_t serial_bounds, bounds;
+  graphene_frustum_t f;
+  graphene_matrix_t m, p;
+
+  for (unsigned int i = 0; i < N_ITEMS; i++)
+    graphene_box_init (&boxes[i],
+                       &points[i],
+                       &GRAPHENE_POINT3D_INIT (points[i].x + 1.f, points[i].y + 1.f, points[i].z + 1.f));
+
+  graphene_matrix_init_rotate (&m, 30.f, graphene_vec3_y_axis ());
+  graphene_matrix_translate (&m, &GRAPHENE_POINT3D_INIT (1.f, 2.f, 3.f));
+  graphene_matrix_init_perspective (&p, 60.f, 1.f, 1.f, 100.f);
+  graphene_frustum_init_from_matrix (&f, &p);
+
+  graphene_parallel_set_n_threads (1);
+  graphene_matrix_transform_points3d (&m, N_ITEMS, points, serial_res);
+  serial_n_visible = graphene_frustum_cull_boxes (&f, N_ITEMS, boxes, serial_visible);
+  graphene_box_init_from_points (&serial_bounds, N_ITEMS, points);
+
+  graphene_parallel_set_n_threads (4);
+  graphene_matrix_transform_points3d (&m, N_ITEMS, points, res);
+  n_visible = graphene_frustum_cull_boxes (&f, N_ITEMS, boxes, visible);
+  graphene_box_init_from_points (&bounds, N_ITEMS, points);
+
+  mutest_expect ("transform_points3d() to not depend on the number of threads",
+                 mutest_bool_value (memcmp (res, serial_res, sizeof (graphene_point3d_t) * N_ITEMS) == 0),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("cull_boxes() to return the same count on multiple threads",
+                 mutest_int_value (n_visible),
+                 mutest_to_be, serial_n_visible,
+                 NULL);
+  mutest_expect ("cull_boxes() to return the same bitmask on multiple threads",
+                 mutest_bool_value (memcmp (visible, serial_visible, sizeof (uint32_t) * (N_ITEMS / 32)) == 0),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("init_from_points() to return the same bounds on multiple threads",
+                 mutest_bool_value (graphene_box_equal (&bounds, &serial_bounds)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_parallel_set_executor (reverse_executor, &n_tasks_run);
+  memset (res, 0, sizeof (graphene_point3d_t) * N_ITEMS);
+  graphene_matrix_transform_points3d (&m, N_ITEMS, points, res);
+  graphene_box_init_from_points (&bounds, N_ITEMS, points);
+
+  mutest_expect ("the executor to be used for large arrays",
+                 mutest_int_value (n_executor_calls),
+                 mutest_to_be, 2,
+                 NULL);
+  mutest_expect ("the executor to run more than one task",
+                 mutest_int_value (n_tasks_run),
+                 mutest_to_be_greater_than, 2.0,
+                 NULL);
+  mutest_expect ("the executor to return the same transformed points",
+                 mutest_bool_value (memcmp (res, serial_res, sizeof (graphene_point3d_t) * N_ITEMS) == 0),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("the executor to return the same bounds",
+                 mutest_bool_value (graphene_box_equal (&bounds, &serial_bounds)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_transform_points3d (&m, 16, points, res);
+  mutest_expect ("the executor to not be used for small arrays",
+                 mutest_int_value (n_executor_calls),
+                 mutest_to_be, 2,
+                 NULL);
+
+  graphene_parallel_set_executor (NULL, NULL);
+  graphene_parallel_set_n_threads (1);
+
+  free (visible);
+  free (serial_visible);
+  free (boxes);
+  free (res);
+  free (serial_res);
+  free (points);
+}
+
+static void
+parallel_transform_hierarchy (void)
+{
+  const unsigned int n_nodes = 50000;
+  unsigned int *parents = malloc (sizeof (unsigned int) * n_nodes);
+  graphene_transform_hierarchy_t *serial, *h;
+  graphene_matrix_t m;
+
+  for (unsigned int i = 0; i < n_nodes; i++)
+    parents[i] = i == 0 ? GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT : (i - 1) / 4;
+
+  serial = graphene_transform_hierarchy_new (n_nodes, parents);
+  h = graphene_transform_hierarchy_new (n_nodes, parents);
+
+  for (unsigned int i = 0; i < n_nodes; i++)
+    {
+      graphene_matrix_init_rotate (&m, (float) (i % 360), graphene_vec3_z_axis ());
+      graphene_matrix_translate (&m, &GRAPHENE_POINT3D_INIT (1.f, 0.f, 0.f));
+      graphene_transform_hierarchy_set_local (serial, i, &m);
+      graphene_transform_hierarchy_set_local (h, i, &m);
+    }
+
+  graphene_parallel_set_n_threads (1);
+  graphene_transform_hierarchy_update (serial);
+
+  graphene_parallel_set_n_threads (4);
+  mutest_expect ("a parallel update to update all the nodes",
+                 mutest_int_value (graphene_transform_hierarchy_update (h)),
+                 mutest_to_be, n_nodes,
+                 NULL);
+  mutest_expect ("a parallel update to return the same world matrices",
+                 mutest_bool_value (memcmp (graphene_transform_hierarchy_get_world_matrices (h),
+                                            graphene_transform_hierarchy_get_world_matrices (serial),
+                                            sizeof (graphene_matrix_t) * n_nodes) == 0),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_parallel_set_n_threads (1);
+
+  graphene_transform_hierarchy_free (h);
+  graphene_transform_hierarchy_free (serial);
+  free (parents);
+}
+
+static void
+parallel_suite (void)
+{
+  mutest_it ("sets the number of threads", parallel_n_threads);
+  mutest_it ("returns the same results on multiple threads", parallel_batch_results);
+  mutest_it ("updates transform hierarchies", parallel_transform_hierarchy);
+}
+
+MUTEST_MAIN (
+  mutest_describe ("graphene_parallel", parallel_suite);
+)
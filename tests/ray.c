@@ -340,6 +340,223 @@ ray_picking (void)
                  NULL);
 }
 
+static void
+ray_packet_intersect (void)
+{
+  graphene_ray_t rays[4];
+  graphene_ray_packet_t packet;
+  graphene_box_t box;
+  graphene_sphere_t sphere;
+  graphene_triangle_t triangle;
+  float t_packet[4];
+  unsigned int mask;
+  bool all_match;
+
+  graphene_ray_init (&rays[0], &GRAPHENE_POINT3D_INIT (0.f, 0.f, -10.f), graphene_vec3_z_axis ());
+  graphene_ray_init (&rays[1], &GRAPHENE_POINT3D_INIT (0.5f, 0.5f, -10.f), graphene_vec3_z_axis ());
+  graphene_ray_init (&rays[2], &GRAPHENE_POINT3D_INIT (5.f, 5.f, -10.f), graphene_vec3_z_axis ());
+  graphene_ray_init (&rays[3], &GRAPHENE_POINT3D_INIT (0.f, 0.f, 0.f), graphene_vec3_x_axis ());
+  graphene_ray_packet_init (&packet, 4, rays);
+
+  graphene_box_init (&box,
+                     &GRAPHENE_POINT3D_INIT (-1.f, -1.f, -1.f),
+                     &GRAPHENE_POINT3D_INIT (1.f, 1.f, 1.f));
+  graphene_sphere_init (&sphere, &GRAPHENE_POINT3D_INIT (0.f, 0.f, 0.f), 1.f);
+  graphene_triangle_init_from_point3d (&triangle,
+                                       &GRAPHENE_POINT3D_INIT (-1.f, -1.f, 0.f),
+                                       &GRAPHENE_POINT3D_INIT (1.f, -1.f, 0.f),
+                                       &GRAPHENE_POINT3D_INIT (0.f, 1.f, 0.f));
+
+  mask = graphene_ray_packet_intersect_box (&packet, &box, t_packet);
+  all_match = true;
+  for (unsigned int i = 0; i < 4; i++)
+    {
+      float t;
+      bool hit = graphene_ray_intersect_box (&rays[i], &box, &t) != GRAPHENE_RAY_INTERSECTION_KIND_NONE;
+
+      all_match = all_match && hit == ((mask & (1u << i)) != 0) && fabsf (t - t_packet[i]) < 0.001f;
+    }
+
+  mutest_expect ("packet intersection with a box to match single rays",
+                 mutest_bool_value (all_match && mask == 0xb),
+                 mutest_to_be_true,
+                 NULL);
+
+  mask = graphene_ray_packet_intersect_sphere (&packet, &sphere, t_packet);
+  all_match = true;
+  for (unsigned int i = 0; i < 4; i++)
+    {
+      float t;
+      bool hit = graphene_ray_intersect_sphere (&rays[i], &sphere, &t) != GRAPHENE_RAY_INTERSECTION_KIND_NONE;
+
+      all_match = all_match && hit == ((mask & (1u << i)) != 0) && fabsf (t - t_packet[i]) < 0.001f;
+    }
+
+  mutest_expect ("packet intersection with a sphere to match single rays",
+                 mutest_bool_value (all_match && mask == 0xb),
+                 mutest_to_be_true,
+                 NULL);
+
+  mask = graphene_ray_packet_intersect_triangle (&packet, &triangle, t_packet);
+  all_match = true;
+  for (unsigned int i = 0; i < 4; i++)
+    {
+      float t = 0.f;
+      bool hit = graphene_ray_intersect_triangle (&rays[i], &triangle, &t) != GRAPHENE_RAY_INTERSECTION_KIND_NONE;
+
+      all_match = all_match && hit == ((mask & (1u << i)) != 0) && fabsf (t - t_packet[i]) < 0.001f;
+    }
+
+  mutest_expect ("packet intersection with a triangle to match single rays",
+                 mutest_bool_value (all_match && mask == 0x1),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("packet intersection distance with a triangle to be valid",
+                 mutest_float_value (t_packet[0]),
+                 mutest_to_be_close_to, 10.0, 0.001,
+                 NULL);
+
+  graphene_ray_packet_init (&packet, 2, &rays[2]);
+  mutest_expect ("partial packets to only report the rays they contain",
+                 mutest_bool_value (graphene_ray_packet_get_n_rays (&packet) == 2 &&
+                                    graphene_ray_packet_intersect_box (&packet, &box, NULL) == 0x2),
+                 mutest_to_be_true,
+                 NULL);
+}
+
+static void
+ray_packet8_intersect (void)
+{
+  graphene_ray_t rays[8];
+  graphene_ray_packet8_t packet;
+  graphene_vec3_t minus_z;
+  graphene_box_t box;
+  graphene_sphere_t sphere;
+  graphene_triangle_t triangle;
+  float t_packet[8];
+  unsigned int masks[3];
+  bool all_match = true;
+
+  graphene_vec3_negate (graphene_vec3_z_axis (), &minus_z);
+
+  graphene_ray_init (&rays[0], &GRAPHENE_POINT3D_INIT (0.f, 0.f, -10.f), graphene_vec3_z_axis ());
+  graphene_ray_init (&rays[1], &GRAPHENE_POINT3D_INIT (0.5f, 0.5f, -10.f), graphene_vec3_z_axis ());
+  graphene_ray_init (&rays[2], &GRAPHENE_POINT3D_INIT (5.f, 5.f, -10.f), graphene_vec3_z_axis ());
+  graphene_ray_init (&rays[3], &GRAPHENE_POINT3D_INIT (0.f, 0.f, 0.f), graphene_vec3_x_axis ());
+  graphene_ray_init (&rays[4], &GRAPHENE_POINT3D_INIT (0.f, -10.f, 0.f), graphene_vec3_y_axis ());
+  graphene_ray_init (&rays[5], &GRAPHENE_POINT3D_INIT (0.f, 0.f, 10.f), graphene_vec3_z_axis ());
+  graphene_ray_init (&rays[6], &GRAPHENE_POINT3D_INIT (-0.5f, -0.5f, 10.f), &minus_z);
+  graphene_ray_init (&rays[7], &GRAPHENE_POINT3D_INIT (1.5f, 0.f, -10.f), graphene_vec3_z_axis ());
+  graphene_ray_packet8_init (&packet, 8, rays);
+
+  graphene_box_init (&box,
+                     &GRAPHENE_POINT3D_INIT (-1.f, -1.f, -1.f),
+                     &GRAPHENE_POINT3D_INIT (1.f, 1.f, 1.f));
+  graphene_sphere_init (&sphere, &GRAPHENE_POINT3D_INIT (0.f, 0.f, 0.f), 1.f);
+  graphene_triangle_init_from_point3d (&triangle,
+                                       &GRAPHENE_POINT3D_INIT (-1.f, -1.f, 0.f),
+                                       &GRAPHENE_POINT3D_INIT (1.f, -1.f, 0.f),
+                                       &GRAPHENE_POINT3D_INIT (0.f, 1.f, 0.f));
+
+  /* Every ray of the packet must match the single ray intersection */
+  for (unsigned int j = 0; j < 3; j++)
+    {
+      if (j == 0)
+        masks[j] = graphene_ray_packet8_intersect_box (&packet, &box, t_packet);
+      else if (j == 1)
+        masks[j] = graphene_ray_packet8_intersect_sphere (&packet, &sphere, t_packet);
+      else
+        masks[j] = graphene_ray_packet8_intersect_triangle (&packet, &triangle, t_packet);
+
+      for (unsigned int i = 0; i < 8; i++)
+        {
+          graphene_ray_intersection_kind_t kind;
+          float t = 0.f;
+
+          if (j == 0)
+            kind = graphene_ray_intersect_box (&rays[i], &box, &t);
+          else if (j == 1)
+            kind = graphene_ray_intersect_sphere (&rays[i], &sphere, &t);
+          else
+            kind = graphene_ray_intersect_triangle (&rays[i], &triangle, &t);
+
+          all_match = all_match &&
+                      (kind != GRAPHENE_RAY_INTERSECTION_KIND_NONE) == ((masks[j] & (1u << i)) != 0) &&
+                      fabsf (t - t_packet[i]) < 0.001f;
+        }
+    }
+
+  mutest_expect ("8-wide packet intersections to match single rays",
+                 mutest_bool_value (all_match),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("8-wide packet intersections to use all the lanes",
+                 mutest_bool_value (masks[0] == 0x5b && masks[1] == 0x5b && masks[2] == 0x41),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_ray_packet8_init (&packet, 5, &rays[2]);
+  mutest_expect ("partial 8-wide packets to only report the rays they contain",
+                 mutest_bool_value (graphene_ray_packet8_get_n_rays (&packet) == 5 &&
+                                    graphene_ray_packet8_intersect_box (&packet, &box, NULL) == 0x16),
+                 mutest_to_be_true,
+                 NULL);
+}
+
+static void
+ray_intersect_boxes (void)
+{
+  graphene_box_t boxes[19];
+  graphene_ray_t r;
+  uint32_t hits[1];
+  float t_batch[19];
+  unsigned int n_hits, n_expected = 0;
+  bool all_match = true;
+
+  /* Boxes with an even index are on the path of the ray */
+  for (unsigned int i = 0; i < 19; i++)
+    {
+      float x = (float) i * 2.f - 12.f;
+      float y = i % 2 == 0 ? 0.f : 5.f;
+
+      graphene_box_init (&boxes[i],
+                         &GRAPHENE_POINT3D_INIT (x - 0.5f, y - 0.5f, -0.5f),
+                         &GRAPHENE_POINT3D_INIT (x + 0.5f, y + 0.5f, 0.5f));
+    }
+
+  graphene_ray_init (&r, &GRAPHENE_POINT3D_INIT (-0.25f, 0.f, 0.f), graphene_vec3_x_axis ());
+
+  n_hits = graphene_ray_intersect_boxes (&r, 19, boxes, t_batch, hits);
+
+  for (unsigned int i = 0; i < 19; i++)
+    {
+      float t = 0.f;
+      bool hit = graphene_ray_intersect_box (&r, &boxes[i], &t) != GRAPHENE_RAY_INTERSECTION_KIND_NONE;
+
+      if (hit)
+        n_expected += 1;
+
+      all_match = all_match && hit == ((hits[0] & (1u << i)) != 0) && fabsf (t - t_batch[i]) < 0.001f;
+    }
+
+  mutest_expect ("batched intersection with boxes to match single boxes",
+                 mutest_bool_value (all_match),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("batched intersection to count the boxes in front of the ray",
+                 mutest_int_value (n_hits),
+                 mutest_to_be, n_expected,
+                 NULL);
+  mutest_expect ("batched intersection to hit the box containing the origin",
+                 mutest_bool_value ((hits[0] & (1u << 6)) != 0 && fabsf (t_batch[6] - 0.75f) < 0.001f),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("batched intersection to skip the boxes behind the ray",
+                 mutest_bool_value ((hits[0] & 0x3f) == 0),
+                 mutest_to_be_true,
+                 NULL);
+}
+
 static void
 ray_suite (void)
 {
@@ -351,6 +568,9 @@ ray_suite (void)
   mutest_it ("can intersect triangles", ray_intersect_triangle);
   mutest_it ("can intersect on axis", ray_intersects_box);
   mutest_it ("can be used for picking", ray_picking);
+  mutest_it ("can intersect primitives with packets of rays", ray_packet_intersect);
+  mutest_it ("can intersect primitives with 8-wide packets of rays", ray_packet8_intersect);
+  mutest_it ("can intersect arrays of boxes", ray_intersect_boxes);
 }
 
 MUTEST_MAIN (
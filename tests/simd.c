@@ -353,6 +353,199 @@ simd_operators_floor (void)
                  NULL);
 }
 
+static bool
+simd8f_equal (graphene_simd8f_t s,
+              const float       check[8],
+              float             epsilon)
+{
+  float v[8];
+
+  graphene_simd8f_dup_8f (s, v);
+
+  for (unsigned int i = 0; i < 8; i++)
+    {
+      if (fabsf (v[i] - check[i]) > epsilon)
+        return false;
+    }
+
+  return true;
+}
+
+static void
+simd8f_init (void)
+{
+  const float check[8] = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f };
+  const float zero[8] = { 0.f, };
+  graphene_simd8f_t s;
+  graphene_simd4f_t half;
+  float v[4];
+
+  s = graphene_simd8f_init (1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f);
+  mutest_expect ("init() to set all components",
+                 mutest_bool_value (simd8f_equal (s, check, 0.f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  s = graphene_simd8f_init_8f (check);
+  mutest_expect ("init_8f() to load all components",
+                 mutest_bool_value (simd8f_equal (s, check, 0.f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  s = graphene_simd8f_init_simd4f (graphene_simd4f_init (1.f, 2.f, 3.f, 4.f),
+                                   graphene_simd4f_init (5.f, 6.f, 7.f, 8.f));
+  mutest_expect ("init_simd4f() to concatenate two vectors",
+                 mutest_bool_value (simd8f_equal (s, check, 0.f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  half = graphene_simd8f_get_high (s);
+  graphene_simd4f_dup_4f (half, v);
+  mutest_expect ("get_high() to return the last four components",
+                 mutest_bool_value (memcmp (v, check + 4, sizeof (float) * 4) == 0),
+                 mutest_to_be_true,
+                 NULL);
+
+  half = graphene_simd8f_get_low (s);
+  graphene_simd4f_dup_4f (half, v);
+  mutest_expect ("get_low() to return the first four components",
+                 mutest_bool_value (memcmp (v, check, sizeof (float) * 4) == 0),
+                 mutest_to_be_true,
+                 NULL);
+
+  mutest_expect ("init_zero() to set all components to zero",
+                 mutest_bool_value (simd8f_equal (graphene_simd8f_init_zero (), zero, 0.f)),
+                 mutest_to_be_true,
+                 NULL);
+}
+
+static void
+simd8f_transpose (void)
+{
+  const float check_x[8] = { 0.f, 4.f, 8.f, 12.f, 16.f, 20.f, 24.f, 28.f };
+  const float check_w[8] = { 3.f, 7.f, 11.f, 15.f, 19.f, 23.f, 27.f, 31.f };
+  graphene_simd4f_t rows[8];
+  graphene_simd8f_t x, y, z, w;
+
+  for (unsigned int i = 0; i < 8; i++)
+    {
+      float f = (float) i * 4.f;
+
+      rows[i] = graphene_simd4f_init (f, f + 1.f, f + 2.f, f + 3.f);
+    }
+
+  graphene_simd8f_transpose_simd4f (rows, &x, &y, &z, &w);
+  mutest_expect ("transpose_simd4f() to gather the first components",
+                 mutest_bool_value (simd8f_equal (x, check_x, 0.f)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("transpose_simd4f() to gather the last components",
+                 mutest_bool_value (simd8f_equal (w, check_w, 0.f)),
+                 mutest_to_be_true,
+                 NULL);
+}
+
+static void
+simd8f_operators (void)
+{
+  const float check_add[8] = { 3.f, 3.f, 3.f, 3.f, 3.f, 3.f, 3.f, 3.f };
+  const float check_mul[8] = { 2.f, 4.f, 6.f, 8.f, 10.f, 12.f, 14.f, 16.f };
+  const float check_madd[8] = { 4.f, 6.f, 8.f, 10.f, 12.f, 14.f, 16.f, 18.f };
+  const float check_min[8] = { 1.f, 2.f, 2.f, 2.f, 2.f, 2.f, 2.f, 2.f };
+  const float check_max[8] = { 2.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f };
+  const float check_sqrt[8] = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f };
+  const float check_rcp[8] = { 1.f, -0.5f, 0.25f, -0.125f, 2.f, -4.f, 10.f, 0.1f };
+  graphene_simd8f_t a, b, two;
+
+  a = graphene_simd8f_init (1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f);
+  b = graphene_simd8f_init (2.f, 1.f, 0.f, -1.f, -2.f, -3.f, -4.f, -5.f);
+  two = graphene_simd8f_splat (2.f);
+
+  mutest_expect ("add() to sum each component",
+                 mutest_bool_value (simd8f_equal (graphene_simd8f_add (a, b), check_add, 0.f)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("sub() to subtract each component",
+                 mutest_bool_value (simd8f_equal (graphene_simd8f_sub (graphene_simd8f_add (a, b), b), check_sqrt, 0.f)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("mul() to multiply each component",
+                 mutest_bool_value (simd8f_equal (graphene_simd8f_mul (a, two), check_mul, 0.f)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("div() to divide each component",
+                 mutest_bool_value (simd8f_equal (graphene_simd8f_div (graphene_simd8f_mul (a, two), two), check_sqrt, 0.f)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("madd() to multiply and add each component",
+                 mutest_bool_value (simd8f_equal (graphene_simd8f_madd (a, two, two), check_madd, 0.f)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("min() to return the smallest of each component",
+                 mutest_bool_value (simd8f_equal (graphene_simd8f_min (a, two), check_min, 0.f)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("max() to return the largest of each component",
+                 mutest_bool_value (simd8f_equal (graphene_simd8f_max (a, two), check_max, 0.f)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("sqrt() to return the square root of each component",
+                 mutest_bool_value (simd8f_equal (graphene_simd8f_sqrt (graphene_simd8f_mul (a, a)), check_sqrt, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  a = graphene_simd8f_init (1.f, -2.f, 4.f, -8.f, 0.5f, -0.25f, 0.1f, 10.f);
+  mutest_expect ("reciprocal() to return the reciprocal of each component",
+                 mutest_bool_value (simd8f_equal (graphene_simd8f_reciprocal (a), check_rcp, 0.00001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  a = graphene_simd8f_init (0.f, -0.f, 0.f, -0.f, 0.f, -0.f, 0.f, -0.f);
+  b = graphene_simd8f_reciprocal (a);
+  mutest_expect ("reciprocal() to return infinity for zero components",
+                 mutest_bool_value (graphene_simd8f_mask_ge (b, graphene_simd8f_splat (INFINITY)) == 0x55 &&
+                                    graphene_simd8f_mask_le (b, graphene_simd8f_splat (-INFINITY)) == 0xaa),
+                 mutest_to_be_true,
+                 NULL);
+}
+
+static void
+simd8f_masks (void)
+{
+  graphene_simd8f_t a, b;
+
+  a = graphene_simd8f_init (1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f);
+  b = graphene_simd8f_splat (4.f);
+
+  mutest_expect ("mask_ge() to set a bit for each greater or equal component",
+                 mutest_int_value (graphene_simd8f_mask_ge (a, b)),
+                 mutest_to_be, 0xf8,
+                 NULL);
+  mutest_expect ("mask_le() to set a bit for each less or equal component",
+                 mutest_int_value (graphene_simd8f_mask_le (a, b)),
+                 mutest_to_be, 0x0f,
+                 NULL);
+  mutest_expect ("mask_ge() to set all bits for equal vectors",
+                 mutest_int_value (graphene_simd8f_mask_ge (a, a)),
+                 mutest_to_be, 0xff,
+                 NULL);
+}
+
+static void
+simd_active_backend (void)
+{
+  const char *backend = graphene_simd_get_active_backend ();
+
+  mutest_expect ("get_active_backend() to return a name",
+                 mutest_pointer ((void *) backend),
+                 mutest_not, mutest_to_be_null,
+                 NULL);
+  mutest_expect ("get_active_backend() to return the same name each time",
+                 mutest_bool_value (strcmp (backend, graphene_simd_get_active_backend ()) == 0),
+                 mutest_to_be_true,
+                 NULL);
+}
+
 static void
 simd_suite (void)
 {
@@ -375,8 +568,20 @@ simd_suite (void)
 
   mutest_it ("can round up vector components", simd_operators_ceil);
   mutest_it ("can round down vector components", simd_operators_floor);
+
+  mutest_it ("has an active backend", simd_active_backend);
+}
+
+static void
+simd8f_suite (void)
+{
+  mutest_it ("can be initialized", simd8f_init);
+  mutest_it ("can transpose 4-wide vectors", simd8f_transpose);
+  mutest_it ("has arithmetic operators", simd8f_operators);
+  mutest_it ("can compare components into a bitmask", simd8f_masks);
 }
 
 MUTEST_MAIN (
   mutest_describe ("graphene_simd4f_t", simd_suite);
+  mutest_describe ("graphene_simd8f_t", simd8f_suite);
 )
@@ -0,0 +1,526 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include <math.h>
+#include <stdlib.h>
+#include <graphene.h>
+#include <mutest.h>
+
+#include "graphene-test-utils.h"
+
+/* Not a multiple of the SIMD width, to exercise the remainders */
+#define N_VECTORS       1003
+
+static graphene_vec3_t *
+random_vec3 (void)
+{
+  graphene_vec3_t *res = malloc (sizeof (graphene_vec3_t) * N_VECTORS);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_vec3_init (&res[i],
+                        random_float (-10.f, 10.f),
+                        random_float (-10.f, 10.f),
+                        random_float (-10.f, 10.f));
+
+  return res;
+}
+
+static graphene_vec4_t *
+random_vec4 (void)
+{
+  graphene_vec4_t *res = malloc (sizeof (graphene_vec4_t) * N_VECTORS);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_vec4_init (&res[i],
+                        random_float (-10.f, 10.f),
+                        random_float (-10.f, 10.f),
+                        random_float (-10.f, 10.f),
+                        random_float (-10.f, 10.f));
+
+  return res;
+}
+
+/* Scaled, rotated, and translated matrices, with a perspective one and
+ * a singular one in each group of eight
+ */
+static graphene_matrix_t *
+random_matrices (void)
+{
+  graphene_matrix_t *res = malloc (sizeof (graphene_matrix_t) * N_VECTORS);
+  graphene_vec3_t axis;
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    {
+      if (i % 8 == 3)
+        {
+          graphene_matrix_init_perspective (&res[i], random_float (30.f, 90.f), 1.f, 1.f, 100.f);
+          continue;
+        }
+
+      graphene_matrix_init_scale (&res[i],
+                                  random_float (0.5f, 2.f),
+                                  random_float (0.5f, 2.f),
+                                  i % 8 == 5 ? 0.f : random_float (0.5f, 2.f));
+      graphene_vec3_init (&axis,
+                          random_float (-1.f, 1.f),
+                          random_float (-1.f, 1.f),
+                          random_float (0.1f, 1.f));
+      graphene_matrix_rotate (&res[i], random_float (0.f, 360.f), &axis);
+      graphene_matrix_translate (&res[i],
+                                 &GRAPHENE_POINT3D_INIT (random_float (-10.f, 10.f),
+                                                         random_float (-10.f, 10.f),
+                                                         random_float (-10.f, 10.f)));
+    }
+
+  return res;
+}
+
+/* Laplace expansion along the first row */
+static float
+matrix_determinant (const graphene_matrix_t *m)
+{
+  float res = 0.f;
+
+  for (unsigned int c = 0; c < 4; c++)
+    {
+      float minor[9];
+      unsigned int k = 0;
+
+      for (unsigned int row = 1; row < 4; row++)
+        {
+          for (unsigned int col = 0; col < 4; col++)
+            {
+              if (col != c)
+                minor[k++] = graphene_matrix_get_value (m, row, col);
+            }
+        }
+
+      res += (c % 2 == 0 ? 1.f : -1.f) * graphene_matrix_get_value (m, 0, c) *
+             (minor[0] * (minor[4] * minor[8] - minor[5] * minor[7]) -
+              minor[1] * (minor[3] * minor[8] - minor[5] * minor[6]) +
+              minor[2] * (minor[3] * minor[7] - minor[4] * minor[6]));
+    }
+
+  return res;
+}
+
+static bool
+matrix_soa_near (const graphene_matrix_soa_t *soa,
+                 const graphene_matrix_t     *expected)
+{
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    {
+      graphene_matrix_t m;
+
+      graphene_matrix_soa_get (soa, i, &m);
+      if (!graphene_matrix_near (&m, &expected[i], 0.001f))
+        return false;
+    }
+
+  return true;
+}
+
+static bool
+vec3_soa_near (graphene_vec3_soa_t   *soa,
+               const graphene_vec3_t *expected)
+{
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    {
+      graphene_vec3_t v;
+
+      graphene_vec3_soa_get (soa, i, &v);
+      if (!graphene_vec3_near (&v, &expected[i], 0.0001f))
+        return false;
+    }
+
+  return true;
+}
+
+static bool
+floats_near (const float *a,
+             const float *b)
+{
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    {
+      if (fabsf (a[i] - b[i]) > 0.001f)
+        return false;
+    }
+
+  return true;
+}
+
+static void
+soa_convert (void)
+{
+  graphene_vec3_t *v3 = random_vec3 ();
+  graphene_vec4_t *v4 = random_vec4 ();
+  graphene_vec3_t *res3 = malloc (sizeof (graphene_vec3_t) * N_VECTORS);
+  graphene_vec4_t *res4 = malloc (sizeof (graphene_vec4_t) * N_VECTORS);
+  graphene_vec3_soa_t *a = graphene_vec3_soa_new (N_VECTORS);
+  graphene_vec4_soa_t *b = graphene_vec4_soa_new (N_VECTORS);
+  bool equal = true;
+
+  mutest_expect ("get_size() to return the number of vectors",
+                 mutest_int_value (graphene_vec3_soa_get_size (a)),
+                 mutest_to_be, N_VECTORS,
+                 NULL);
+
+  graphene_vec3_soa_init_from_vec3 (a, v3);
+  graphene_vec4_soa_init_from_vec4 (b, v4);
+  graphene_vec3_soa_to_vec3 (a, res3);
+  graphene_vec4_soa_to_vec4 (b, res4);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    {
+      if (!graphene_vec3_equal (&res3[i], &v3[i]) || !graphene_vec4_equal (&res4[i], &v4[i]))
+        equal = false;
+    }
+
+  mutest_expect ("converting to and from arrays of vectors to preserve them",
+                 mutest_bool_value (equal),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("the components to be stored in separate arrays",
+                 mutest_bool_value (graphene_vec3_soa_get_y (a)[7] == graphene_vec3_get_y (&v3[7]) &&
+                                    graphene_vec4_soa_get_w (b)[N_VECTORS - 1] == graphene_vec4_get_w (&v4[N_VECTORS - 1])),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("the components to be aligned",
+                 mutest_bool_value (((uintptr_t) graphene_vec3_soa_get_z (a) % 32) == 0 &&
+                                    ((uintptr_t) graphene_vec4_soa_get_w (b) % 32) == 0),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_vec4_soa_free (b);
+  graphene_vec3_soa_free (a);
+  free (res4);
+  free (res3);
+  free (v4);
+  free (v3);
+}
+
+static void
+soa_vec3_operations (void)
+{
+  graphene_vec3_t *v1 = random_vec3 ();
+  graphene_vec3_t *v2 = random_vec3 ();
+  graphene_vec3_t *expected = malloc (sizeof (graphene_vec3_t) * N_VECTORS);
+  float *values = malloc (sizeof (float) * N_VECTORS);
+  float *expected_values = malloc (sizeof (float) * N_VECTORS);
+  graphene_vec3_soa_t *a = graphene_vec3_soa_new (N_VECTORS);
+  graphene_vec3_soa_t *b = graphene_vec3_soa_new (N_VECTORS);
+  graphene_vec3_soa_t *res = graphene_vec3_soa_new (N_VECTORS);
+  graphene_vec3_t min, max, soa_min, soa_max;
+  graphene_matrix_t m;
+
+  graphene_vec3_soa_init_from_vec3 (a, v1);
+  graphene_vec3_soa_init_from_vec3 (b, v2);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_vec3_add (&v1[i], &v2[i], &expected[i]);
+  graphene_vec3_soa_add (a, b, res);
+  mutest_expect ("add() to match graphene_vec3_add()",
+                 mutest_bool_value (vec3_soa_near (res, expected)),
+                 mutest_to_be_true,
+                 NULL);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_vec3_subtract (&v1[i], &v2[i], &expected[i]);
+  graphene_vec3_soa_subtract (a, b, res);
+  mutest_expect ("subtract() to match graphene_vec3_subtract()",
+                 mutest_bool_value (vec3_soa_near (res, expected)),
+                 mutest_to_be_true,
+                 NULL);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_vec3_scale (&v1[i], 2.5f, &expected[i]);
+  graphene_vec3_soa_scale (a, 2.5f, res);
+  mutest_expect ("scale() to match graphene_vec3_scale()",
+                 mutest_bool_value (vec3_soa_near (res, expected)),
+                 mutest_to_be_true,
+                 NULL);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_vec3_interpolate (&v1[i], &v2[i], 0.25, &expected[i]);
+  graphene_vec3_soa_lerp (a, b, 0.25f, res);
+  mutest_expect ("lerp() to match graphene_vec3_interpolate()",
+                 mutest_bool_value (vec3_soa_near (res, expected)),
+                 mutest_to_be_true,
+                 NULL);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_vec3_cross (&v1[i], &v2[i], &expected[i]);
+  graphene_vec3_soa_cross (a, b, res);
+  mutest_expect ("cross() to match graphene_vec3_cross()",
+                 mutest_bool_value (vec3_soa_near (res, expected)),
+                 mutest_to_be_true,
+                 NULL);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    expected_values[i] = graphene_vec3_dot (&v1[i], &v2[i]);
+  graphene_vec3_soa_dot (a, b, values);
+  mutest_expect ("dot() to match graphene_vec3_dot()",
+                 mutest_bool_value (floats_near (values, expected_values)),
+                 mutest_to_be_true,
+                 NULL);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    expected_values[i] = graphene_vec3_length (&v1[i]);
+  graphene_vec3_soa_length (a, values);
+  mutest_expect ("length() to match graphene_vec3_length()",
+                 mutest_bool_value (floats_near (values, expected_values)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_vec3_init (&v1[N_VECTORS - 1], 0.f, 0.f, 0.f);
+  graphene_vec3_soa_set (a, N_VECTORS - 1, &v1[N_VECTORS - 1]);
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_vec3_normalize (&v1[i], &expected[i]);
+  graphene_vec3_soa_normalize (a, res);
+  mutest_expect ("normalize() to match graphene_vec3_normalize(), including zero vectors",
+                 mutest_bool_value (vec3_soa_near (res, expected)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_init_rotate (&m, 30.f, graphene_vec3_y_axis ());
+  graphene_matrix_translate (&m, &GRAPHENE_POINT3D_INIT (1.f, 2.f, 3.f));
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_matrix_transform_vec3 (&m, &v1[i], &expected[i]);
+  graphene_vec3_soa_transform (a, &m, res);
+  mutest_expect ("transform() to match graphene_matrix_transform_vec3()",
+                 mutest_bool_value (vec3_soa_near (res, expected)),
+                 mutest_to_be_true,
+                 NULL);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    {
+      graphene_point3d_t p;
+
+      graphene_point3d_init_from_vec3 (&p, &v1[i]);
+      graphene_matrix_transform_point3d (&m, &p, &p);
+      graphene_point3d_to_vec3 (&p, &expected[i]);
+    }
+  graphene_vec3_soa_transform_points (a, &m, a);
+  mutest_expect ("transform_points() to match graphene_matrix_transform_point3d() in place",
+                 mutest_bool_value (vec3_soa_near (a, expected)),
+                 mutest_to_be_true,
+                 NULL);
+
+  min = v2[0];
+  max = v2[0];
+  for (unsigned int i = 1; i < N_VECTORS; i++)
+    {
+      graphene_vec3_min (&min, &v2[i], &min);
+      graphene_vec3_max (&max, &v2[i], &max);
+    }
+  graphene_vec3_soa_get_min (b, &soa_min);
+  graphene_vec3_soa_get_max (b, &soa_max);
+  mutest_expect ("get_min() and get_max() to return the bounds of the vectors",
+                 mutest_bool_value (graphene_vec3_equal (&min, &soa_min) &&
+                                    graphene_vec3_equal (&max, &soa_max)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_vec3_soa_free (res);
+  graphene_vec3_soa_free (b);
+  graphene_vec3_soa_free (a);
+  free (expected_values);
+  free (values);
+  free (expected);
+  free (v2);
+  free (v1);
+}
+
+static void
+soa_vec4_operations (void)
+{
+  graphene_vec4_t *v1 = random_vec4 ();
+  graphene_vec4_t *v2 = random_vec4 ();
+  graphene_vec4_t *expected = malloc (sizeof (graphene_vec4_t) * N_VECTORS);
+  float *values = malloc (sizeof (float) * N_VECTORS);
+  float *expected_values = malloc (sizeof (float) * N_VECTORS);
+  graphene_vec4_soa_t *a = graphene_vec4_soa_new (N_VECTORS);
+  graphene_vec4_soa_t *b = graphene_vec4_soa_new (N_VECTORS);
+  graphene_vec4_soa_t *res = graphene_vec4_soa_new (N_VECTORS);
+  graphene_vec4_t min, soa_min, v;
+  graphene_matrix_t m;
+  bool near;
+
+  graphene_vec4_soa_init_from_vec4 (a, v1);
+  graphene_vec4_soa_init_from_vec4 (b, v2);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    expected_values[i] = graphene_vec4_dot (&v1[i], &v2[i]);
+  graphene_vec4_soa_dot (a, b, values);
+  mutest_expect ("dot() to match graphene_vec4_dot()",
+                 mutest_bool_value (floats_near (values, expected_values)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_vec4_soa_normalize (a, res);
+  near = true;
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    {
+      graphene_vec4_normalize (&v1[i], &expected[i]);
+      graphene_vec4_soa_get (res, i, &v);
+      if (!graphene_vec4_near (&v, &expected[i], 0.0001f))
+        near = false;
+    }
+  mutest_expect ("normalize() to match graphene_vec4_normalize()",
+                 mutest_bool_value (near),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_init_perspective (&m, 60.f, 1.f, 1.f, 100.f);
+  graphene_vec4_soa_transform (a, &m, res);
+  near = true;
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    {
+      graphene_matrix_transform_vec4 (&m, &v1[i], &expected[i]);
+      graphene_vec4_soa_get (res, i, &v);
+      if (!graphene_vec4_near (&v, &expected[i], 0.0001f))
+        near = false;
+    }
+  mutest_expect ("transform() to match graphene_matrix_transform_vec4()",
+                 mutest_bool_value (near),
+                 mutest_to_be_true,
+                 NULL);
+
+  min = v1[0];
+  for (unsigned int i = 1; i < N_VECTORS; i++)
+    graphene_vec4_min (&min, &v1[i], &min);
+  graphene_vec4_soa_get_min (a, &soa_min);
+  mutest_expect ("get_min() to return the minimum of the vectors",
+                 mutest_bool_value (graphene_vec4_equal (&min, &soa_min)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_vec4_soa_free (res);
+  graphene_vec4_soa_free (b);
+  graphene_vec4_soa_free (a);
+  free (expected_values);
+  free (values);
+  free (expected);
+  free (v2);
+  free (v1);
+}
+
+static void
+soa_matrix_operations (void)
+{
+  graphene_matrix_t *m1 = random_matrices ();
+  graphene_matrix_t *m2 = random_matrices ();
+  graphene_matrix_t *expected = malloc (sizeof (graphene_matrix_t) * N_VECTORS);
+  graphene_vec3_t *points = random_vec3 ();
+  graphene_vec3_t *expected_points = malloc (sizeof (graphene_vec3_t) * N_VECTORS);
+  float *values = malloc (sizeof (float) * N_VECTORS);
+  float *expected_values = malloc (sizeof (float) * N_VECTORS);
+  graphene_matrix_soa_t *a = graphene_matrix_soa_new (N_VECTORS);
+  graphene_matrix_soa_t *b = graphene_matrix_soa_new (N_VECTORS);
+  graphene_matrix_soa_t *res = graphene_matrix_soa_new (N_VECTORS);
+  graphene_vec3_soa_t *p = graphene_vec3_soa_new (N_VECTORS);
+  graphene_vec3_soa_t *p_res = graphene_vec3_soa_new (N_VECTORS);
+  unsigned int n_invertible = 0;
+  bool equal = true;
+
+  graphene_matrix_soa_init_from_matrices (a, m1);
+  graphene_matrix_soa_init_from_matrices (b, m2);
+  graphene_vec3_soa_init_from_vec3 (p, points);
+
+  graphene_matrix_soa_to_matrices (a, expected);
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    {
+      if (!graphene_matrix_equal (&expected[i], &m1[i]))
+        equal = false;
+    }
+  mutest_expect ("converting to and from arrays of matrices to preserve them",
+                 mutest_bool_value (equal),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("the elements to be stored in separate arrays",
+                 mutest_bool_value (graphene_matrix_soa_get_element (a, 3, 1)[9] == graphene_matrix_get_value (&m1[9], 3, 1) &&
+                                    ((uintptr_t) graphene_matrix_soa_get_element (a, 2, 3) % 32) == 0),
+                 mutest_to_be_true,
+                 NULL);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_matrix_multiply (&m1[i], &m2[i], &expected[i]);
+  graphene_matrix_soa_multiply (a, b, res);
+  mutest_expect ("multiply() to match graphene_matrix_multiply()",
+                 mutest_bool_value (matrix_soa_near (res, expected)),
+                 mutest_to_be_true,
+                 NULL);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    expected_values[i] = matrix_determinant (&m1[i]);
+  graphene_matrix_soa_determinant (a, values);
+  mutest_expect ("determinant() to return the determinant of each matrix",
+                 mutest_bool_value (floats_near (values, expected_values)),
+                 mutest_to_be_true,
+                 NULL);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    {
+      expected[i] = m1[i];
+      if (graphene_matrix_inverse (&m1[i], &expected[i]))
+        n_invertible += 1;
+    }
+  mutest_expect ("inverse() to return the number of invertible matrices",
+                 mutest_int_value (graphene_matrix_soa_inverse (a, res)),
+                 mutest_to_be, n_invertible,
+                 NULL);
+  mutest_expect ("inverse() to match graphene_matrix_inverse()",
+                 mutest_bool_value (matrix_soa_near (res, expected)),
+                 mutest_to_be_true,
+                 NULL);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    graphene_matrix_transpose (&m1[i], &expected[i]);
+  graphene_matrix_soa_transpose (a, a);
+  mutest_expect ("transpose() to match graphene_matrix_transpose() in place",
+                 mutest_bool_value (matrix_soa_near (a, expected)),
+                 mutest_to_be_true,
+                 NULL);
+
+  for (unsigned int i = 0; i < N_VECTORS; i++)
+    {
+      graphene_point3d_t pt;
+
+      graphene_point3d_init_from_vec3 (&pt, &points[i]);
+      graphene_matrix_transform_point3d (&m2[i], &pt, &pt);
+      graphene_point3d_to_vec3 (&pt, &expected_points[i]);
+    }
+  graphene_matrix_soa_transform_points (b, p, p_res);
+  mutest_expect ("transform_points() to match graphene_matrix_transform_point3d()",
+                 mutest_bool_value (vec3_soa_near (p_res, expected_points)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_vec3_soa_free (p_res);
+  graphene_vec3_soa_free (p);
+  graphene_matrix_soa_free (res);
+  graphene_matrix_soa_free (b);
+  graphene_matrix_soa_free (a);
+  free (expected_values);
+  free (values);
+  free (expected_points);
+  free (points);
+  free (expected);
+  free (m2);
+  free (m1);
+}
+
+static void
+soa_suite (void)
+{
+  mutest_it ("converts arrays of vectors", soa_convert);
+  mutest_it ("operates on arrays of vec3", soa_vec3_operations);
+  mutest_it ("operates on arrays of vec4", soa_vec4_operations);
+  mutest_it ("operates on arrays of matrices", soa_matrix_operations);
+}
+
+MUTEST_MAIN (
+  mutest_describe ("graphene_vec_soa", soa_suite);
+)
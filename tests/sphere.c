@@ -4,6 +4,9 @@
 
 #include <graphene.h>
 #include <mutest.h>
+#include <math.h>
+
+#include "graphene-test-utils.h"
 
 static void
 sphere_init (mutest_spec_t *spec)
@@ -157,6 +160,117 @@ sphere_empty (mutest_spec_t *spec)
                  NULL);
 }
 
+static bool
+sphere_contains_points (const graphene_sphere_t  *s,
+                        unsigned int              n_points,
+                        const graphene_point3d_t *points)
+{
+  for (unsigned int i = 0; i < n_points; i++)
+    {
+      if (!graphene_sphere_contains_point (s, &points[i]))
+        return false;
+    }
+
+  return true;
+}
+
+static void
+sphere_tight (mutest_spec_t *spec)
+{
+  graphene_point3d_t points[1000];
+  graphene_point3d_t center = GRAPHENE_POINT3D_INIT (1.f, 2.f, 3.f);
+  graphene_point3d_t check;
+  graphene_sphere_t loose, fast, exact;
+  unsigned int n_points = 0;
+
+  /* The vertices of an octahedron, and points inside of it */
+  for (unsigned int i = 0; i < 3; i++)
+    {
+      float offset[3] = { 0.f, 0.f, 0.f };
+
+      offset[i] = 2.f;
+      graphene_point3d_init (&points[n_points++], center.x + offset[0], center.y + offset[1], center.z + offset[2]);
+      graphene_point3d_init (&points[n_points++], center.x - offset[0], center.y - offset[1], center.z - offset[2]);
+    }
+  while (n_points < 1000)
+    graphene_point3d_init (&points[n_points++],
+                           center.x + random_float (-0.6f, 0.6f),
+                           center.y + random_float (-0.6f, 0.6f),
+                           center.z + random_float (-0.6f, 0.6f));
+
+  graphene_sphere_init_from_points_tight (&exact, n_points, points, GRAPHENE_SPHERE_FIT_EXACT);
+  graphene_sphere_get_center (&exact, &check);
+  mutest_expect ("exact fit to find the circumsphere of an octahedron",
+                 mutest_float_value (graphene_sphere_get_radius (&exact)),
+                 mutest_to_be_close_to, 2.0, 0.0001,
+                 NULL);
+  mutest_expect ("exact fit to find the center of an octahedron",
+                 mutest_bool_value (graphene_point3d_near (&check, &center, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  /* A cloud of points along a diagonal, where the bounding box is loose */
+  random_seed (1);
+  for (unsigned int i = 0; i < 1000; i++)
+    {
+      float t = random_float (0.f, 10.f);
+
+      graphene_point3d_init (&points[i],
+                             t + random_float (-1.f, 1.f),
+                             t + random_float (-1.f, 1.f),
+                             random_float (-1.f, 1.f));
+    }
+
+  graphene_sphere_init_from_points (&loose, 1000, points, NULL);
+  graphene_sphere_init_from_points_tight (&fast, 1000, points, GRAPHENE_SPHERE_FIT_FAST);
+  graphene_sphere_init_from_points_tight (&exact, 1000, points, GRAPHENE_SPHERE_FIT_EXACT);
+
+  mutest_expect ("fast fit to contain all the points",
+                 mutest_bool_value (sphere_contains_points (&fast, 1000, points)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("exact fit to contain all the points",
+                 mutest_bool_value (sphere_contains_points (&exact, 1000, points)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("fast fit to be smaller than the bounding box sphere",
+                 mutest_bool_value (graphene_sphere_get_radius (&fast) < graphene_sphere_get_radius (&loose)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("exact fit to be no larger than the fast fit",
+                 mutest_bool_value (graphene_sphere_get_radius (&exact) <= graphene_sphere_get_radius (&fast)),
+                 mutest_to_be_true,
+                 NULL);
+
+  /* Degenerate sets of points */
+  for (unsigned int i = 0; i < 100; i++)
+    graphene_point3d_init (&points[i], (float) (i % 11), (float) (i % 11) * 2.f, 0.f);
+
+  graphene_sphere_init_from_points_tight (&exact, 100, points, GRAPHENE_SPHERE_FIT_EXACT);
+  mutest_expect ("exact fit of collinear points to have half of their length as radius",
+                 mutest_float_value (graphene_sphere_get_radius (&exact)),
+                 mutest_to_be_close_to, sqrtf (500.f) * 0.5f, 0.0001,
+                 NULL);
+
+  for (unsigned int i = 0; i < 100; i++)
+    graphene_point3d_init (&points[i], 1.f, 2.f, 3.f);
+
+  graphene_sphere_init_from_points_tight (&fast, 100, points, GRAPHENE_SPHERE_FIT_FAST);
+  graphene_sphere_init_from_points_tight (&exact, 100, points, GRAPHENE_SPHERE_FIT_EXACT);
+  mutest_expect ("tight fits of the same point to contain it",
+                 mutest_bool_value (sphere_contains_points (&fast, 100, points) &&
+                                    sphere_contains_points (&exact, 100, points) &&
+                                    graphene_sphere_get_radius (&exact) < 0.0001f),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_sphere_init_from_points_tight (&exact, 0, NULL, GRAPHENE_SPHERE_FIT_EXACT);
+  mutest_expect ("tight fit of no points to be empty",
+                 mutest_bool_value (graphene_sphere_is_empty (&exact)),
+                 mutest_to_be_true,
+                 NULL);
+}
+
 static void
 sphere_suite (mutest_suite_t *suite)
 {
@@ -166,6 +280,7 @@ sphere_suite (mutest_suite_t *suite)
   mutest_it ("distance", sphere_distance);
   mutest_it ("translate", sphere_translate);
   mutest_it ("empty", sphere_empty);
+  mutest_it ("tight fit", sphere_tight);
 }
 
 MUTEST_MAIN (
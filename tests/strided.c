@@ -0,0 +1,292 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdlib.h>
+#include <string.h>
+#include <graphene.h>
+#include <mutest.h>
+
+#include "graphene-test-utils.h"
+
+/* Large enough to be split into many chunks */
+#define N_VERTICES      100003
+
+/* A typical interleaved vertex: position, normal and texture coordinates */
+typedef struct {
+  float position[3];
+  float normal[3];
+  float uv[2];
+} vertex_t;
+
+static vertex_t *
+random_vertices (graphene_point3d_t *positions)
+{
+  vertex_t *res = malloc (sizeof (vertex_t) * N_VERTICES);
+
+  random_seed (1);
+
+  for (unsigned int i = 0; i < N_VERTICES; i++)
+    {
+      for (unsigned int j = 0; j < 3; j++)
+        res[i].position[j] = random_float (-100.f, 100.f);
+      for (unsigned int j = 0; j < 3; j++)
+        res[i].normal[j] = (float) (i + j);
+      for (unsigned int j = 0; j < 2; j++)
+        res[i].uv[j] = (float) (i * j);
+
+      graphene_point3d_init (&positions[i], res[i].position[0], res[i].position[1], res[i].position[2]);
+    }
+
+  return res;
+}
+
+static void
+strided_view_init (void)
+{
+  float data[12] = { 0.f, };
+  graphene_strided_view_t view;
+
+  graphene_strided_view_init (&view, data, sizeof (float) * 3, 3, 4);
+  mutest_expect ("init() to set the number of elements",
+                 mutest_int_value (view.n_elements),
+                 mutest_to_be, 4,
+                 NULL);
+
+  graphene_strided_view_init (&view, data, sizeof (float) * 6, 6, 2);
+  mutest_expect ("init() to clamp the number of components to four",
+                 mutest_int_value (view.n_components),
+                 mutest_to_be, 4,
+                 NULL);
+
+  graphene_strided_view_init (&view, data, sizeof (float), 1, 12);
+  mutest_expect ("init() to make views with one component empty",
+                 mutest_int_value (view.n_elements),
+                 mutest_to_be, 0,
+                 NULL);
+}
+
+static void
+strided_bounds (void)
+{
+  graphene_point3d_t *positions = malloc (sizeof (graphene_point3d_t) * N_VERTICES);
+  vertex_t *vertices = random_vertices (positions);
+  graphene_strided_view_t view;
+  graphene_box_t box, check_box;
+  graphene_sphere_t s, check_s;
+  float coords[2 * 21];
+
+  graphene_strided_view_init (&view, vertices[0].position, sizeof (vertex_t), 3, N_VERTICES);
+
+  graphene_box_init_from_strided (&box, &view);
+  graphene_box_init_from_points (&check_box, N_VERTICES, positions);
+  mutest_expect ("init_from_strided() to match init_from_points() for boxes",
+                 mutest_bool_value (graphene_box_equal (&box, &check_box)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_sphere_init_from_strided (&s, &view, NULL);
+  graphene_sphere_init_from_points (&check_s, N_VERTICES, positions, NULL);
+  mutest_expect ("init_from_strided() to match init_from_points() for spheres",
+                 mutest_bool_value (graphene_sphere_equal (&s, &check_s)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_strided_view_init (&view, vertices[0].uv, sizeof (vertex_t), 2, 3);
+  graphene_box_init_from_strided (&box, &view);
+  mutest_expect ("views with two components to be on the z = 0 plane",
+                 mutest_bool_value (graphene_box_get_depth (&box) == 0.f &&
+                                    graphene_box_get_width (&box) == 0.f &&
+                                    graphene_box_get_height (&box) == 2.f),
+                 mutest_to_be_true,
+                 NULL);
+
+  for (unsigned int i = 0; i < 21; i++)
+    {
+      coords[i * 2 + 0] = (float) i;
+      coords[i * 2 + 1] = -2.f * (float) i;
+    }
+  graphene_strided_view_init (&view, coords, sizeof (float) * 2, 2, 21);
+  graphene_box_init_from_strided (&box, &view);
+  graphene_box_init (&check_box,
+                     &GRAPHENE_POINT3D_INIT (0.f, -40.f, 0.f),
+                     &GRAPHENE_POINT3D_INIT (20.f, 0.f, 0.f));
+  mutest_expect ("packed views with two components to have the right bounds",
+                 mutest_bool_value (graphene_box_equal (&box, &check_box)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_strided_view_init (&view, vertices, sizeof (vertex_t), 3, 0);
+  graphene_box_init_from_strided (&box, &view);
+  mutest_expect ("empty views to return an empty box",
+                 mutest_bool_value (graphene_box_equal (&box, graphene_box_empty ())),
+                 mutest_to_be_true,
+                 NULL);
+
+  free (vertices);
+  free (positions);
+}
+
+/* The buffer ends right after the last component of the last element,
+ * so that reading past it is caught by memory checkers
+ */
+static void
+strided_bounds_exact_buffer (void)
+{
+  const struct {
+    unsigned int stride;
+    unsigned int n_components;
+  } layouts[] = {
+    { 12, 3 }, { 16, 3 }, { 16, 4 }, { 8, 2 }, { 20, 3 }, { 32, 3 },
+  };
+  const unsigned int n_layouts = sizeof (layouts) / sizeof (layouts[0]);
+  const unsigned int n_elements = 37;
+  bool all_match = true;
+
+  for (unsigned int l = 0; l < n_layouts; l++)
+    {
+      unsigned int stride = layouts[l].stride;
+      unsigned int n_components = layouts[l].n_components;
+      size_t size = (n_elements - 1) * stride + n_components * sizeof (float);
+      unsigned char *data = malloc (size);
+      float min_v[3] = { 0.f, 0.f, 0.f };
+      float max_v[3] = { 0.f, 0.f, 0.f };
+      graphene_strided_view_t view;
+      graphene_box_t box, check_box;
+
+      for (unsigned int i = 0; i < n_elements; i++)
+        {
+          float *p = (float *) (data + i * stride);
+
+          /* The last element holds the maximum of every component */
+          for (unsigned int j = 0; j < n_components; j++)
+            p[j] = i == n_elements - 1 ? 1000.f : (float) (i % 7) - (float) j;
+
+          for (unsigned int j = 0; j < n_components && j < 3; j++)
+            {
+              if (i == 0 || p[j] < min_v[j])
+                min_v[j] = p[j];
+              if (i == 0 || p[j] > max_v[j])
+                max_v[j] = p[j];
+            }
+        }
+
+      graphene_strided_view_init (&view, data, stride, n_components, n_elements);
+      graphene_box_init_from_strided (&box, &view);
+      graphene_box_init (&check_box,
+                         &GRAPHENE_POINT3D_INIT (min_v[0], min_v[1], min_v[2]),
+                         &GRAPHENE_POINT3D_INIT (max_v[0], max_v[1], max_v[2]));
+
+      all_match = all_match && graphene_box_equal (&box, &check_box);
+
+      free (data);
+    }
+
+  mutest_expect ("bounds of views ending at the end of the buffer to be right",
+                 mutest_bool_value (all_match),
+                 mutest_to_be_true,
+                 NULL);
+}
+
+static void
+strided_transform (void)
+{
+  graphene_point3d_t *positions = malloc (sizeof (graphene_point3d_t) * N_VERTICES);
+  vertex_t *vertices = random_vertices (positions);
+  vertex_t *orig = malloc (sizeof (vertex_t) * N_VERTICES);
+  graphene_strided_view_t view;
+  graphene_matrix_t m;
+  bool same_points = true, same_attributes = true;
+
+  memcpy (orig, vertices, sizeof (vertex_t) * N_VERTICES);
+
+  graphene_matrix_init_rotate (&m, 30.f, graphene_vec3_y_axis ());
+  graphene_matrix_translate (&m, &GRAPHENE_POINT3D_INIT (1.f, 2.f, 3.f));
+
+  graphene_strided_view_init (&view, vertices[0].position, sizeof (vertex_t), 3, N_VERTICES);
+  graphene_matrix_transform_strided (&m, &view);
+  graphene_matrix_transform_points3d (&m, N_VERTICES, positions, positions);
+
+  for (unsigned int i = 0; i < N_VERTICES; i++)
+    {
+      same_points &= vertices[i].position[0] == positions[i].x &&
+                     vertices[i].position[1] == positions[i].y &&
+                     vertices[i].position[2] == positions[i].z;
+      same_attributes &= memcmp (vertices[i].normal, orig[i].normal, sizeof (float) * 5) == 0;
+    }
+
+  mutest_expect ("transform_strided() to match transform_points3d()",
+                 mutest_bool_value (same_points),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("transform_strided() to not touch the other attributes",
+                 mutest_bool_value (same_attributes),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_init_translate (&m, &GRAPHENE_POINT3D_INIT (1.f, 2.f, 3.f));
+  graphene_strided_view_init (&view, vertices[0].uv, sizeof (vertex_t), 2, N_VERTICES);
+  graphene_matrix_transform_strided (&m, &view);
+  mutest_expect ("transform_strided() to only write two components of 2D points",
+                 mutest_bool_value (vertices[7].uv[0] == orig[7].uv[0] + 1.f &&
+                                    vertices[7].uv[1] == orig[7].uv[1] + 2.f &&
+                                    vertices[8].normal[0] == orig[8].normal[0]),
+                 mutest_to_be_true,
+                 NULL);
+
+  free (orig);
+  free (vertices);
+  free (positions);
+}
+
+static void
+strided_cull (void)
+{
+  graphene_point3d_t *positions = malloc (sizeof (graphene_point3d_t) * N_VERTICES);
+  vertex_t *vertices = random_vertices (positions);
+  uint32_t *visible = malloc (sizeof (uint32_t) * (N_VERTICES + 31) / 32);
+  uint32_t *check_visible = malloc (sizeof (uint32_t) * (N_VERTICES + 31) / 32);
+  graphene_strided_view_t view;
+  graphene_frustum_t f;
+  graphene_matrix_t p;
+  unsigned int n_visible, check_n_visible;
+
+  graphene_matrix_init_perspective (&p, 60.f, 1.f, 1.f, 100.f);
+  graphene_frustum_init_from_matrix (&f, &p);
+
+  graphene_strided_view_init (&view, vertices[0].position, sizeof (vertex_t), 3, N_VERTICES);
+  n_visible = graphene_frustum_cull_strided (&f, &view, visible);
+  check_n_visible = graphene_frustum_cull_points (&f, N_VERTICES, positions, check_visible);
+
+  mutest_expect ("cull_strided() to find some visible points",
+                 mutest_int_value (n_visible),
+                 mutest_to_be_greater_than, 0.0,
+                 NULL);
+  mutest_expect ("cull_strided() to match the count of cull_points()",
+                 mutest_int_value (n_visible),
+                 mutest_to_be, check_n_visible,
+                 NULL);
+  mutest_expect ("cull_strided() to match the bitmask of cull_points()",
+                 mutest_bool_value (memcmp (visible, check_visible, sizeof (uint32_t) * (N_VERTICES / 32)) == 0),
+                 mutest_to_be_true,
+                 NULL);
+
+  free (check_visible);
+  free (visible);
+  free (vertices);
+  free (positions);
+}
+
+static void
+strided_suite (void)
+{
+  mutest_it ("initializes views", strided_view_init);
+  mutest_it ("computes bounds", strided_bounds);
+  mutest_it ("computes bounds of exactly sized buffers", strided_bounds_exact_buffer);
+  mutest_it ("transforms elements in place", strided_transform);
+  mutest_it ("culls points", strided_cull);
+}
+
+MUTEST_MAIN (
+  mutest_describe ("graphene_strided_view_t", strided_suite);
+)
@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdlib.h>
+#include <graphene.h>
+#include <mutest.h>
+
+#include "graphene-test-utils.h"
+
+/* Large enough for the widest level to be updated by multiple threads */
+#define N_NODES         40000
+
+#define N_PARENTS       5
+
+static void
+random_matrix (graphene_matrix_t *m)
+{
+  graphene_matrix_init_rotate (m, random_float (-180.f, 180.f), graphene_vec3_y_axis ());
+  graphene_matrix_scale (m, random_float (0.9f, 1.1f), random_float (0.9f, 1.1f), 1.f);
+  graphene_matrix_translate (m, &GRAPHENE_POINT3D_INIT (random_float (-1.f, 1.f),
+                                                        random_float (-1.f, 1.f),
+                                                        random_float (-1.f, 1.f)));
+}
+
+/* Builds a tree with a few roots, where each node is the child of a
+ * random node among the first ones, to get a few wide levels
+ */
+static unsigned int *
+random_parents (unsigned int n_nodes)
+{
+  unsigned int *parents = malloc (sizeof (unsigned int) * n_nodes);
+
+  for (unsigned int i = 0; i < n_nodes; i++)
+    {
+      if (i < 4)
+        parents[i] = GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT;
+      else
+        {
+          unsigned int parent = (unsigned int) random_float (0.f, (float) i / 16.f);
+
+          parents[i] = parent < i ? parent : i - 1;
+        }
+    }
+
+  return parents;
+}
+
+/* Computes the world matrices one node at a time, and compares them with
+ * the ones stored in the hierarchy
+ */
+static bool
+check_world_matrices (const graphene_transform_hierarchy_t *h)
+{
+  unsigned int n_nodes = graphene_transform_hierarchy_get_n_nodes (h);
+  const graphene_matrix_t *world = graphene_transform_hierarchy_get_world_matrices (h);
+  graphene_matrix_t *check = malloc (sizeof (graphene_matrix_t) * n_nodes);
+  bool res = true;
+
+  for (unsigned int i = 0; i < n_nodes; i++)
+    {
+      unsigned int parent = graphene_transform_hierarchy_get_parent (h, i);
+      graphene_matrix_t local;
+
+      graphene_transform_hierarchy_get_local (h, i, &local);
+
+      if (parent == GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT)
+        graphene_matrix_init_from_matrix (&check[i], &local);
+      else
+        graphene_matrix_multiply (&local, &check[parent], &check[i]);
+
+      if (!graphene_matrix_near (&world[i], &check[i], 0.001f))
+        res = false;
+    }
+
+  free (check);
+
+  return res;
+}
+
+static void
+hierarchy_update (void)
+{
+  unsigned int *parents;
+  graphene_transform_hierarchy_t *h;
+  graphene_matrix_t m, world;
+
+  random_seed (1);
+  parents = random_parents (N_NODES);
+  h = graphene_transform_hierarchy_new (N_NODES, parents);
+
+  for (unsigned int i = 0; i < N_NODES; i++)
+    {
+      random_matrix (&m);
+      graphene_transform_hierarchy_set_local (h, i, &m);
+    }
+
+  mutest_expect ("the first update() to update all the nodes",
+                 mutest_int_value (graphene_transform_hierarchy_update (h)),
+                 mutest_to_be, N_NODES,
+                 NULL);
+  mutest_expect ("update() to compose each node with its parent",
+                 mutest_bool_value (check_world_matrices (h)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("update() to do nothing without dirty nodes",
+                 mutest_int_value (graphene_transform_hierarchy_update (h)),
+                 mutest_to_be, 0,
+                 NULL);
+
+  /* Changing a leaf only updates the leaf */
+  random_matrix (&m);
+  graphene_transform_hierarchy_set_local (h, N_NODES - 1, &m);
+  mutest_expect ("update() to only update the dirty leaf",
+                 mutest_int_value (graphene_transform_hierarchy_update (h)),
+                 mutest_to_be, 1,
+                 NULL);
+
+  /* Changing a root updates its whole subtree */
+  random_matrix (&m);
+  graphene_transform_hierarchy_set_local (h, 0, &m);
+  random_matrix (&m);
+  graphene_transform_hierarchy_set_local (h, N_NODES / 2, &m);
+  mutest_expect ("update() to update the dirty subtrees",
+                 mutest_int_value (graphene_transform_hierarchy_update (h)),
+                 mutest_to_be_in_range, 2.0, (double) N_NODES - 3.0,
+                 NULL);
+  mutest_expect ("incremental updates to compose each node with its parent",
+                 mutest_bool_value (check_world_matrices (h)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_transform_hierarchy_get_world (h, 0, &world);
+  mutest_expect ("the world transformation of a root to be its local one",
+                 mutest_bool_value (graphene_matrix_equal (&world, &graphene_transform_hierarchy_get_world_matrices (h)[0])),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_transform_hierarchy_free (h);
+  free (parents);
+}
+
+static void
+hierarchy_parents (void)
+{
+  const unsigned int parents[N_PARENTS] = {
+    GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT, 0, 1, 3, 1,
+  };
+  graphene_transform_hierarchy_t *h;
+  graphene_matrix_t m, world;
+
+  h = graphene_transform_hierarchy_new (N_PARENTS, parents);
+
+  mutest_expect ("get_parent() to return the parent of a node",
+                 mutest_int_value (graphene_transform_hierarchy_get_parent (h, 2)),
+                 mutest_to_be, 1,
+                 NULL);
+  mutest_expect ("a node that is its own parent to be a root",
+                 mutest_bool_value (graphene_transform_hierarchy_get_parent (h, 3) == GRAPHENE_TRANSFORM_HIERARCHY_NO_PARENT),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("new() to mark all nodes as dirty",
+                 mutest_int_value (graphene_transform_hierarchy_update (h)),
+                 mutest_to_be, N_PARENTS,
+                 NULL);
+
+  graphene_matrix_init_translate (&m, &GRAPHENE_POINT3D_INIT (1.f, 2.f, 3.f));
+  graphene_transform_hierarchy_set_local (h, 0, &m);
+  graphene_transform_hierarchy_set_local (h, 2, &m);
+  mutest_expect ("update() to update the descendants of the dirty nodes",
+                 mutest_int_value (graphene_transform_hierarchy_update (h)),
+                 mutest_to_be, 4,
+                 NULL);
+
+  graphene_transform_hierarchy_get_world (h, 2, &world);
+  graphene_matrix_init_translate (&m, &GRAPHENE_POINT3D_INIT (2.f, 4.f, 6.f));
+  mutest_expect ("world transformations to accumulate the ancestors",
+                 mutest_bool_value (graphene_matrix_near (&world, &m, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_transform_hierarchy_get_world (h, 3, &world);
+  mutest_expect ("root nodes to not be affected by other roots",
+                 mutest_bool_value (graphene_matrix_is_identity (&world)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_transform_hierarchy_free (h);
+}
+
+static void
+hierarchy_empty (void)
+{
+  graphene_transform_hierarchy_t *h = graphene_transform_hierarchy_new (0, NULL);
+
+  mutest_expect ("an empty hierarchy to have no nodes",
+                 mutest_int_value (graphene_transform_hierarchy_get_n_nodes (h)),
+                 mutest_to_be, 0,
+                 NULL);
+  mutest_expect ("an empty hierarchy to not update any node",
+                 mutest_int_value (graphene_transform_hierarchy_update (h)),
+                 mutest_to_be, 0,
+                 NULL);
+
+  graphene_transform_hierarchy_free (h);
+}
+
+static void
+hierarchy_suite (void)
+{
+  mutest_it ("updates the world transformations", hierarchy_update);
+  mutest_it ("validates the parents", hierarchy_parents);
+  mutest_it ("can be empty", hierarchy_empty);
+}
+
+MUTEST_MAIN (
+  mutest_describe ("graphene_transform_hierarchy_t", hierarchy_suite);
+)
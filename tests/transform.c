@@ -0,0 +1,286 @@
+// SPDX-FileCopyrightText: 2026 Graphene contributors
+//
+// SPDX-License-Identifier: MIT
+
+#include <math.h>
+#include <graphene.h>
+#include <mutest.h>
+
+static bool
+rect_near (const graphene_rect_t *a,
+           const graphene_rect_t *b,
+           float                  epsilon)
+{
+  return fabsf (a->origin.x - b->origin.x) < epsilon &&
+         fabsf (a->origin.y - b->origin.y) < epsilon &&
+         fabsf (a->size.width - b->size.width) < epsilon &&
+         fabsf (a->size.height - b->size.height) < epsilon;
+}
+
+static bool
+transform_near_matrix (const graphene_transform_t *t,
+                       const graphene_matrix_t    *m,
+                       float                       epsilon)
+{
+  graphene_matrix_t tm;
+
+  graphene_transform_to_matrix (t, &tm);
+
+  return graphene_matrix_near (&tm, m, epsilon);
+}
+
+static void
+transform_classify (mutest_spec_t *spec)
+{
+  graphene_transform_t t;
+  graphene_matrix_t m;
+
+  graphene_transform_init_identity (&t);
+  mutest_expect ("init_identity() to be the identity",
+                 mutest_int_value (graphene_transform_get_category (&t)),
+                 mutest_to_be, GRAPHENE_TRANSFORM_CATEGORY_IDENTITY,
+                 NULL);
+
+  graphene_transform_init_translate (&t, &GRAPHENE_POINT3D_INIT (1.f, 2.f, 3.f));
+  mutest_expect ("init_translate() to be a translation",
+                 mutest_int_value (graphene_transform_get_category (&t)),
+                 mutest_to_be, GRAPHENE_TRANSFORM_CATEGORY_TRANSLATE,
+                 NULL);
+
+  graphene_transform_init_translate (&t, &GRAPHENE_POINT3D_INIT_ZERO);
+  mutest_expect ("init_translate() with a zero offset to be the identity",
+                 mutest_int_value (graphene_transform_get_category (&t)),
+                 mutest_to_be, GRAPHENE_TRANSFORM_CATEGORY_IDENTITY,
+                 NULL);
+
+  graphene_transform_init_scale (&t, 2.f, -1.f, 1.f);
+  mutest_expect ("init_scale() to be a scale",
+                 mutest_int_value (graphene_transform_get_category (&t)),
+                 mutest_to_be, GRAPHENE_TRANSFORM_CATEGORY_SCALE,
+                 NULL);
+
+  graphene_matrix_init_rotate (&m, 30.f, graphene_vec3_z_axis ());
+  graphene_matrix_translate (&m, &GRAPHENE_POINT3D_INIT (10.f, 20.f, 0.f));
+  graphene_transform_init_from_matrix (&t, &m);
+  mutest_expect ("a rotation around the Z axis to be a 2D affine transformation",
+                 mutest_int_value (graphene_transform_get_category (&t)),
+                 mutest_to_be, GRAPHENE_TRANSFORM_CATEGORY_AFFINE_2D,
+                 NULL);
+
+  graphene_matrix_init_rotate (&m, 30.f, graphene_vec3_x_axis ());
+  graphene_transform_init_from_matrix (&t, &m);
+  mutest_expect ("a rotation around the X axis to be a 3D affine transformation",
+                 mutest_int_value (graphene_transform_get_category (&t)),
+                 mutest_to_be, GRAPHENE_TRANSFORM_CATEGORY_AFFINE_3D,
+                 NULL);
+
+  graphene_matrix_init_perspective (&m, 60.f, 1.f, 1.f, 100.f);
+  graphene_transform_init_from_matrix (&t, &m);
+  mutest_expect ("a perspective projection to be projective",
+                 mutest_int_value (graphene_transform_get_category (&t)),
+                 mutest_to_be, GRAPHENE_TRANSFORM_CATEGORY_PROJECTIVE,
+                 NULL);
+}
+
+static void
+transform_compose (mutest_spec_t *spec)
+{
+  graphene_transform_t t, s;
+  graphene_matrix_t m, n;
+
+  graphene_transform_init_identity (&t);
+  graphene_transform_translate (&t, &GRAPHENE_POINT3D_INIT (10.f, 20.f, 0.f));
+  graphene_transform_scale (&t, 2.f, 3.f, 1.f);
+  mutest_expect ("translate() and scale() to keep a scale",
+                 mutest_int_value (graphene_transform_get_category (&t)),
+                 mutest_to_be, GRAPHENE_TRANSFORM_CATEGORY_SCALE,
+                 NULL);
+
+  graphene_matrix_init_translate (&m, &GRAPHENE_POINT3D_INIT (10.f, 20.f, 0.f));
+  graphene_matrix_scale (&m, 2.f, 3.f, 1.f);
+  mutest_expect ("translate() and scale() to match the matrix operations",
+                 mutest_bool_value (transform_near_matrix (&t, &m, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_transform_rotate (&t, 45.f, graphene_vec3_z_axis ());
+  graphene_matrix_rotate (&m, 45.f, graphene_vec3_z_axis ());
+  mutest_expect ("rotate() around the Z axis to give a 2D affine transformation",
+                 mutest_int_value (graphene_transform_get_category (&t)),
+                 mutest_to_be, GRAPHENE_TRANSFORM_CATEGORY_AFFINE_2D,
+                 NULL);
+  mutest_expect ("rotate() to match the matrix operation",
+                 mutest_bool_value (transform_near_matrix (&t, &m, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_transform_translate (&t, &GRAPHENE_POINT3D_INIT (0.f, 0.f, 5.f));
+  mutest_expect ("translate() along the Z axis to give a 3D affine transformation",
+                 mutest_int_value (graphene_transform_get_category (&t)),
+                 mutest_to_be, GRAPHENE_TRANSFORM_CATEGORY_AFFINE_3D,
+                 NULL);
+
+  graphene_transform_init_translate (&t, &GRAPHENE_POINT3D_INIT (1.f, 2.f, 3.f));
+  graphene_transform_init_scale (&s, 2.f, 4.f, 8.f);
+  graphene_transform_multiply (&t, &s, &t);
+  graphene_matrix_init_translate (&m, &GRAPHENE_POINT3D_INIT (1.f, 2.f, 3.f));
+  graphene_matrix_init_scale (&n, 2.f, 4.f, 8.f);
+  graphene_matrix_multiply (&m, &n, &m);
+  mutest_expect ("multiply() of a translation and a scale to be a scale",
+                 mutest_int_value (graphene_transform_get_category (&t)),
+                 mutest_to_be, GRAPHENE_TRANSFORM_CATEGORY_SCALE,
+                 NULL);
+  mutest_expect ("multiply() to match graphene_matrix_multiply()",
+                 mutest_bool_value (transform_near_matrix (&t, &m, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_matrix_init_rotate (&n, 30.f, graphene_vec3_z_axis ());
+  graphene_transform_init_from_matrix (&s, &n);
+  graphene_transform_multiply (&t, &s, &t);
+  graphene_matrix_multiply (&m, &n, &m);
+  mutest_expect ("multiply() of a scale along Z and a 2D rotation to be a 3D transformation",
+                 mutest_int_value (graphene_transform_get_category (&t)),
+                 mutest_to_be, GRAPHENE_TRANSFORM_CATEGORY_AFFINE_3D,
+                 NULL);
+  mutest_expect ("multiply() of generic transformations to match graphene_matrix_multiply()",
+                 mutest_bool_value (transform_near_matrix (&t, &m, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+}
+
+static void
+transform_inverse (mutest_spec_t *spec)
+{
+  graphene_transform_t t, inv;
+  graphene_matrix_t m, m_inv;
+
+  graphene_transform_init_translate (&t, &GRAPHENE_POINT3D_INIT (1.f, -2.f, 3.f));
+  graphene_transform_to_matrix (&t, &m);
+  graphene_matrix_inverse (&m, &m_inv);
+  mutest_expect ("inverse() of a translation to succeed",
+                 mutest_bool_value (graphene_transform_inverse (&t, &inv)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("inverse() of a translation to match the matrix inverse",
+                 mutest_bool_value (transform_near_matrix (&inv, &m_inv, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_transform_init_scale (&t, 2.f, -4.f, 0.5f);
+  graphene_transform_translate (&t, &GRAPHENE_POINT3D_INIT (1.f, -2.f, 3.f));
+  graphene_transform_to_matrix (&t, &m);
+  graphene_matrix_inverse (&m, &m_inv);
+  mutest_expect ("inverse() of a scale to succeed",
+                 mutest_bool_value (graphene_transform_inverse (&t, &inv)),
+                 mutest_to_be_true,
+                 NULL);
+  mutest_expect ("inverse() of a scale to keep its category",
+                 mutest_int_value (graphene_transform_get_category (&inv)),
+                 mutest_to_be, GRAPHENE_TRANSFORM_CATEGORY_SCALE,
+                 NULL);
+  mutest_expect ("inverse() of a scale to match the matrix inverse",
+                 mutest_bool_value (transform_near_matrix (&inv, &m_inv, 0.0001f)),
+                 mutest_to_be_true,
+                 NULL);
+
+  graphene_transform_init_scale (&t, 2.f, 0.f, 1.f);
+  mutest_expect ("inverse() of a degenerate scale to fail",
+                 mutest_bool_value (graphene_transform_inverse (&t, &inv)),
+                 mutest_to_be_false,
+                 NULL);
+}
+
+static void
+transform_bounds (mutest_spec_t *spec)
+{
+  const graphene_rect_t r = GRAPHENE_RECT_INIT (10.f, 20.f, -30.f, 40.f);
+  graphene_transform_t transforms[5];
+  graphene_matrix_t m;
+
+  graphene_transform_init_identity (&transforms[0]);
+  graphene_transform_init_translate (&transforms[1], &GRAPHENE_POINT3D_INIT (5.f, -5.f, 2.f));
+  graphene_transform_init_scale (&transforms[2], -2.f, 0.5f, 1.f);
+  graphene_transform_translate (&transforms[2], &GRAPHENE_POINT3D_INIT (3.f, 4.f, 0.f));
+  graphene_matrix_init_rotate (&m, 30.f, graphene_vec3_z_axis ());
+  graphene_matrix_translate (&m, &GRAPHENE_POINT3D_INIT (10.f, 20.f, 0.f));
+  graphene_transform_init_from_matrix (&transforms[3], &m);
+  graphene_matrix_init_rotate (&m, 60.f, graphene_vec3_y_axis ());
+  graphene_matrix_scale (&m, 1.5f, 2.f, 3.f);
+  graphene_transform_init_from_matrix (&transforms[4], &m);
+
+  for (int i = 0; i < 5; i++)
+    {
+      graphene_rect_t expected, bounds;
+      graphene_point3d_t p, q;
+      graphene_point3d_t pe, qe;
+      graphene_point_t p2, q2;
+      graphene_box_t box, box_expected;
+
+      graphene_transform_to_matrix (&transforms[i], &m);
+
+      graphene_matrix_transform_bounds (&m, &r, &expected);
+      graphene_transform_transform_bounds (&transforms[i], &r, &bounds);
+      mutest_expect ("transform_bounds() to match graphene_matrix_transform_bounds()",
+                     mutest_bool_value (rect_near (&bounds, &expected, 0.001f)),
+                     mutest_to_be_true,
+                     NULL);
+
+      graphene_point3d_init (&p, 1.f, -2.f, 3.f);
+      graphene_matrix_transform_point3d (&m, &p, &pe);
+      graphene_transform_transform_point3d (&transforms[i], &p, &q);
+      mutest_expect ("transform_point3d() to match graphene_matrix_transform_point3d()",
+                     mutest_bool_value (graphene_point3d_near (&q, &pe, 0.0001f)),
+                     mutest_to_be_true,
+                     NULL);
+
+      graphene_point_init (&p2, 1.f, -2.f);
+      graphene_matrix_transform_point (&m, &p2, &q2);
+      graphene_transform_transform_point (&transforms[i], &p2, &p2);
+      mutest_expect ("transform_point() to match graphene_matrix_transform_point()",
+                     mutest_bool_value (graphene_point_near (&p2, &q2, 0.0001f)),
+                     mutest_to_be_true,
+                     NULL);
+
+      graphene_box_init (&box, &GRAPHENE_POINT3D_INIT (-1.f, 2.f, -3.f), &GRAPHENE_POINT3D_INIT (4.f, 5.f, 6.f));
+      graphene_matrix_transform_box (&m, &box, &box_expected);
+      graphene_transform_transform_box (&transforms[i], &box, &box);
+      graphene_box_get_min (&box, &p);
+      graphene_box_get_max (&box, &q);
+      graphene_box_get_min (&box_expected, &pe);
+      graphene_box_get_max (&box_expected, &qe);
+      mutest_expect ("transform_box() to match graphene_matrix_transform_box()",
+                     mutest_bool_value (graphene_point3d_near (&p, &pe, 0.001f) &&
+                                        graphene_point3d_near (&q, &qe, 0.001f)),
+                     mutest_to_be_true,
+                     NULL);
+    }
+}
+
+static void
+transform_box_empty (mutest_spec_t *spec)
+{
+  graphene_transform_t t;
+  graphene_box_t res;
+
+  graphene_transform_init_scale (&t, -2.f, 1.f, 1.f);
+  graphene_transform_transform_box (&t, graphene_box_empty (), &res);
+  mutest_expect ("transform_box() with a negative scale to keep empty boxes empty",
+                 mutest_bool_value (graphene_box_equal (&res, graphene_box_empty ())),
+                 mutest_to_be_true,
+                 NULL);
+}
+
+static void
+transform_suite (mutest_suite_t *suite)
+{
+  mutest_it ("computes the category of a matrix", transform_classify);
+  mutest_it ("tracks the category when composing transformations", transform_compose);
+  mutest_it ("inverts transformations", transform_inverse);
+  mutest_it ("transforms points, bounds, and boxes", transform_bounds);
+  mutest_it ("keeps empty boxes empty", transform_box_empty);
+}
+
+MUTEST_MAIN (
+  mutest_describe ("graphene_transform_t", transform_suite);
+)